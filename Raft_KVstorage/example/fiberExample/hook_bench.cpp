@@ -0,0 +1,79 @@
+// hook的recv比直接系统调用多出来的开销
+//   socketpair的一端先写入数据，调度器里的协程反复recv(MSG_PEEK)，数据一直在，不会挂起，
+//   hook的开销就是查fd上下文加上判断。分别测原始recv、hook的recv，以及单独的FdManager查找；
+//   threads个线程各自跑一个协程时再测一次hook的recv（查找在多线程下是否互相影响）
+// 用法：hook_bench [threads] [loops]
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <chrono>
+#include "monsoon.h"
+
+double nowNs() {
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 建一对socket，一端写好数据，返回另一端；和hook的socket()一样登记到FdManager
+int makeReadableSocket() {
+  int fds[2];
+  monsoon::CondPanic(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0, "socketpair error");
+  monsoon::FdMgr::GetInstance()->get(fds[0], true);
+  monsoon::CondPanic(::write(fds[1], "x", 1) == 1, "write error");
+  return fds[0];
+}
+
+// 在调度器的协程里跑fn，返回平均每次的纳秒数
+template <typename Fn>
+double timeInFiber(int threads, int loops, Fn fn) {
+  monsoon::IOManager iom(threads, false, "bench");
+  monsoon::WaitGroup ready;
+  monsoon::WaitGroup done;
+  std::atomic<double> total = {0};
+  ready.add(threads);
+  done.add(threads);
+  for (int t = 0; t < threads; ++t) {
+    iom.scheduler([&]() {
+      int fd = makeReadableSocket();
+      // 等所有线程都准备好一起开始
+      ready.done();
+      ready.wait();
+      double start = nowNs();
+      for (int i = 0; i < loops; ++i) {
+        fn(fd);
+      }
+      double ns = (nowNs() - start) / loops;
+      close(fd);
+      double cur = total.load();
+      while (!total.compare_exchange_weak(cur, cur + ns)) {
+      }
+      done.done();
+    });
+  }
+  done.wait();
+  return total / threads;
+}
+
+int main(int argc, char **argv) {
+  int threads = argc > 1 ? atoi(argv[1]) : 4;
+  int loops = argc > 2 ? atoi(argv[2]) : 1000000;
+  // 调度器的日志输出到stdout，结果写到stderr
+  fprintf(stderr, "loops %d\n", loops);
+  auto hookedRecv = [](int fd) {
+    char c;
+    recv(fd, &c, 1, MSG_PEEK);
+  };
+  double raw = timeInFiber(1, loops, [](int fd) {
+    char c;
+    recv_f(fd, &c, 1, MSG_PEEK);
+  });
+  double hooked = timeInFiber(1, loops, hookedRecv);
+  double lookup = timeInFiber(1, loops * 10, [](int fd) {
+    auto ctx = monsoon::FdMgr::GetInstance()->get(fd);
+    asm volatile("" : : "r"(&ctx) : "memory");
+  });
+  fprintf(stderr, "raw recv    : %7.1f ns\n", raw);
+  fprintf(stderr, "hooked recv : %7.1f ns (+%.1f ns)\n", hooked, hooked - raw);
+  fprintf(stderr, "fd lookup   : %7.1f ns\n", lookup);
+  double parallel = timeInFiber(threads, loops, hookedRecv);
+  fprintf(stderr, "hooked recv, %d threads: %7.1f ns\n", threads, parallel);
+  return 0;
+}
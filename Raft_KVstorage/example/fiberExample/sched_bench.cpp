@@ -0,0 +1,83 @@
+// 调度器吞吐测试，按线程数 1/2/4/8/16/32 分别跑：
+//   1. inject：非调度线程提交n个回调任务（都走注入队列）
+//   2. fanout：一个任务递归地派生子任务，共n个，子任务进本线程队列，靠别的线程偷走
+// 带上第三个参数metrics时，每轮结束后打印调度器的统计（各线程的计数、调度延迟和执行时间的分布）
+// 用法：sched_bench [tasks] [max threads] [metrics]
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "monsoon.h"
+
+static std::atomic<long> g_done{0};
+static bool g_dumpMetrics = false;
+
+double nowSec() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void waitDone(long n) {
+  while (g_done.load() < n) {
+    std::this_thread::yield();
+  }
+}
+
+void dumpMetrics(monsoon::Scheduler &sched) {
+  if (g_dumpMetrics) {
+    fprintf(stderr, "%s", sched.getMetrics().toString().c_str());
+  }
+}
+
+double benchInject(int threads, long n) {
+  g_done = 0;
+  monsoon::IOManager iom(threads, false);
+  double start = nowSec();
+  for (long i = 0; i < n; ++i) {
+    iom.scheduler([]() { ++g_done; });
+  }
+  waitDone(n);
+  double rate = n / (nowSec() - start);
+  dumpMetrics(iom);
+  return rate;
+}
+
+// 以当前任务为根，派生出一棵共n个节点的任务树
+void spawn(long n) {
+  ++g_done;
+  long rest = n - 1;
+  if (rest <= 0) {
+    return;
+  }
+  long left = rest / 2;
+  monsoon::Scheduler *sched = monsoon::Scheduler::GetThis();
+  if (left > 0) {
+    sched->scheduler([left]() { spawn(left); });
+  }
+  sched->scheduler([rest, left]() { spawn(rest - left); });
+}
+
+double benchFanout(int threads, long n) {
+  g_done = 0;
+  monsoon::IOManager iom(threads, false);
+  double start = nowSec();
+  iom.scheduler([n]() { spawn(n); });
+  waitDone(n);
+  double rate = n / (nowSec() - start);
+  dumpMetrics(iom);
+  return rate;
+}
+
+int main(int argc, char **argv) {
+  long n = argc > 1 ? atol(argv[1]) : 1000000;
+  int maxThreads = argc > 2 ? atoi(argv[2]) : 32;
+  g_dumpMetrics = argc > 3 && strcmp(argv[3], "metrics") == 0;
+  // 调度器的日志输出到stdout，结果写到stderr
+  for (int threads = 1; threads <= maxThreads; threads *= 2) {
+    double inject = benchInject(threads, n);
+    double fanout = benchFanout(threads, n);
+    fprintf(stderr, "threads %2d : inject %9ld tasks/s, fanout %9ld tasks/s\n", threads, (long)inject,
+            (long)fanout);
+  }
+  return 0;
+}
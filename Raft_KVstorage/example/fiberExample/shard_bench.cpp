@@ -0,0 +1,195 @@
+// IOManager共享epoll和每线程epoll（分片）对比：本机TCP回显
+//   conns个连接，每个连接上客户端协程发一条msg字节的消息、等回显，重复loops次；服务端每个连接一个协程回显。
+//   除了吞吐和系统调用次数，还统计协程等到数据后换了线程执行的比例（跨线程迁移），以及分片模式下各线程分到的fd数。
+//   系统调用次数用perf的raw_syscalls:sys_enter计数，需要能访问tracefs（/sys/kernel/tracing）
+// 用法：shard_bench [threads] [conns] [loops] [msg]
+#include <arpa/inet.h>
+#include <linux/perf_event.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdlib.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <chrono>
+#include <fstream>
+#include "monsoon.h"
+
+double nowSec() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 统计本进程（包括之后创建的线程）的系统调用次数，打不开返回-1
+int openSyscallCounter() {
+  const char *paths[] = {"/sys/kernel/tracing/events/raw_syscalls/sys_enter/id",
+                         "/sys/kernel/debug/tracing/events/raw_syscalls/sys_enter/id"};
+  for (const char *path : paths) {
+    std::ifstream in(path);
+    uint64_t id = 0;
+    if (!(in >> id)) {
+      continue;
+    }
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_TRACEPOINT;
+    attr.config = id;
+    attr.inherit = 1;
+    return syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+  }
+  return -1;
+}
+
+uint64_t readCounter(int fd) {
+  uint64_t cnt = 0;
+  if (fd < 0 || ::read(fd, &cnt, sizeof(cnt)) != sizeof(cnt)) {
+    return 0;
+  }
+  return cnt;
+}
+
+// 收满len字节，对端关闭或出错返回false；每次recv返回后线程变了就记一次迁移
+bool recvAll(int fd, char *buf, size_t len, int &thread, long &migrations) {
+  while (len > 0) {
+    ssize_t n = recv(fd, buf, len, 0);
+    if (n <= 0) {
+      return false;
+    }
+    int cur = monsoon::GetThreadId();
+    if (cur != thread) {
+      ++migrations;
+      thread = cur;
+    }
+    buf += n;
+    len -= n;
+  }
+  return true;
+}
+
+bool sendAll(int fd, const char *buf, size_t len) {
+  while (len > 0) {
+    ssize_t n = send(fd, buf, len, 0);
+    if (n <= 0) {
+      return false;
+    }
+    buf += n;
+    len -= n;
+  }
+  return true;
+}
+
+const char *shardName(monsoon::EpollShard shard) {
+  switch (shard) {
+    case monsoon::EpollShard::SHARED:
+      return "shared";
+    case monsoon::EpollShard::ROUND_ROBIN:
+      return "round-robin";
+    default:
+      return "least-loaded";
+  }
+}
+
+void bench(monsoon::EpollShard shard, int threads, int conns, int loops, int msg) {
+  int counter = openSyscallCounter();
+  monsoon::IOManager iom(threads, false, "bench", false, shard);
+  monsoon::WaitGroup ready;
+  monsoon::WaitGroup connected;
+  monsoon::WaitGroup done;
+  sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  std::atomic<long> failed = {0};
+  std::atomic<long> migrations = {0};
+
+  ready.add(1);
+  iom.scheduler([&]() {
+    int listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    socklen_t len = sizeof(addr);
+    monsoon::CondPanic(bind(listenFd, (sockaddr *)&addr, len) == 0, "bind error");
+    monsoon::CondPanic(listen(listenFd, 1024) == 0, "listen error");
+    getsockname(listenFd, (sockaddr *)&addr, &len);
+    ready.done();
+    for (int i = 0; i < conns; ++i) {
+      int fd = accept(listenFd, nullptr, nullptr);
+      monsoon::CondPanic(fd >= 0, "accept error");
+      iom.scheduler([&, fd]() {
+        std::vector<char> buf(msg);
+        int thread = monsoon::GetThreadId();
+        long moved = 0;
+        while (recvAll(fd, buf.data(), msg, thread, moved) && sendAll(fd, buf.data(), msg)) {
+        }
+        migrations += moved;
+        close(fd);
+      });
+    }
+    close(listenFd);
+  });
+  ready.wait();
+
+  uint64_t syscalls = readCounter(counter);
+  double start = nowSec();
+  connected.add(conns);
+  done.add(conns);
+  for (int c = 0; c < conns; ++c) {
+    iom.scheduler([&]() {
+      int fd = socket(AF_INET, SOCK_STREAM, 0);
+      int one = 1;
+      setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+      bool ok = connect(fd, (sockaddr *)&addr, sizeof(addr)) == 0;
+      connected.done();
+      if (!ok) {
+        ++failed;
+      } else {
+        std::vector<char> buf(msg, 'x');
+        int thread = monsoon::GetThreadId();
+        long moved = 0;
+        for (int i = 0; i < loops; ++i) {
+          if (!sendAll(fd, buf.data(), msg) || !recvAll(fd, buf.data(), msg, thread, moved)) {
+            ++failed;
+            break;
+          }
+        }
+        migrations += moved;
+      }
+      close(fd);
+      done.done();
+    });
+  }
+  // 连接都建好之后各线程分到的fd数，结束时连接已经关掉了
+  connected.wait();
+  std::vector<size_t> fds = iom.fdCountPerThread();
+  done.wait();
+  double sec = nowSec() - start;
+  syscalls = readCounter(counter) - syscalls;
+
+  // 客户端和服务端各收一次算两次等待
+  double ops = (double)conns * loops;
+  fprintf(stderr, "%-12s: %9.0f round trips/s", shardName(shard), ops / sec);
+  if (counter >= 0) {
+    fprintf(stderr, ", %.2f syscalls/op", syscalls / ops);
+  }
+  fprintf(stderr, ", %.1f%% recv migrated", migrations * 100.0 / (ops * 2));
+  if (shard != monsoon::EpollShard::SHARED) {
+    fprintf(stderr, ", fds/thread");
+    for (size_t cnt : fds) {
+      fprintf(stderr, " %zu", cnt);
+    }
+  }
+  fprintf(stderr, "%s\n", failed ? ", FAILED" : "");
+  if (counter >= 0) {
+    ::close(counter);
+  }
+}
+
+int main(int argc, char **argv) {
+  int threads = argc > 1 ? atoi(argv[1]) : 4;
+  int conns = argc > 2 ? atoi(argv[2]) : 64;
+  int loops = argc > 3 ? atoi(argv[3]) : 2000;
+  int msg = argc > 4 ? atoi(argv[4]) : 64;
+  // 调度器的日志输出到stdout，结果写到stderr
+  fprintf(stderr, "threads %d, conns %d, loops %d, msg %d bytes\n", threads, conns, loops, msg);
+  bench(monsoon::EpollShard::SHARED, threads, conns, loops, msg);
+  bench(monsoon::EpollShard::ROUND_ROBIN, threads, conns, loops, msg);
+  bench(monsoon::EpollShard::LEAST_LOADED, threads, conns, loops, msg);
+  return 0;
+}
@@ -0,0 +1,108 @@
+// 协程栈分配测试：
+//   1. 栈的分配/释放速度：malloc(128K) 和 StackAllocator 对比
+//   2. 协程创建+运行+销毁的速度
+//   3. 同时存在n个（默认10万）挂起的协程时的RSS，以及全部销毁之后的RSS
+// 用法：stack_bench [live fibers] [loops] [release unused 0/1]
+#include <stdlib.h>
+#include <chrono>
+#include <fstream>
+#include <vector>
+#include "monsoon.h"
+
+static const size_t kStackSize = 128 * 1024;
+// 防止编译器把没有用到的malloc/free整个优化掉
+static char *volatile g_sink = nullptr;
+
+double nowSec() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 当前进程的常驻内存（MB）
+double rssMB() {
+  long pages = 0;
+  long resident = 0;
+  std::ifstream in("/proc/self/statm");
+  in >> pages >> resident;
+  return resident * sysconf(_SC_PAGESIZE) / 1024.0 / 1024.0;
+}
+
+void printStats(const std::string &tag) {
+  monsoon::StackAllocator::Stats s = monsoon::StackAllocator::GetStats();
+  std::cout << tag << " rss " << rssMB() << " MB, mapped " << s.mappedBytes / 1024 / 1024 << " MB, live "
+            << s.liveStacks << ", cached " << s.cachedStacks << ", guarded " << s.guardedStacks << ", unguarded "
+            << s.unguardedStacks << std::endl;
+}
+
+void benchAlloc(int n) {
+  // 每次都写一下栈顶附近，和协程真正使用栈时一样会触发缺页
+  double start = nowSec();
+  for (int i = 0; i < n; ++i) {
+    char *p = static_cast<char *>(malloc(kStackSize));
+    p[kStackSize - 1] = 1;
+    g_sink = p;
+    free(g_sink);
+  }
+  double mallocSec = nowSec() - start;
+
+  size_t size = monsoon::StackAllocator::RoundUp(kStackSize);
+  start = nowSec();
+  for (int i = 0; i < n; ++i) {
+    char *p = static_cast<char *>(monsoon::StackAllocator::Alloc(size));
+    p[size - 1] = 1;
+    g_sink = p;
+    monsoon::StackAllocator::Delete(g_sink, size);
+  }
+  double poolSec = nowSec() - start;
+  std::cout << "alloc+free 128K x" << n << " : malloc " << (long)(n / mallocSec) << " /s, pool "
+            << (long)(n / poolSec) << " /s" << std::endl;
+}
+
+void benchFiber(int n) {
+  int counter = 0;
+  double start = nowSec();
+  for (int i = 0; i < n; ++i) {
+    monsoon::Fiber::ptr fiber(new monsoon::Fiber([&counter]() { ++counter; }, 0, false));
+    fiber->resume();
+  }
+  double sec = nowSec() - start;
+  std::cout << "fiber create+run+destroy x" << n << " : " << (long)(n / sec) << " /s" << std::endl;
+}
+
+void benchLive(int n) {
+  printStats("before");
+  std::vector<monsoon::Fiber::ptr> fibers;
+  fibers.reserve(n);
+  double start = nowSec();
+  for (int i = 0; i < n; ++i) {
+    fibers.emplace_back(new monsoon::Fiber(
+        []() {
+          // 用掉一点栈再挂起，恢复后栈上的内容应该还在
+          volatile char buf[1024];
+          buf[0] = 1;
+          monsoon::Fiber::GetThis()->yield();
+          monsoon::CondPanic(buf[0] == 1, "fiber stack corrupted");
+        },
+        0, false));
+    fibers.back()->resume();
+  }
+  std::cout << n << " live fibers created in " << (nowSec() - start) * 1000 << " ms" << std::endl;
+  printStats("live");
+  for (auto &fiber : fibers) {
+    fiber->resume();
+  }
+  fibers.clear();
+  // 空闲栈的物理页已经还给系统，剩下的主要是协程对象本身占用的malloc堆
+  printStats("destroyed");
+}
+
+int main(int argc, char **argv) {
+  int liveNum = argc > 1 ? atoi(argv[1]) : 100000;
+  int loops = argc > 2 ? atoi(argv[2]) : 200000;
+  // 第三个参数为0时空闲栈不MADV_DONTNEED，对比销毁后的RSS
+  monsoon::StackAllocator::SetReleaseUnused(argc > 3 ? atoi(argv[3]) != 0 : true);
+  monsoon::Fiber::GetThis();
+  benchAlloc(loops);
+  benchFiber(loops);
+  benchLive(liveNum);
+  return 0;
+}
@@ -0,0 +1,96 @@
+// 协程同步原语测试：
+//   1. 锁竞争：m个协程各加锁n次，临界区里做一点计算，对比pthread锁（Mutex）和FiberMutex
+//   2. 临界区里有IO：持锁期间hook的usleep让出协程，只测FiberMutex（pthread锁会把线程卡住，其他协程都跑不了）
+//   3. 信号量乒乓：两两一组的协程用FiberSemaphore互相唤醒
+// 用法：sync_bench [threads] [fibers] [loops]
+#include <stdlib.h>
+#include <unistd.h>
+#include <chrono>
+#include "monsoon.h"
+
+static long g_counter = 0;
+
+double nowSec() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void work() {
+  volatile long x = 0;
+  for (int i = 0; i < 50; ++i) {
+    x = x + i;
+  }
+}
+
+template <class MutexType>
+double benchLock(monsoon::IOManager &iom, int fibers, int loops, int sleepEvery) {
+  MutexType mutex;
+  monsoon::WaitGroup wg;
+  g_counter = 0;
+  wg.add(fibers);
+  double start = nowSec();
+  for (int f = 0; f < fibers; ++f) {
+    iom.scheduler([&]() {
+      for (int i = 0; i < loops; ++i) {
+        mutex.lock();
+        ++g_counter;
+        work();
+        if (sleepEvery > 0 && i % sleepEvery == 0) {
+          usleep(100);
+        }
+        mutex.unlock();
+      }
+      wg.done();
+    });
+  }
+  wg.wait();
+  double sec = nowSec() - start;
+  monsoon::CondPanic(g_counter == (long)fibers * loops, "lost update");
+  return fibers * loops / sec;
+}
+
+double benchPingPong(monsoon::IOManager &iom, int fibers, int loops) {
+  int pairs = fibers / 2;
+  std::vector<std::unique_ptr<monsoon::FiberSemaphore>> sems;
+  for (int i = 0; i < pairs * 2; ++i) {
+    sems.emplace_back(new monsoon::FiberSemaphore(0));
+  }
+  monsoon::WaitGroup wg;
+  wg.add(pairs * 2);
+  double start = nowSec();
+  for (int p = 0; p < pairs; ++p) {
+    monsoon::FiberSemaphore *ping = sems[p * 2].get();
+    monsoon::FiberSemaphore *pong = sems[p * 2 + 1].get();
+    iom.scheduler([&, ping, pong]() {
+      for (int i = 0; i < loops; ++i) {
+        ping->notify();
+        pong->wait();
+      }
+      wg.done();
+    });
+    iom.scheduler([&, ping, pong]() {
+      for (int i = 0; i < loops; ++i) {
+        ping->wait();
+        pong->notify();
+      }
+      wg.done();
+    });
+  }
+  wg.wait();
+  return (double)pairs * loops / (nowSec() - start);
+}
+
+int main(int argc, char **argv) {
+  int threads = argc > 1 ? atoi(argv[1]) : 4;
+  int fibers = argc > 2 ? atoi(argv[2]) : 64;
+  int loops = argc > 3 ? atoi(argv[3]) : 20000;
+  monsoon::IOManager iom(threads, false);
+  // 调度器的日志输出到stdout，结果写到stderr
+  fprintf(stderr, "threads %d, fibers %d, loops %d\n", threads, fibers, loops);
+  fprintf(stderr, "contended lock      : pthread %9ld /s, fiber %9ld /s\n",
+          (long)benchLock<monsoon::Mutex>(iom, fibers, loops, 0),
+          (long)benchLock<monsoon::FiberMutex>(iom, fibers, loops, 0));
+  fprintf(stderr, "lock held across io : fiber %9ld /s\n",
+          (long)benchLock<monsoon::FiberMutex>(iom, fibers, loops / 100, 10));
+  fprintf(stderr, "semaphore ping-pong : fiber %9ld round trips/s\n", (long)benchPingPong(iom, fibers, loops));
+  return 0;
+}
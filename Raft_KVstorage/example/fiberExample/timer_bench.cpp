@@ -0,0 +1,93 @@
+// 定时器测试，模拟大量带超时的IO：
+//   1. 同时挂n个（默认100万）5s超时的定时器，再全部取消（IO在超时前完成），统计添加/取消速度
+//   2. n个超时时间分布在1~5000ms内的定时器全部触发，统计触发吞吐和触发延迟
+// 测试在调度线程的协程里执行（和hook的do_io一样），也可以选择从非调度线程添加
+// 用法：timer_bench [timers] [from scheduler thread 0/1]
+#include <stdlib.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "monsoon.h"
+
+static std::atomic<long> g_fired{0};
+static std::atomic<long> g_lateSumMs{0};
+static std::atomic<long> g_lateMaxMs{0};
+
+uint64_t nowMs() { return monsoon::GetElapsedMS(); }
+
+double nowSec() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void benchAddCancel(monsoon::IOManager *iom, long n) {
+  std::vector<monsoon::Timer::ptr> timers;
+  timers.reserve(n);
+  double start = nowSec();
+  for (long i = 0; i < n; ++i) {
+    timers.push_back(iom->addTimer(5000, []() {}));
+  }
+  double addSec = nowSec() - start;
+  start = nowSec();
+  for (auto &timer : timers) {
+    timer->cancel();
+  }
+  double cancelSec = nowSec() - start;
+  fprintf(stderr, "%ld concurrent timeouts: add %ld /s, cancel %ld /s\n", n, (long)(n / addSec),
+          (long)(n / cancelSec));
+}
+
+void benchFire(monsoon::IOManager *iom, long n) {
+  g_fired = 0;
+  g_lateSumMs = 0;
+  g_lateMaxMs = 0;
+  double start = nowSec();
+  for (long i = 0; i < n; ++i) {
+    uint64_t ms = 1 + i % 5000;
+    uint64_t deadline = nowMs() + ms;
+    iom->addTimer(ms, [deadline]() {
+      long late = (long)(nowMs() - deadline);
+      g_lateSumMs += late;
+      long max = g_lateMaxMs.load();
+      while (late > max && !g_lateMaxMs.compare_exchange_weak(max, late)) {
+      }
+      ++g_fired;
+    });
+  }
+  double addSec = nowSec() - start;
+  while (g_fired < n) {
+    usleep(1000);
+  }
+  double sec = nowSec() - start;
+  fprintf(stderr, "%ld timeouts fired in %.2f s (add %.2f s), late avg %.2f ms, max %ld ms\n", n, sec, addSec,
+          (double)g_lateSumMs / n, (long)g_lateMaxMs);
+}
+
+int main(int argc, char **argv) {
+  long n = argc > 1 ? atol(argv[1]) : 1000000;
+  bool onScheduler = argc > 2 ? atoi(argv[2]) != 0 : true;
+  monsoon::IOManager iom(2, false);
+  if (onScheduler) {
+    std::atomic<bool> done{false};
+    iom.scheduler([&]() {
+      benchAddCancel(&iom, n);
+      done = true;
+    });
+    while (!done) {
+      usleep(1000);
+    }
+    done = false;
+    iom.scheduler([&]() {
+      benchFire(&iom, n);
+      done = true;
+    });
+    while (!done) {
+      usleep(1000);
+    }
+  } else {
+    benchAddCancel(&iom, n);
+    benchFire(&iom, n);
+  }
+  return 0;
+}
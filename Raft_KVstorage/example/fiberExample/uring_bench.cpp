@@ -0,0 +1,162 @@
+// IOManager的epoll和io_uring后端对比：本机TCP回显
+//   conns个连接，每个连接上客户端协程发一条msg字节的消息、等回显，重复loops次；服务端每个连接一个协程回显。
+//   所有IO都走hook的send/recv/accept/connect。系统调用次数用perf的raw_syscalls:sys_enter计数，
+//   需要能访问tracefs（/sys/kernel/tracing），拿不到时只输出吞吐
+// 用法：uring_bench [threads] [conns] [loops] [msg]
+#include <arpa/inet.h>
+#include <linux/perf_event.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdlib.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <chrono>
+#include <fstream>
+#include "monsoon.h"
+
+double nowSec() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 统计本进程（包括之后创建的线程）的系统调用次数，打不开返回-1
+int openSyscallCounter() {
+  const char *paths[] = {"/sys/kernel/tracing/events/raw_syscalls/sys_enter/id",
+                         "/sys/kernel/debug/tracing/events/raw_syscalls/sys_enter/id"};
+  for (const char *path : paths) {
+    std::ifstream in(path);
+    uint64_t id = 0;
+    if (!(in >> id)) {
+      continue;
+    }
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_TRACEPOINT;
+    attr.config = id;
+    attr.inherit = 1;
+    attr.exclude_kernel = 0;
+    return syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+  }
+  return -1;
+}
+
+uint64_t readCounter(int fd) {
+  uint64_t cnt = 0;
+  if (fd < 0 || ::read(fd, &cnt, sizeof(cnt)) != sizeof(cnt)) {
+    return 0;
+  }
+  return cnt;
+}
+
+// 收满len字节，对端关闭或出错返回false
+bool recvAll(int fd, char *buf, size_t len) {
+  while (len > 0) {
+    ssize_t n = recv(fd, buf, len, 0);
+    if (n <= 0) {
+      return false;
+    }
+    buf += n;
+    len -= n;
+  }
+  return true;
+}
+
+bool sendAll(int fd, const char *buf, size_t len) {
+  while (len > 0) {
+    ssize_t n = send(fd, buf, len, 0);
+    if (n <= 0) {
+      return false;
+    }
+    buf += n;
+    len -= n;
+  }
+  return true;
+}
+
+void bench(bool useIoUring, int threads, int conns, int loops, int msg) {
+  int counter = openSyscallCounter();
+  monsoon::IOManager iom(threads, false, "bench", useIoUring);
+  monsoon::WaitGroup ready;
+  monsoon::WaitGroup done;
+  sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  std::atomic<long> failed = {0};
+
+  ready.add(1);
+  iom.scheduler([&]() {
+    int listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    socklen_t len = sizeof(addr);
+    monsoon::CondPanic(bind(listenFd, (sockaddr *)&addr, len) == 0, "bind error");
+    monsoon::CondPanic(listen(listenFd, 1024) == 0, "listen error");
+    getsockname(listenFd, (sockaddr *)&addr, &len);
+    ready.done();
+    for (int i = 0; i < conns; ++i) {
+      int fd = accept(listenFd, nullptr, nullptr);
+      monsoon::CondPanic(fd >= 0, "accept error");
+      iom.scheduler([&, fd]() {
+        std::vector<char> buf(msg);
+        while (recvAll(fd, buf.data(), msg) && sendAll(fd, buf.data(), msg)) {
+        }
+        close(fd);
+      });
+    }
+    close(listenFd);
+  });
+  ready.wait();
+
+  uint64_t syscalls = readCounter(counter);
+  uint64_t enters = iom.ringEnterCount();
+  double start = nowSec();
+  done.add(conns);
+  for (int c = 0; c < conns; ++c) {
+    iom.scheduler([&]() {
+      int fd = socket(AF_INET, SOCK_STREAM, 0);
+      int one = 1;
+      setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+      if (connect(fd, (sockaddr *)&addr, sizeof(addr)) != 0) {
+        ++failed;
+      } else {
+        std::vector<char> buf(msg, 'x');
+        for (int i = 0; i < loops; ++i) {
+          if (!sendAll(fd, buf.data(), msg) || !recvAll(fd, buf.data(), msg)) {
+            ++failed;
+            break;
+          }
+        }
+      }
+      close(fd);
+      done.done();
+    });
+  }
+  done.wait();
+  double sec = nowSec() - start;
+  syscalls = readCounter(counter) - syscalls;
+  enters = iom.ringEnterCount() - enters;
+
+  double ops = (double)conns * loops;
+  fprintf(stderr, "%-8s: %9.0f round trips/s", iom.isUseIoUring() ? "io_uring" : "epoll", ops / sec);
+  if (counter >= 0) {
+    fprintf(stderr, ", %.2f syscalls/op", syscalls / ops);
+  }
+  if (iom.isUseIoUring()) {
+    fprintf(stderr, " (io_uring_enter %.2f/op)", enters / ops);
+  }
+  fprintf(stderr, "%s\n", failed ? ", FAILED" : "");
+  if (counter >= 0) {
+    ::close(counter);
+  }
+}
+
+int main(int argc, char **argv) {
+  int threads = argc > 1 ? atoi(argv[1]) : 1;
+  int conns = argc > 2 ? atoi(argv[2]) : 64;
+  int loops = argc > 3 ? atoi(argv[3]) : 5000;
+  int msg = argc > 4 ? atoi(argv[4]) : 64;
+  // 调度器的日志输出到stdout，结果写到stderr
+  fprintf(stderr, "threads %d, conns %d, loops %d, msg %d bytes\n", threads, conns, loops, msg);
+  bench(false, threads, conns, loops, msg);
+  bench(true, threads, conns, loops, msg);
+  return 0;
+}
@@ -0,0 +1,124 @@
+// IOManager唤醒空闲线程的开销
+//   latency：调度线程全部空闲时，外部线程投递一个任务到它开始执行的时间（p50/p99）
+//   fanout：调度线程里的协程一次投递batch个小任务，等它们全部执行完，重复rounds次；
+//           统计每个任务平均的唤醒次数和系统调用次数（perf的raw_syscalls:sys_enter，需要能访问tracefs）
+// 用法：wake_bench [threads] [rounds] [batch]
+#include <linux/perf_event.h>
+#include <stdlib.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include "monsoon.h"
+
+double nowUs() {
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 统计本进程（包括之后创建的线程）的系统调用次数，打不开返回-1
+int openSyscallCounter() {
+  const char *paths[] = {"/sys/kernel/tracing/events/raw_syscalls/sys_enter/id",
+                         "/sys/kernel/debug/tracing/events/raw_syscalls/sys_enter/id"};
+  for (const char *path : paths) {
+    std::ifstream in(path);
+    uint64_t id = 0;
+    if (!(in >> id)) {
+      continue;
+    }
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_TRACEPOINT;
+    attr.config = id;
+    attr.inherit = 1;
+    return syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+  }
+  return -1;
+}
+
+uint64_t readCounter(int fd) {
+  uint64_t cnt = 0;
+  if (fd < 0 || ::read(fd, &cnt, sizeof(cnt)) != sizeof(cnt)) {
+    return 0;
+  }
+  return cnt;
+}
+
+uint64_t wakeups(monsoon::IOManager &iom) {
+#ifdef NO_WAKE_COUNT
+  return 0;
+#else
+  return iom.wakeupCount();
+#endif
+}
+
+void latency(monsoon::IOManager &iom, int samples) {
+  std::vector<double> lat;
+  lat.reserve(samples);
+  monsoon::Semaphore sem;
+  for (int i = 0; i < samples; ++i) {
+    // 等调度线程都睡下
+    usleep(200);
+    double start = nowUs();
+    iom.scheduler([&lat, &sem, start]() {
+      lat.push_back(nowUs() - start);
+      sem.notify();
+    });
+    sem.wait();
+  }
+  std::sort(lat.begin(), lat.end());
+  fprintf(stderr, "  latency: p50 %.1f us, p99 %.1f us\n", lat[lat.size() / 2], lat[lat.size() * 99 / 100]);
+}
+
+void fanout(monsoon::IOManager &iom, int counter, int rounds, int batch) {
+  monsoon::Semaphore finished;
+  uint64_t syscalls = readCounter(counter);
+  uint64_t wakes = wakeups(iom);
+  double start = nowUs();
+  iom.scheduler([&]() {
+    for (int r = 0; r < rounds; ++r) {
+      monsoon::WaitGroup wg;
+      wg.add(batch);
+      for (int i = 0; i < batch; ++i) {
+        iom.scheduler([&wg]() { wg.done(); });
+      }
+      wg.wait();
+    }
+    finished.notify();
+  });
+  finished.wait();
+  double us = nowUs() - start;
+  syscalls = readCounter(counter) - syscalls;
+  wakes = wakeups(iom) - wakes;
+
+  double tasks = (double)rounds * batch;
+  fprintf(stderr, "  fanout: %.0f tasks/s", tasks / us * 1e6);
+#ifndef NO_WAKE_COUNT
+  fprintf(stderr, ", %.3f wakeups/task", wakes / tasks);
+#endif
+  if (counter >= 0) {
+    fprintf(stderr, ", %.3f syscalls/task", syscalls / tasks);
+  }
+  fprintf(stderr, "\n");
+}
+
+int main(int argc, char **argv) {
+  int threads = argc > 1 ? atoi(argv[1]) : 4;
+  int rounds = argc > 2 ? atoi(argv[2]) : 20000;
+  int batch = argc > 3 ? atoi(argv[3]) : 16;
+  // 调度器的日志输出到stdout，结果写到stderr
+  fprintf(stderr, "threads %d, rounds %d, batch %d\n", threads, rounds, batch);
+  for (bool useIoUring : {false, true}) {
+    // 计数只继承给之后创建的线程，要在调度器之前打开
+    int counter = openSyscallCounter();
+    monsoon::IOManager iom(threads, false, "bench", useIoUring);
+    fprintf(stderr, "%s\n", iom.isUseIoUring() ? "io_uring" : "epoll");
+    latency(iom, 2000);
+    fanout(iom, counter, rounds, batch);
+    if (counter >= 0) {
+      ::close(counter);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,223 @@
+//
+// rpc handler 等待 apply 结果这一环节的开销对比：
+//   lockQueue      : 原来的做法，m_mtx + unordered_map<int, LockQueue<Op>*>，每个请求 new/delete 一个 LockQueue
+//   completionRing : 预分配的槽位环 + futex
+// 多个client线程按给定总速率发请求，一个apply线程按日志顺序完成请求，输出实际吞吐、等待延迟和每个请求消耗的CPU时间
+//
+
+#include <sys/resource.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "completionRing.h"
+#include "util.h"
+
+void ShowArgsHelp();
+
+// 模拟raft：client把raftIndex交给apply线程，apply线程按顺序“apply”
+class FakeRaft {
+ public:
+  void Start(int index) {
+    {
+      std::lock_guard<std::mutex> lg(m_mtx);
+      m_pending.push_back(index);
+    }
+    m_cv.notify_one();
+  }
+  // 取走当前所有待apply的日志，stop后返回false
+  bool PopAll(std::vector<int> *out) {
+    std::unique_lock<std::mutex> lock(m_mtx);
+    m_cv.wait(lock, [this] { return !m_pending.empty() || m_stop; });
+    out->swap(m_pending);
+    m_pending.clear();
+    return !out->empty() || !m_stop;
+  }
+  void Stop() {
+    {
+      std::lock_guard<std::mutex> lg(m_mtx);
+      m_stop = true;
+    }
+    m_cv.notify_all();
+  }
+
+ private:
+  std::mutex m_mtx;
+  std::condition_variable m_cv;
+  std::vector<int> m_pending;
+  bool m_stop = false;
+};
+
+// 原来KvServer中的实现
+class LockQueueWaiters {
+ public:
+  bool Acquire(int index) {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (m_waitApplyCh.find(index) == m_waitApplyCh.end()) {
+      m_waitApplyCh.insert(std::make_pair(index, new LockQueue<Op>()));
+    }
+    return true;
+  }
+  bool Wait(int index, int timeoutMs, Op *op) {
+    m_mtx.lock();
+    auto ch = m_waitApplyCh[index];
+    m_mtx.unlock();
+    bool ok = ch->timeOutPop(timeoutMs, op);
+    m_mtx.lock();
+    m_waitApplyCh.erase(index);
+    delete ch;
+    m_mtx.unlock();
+    return ok;
+  }
+  bool Complete(int index, const Op &op) {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (m_waitApplyCh.find(index) == m_waitApplyCh.end()) {
+      return false;
+    }
+    m_waitApplyCh[index]->Push(op);
+    return true;
+  }
+
+ private:
+  std::mutex m_mtx;
+  std::unordered_map<int, LockQueue<Op> *> m_waitApplyCh;
+};
+
+struct Result {
+  double opsPerSec;
+  double cpuUsPerOp;
+  long p50Ns;
+  long p99Ns;
+  long p999Ns;
+  long timeouts;
+};
+
+double cpuSeconds() {
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+template <typename Waiters>
+Result runBench(Waiters &waiters, int rate, int clientNum, int seconds) {
+  FakeRaft raft;
+  std::atomic<int> nextIndex{1};
+  std::atomic<long> timeouts{0};
+  std::vector<std::vector<long>> latencies(clientNum);
+
+  std::thread applier([&]() {
+    std::vector<int> indexes;
+    Op op;
+    op.Operation = OpType::Put;
+    op.Key = "key";
+    op.Value = "value";
+    while (raft.PopAll(&indexes)) {
+      for (int index : indexes) {
+        op.RequestId = index;
+        waiters.Complete(index, op);
+      }
+    }
+  });
+
+  double cpuStart = cpuSeconds();
+  auto start = std::chrono::steady_clock::now();
+  auto end = start + std::chrono::seconds(seconds);
+  // 每个client按 rate/clientNum 的速率均匀发请求
+  auto interval = std::chrono::nanoseconds(1000000000LL * clientNum / rate);
+  std::vector<std::thread> clients;
+  for (int c = 0; c < clientNum; ++c) {
+    clients.emplace_back([&, c]() {
+      auto next = start + interval * c / clientNum;
+      Op op;
+      while (next < end) {
+        std::this_thread::sleep_until(next);
+        next += interval;
+        int index = nextIndex.fetch_add(1);
+        auto begin = std::chrono::steady_clock::now();
+        if (!waiters.Acquire(index)) {
+          timeouts++;
+          continue;
+        }
+        raft.Start(index);
+        if (!waiters.Wait(index, CONSENSUS_TIMEOUT, &op)) {
+          timeouts++;
+          continue;
+        }
+        latencies[c].push_back(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count());
+      }
+    });
+  }
+  for (auto &t : clients) {
+    t.join();
+  }
+  double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  raft.Stop();
+  applier.join();
+  double cpu = cpuSeconds() - cpuStart;
+
+  std::vector<long> all;
+  for (auto &l : latencies) {
+    all.insert(all.end(), l.begin(), l.end());
+  }
+  std::sort(all.begin(), all.end());
+  Result r{};
+  r.timeouts = timeouts;
+  if (all.empty()) {
+    return r;
+  }
+  r.opsPerSec = all.size() / elapsed;
+  r.cpuUsPerOp = cpu * 1e6 / all.size();
+  r.p50Ns = all[all.size() / 2];
+  r.p99Ns = all[all.size() * 99 / 100];
+  r.p999Ns = all[all.size() * 999 / 1000];
+  return r;
+}
+
+void printResult(const std::string &name, const Result &r) {
+  std::cout << name << " : " << (long)r.opsPerSec << " ops/s, cpu " << r.cpuUsPerOp << " us/op, wait p50 "
+            << r.p50Ns / 1000.0 << " us, p99 " << r.p99Ns / 1000.0 << " us, p999 " << r.p999Ns / 1000.0
+            << " us, failed " << r.timeouts << std::endl;
+}
+
+int main(int argc, char **argv) {
+  int rate = 100000;
+  int clientNum = 64;
+  int seconds = 3;
+  int c = 0;
+  while ((c = getopt(argc, argv, "r:c:s:")) != -1) {
+    switch (c) {
+      case 'r':
+        rate = atoi(optarg);
+        break;
+      case 'c':
+        clientNum = atoi(optarg);
+        break;
+      case 's':
+        seconds = atoi(optarg);
+        break;
+      default:
+        ShowArgsHelp();
+        exit(EXIT_FAILURE);
+    }
+  }
+
+  std::cout << "target rate:" << rate << " ops/s clients:" << clientNum << " seconds:" << seconds << std::endl;
+  {
+    LockQueueWaiters waiters;
+    printResult("[lockQueue     ]", runBench(waiters, rate, clientNum, seconds));
+  }
+  {
+    CompletionRing<Op> waiters(KV_WAIT_SLOT_NUM);
+    printResult("[completionRing]", runBench(waiters, rate, clientNum, seconds));
+  }
+  return 0;
+}
+
+void ShowArgsHelp() { std::cout << "format: command [-r <ops per second>] [-c <clientNum>] [-s <seconds>]" << std::endl; }
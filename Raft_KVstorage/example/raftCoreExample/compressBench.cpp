@@ -0,0 +1,207 @@
+//
+// 压缩测试：分别在关闭、开启压缩的情况下fork出n个raft节点，节点之间的rpc带宽用MprpcChannel::SetBandwidthLimit限制，
+// 模拟跨机房的窄带宽链路。测试进程用多个clerk写约4KB的json风格的value，每种模式输出写吞吐、写延迟p50/p99，
+// 以及结束时各节点持久化文件（raft状态 + 快照）的大小
+//
+// 测试进程本身是一个独立的集群，不需要先启动raftCoreRun
+//
+
+#include <signal.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "clerk.h"
+#include "kvServer.h"
+#include "mprpcchannel.h"
+#include "rpcprovider.h"
+#include "util.h"
+
+void ShowArgsHelp();
+
+struct BenchResult {
+  double opsPerSec = 0;
+  double p50Ms = 0;
+  double p99Ms = 0;
+  long long persistBytes = 0;
+};
+
+long long fileSize(const std::string &name) {
+  struct stat st;
+  return stat(name.c_str(), &st) == 0 ? st.st_size : 0;
+}
+
+// 字段名重复、数值随机的json文本，和业务里常见的value差不多
+std::string makeValue(std::mt19937 &gen, int bytes) {
+  std::uniform_int_distribution<> num(0, 999999);
+  std::string value = "[";
+  for (int i = 0; value.size() < bytes; ++i) {
+    value += "{\"id\":" + std::to_string(num(gen)) + ",\"name\":\"user" + std::to_string(num(gen)) +
+             "\",\"status\":\"active\",\"score\":" + std::to_string(num(gen) % 100) +
+             ",\"tags\":[\"raft\",\"kv\",\"bench\"]},";
+  }
+  value.back() = ']';
+  return value;
+}
+
+void runNode(int me, unsigned short port, int64_t bandwidth, int maxRaftState) {
+  // 节点的日志写到各自的文件里，测试进程的输出只保留结果
+  std::string logName = "compressNode" + std::to_string(me) + ".log";
+  freopen(logName.c_str(), "w", stdout);
+  freopen(logName.c_str(), "a", stderr);
+  MprpcChannel::SetBandwidthLimit(bandwidth);
+  new KvServer(me, maxRaftState, "test.conf", port);  // 不会返回
+}
+
+BenchResult runMode(bool compress, int nodeNum, int clientNum, int seconds, int valueBytes, int64_t bandwidth,
+                    int maxRaftState) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<> dis(10000, 29999);
+  unsigned short startPort = dis(gen);
+
+  // RpcProvider固定把节点地址追加到test.conf，这里先写好集群成员和压缩开关
+  std::ofstream file("test.conf", std::ios::out | std::ios::trunc);
+  file << "compress=" << (compress ? 1 : 0) << std::endl;
+  std::string ip = RpcProvider::GetLocalIp();
+  for (int i = 0; i < nodeNum; ++i) {
+    file << "node" << i << "ip=" << ip << std::endl;
+    file << "node" << i << "port=" << startPort + i << std::endl;
+  }
+  file.close();
+
+  std::vector<pid_t> children;
+  for (int i = 0; i < nodeNum; ++i) {
+    pid_t pid = fork();
+    if (pid == 0) {
+      runNode(i, startPort + i, bandwidth, maxRaftState);
+      exit(EXIT_SUCCESS);
+    } else if (pid < 0) {
+      std::cerr << "Failed to create child process." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    children.push_back(pid);
+  }
+
+  std::vector<Clerk *> clients;
+  for (int i = 0; i < clientNum; ++i) {
+    clients.push_back(new Clerk());
+    clients.back()->Init("test.conf");
+  }
+  clients[0]->Put("warmup", "0");  // 等到集群选出leader
+
+  std::vector<std::string> values;
+  for (int i = 0; i < 64; ++i) {
+    values.push_back(makeValue(gen, valueBytes));
+  }
+  std::vector<std::vector<double>> latencies(clientNum);
+  std::atomic<bool> stop{false};
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (int c = 0; c < clientNum; ++c) {
+    threads.emplace_back([&, c]() {
+      for (int seq = 0; !stop; ++seq) {
+        auto begin = std::chrono::steady_clock::now();
+        clients[c]->Put("compress" + std::to_string(c) + "_" + std::to_string(seq % 100),
+                        values[(c + seq) % values.size()]);
+        latencies[c].push_back(
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count());
+      }
+    });
+  }
+  sleep(seconds);
+  stop = true;
+  for (auto &t : threads) {
+    t.join();
+  }
+  double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  BenchResult r;
+  for (int i = 0; i < nodeNum; ++i) {
+    r.persistBytes +=
+        fileSize("raftstatePersist" + std::to_string(i) + ".txt") + fileSize("snapshotPersist" + std::to_string(i) + ".txt");
+  }
+  for (pid_t pid : children) {
+    kill(pid, SIGKILL);
+    waitpid(pid, nullptr, 0);
+  }
+  for (auto client : clients) {
+    delete client;
+  }
+
+  std::vector<double> all;
+  for (const auto &l : latencies) {
+    all.insert(all.end(), l.begin(), l.end());
+  }
+  if (!all.empty()) {
+    std::sort(all.begin(), all.end());
+    r.opsPerSec = all.size() / elapsed;
+    r.p50Ms = all[all.size() / 2];
+    r.p99Ms = all[all.size() * 99 / 100];
+  }
+  return r;
+}
+
+int main(int argc, char **argv) {
+  int nodeNum = 3;
+  int clientNum = 8;
+  int seconds = 5;
+  int valueBytes = 4096;
+  int64_t bandwidthKB = 1024;
+  int maxRaftState = 4 * 1024 * 1024;
+  int c = 0;
+  while ((c = getopt(argc, argv, "n:c:s:v:b:m:")) != -1) {
+    switch (c) {
+      case 'n':
+        nodeNum = atoi(optarg);
+        break;
+      case 'c':
+        clientNum = atoi(optarg);
+        break;
+      case 's':
+        seconds = atoi(optarg);
+        break;
+      case 'v':
+        valueBytes = atoi(optarg);
+        break;
+      case 'b':
+        bandwidthKB = atoll(optarg);
+        break;
+      case 'm':
+        maxRaftState = atoi(optarg);
+        break;
+      default:
+        ShowArgsHelp();
+        exit(EXIT_FAILURE);
+    }
+  }
+  if (nodeNum < 1 || clientNum < 1) {
+    ShowArgsHelp();
+    exit(EXIT_FAILURE);
+  }
+  signal(SIGPIPE, SIG_IGN);
+
+  std::cout << "nodes:" << nodeNum << " clients:" << clientNum << " value:" << valueBytes
+            << "B bandwidth:" << bandwidthKB << "KB/s seconds:" << seconds << std::endl;
+  for (bool compress : {false, true}) {
+    BenchResult r = runMode(compress, nodeNum, clientNum, seconds, valueBytes, bandwidthKB * 1024, maxRaftState);
+    std::cout << "compress " << (compress ? "on " : "off") << " : put " << (long)r.opsPerSec << " ops/s, p50 "
+              << r.p50Ms << " ms, p99 " << r.p99Ms << " ms, persisted " << r.persistBytes / 1024 << " KB" << std::endl;
+  }
+  // 节点已经全部停掉，clerk里可能还有阻塞在rpc上的线程，直接退出
+  _exit(EXIT_SUCCESS);
+}
+
+void ShowArgsHelp() {
+  std::cout << "format: command [-n <nodeNum>] [-c <clientNum>] [-s <seconds>] [-v <value bytes>] "
+               "[-b <bandwidth KB/s per node>] [-m <maxraftstate>]"
+            << std::endl;
+}
@@ -0,0 +1,138 @@
+//
+// leader转移测试：一个clerk不停地写，另一个clerk每轮调用TransferLeadership把leader依次转移给下一个节点，
+// 输出每轮转移rpc的耗时（从发起到原leader退位）和写入不可用窗口（转移前后相邻两次成功写入的最大间隔）
+// 需要先按配置文件启动集群，例如 raftCoreRun -n 3 -f test.conf
+//
+
+#include <signal.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "clerk.h"
+#include "util.h"
+
+void ShowArgsHelp();
+
+long long nowMs() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+class TransferTester {
+ public:
+  explicit TransferTester(const std::string &configFileName) : m_configFileName(configFileName) {}
+
+  // 后台一直写，记录每次写成功的时间
+  void startWriter() {
+    std::thread([this]() {
+      Clerk client;
+      client.Init(m_configFileName);
+      for (int seq = 0;; ++seq) {
+        if (client.Put("transfer", std::to_string(seq)) != OK) {
+          continue;  // 是否写入未知，不算成功
+        }
+        std::lock_guard<std::mutex> lg(m_mtx);
+        m_writeTimes.push_back(nowMs());
+      }
+    }).detach();
+  }
+
+  // [start, end] 内相邻两次成功写入的最大间隔
+  long long maxWriteGap(long long start, long long end) {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    long long prev = start;
+    long long maxGap = 0;
+    for (long long t : m_writeTimes) {
+      if (t <= start || t > end) {
+        continue;
+      }
+      maxGap = std::max(maxGap, t - prev);
+      prev = t;
+    }
+    return std::max(maxGap, end - prev);
+  }
+
+ private:
+  std::string m_configFileName;
+  std::mutex m_mtx;
+  std::vector<long long> m_writeTimes;
+};
+
+int main(int argc, char **argv) {
+  signal(SIGPIPE, SIG_IGN);
+  std::string configFileName = "test.conf";
+  int nodeNum = 3;
+  int rounds = 10;
+  int intervalMs = 1000;
+  int c = 0;
+  while ((c = getopt(argc, argv, "f:n:r:i:")) != -1) {
+    switch (c) {
+      case 'f':
+        configFileName = optarg;
+        break;
+      case 'n':
+        nodeNum = atoi(optarg);
+        break;
+      case 'r':
+        rounds = atoi(optarg);
+        break;
+      case 'i':
+        intervalMs = atoi(optarg);
+        break;
+      default:
+        ShowArgsHelp();
+        exit(EXIT_FAILURE);
+    }
+  }
+
+  TransferTester tester(configFileName);
+  tester.startWriter();
+  Clerk admin;
+  admin.Init(configFileName);
+  sleep(2);
+
+  long long totalRpcMs = 0;
+  long long totalGapMs = 0;
+  long long worstGapMs = 0;
+  int succeeded = 0;
+  int target = 0;
+  for (int r = 0; r < rounds; ++r) {
+    long long start = nowMs();
+    std::string err = admin.TransferLeadership(target);
+    if (err == ErrInvalidTarget) {
+      // target就是当前leader，换下一个
+      target = (target + 1) % nodeNum;
+      err = admin.TransferLeadership(target);
+    }
+    long long rpcDone = nowMs();
+    // 留出时间让clerk发现新leader，窗口覆盖整个切换过程
+    usleep(intervalMs * 1000);
+    long long gap = tester.maxWriteGap(start - 100, nowMs());
+    std::cout << "round " << r << " -> node " << target << " : " << err << ", transfer rpc " << rpcDone - start
+              << " ms, write unavailable max " << gap << " ms" << std::endl;
+    if (err == OK) {
+      succeeded++;
+      totalRpcMs += rpcDone - start;
+      totalGapMs += gap;
+      worstGapMs = std::max(worstGapMs, gap);
+    }
+    target = (target + 1) % nodeNum;
+  }
+  std::cout << "transfers ok " << succeeded << "/" << rounds;
+  if (succeeded > 0) {
+    std::cout << ", avg transfer rpc " << totalRpcMs / succeeded << " ms, avg write unavailable "
+              << totalGapMs / succeeded << " ms, worst " << worstGapMs << " ms";
+  }
+  std::cout << std::endl;
+  // 写线程的clerk还阻塞在rpc上，直接退出
+  _exit(EXIT_SUCCESS);
+}
+
+void ShowArgsHelp() {
+  std::cout << "format: command [-f <configFileName>] [-n <nodeNum>] [-r <rounds>] [-i <interval ms>]" << std::endl;
+}
@@ -0,0 +1,134 @@
+//
+// learner读测试：一个clerk不停地写同一个key（值为递增的序号），每个节点一个读线程用GetStale在该节点上本地读，
+// 输出写延迟、每个节点的读吞吐和读到的数据的陈旧程度（读到序号s时，s+1已经写成功了多久）
+// 用来对比有无learner时的提交延迟，例如：
+//   raftCoreRun -n 3 -f test.conf            -> learnerRead -n 3
+//   raftCoreRun -n 5 -f test.conf -l 3,4     -> learnerRead -n 5
+//
+
+#include <signal.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "clerk.h"
+#include "util.h"
+
+void ShowArgsHelp();
+
+long long nowUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+struct ReaderResult {
+  long reads = 0;
+  long long maxStaleUs = 0;
+  long long totalStaleUs = 0;
+};
+
+int main(int argc, char **argv) {
+  signal(SIGPIPE, SIG_IGN);
+  std::string configFileName = "test.conf";
+  int nodeNum = 3;
+  int maxStaleMs = 100;
+  int seconds = 5;
+  int c = 0;
+  while ((c = getopt(argc, argv, "f:n:m:s:")) != -1) {
+    switch (c) {
+      case 'f':
+        configFileName = optarg;
+        break;
+      case 'n':
+        nodeNum = atoi(optarg);
+        break;
+      case 'm':
+        maxStaleMs = atoi(optarg);
+        break;
+      case 's':
+        seconds = atoi(optarg);
+        break;
+      default:
+        ShowArgsHelp();
+        exit(EXIT_FAILURE);
+    }
+  }
+
+  // commitTimes[s]：序号s写成功的时间
+  std::mutex mtx;
+  std::vector<long long> commitTimes;
+  std::vector<double> putLatencies;
+  std::atomic<bool> stop{false};
+
+  Clerk writer;
+  writer.Init(configFileName);
+  while (writer.Put("learner", "0") != OK) {
+  }
+  commitTimes.push_back(nowUs());
+
+  std::thread writerThread([&]() {
+    for (int seq = 1; !stop; ++seq) {
+      long long begin = nowUs();
+      while (writer.Put("learner", std::to_string(seq)) != OK) {
+        // 是否写入未知，重复Put同一个值是安全的，直到确认写入，保证commitTimes[seq]对应值seq
+      }
+      long long end = nowUs();
+      std::lock_guard<std::mutex> lg(mtx);
+      commitTimes.push_back(end);
+      putLatencies.push_back((end - begin) / 1000.0);
+    }
+  });
+
+  std::vector<ReaderResult> results(nodeNum);
+  std::vector<std::thread> readers;
+  for (int i = 0; i < nodeNum; ++i) {
+    readers.emplace_back([&, i]() {
+      Clerk reader;
+      reader.Init(configFileName);
+      while (!stop) {
+        int seq = atoi(reader.GetStale("learner", maxStaleMs, i).c_str());
+        long long t = nowUs();
+        long long staleUs = 0;
+        {
+          std::lock_guard<std::mutex> lg(mtx);
+          if (seq + 1 < commitTimes.size()) {
+            staleUs = std::max(0LL, t - commitTimes[seq + 1]);
+          }
+        }
+        results[i].reads++;
+        results[i].totalStaleUs += staleUs;
+        results[i].maxStaleUs = std::max(results[i].maxStaleUs, staleUs);
+      }
+    });
+  }
+
+  sleep(seconds);
+  stop = true;
+  writerThread.join();
+  for (auto &t : readers) {
+    t.join();
+  }
+
+  std::sort(putLatencies.begin(), putLatencies.end());
+  std::cout << "nodes:" << nodeNum << " maxStale:" << maxStaleMs << "ms seconds:" << seconds << std::endl;
+  if (!putLatencies.empty()) {
+    std::cout << "put " << putLatencies.size() / seconds << " ops/s, p50 " << putLatencies[putLatencies.size() / 2]
+              << " ms, p99 " << putLatencies[putLatencies.size() * 99 / 100] << " ms" << std::endl;
+  }
+  for (int i = 0; i < nodeNum; ++i) {
+    const auto &r = results[i];
+    std::cout << "node " << i << " : " << r.reads / seconds << " reads/s, staleness avg "
+              << (r.reads > 0 ? r.totalStaleUs / r.reads / 1000.0 : 0) << " ms, max " << r.maxStaleUs / 1000.0
+              << " ms" << std::endl;
+  }
+  _exit(EXIT_SUCCESS);
+}
+
+void ShowArgsHelp() {
+  std::cout << "format: command [-f <configFileName>] [-n <nodeNum>] [-m <maxStaleMs>] [-s <seconds>]" << std::endl;
+}
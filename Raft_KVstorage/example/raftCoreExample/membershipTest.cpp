@@ -0,0 +1,202 @@
+//
+// 成员变更测试：fork出n个初始节点和一个待加入的节点（配置里标记为join，启动时不属于任何配置），
+// 测试进程用一个clerk不停地写，同时依次做三次单节点变更：
+//   1. 把新节点以learner加入，等它追上日志
+//   2. 把新节点提升为voter
+//   3. 删除原来的node0（它是leader时会在变更提交后退位）
+// 每一步输出变更rpc的耗时和写入不可用窗口（变更前后相邻两次成功写入的最大间隔），最后确认写入仍然可用
+//
+// 测试进程本身是一个独立的集群，不需要先启动raftCoreRun
+//
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "clerk.h"
+#include "kvServer.h"
+#include "rpcprovider.h"
+#include "util.h"
+
+void ShowArgsHelp();
+
+long long nowMs() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void runNode(int me, unsigned short port, const std::string &configFileName) {
+  // 节点的日志写到各自的文件里，测试进程的输出只保留结果
+  std::string logName = "membershipNode" + std::to_string(me) + ".log";
+  freopen(logName.c_str(), "w", stdout);
+  freopen(logName.c_str(), "a", stderr);
+  new KvServer(me, 500, configFileName, port);  // 不会返回
+}
+
+class MembershipTester {
+ public:
+  explicit MembershipTester(const std::string &configFileName) : m_configFileName(configFileName) {}
+
+  // 后台一直写，记录每次写成功的时间
+  void startWriter() {
+    std::thread([this]() {
+      Clerk client;
+      client.Init(m_configFileName);
+      for (int seq = 0;; ++seq) {
+        if (client.Put("membership", std::to_string(seq)) != OK) {
+          continue;  // 是否写入未知，不算成功
+        }
+        std::lock_guard<std::mutex> lg(m_mtx);
+        m_writeTimes.push_back(nowMs());
+      }
+    }).detach();
+  }
+
+  long long writes() {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    return m_writeTimes.size();
+  }
+
+  // [start, end] 内相邻两次成功写入的最大间隔
+  long long maxWriteGap(long long start, long long end) {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    long long prev = start;
+    long long maxGap = 0;
+    for (long long t : m_writeTimes) {
+      if (t <= start || t > end) {
+        continue;
+      }
+      maxGap = std::max(maxGap, t - prev);
+      prev = t;
+    }
+    return std::max(maxGap, end - prev);
+  }
+
+ private:
+  std::string m_configFileName;
+  std::mutex m_mtx;
+  std::vector<long long> m_writeTimes;
+};
+
+int main(int argc, char **argv) {
+  int nodeNum = 3;
+  int catchUpMs = 1000;
+  int settleMs = 1000;
+  int c = 0;
+  while ((c = getopt(argc, argv, "n:w:s:")) != -1) {
+    switch (c) {
+      case 'n':
+        nodeNum = atoi(optarg);
+        break;
+      case 'w':
+        catchUpMs = atoi(optarg);
+        break;
+      case 's':
+        settleMs = atoi(optarg);
+        break;
+      default:
+        ShowArgsHelp();
+        exit(EXIT_FAILURE);
+    }
+  }
+  if (nodeNum < 3) {
+    ShowArgsHelp();
+    exit(EXIT_FAILURE);
+  }
+  signal(SIGPIPE, SIG_IGN);
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<> dis(10000, 29999);
+  unsigned short startPort = dis(gen);
+  const int newNode = nodeNum;
+
+  // RpcProvider固定把节点地址追加到test.conf。新节点的地址也写进去，clerk才能访问到它，join=1使它不属于初始配置
+  const std::string configFileName = "test.conf";
+  std::ofstream file(configFileName, std::ios::out | std::ios::trunc);
+  std::string ip = RpcProvider::GetLocalIp();
+  for (int i = 0; i <= newNode; ++i) {
+    file << "node" << i << "ip=" << ip << std::endl;
+    file << "node" << i << "port=" << startPort + i << std::endl;
+  }
+  file << "node" << newNode << "join=1" << std::endl;
+  file.close();
+
+  std::vector<pid_t> children;
+  auto startNode = [&](int i) {
+    pid_t pid = fork();
+    if (pid == 0) {
+      runNode(i, startPort + i, configFileName);
+      exit(EXIT_SUCCESS);
+    } else if (pid < 0) {
+      std::cerr << "Failed to create child process." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    children.push_back(pid);
+  };
+  for (int i = 0; i < nodeNum; ++i) {
+    startNode(i);
+  }
+
+  MembershipTester tester(configFileName);
+  Clerk admin;
+  admin.Init(configFileName);
+  long long begin = nowMs();
+  admin.Put("membership", "start");  // 等到初始集群选出leader
+  std::cout << "initial cluster of " << nodeNum << " ready in " << nowMs() - begin << " ms" << std::endl;
+  tester.startWriter();
+  startNode(newNode);
+  sleep(1);
+
+  struct Step {
+    const char *name;
+    raftKVRpcProctoc::ConfChangeType type;
+    int nodeId;
+    int waitMs;
+  };
+  std::vector<Step> steps{{"add learner", raftKVRpcProctoc::AddLearner, newNode, catchUpMs},
+                          {"promote voter", raftKVRpcProctoc::AddVoter, newNode, settleMs},
+                          {"remove node0", raftKVRpcProctoc::RemoveNode, 0, settleMs}};
+  bool allOk = true;
+  for (const auto &step : steps) {
+    long long start = nowMs();
+    std::string err = admin.ChangeMembership(step.type, step.nodeId, ip, startPort + step.nodeId);
+    long long rpcDone = nowMs();
+    usleep(step.waitMs * 1000);
+    long long gap = tester.maxWriteGap(start - 100, nowMs());
+    std::cout << step.name << " : " << err << ", change rpc " << rpcDone - start << " ms, write unavailable max "
+              << gap << " ms" << std::endl;
+    allOk = allOk && err == OK;
+  }
+
+  // node0已经不在配置中，停掉它之后剩下的节点仍然要能写
+  kill(children[0], SIGKILL);
+  waitpid(children[0], nullptr, 0);
+  long long writesBefore = tester.writes();
+  long long start = nowMs();
+  sleep(2);
+  long long writesAfter = tester.writes();
+  std::cout << "after stopping node0 : " << writesAfter - writesBefore << " writes in 2s, write unavailable max "
+            << tester.maxWriteGap(start, nowMs()) << " ms" << std::endl;
+  std::cout << (allOk && writesAfter > writesBefore ? "membership test passed" : "membership test FAILED")
+            << std::endl;
+
+  for (size_t i = 1; i < children.size(); ++i) {
+    kill(children[i], SIGKILL);
+    waitpid(children[i], nullptr, 0);
+  }
+  // clerk线程还阻塞在rpc上，直接退出
+  _exit(EXIT_SUCCESS);
+}
+
+void ShowArgsHelp() {
+  std::cout << "format: command [-n <initial nodeNum >= 3>] [-w <learner catch up ms>] [-s <settle ms>]" << std::endl;
+}
@@ -0,0 +1,140 @@
+//
+// Op 编解码的性能对比：原来的 boost text_oarchive/text_iarchive 与现在的二进制格式
+// 分别测不同value长度下的 编码ops/s、解码ops/s、每条日志的字节数
+//
+
+#include <unistd.h>
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/serialization/string.hpp>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "util.h"
+
+void ShowArgsHelp();
+
+// 原来的Op：操作类型为字符串，用boost text archive序列化
+class LegacyOp {
+ public:
+  std::string Operation;
+  std::string Key;
+  std::string Value;
+  std::string ClientId;
+  int RequestId;
+  int64_t Timestamp;
+
+  std::string asString() const {
+    std::stringstream ss;
+    boost::archive::text_oarchive oa(ss);
+    oa << *this;
+    return ss.str();
+  }
+
+  bool parseFromString(std::string str) {
+    std::stringstream iss(str);
+    boost::archive::text_iarchive ia(iss);
+    ia >> *this;
+    return true;
+  }
+
+ private:
+  friend class boost::serialization::access;
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int version) {
+    ar& Operation;
+    ar& Key;
+    ar& Value;
+    ar& ClientId;
+    ar& RequestId;
+    ar& Timestamp;
+  }
+};
+
+struct CodecResult {
+  double encodeOpsPerSec;
+  double decodeOpsPerSec;
+  double bytesPerOp;
+};
+
+template <typename OpT>
+CodecResult runCodec(std::vector<OpT>& ops, int rounds) {
+  std::vector<std::string> encoded(ops.size());
+  size_t bytes = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; ++r) {
+    for (size_t i = 0; i < ops.size(); ++i) {
+      encoded[i] = ops[i].asString();
+    }
+  }
+  double encodeSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  for (const auto& e : encoded) {
+    bytes += e.size();
+  }
+
+  OpT op;
+  long check = 0;
+  start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; ++r) {
+    for (const auto& e : encoded) {
+      op.parseFromString(e);
+      check += op.RequestId;
+    }
+  }
+  double decodeSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  if (check < 0) {
+    std::cout << check << std::endl;  // 防止编译器把解码优化掉
+  }
+  double total = static_cast<double>(ops.size()) * rounds;
+  return CodecResult{total / encodeSec, total / decodeSec, static_cast<double>(bytes) / ops.size()};
+}
+
+int main(int argc, char** argv) {
+  int opNum = 100000;
+  int rounds = 5;
+  int c = 0;
+  while ((c = getopt(argc, argv, "o:r:")) != -1) {
+    switch (c) {
+      case 'o':
+        opNum = atoi(optarg);
+        break;
+      case 'r':
+        rounds = atoi(optarg);
+        break;
+      default:
+        ShowArgsHelp();
+        exit(EXIT_FAILURE);
+    }
+  }
+
+  std::cout << "ops:" << opNum << " rounds:" << rounds << std::endl;
+  const std::string clientId = "1804289383846930886168169257717146";  // 与Clerk::Uuid生成的长度相当
+  for (int valueSize : {16, 128, 1024}) {
+    std::vector<LegacyOp> legacyOps(opNum);
+    std::vector<Op> ops(opNum);
+    for (int i = 0; i < opNum; ++i) {
+      std::string key = "key" + std::to_string(i);
+      std::string value(valueSize, static_cast<char>('a' + i % 26));
+      int64_t timestamp = 1704067200000LL + i;
+      legacyOps[i] = LegacyOp{i % 2 ? "Put" : "Append", key, value, clientId, i, timestamp};
+      ops[i].Operation = i % 2 ? OpType::Put : OpType::Append;
+      ops[i].Key = key;
+      ops[i].Value = value;
+      ops[i].ClientId = clientId;
+      ops[i].RequestId = i;
+      ops[i].Timestamp = timestamp;
+    }
+    CodecResult legacy = runCodec(legacyOps, rounds);
+    CodecResult binary = runCodec(ops, rounds);
+    std::cout << "value " << valueSize << "B" << std::endl;
+    std::cout << "  [boost text] encode " << (long)legacy.encodeOpsPerSec << " ops/s, decode "
+              << (long)legacy.decodeOpsPerSec << " ops/s, " << legacy.bytesPerOp << " bytes/op" << std::endl;
+    std::cout << "  [binary    ] encode " << (long)binary.encodeOpsPerSec << " ops/s, decode "
+              << (long)binary.decodeOpsPerSec << " ops/s, " << binary.bytesPerOp << " bytes/op" << std::endl;
+  }
+  return 0;
+}
+
+void ShowArgsHelp() { std::cout << "format: command [-o <opNum>] [-r <rounds>]" << std::endl; }
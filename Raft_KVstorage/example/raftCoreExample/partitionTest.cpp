@@ -0,0 +1,314 @@
+//
+// 网络分区测试：fork出n个raft节点，节点之间的链路通断放在共享内存中，由测试进程控制（MprpcChannel::SetLinkFilter），
+// 各节点把自己的term和是否是leader写回共享内存。测试进程用一个clerk不停地写，同时依次制造两种分区：
+//   1. 隔离一个follower一段时间再恢复：没有PreVote时它在隔离期间不断自增term，恢复后迫使正常的leader下台
+//   2. 隔离leader一段时间再恢复：多数派选出新leader；开启CheckQuorum时旧leader会在一个选举超时内主动退位
+// 每个场景输出写入不可用窗口（相邻两次成功写入的最大间隔）、term和leader的变化、旧leader多久退位
+// 用 -p 0 / -q 0 关闭PreVote / CheckQuorum 做对比
+//
+
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "clerk.h"
+#include "mprpcchannel.h"
+#include "multiRaft.h"
+#include "rpcprovider.h"
+#include "util.h"
+
+void ShowArgsHelp();
+
+const int kMaxNodes = 16;
+
+// 放在MAP_SHARED的匿名内存里，fork之后父子进程共用
+struct SharedState {
+  std::atomic<bool> link[kMaxNodes][kMaxNodes];  // link[from][to]：from发往to的rpc是否能送达
+  std::atomic<int> term[kMaxNodes];
+  std::atomic<bool> leader[kMaxNodes];
+};
+
+long long nowMs() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void runNode(int me, unsigned short startPort, SharedState *shared) {
+  // 节点的日志写到各自的文件里，测试进程的输出只保留结果
+  std::string logName = "partitionNode" + std::to_string(me) + ".log";
+  freopen(logName.c_str(), "w", stdout);
+  freopen(logName.c_str(), "a", stderr);
+  MprpcChannel::SetLinkFilter([me, startPort, shared](const std::string &ip, uint16_t port) -> bool {
+    int to = static_cast<int>(port) - startPort;
+    return to < 0 || to >= kMaxNodes || shared->link[me][to].load();
+  });
+  auto node = new MultiRaftNode(me, 1, 500, "test.conf", startPort + me);
+  auto raft = node->GetKvServer(0)->GetRaftNode();
+  while (true) {
+    int term = 0;
+    bool isLeader = false;
+    raft->GetState(&term, &isLeader);
+    shared->term[me] = term;
+    shared->leader[me] = isLeader;
+    usleep(2000);
+  }
+}
+
+class PartitionTester {
+ public:
+  PartitionTester(int nodeNum, SharedState *shared) : m_nodeNum(nodeNum), m_shared(shared) {}
+
+  // 当前term最大的leader，没有返回-1
+  int currentLeader(int *term) {
+    int leader = -1;
+    int maxTerm = -1;
+    for (int i = 0; i < m_nodeNum; ++i) {
+      int t = m_shared->term[i];
+      if (m_shared->leader[i] && t > maxTerm) {
+        leader = i;
+        maxTerm = t;
+      }
+    }
+    if (term != nullptr) {
+      *term = maxTerm;
+    }
+    return leader;
+  }
+
+  int waitLeader(int timeoutMs) {
+    long long deadline = nowMs() + timeoutMs;
+    while (nowMs() < deadline) {
+      int leader = currentLeader(nullptr);
+      if (leader != -1) {
+        return leader;
+      }
+      usleep(10000);
+    }
+    return -1;
+  }
+
+  void setIsolated(int node, bool isolated) {
+    for (int i = 0; i < m_nodeNum; ++i) {
+      if (i != node) {
+        m_shared->link[node][i] = !isolated;
+        m_shared->link[i][node] = !isolated;
+      }
+    }
+  }
+
+  // 后台一直写，记录每次写成功的时间
+  void startWriter(const std::string &configFileName) {
+    std::thread([this, configFileName]() {
+      Clerk client;
+      client.Init(configFileName);
+      for (int seq = 0;; ++seq) {
+        if (client.Put("partition", std::to_string(seq)) != OK) {
+          continue;  // 是否写入未知，不算成功
+        }
+        std::lock_guard<std::mutex> lg(m_mtx);
+        m_writeTimes.push_back(nowMs());
+      }
+    }).detach();
+  }
+
+  /**
+   * 隔离一个节点isolateMs毫秒后恢复，再观察settleMs毫秒
+   * @param isolateLeader  true隔离leader，false隔离一个follower
+   */
+  void runScenario(bool isolateLeader, int isolateMs, int settleMs, std::vector<std::string> *report) {
+    int termBefore = 0;
+    int leader = waitLeader(10000);
+    currentLeader(&termBefore);
+    if (leader == -1) {
+      report->push_back("no leader, skip scenario");
+      return;
+    }
+    int target = isolateLeader ? leader : (leader + 1) % m_nodeNum;
+    long long start = nowMs();
+    setIsolated(target, true);
+
+    // 隔离期间观察目标节点：是否还自认为leader、term涨到多少
+    long long stepDownMs = -1;
+    while (nowMs() - start < isolateMs) {
+      if (isolateLeader && stepDownMs == -1 && !m_shared->leader[target]) {
+        stepDownMs = nowMs() - start;
+      }
+      usleep(2000);
+    }
+    int targetTermAtHeal = m_shared->term[target];
+    long long heal = nowMs();
+    setIsolated(target, false);
+
+    // 恢复之后观察leader是否变化
+    int leaderChangesAfterHeal = 0;
+    int lastLeader = currentLeader(nullptr);
+    while (nowMs() - heal < settleMs) {
+      int l = currentLeader(nullptr);
+      if (l != lastLeader) {
+        leaderChangesAfterHeal++;
+        lastLeader = l;
+      }
+      usleep(2000);
+    }
+    long long end = nowMs();
+    int termAfter = 0;
+    currentLeader(&termAfter);
+
+    long long maxGap = 0;
+    long long maxGapAfterHeal = 0;
+    long long writes = 0;
+    {
+      std::lock_guard<std::mutex> lg(m_mtx);
+      long long prev = start;
+      for (long long t : m_writeTimes) {
+        if (t <= start || t > end) {
+          continue;
+        }
+        writes++;
+        maxGap = std::max(maxGap, t - prev);
+        if (t > heal) {
+          maxGapAfterHeal = std::max(maxGapAfterHeal, t - std::max(prev, heal));
+        }
+        prev = t;
+      }
+      maxGap = std::max(maxGap, end - prev);
+      maxGapAfterHeal = std::max(maxGapAfterHeal, end - std::max(prev, heal));
+    }
+
+    std::string line = std::string(isolateLeader ? "[leader   isolated " : "[follower isolated ") +
+                       std::to_string(isolateMs) + "ms] writes " + std::to_string(writes) + ", unavailable max " +
+                       std::to_string(maxGap) + " ms (after heal " + std::to_string(maxGapAfterHeal) + " ms), term " +
+                       std::to_string(termBefore) + " -> " + std::to_string(termAfter) + ", isolated node term " +
+                       std::to_string(targetTermAtHeal) + ", leader changes after heal " +
+                       std::to_string(leaderChangesAfterHeal);
+    if (isolateLeader) {
+      line += ", old leader stepped down " + (stepDownMs == -1 ? std::string("never") : std::to_string(stepDownMs) + " ms");
+    }
+    report->push_back(line);
+  }
+
+ private:
+  int m_nodeNum;
+  SharedState *m_shared;
+  std::mutex m_mtx;
+  std::vector<long long> m_writeTimes;
+};
+
+int main(int argc, char **argv) {
+  int nodeNum = 3;
+  int preVote = RAFT_PRE_VOTE_DEFAULT;
+  int checkQuorum = RAFT_CHECK_QUORUM_DEFAULT;
+  int isolateMs = 3000;
+  int settleMs = 3000;
+  int c = 0;
+  while ((c = getopt(argc, argv, "n:p:q:i:s:")) != -1) {
+    switch (c) {
+      case 'n':
+        nodeNum = atoi(optarg);
+        break;
+      case 'p':
+        preVote = atoi(optarg);
+        break;
+      case 'q':
+        checkQuorum = atoi(optarg);
+        break;
+      case 'i':
+        isolateMs = atoi(optarg);
+        break;
+      case 's':
+        settleMs = atoi(optarg);
+        break;
+      default:
+        ShowArgsHelp();
+        exit(EXIT_FAILURE);
+    }
+  }
+  if (nodeNum < 3 || nodeNum > kMaxNodes) {
+    ShowArgsHelp();
+    exit(EXIT_FAILURE);
+  }
+  signal(SIGPIPE, SIG_IGN);
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<> dis(10000, 29999);
+  unsigned short startPort = dis(gen);
+
+  // RpcProvider固定把节点地址追加到test.conf，这里先写好初始成员
+  const std::string configFileName = "test.conf";
+  std::ofstream file(configFileName, std::ios::out | std::ios::trunc);
+  file << "preVote=" << preVote << std::endl;
+  file << "checkQuorum=" << checkQuorum << std::endl;
+  std::string ip = RpcProvider::GetLocalIp();
+  for (int i = 0; i < nodeNum; ++i) {
+    file << "node" << i << "ip=" << ip << std::endl;
+    file << "node" << i << "port=" << startPort + i << std::endl;
+  }
+  file.close();
+
+  void *mem = mmap(nullptr, sizeof(SharedState), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (mem == MAP_FAILED) {
+    std::cerr << "mmap failed" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  auto *shared = new (mem) SharedState();
+  for (int i = 0; i < kMaxNodes; ++i) {
+    for (int j = 0; j < kMaxNodes; ++j) {
+      shared->link[i][j] = true;
+    }
+    shared->term[i] = 0;
+    shared->leader[i] = false;
+  }
+
+  std::vector<pid_t> children;
+  for (int i = 0; i < nodeNum; ++i) {
+    pid_t pid = fork();
+    if (pid == 0) {
+      runNode(i, startPort, shared);
+      exit(EXIT_SUCCESS);
+    } else if (pid < 0) {
+      std::cerr << "Failed to create child process." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    children.push_back(pid);
+    sleep(1);
+  }
+
+  PartitionTester tester(nodeNum, shared);
+  std::vector<std::string> report;
+  if (tester.waitLeader(30000) == -1) {
+    report.push_back("no leader elected");
+  } else {
+    tester.startWriter(configFileName);
+    sleep(2);
+    tester.runScenario(false, isolateMs, settleMs, &report);
+    tester.runScenario(true, isolateMs, settleMs, &report);
+  }
+  for (pid_t pid : children) {
+    kill(pid, SIGKILL);
+    waitpid(pid, nullptr, 0);
+  }
+
+  std::cout << "==== nodes:" << nodeNum << " preVote:" << preVote << " checkQuorum:" << checkQuorum << std::endl;
+  for (const auto &line : report) {
+    std::cout << line << std::endl;
+  }
+  // clerk线程还阻塞在rpc上，直接退出
+  _exit(EXIT_SUCCESS);
+}
+
+void ShowArgsHelp() {
+  std::cout << "format: command [-n <nodeNum 3~16>] [-p <preVote 0/1>] [-q <checkQuorum 0/1>] [-i <isolate ms>] "
+               "[-s <settle ms>]"
+            << std::endl;
+}
@@ -5,9 +5,11 @@
 #include "raft.h"
 // #include "kvServer.h"
 #include <kvServer.h>
+#include <multiRaft.h>
 #include <unistd.h>
 #include <iostream>
 #include <random>
+#include "rpcprovider.h"
 
 void ShowArgsHelp();
 
@@ -20,11 +22,14 @@ int main(int argc, char **argv) {
   int c = 0;
   int nodeNum = 0;
   std::string configFileName;
+  std::string hashIndexNodes;  // 开启点查哈希索引的节点，逗号分隔，如 0,2；all表示全部
+  std::string learnerNodes;    // 作为learner（不投票）启动的节点，逗号分隔，如 3,4
+  int groupNum = 1;            // multi-raft：每个进程中的raft组数量
   std::random_device rd;
   std::mt19937 gen(rd());
   std::uniform_int_distribution<> dis(10000, 29999);
   unsigned short startPort = dis(gen);
-  while ((c = getopt(argc, argv, "n:f:")) != -1) {
+  while ((c = getopt(argc, argv, "n:f:i:g:l:")) != -1) {
     switch (c) {
       case 'n':
         nodeNum = atoi(optarg);
@@ -32,6 +37,15 @@ int main(int argc, char **argv) {
       case 'f':
         configFileName = optarg;
         break;
+      case 'i':
+        hashIndexNodes = optarg;
+        break;
+      case 'g':
+        groupNum = atoi(optarg);
+        break;
+      case 'l':
+        learnerNodes = optarg;
+        break;
       default:
         ShowArgsHelp();
         exit(EXIT_FAILURE);
@@ -41,6 +55,34 @@ int main(int argc, char **argv) {
   file.close();
   file = std::ofstream(configFileName, std::ios::out | std::ios::trunc);
   if (file.is_open()) {
+    // 先写好所有节点的地址作为集群的初始成员，节点启动后不需要互相等待；之后的成员变更走raft日志
+    std::string ip = RpcProvider::GetLocalIp();
+    for (int i = 0; i < nodeNum; i++) {
+      file << "node" << i << "ip=" << ip << std::endl;
+      file << "node" << i << "port=" << startPort + i << std::endl;
+    }
+    // 每个节点是否开启哈希索引写在配置文件里，由各个kvServer启动时自己读取
+    for (int i = 0; i < nodeNum && !hashIndexNodes.empty(); i++) {
+      std::string id = std::to_string(i);
+      bool enable = hashIndexNodes == "all" || ("," + hashIndexNodes + ",").find("," + id + ",") != std::string::npos;
+      file << "node" + id + "hashIndex=" << (enable ? 1 : 0) << std::endl;
+    }
+    for (int i = 0; i < nodeNum && !learnerNodes.empty(); i++) {
+      std::string id = std::to_string(i);
+      if (("," + learnerNodes + ",").find("," + id + ",") != std::string::npos) {
+        file << "node" + id + "learner=1" << std::endl;
+      }
+    }
+    // multi-raft：把可打印字符组成的两字节key空间均分给各组，clerk按起始key路由
+    if (groupNum > 1) {
+      file << "groupNum=" << groupNum << std::endl;
+      const int base = '~' - '!' + 1;
+      for (int g = 1; g < groupNum; g++) {
+        int start = g * base * base / groupNum;
+        std::string startKey{static_cast<char>('!' + start / base), static_cast<char>('!' + start % base)};
+        file << "group" << g << "startKey=" << startKey << std::endl;
+      }
+    }
     file.close();
     std::cout << configFileName << " 已清空" << std::endl;
   } else {
@@ -55,7 +97,11 @@ int main(int argc, char **argv) {
       // 如果是子进程
       // 子进程的代码
 
-      auto kvServer = new KvServer(i, 500, configFileName, port);
+      if (groupNum > 1) {
+        auto multiRaftNode = new MultiRaftNode(i, groupNum, 500, configFileName, port);
+      } else {
+        auto kvServer = new KvServer(i, 500, configFileName, port);
+      }
       pause();  // 子进程进入等待状态，不会执行 return 语句
     } else if (pid > 0) {
       // 如果是父进程
@@ -71,4 +117,8 @@ int main(int argc, char **argv) {
   return 0;
 }
 
-void ShowArgsHelp() { std::cout << "format: command -n <nodeNum> -f <configFileName>" << std::endl; }
+void ShowArgsHelp() {
+  std::cout << "format: command -n <nodeNum> -f <configFileName> [-i <hashIndexNodes, e.g. 0,2 or all>] "
+               "[-g <groupNum>] [-l <learnerNodes, e.g. 3,4>]"
+            << std::endl;
+}
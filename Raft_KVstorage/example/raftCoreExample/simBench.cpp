@@ -0,0 +1,360 @@
+//
+// 进程内模拟集群压测：在一个进程里启动n个KvServer，节点之间以及clerk到节点的rpc都走SimNetwork，
+// 可以配置单程延迟、丢包率和随机数种子。依次输出：
+//   1. 初次选举耗时
+//   2. 每种读写比例下的吞吐、读/写延迟的p50/p99/p999、复制的字节数（读也走raft日志，按每个操作平均）
+//   3. 隔离leader后重新选出leader的耗时
+// 不需要配置文件和端口，也不需要先启动raftCoreRun
+//
+
+#include <signal.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "kvServer.h"
+#include "simNetwork.h"
+#include "util.h"
+
+void ShowArgsHelp();
+
+long long nowUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// 和Clerk的重试逻辑一致的简化版本，rpc走SimNetwork，直接调用目标KvServer的处理函数
+class SimClerk {
+ public:
+  SimClerk(SimNetwork *network, std::vector<KvServer *> *servers, const std::string &clientId)
+      : m_network(network), m_servers(servers), m_clientId(clientId), m_requestId(0), m_sessionEpoch(0), m_leader(0) {
+    registerSession();
+  }
+
+  void Put(const std::string &key, const std::string &value) {
+    raftKVRpcProctoc::PutAppendArgs args;
+    args.set_key(key);
+    args.set_value(value);
+    args.set_op("Put");
+    args.set_clientid(m_clientId);
+    args.set_requestid(++m_requestId);
+    while (true) {
+      args.set_sessionepoch(m_sessionEpoch);
+      raftKVRpcProctoc::PutAppendReply reply;
+      KvServer *server = (*m_servers)[m_leader];
+      bool ok = m_network->Call(SimNetwork::kClient, m_leader, args, &reply,
+                                [server](auto *a, auto *r) { server->PutAppend(a, r); });
+      if (ok && reply.err() == OK) {
+        return;
+      }
+      if (ok && reply.err() == ErrSessionExpired) {
+        // 压测里只有Put，换新会话重试即使重复执行也不影响结果
+        registerSession();
+        continue;
+      }
+      if (ok && reply.err() == ErrTimeout) {
+        continue;
+      }
+      m_leader = (m_leader + 1) % m_servers->size();
+    }
+  }
+
+  std::string Get(const std::string &key) {
+    raftKVRpcProctoc::GetArgs args;
+    args.set_key(key);
+    args.set_clientid(m_clientId);
+    args.set_requestid(++m_requestId);
+    while (true) {
+      raftKVRpcProctoc::GetReply reply;
+      KvServer *server = (*m_servers)[m_leader];
+      bool ok =
+          m_network->Call(SimNetwork::kClient, m_leader, args, &reply, [server](auto *a, auto *r) { server->Get(a, r); });
+      if (ok && (reply.err() == OK || reply.err() == ErrNoKey)) {
+        return reply.value();
+      }
+      if (ok && reply.err() == ErrTimeout) {
+        continue;
+      }
+      m_leader = (m_leader + 1) % m_servers->size();
+    }
+  }
+
+ private:
+  void registerSession() {
+    raftKVRpcProctoc::RegisterSessionArgs args;
+    args.set_clientid(m_clientId);
+    while (true) {
+      raftKVRpcProctoc::RegisterSessionReply reply;
+      KvServer *server = (*m_servers)[m_leader];
+      bool ok = m_network->Call(SimNetwork::kClient, m_leader, args, &reply,
+                                [server](auto *a, auto *r) { server->RegisterSession(a, r); });
+      if (ok && reply.err() == OK) {
+        m_sessionEpoch = reply.epoch();
+        return;
+      }
+      if (ok && reply.err() == ErrTimeout) {
+        continue;
+      }
+      m_leader = (m_leader + 1) % m_servers->size();
+    }
+  }
+
+  SimNetwork *m_network;
+  std::vector<KvServer *> *m_servers;
+  std::string m_clientId;
+  int m_requestId;
+  int64_t m_sessionEpoch;
+  int m_leader;
+};
+
+class SimCluster {
+ public:
+  SimCluster(int nodeNum, int maxRaftState, uint64_t seed) : m_network(seed) {
+    raftRpcProctoc::ClusterConfig config;
+    for (int i = 0; i < nodeNum; ++i) {
+      auto member = config.add_members();
+      member->set_id(i);
+    }
+    for (int i = 0; i < nodeNum; ++i) {
+      m_servers.push_back(new KvServer(i, maxRaftState, 0, nullptr));
+      m_network.AddNode(i, m_servers[i]->GetRaftNode().get());
+    }
+    for (int i = 0; i < nodeNum; ++i) {
+      m_servers[i]->StartInGroup(
+          config,
+          [this, i](const raftRpcProctoc::Member &member) -> std::shared_ptr<RaftRpcUtil> {
+            return m_network.NewPeer(i, member.id());
+          },
+          KV_HASH_INDEX_DEFAULT);
+    }
+  }
+
+  SimNetwork &Network() { return m_network; }
+  std::vector<KvServer *> &Servers() { return m_servers; }
+
+  // 当前term最大的leader，except之外，没有返回-1
+  int CurrentLeader(int except = -1) {
+    int leader = -1;
+    int maxTerm = -1;
+    for (int i = 0; i < m_servers.size(); ++i) {
+      int term = 0;
+      bool isLeader = false;
+      m_servers[i]->GetRaftNode()->GetState(&term, &isLeader);
+      if (isLeader && i != except && term > maxTerm) {
+        leader = i;
+        maxTerm = term;
+      }
+    }
+    return leader;
+  }
+
+  // 等到选出leader，返回耗时（微秒），超时返回-1
+  long long WaitLeader(int except, int timeoutMs) {
+    long long start = nowUs();
+    while (nowUs() - start < timeoutMs * 1000LL) {
+      if (CurrentLeader(except) != -1) {
+        return nowUs() - start;
+      }
+      usleep(1000);
+    }
+    return -1;
+  }
+
+ private:
+  SimNetwork m_network;
+  std::vector<KvServer *> m_servers;
+};
+
+std::string percentiles(std::vector<double> &latencies) {
+  if (latencies.empty()) {
+    return "-";
+  }
+  std::sort(latencies.begin(), latencies.end());
+  std::stringstream ss;
+  ss << "p50 " << latencies[latencies.size() / 2] << " ms, p99 " << latencies[latencies.size() * 99 / 100]
+     << " ms, p999 " << latencies[latencies.size() * 999 / 1000] << " ms";
+  return ss.str();
+}
+
+std::string runMix(SimCluster &cluster, std::vector<SimClerk *> &clients, int readPercent, int seconds, int keyNum,
+                   int valueBytes, uint64_t seed) {
+  int clientNum = clients.size();
+  std::vector<std::vector<double>> reads(clientNum);
+  std::vector<std::vector<double>> writes(clientNum);
+  int64_t replicatedBefore = cluster.Network().ReplicatedBytes();
+  std::atomic<bool> stop{false};
+  std::string value(valueBytes, 'v');
+  std::vector<std::thread> threads;
+  long long start = nowUs();
+  for (int c = 0; c < clientNum; ++c) {
+    threads.emplace_back([&, c]() {
+      std::mt19937 gen(seed + c);
+      std::uniform_int_distribution<> keyDis(0, keyNum - 1);
+      std::uniform_int_distribution<> opDis(0, 99);
+      while (!stop) {
+        std::string key = "sim" + std::to_string(keyDis(gen));
+        bool isRead = opDis(gen) < readPercent;
+        long long begin = nowUs();
+        if (isRead) {
+          clients[c]->Get(key);
+          reads[c].push_back((nowUs() - begin) / 1000.0);
+        } else {
+          clients[c]->Put(key, value);
+          writes[c].push_back((nowUs() - begin) / 1000.0);
+        }
+      }
+    });
+  }
+  sleep(seconds);
+  stop = true;
+  for (auto &t : threads) {
+    t.join();
+  }
+  double elapsed = (nowUs() - start) / 1000000.0;
+
+  std::vector<double> allReads;
+  std::vector<double> allWrites;
+  for (int c = 0; c < clientNum; ++c) {
+    allReads.insert(allReads.end(), reads[c].begin(), reads[c].end());
+    allWrites.insert(allWrites.end(), writes[c].begin(), writes[c].end());
+  }
+  int64_t replicated = cluster.Network().ReplicatedBytes() - replicatedBefore;
+  std::stringstream ss;
+  ss << "[read " << readPercent << "%] " << (long)((allReads.size() + allWrites.size()) / elapsed)
+     << " ops/s, read " << percentiles(allReads) << "; write " << percentiles(allWrites) << "; replicated "
+     << replicated / 1024 << " KB (" << replicated / std::max<int64_t>(1, allReads.size() + allWrites.size())
+     << " B/op)";
+  return ss.str();
+}
+
+int main(int argc, char **argv) {
+  int nodeNum = 3;
+  int clientNum = 8;
+  int seconds = 5;
+  int keyNum = 1000;
+  int valueBytes = 128;
+  int minLatencyUs = 100;
+  int maxLatencyUs = 300;
+  double lossRate = 0;
+  uint64_t seed = 1;
+  int failovers = 3;
+  std::vector<int> readPercents{0, 50, 95};
+  int c = 0;
+  while ((c = getopt(argc, argv, "n:c:s:k:v:l:p:e:f:r:")) != -1) {
+    switch (c) {
+      case 'n':
+        nodeNum = atoi(optarg);
+        break;
+      case 'c':
+        clientNum = atoi(optarg);
+        break;
+      case 's':
+        seconds = atoi(optarg);
+        break;
+      case 'k':
+        keyNum = atoi(optarg);
+        break;
+      case 'v':
+        valueBytes = atoi(optarg);
+        break;
+      case 'l':
+        // 单程延迟范围，例如 -l 100,300
+        sscanf(optarg, "%d,%d", &minLatencyUs, &maxLatencyUs);
+        break;
+      case 'p':
+        lossRate = atof(optarg);
+        break;
+      case 'e':
+        seed = strtoull(optarg, nullptr, 10);
+        break;
+      case 'f':
+        failovers = atoi(optarg);
+        break;
+      case 'r': {
+        // 逗号分隔的多种读比例（百分比），例如 -r 0,50,95
+        readPercents.clear();
+        std::stringstream ss(optarg);
+        std::string item;
+        while (std::getline(ss, item, ',')) {
+          readPercents.push_back(atoi(item.c_str()));
+        }
+        break;
+      }
+      default:
+        ShowArgsHelp();
+        exit(EXIT_FAILURE);
+    }
+  }
+  if (nodeNum < 1 || clientNum < 1 || keyNum < 1) {
+    ShowArgsHelp();
+    exit(EXIT_FAILURE);
+  }
+  signal(SIGPIPE, SIG_IGN);
+
+  // 节点和clerk都在本进程里，调试输出写到文件
+  int resultFd = dup(STDOUT_FILENO);
+  freopen("simBench.log", "w", stdout);
+  std::vector<std::string> report;
+  std::stringstream title;
+  title << "==== nodes:" << nodeNum << " clients:" << clientNum << " latency:" << minLatencyUs << "~" << maxLatencyUs
+        << "us loss:" << lossRate << " seed:" << seed;
+  report.push_back(title.str());
+
+  long long start = nowUs();
+  SimCluster cluster(nodeNum, -1, seed);
+  cluster.Network().SetLatency(minLatencyUs, maxLatencyUs);
+  cluster.Network().SetLossRate(lossRate);
+  long long electionUs = cluster.WaitLeader(-1, 10000);
+  report.push_back("initial election " +
+                   (electionUs == -1 ? std::string("timeout") : std::to_string((nowUs() - start) / 1000) + " ms"));
+
+  std::vector<SimClerk *> clients;
+  for (int i = 0; i < clientNum; ++i) {
+    clients.push_back(new SimClerk(&cluster.Network(), &cluster.Servers(), "simClerk" + std::to_string(i)));
+  }
+  for (int readPercent : readPercents) {
+    report.push_back(runMix(cluster, clients, readPercent, seconds, keyNum, valueBytes, seed));
+  }
+
+  // 隔离当前leader，计算其余节点选出新leader的时间
+  for (int i = 0; i < failovers && nodeNum >= 3; ++i) {
+    int leader = cluster.CurrentLeader();
+    if (leader == -1) {
+      cluster.WaitLeader(-1, 10000);
+      leader = cluster.CurrentLeader();
+    }
+    cluster.Network().Isolate(leader, true);
+    long long us = cluster.WaitLeader(leader, 10000);
+    report.push_back("failover " + std::to_string(i) + " : isolated leader " + std::to_string(leader) +
+                     ", new leader elected in " + (us == -1 ? std::string("timeout") : std::to_string(us / 1000) + " ms"));
+    cluster.Network().Isolate(leader, false);
+    sleep(1);
+  }
+  std::stringstream net;
+  net << "rpcs " << cluster.Network().RpcCount() << ", dropped " << cluster.Network().DroppedCount() << ", bytes "
+      << cluster.Network().BytesSent() / 1024 << " KB";
+  report.push_back(net.str());
+
+  // 其他线程还在往标准输出（日志文件）写，结果直接写到原来的标准输出上
+  FILE *result = fdopen(resultFd, "w");
+  for (const auto &line : report) {
+    fprintf(result, "%s\n", line.c_str());
+  }
+  fflush(result);
+  // raft节点的线程都还在运行，直接退出
+  _exit(EXIT_SUCCESS);
+}
+
+void ShowArgsHelp() {
+  std::cout << "format: command [-n <nodeNum>] [-c <clientNum>] [-s <seconds per mix>] [-k <keyNum>] [-v <value bytes>] "
+               "[-l <min,max one-way latency us>] [-p <loss rate>] [-e <seed>] [-f <failovers>] "
+               "[-r <read percent1,percent2,...>]"
+            << std::endl;
+}
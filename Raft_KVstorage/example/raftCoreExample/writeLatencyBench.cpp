@@ -0,0 +1,129 @@
+//
+// 写延迟测试：多个clerk按给定的总速率发Put，依次测几档负载，输出每档实际吞吐和写延迟的p50/p99
+// 用来观察新日志立即复制 + 自适应合并窗口的效果：低负载下不再等心跳，高负载下合并成批
+// 需要先按配置文件启动集群，例如 raftCoreRun -n 3 -f test.conf
+//
+
+#include <signal.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "clerk.h"
+#include "util.h"
+
+void ShowArgsHelp();
+
+struct LoadResult {
+  double opsPerSec;
+  double p50Ms;
+  double p99Ms;
+  long late;  // 发出时已经落后于计划的请求数，说明系统跟不上这档负载
+};
+
+LoadResult runLoad(std::vector<Clerk *> &clients, int rate, int seconds) {
+  int clientNum = clients.size();
+  std::vector<std::vector<double>> latencies(clientNum);
+  std::vector<long> late(clientNum, 0);
+  auto start = std::chrono::steady_clock::now();
+  auto end = start + std::chrono::seconds(seconds);
+  // 每个client按 rate/clientNum 的速率均匀发请求，clerk是同步的，跟不上时就退化成闭环压测
+  auto interval = std::chrono::nanoseconds(1000000000LL * clientNum / rate);
+  std::vector<std::thread> threads;
+  for (int c = 0; c < clientNum; ++c) {
+    threads.emplace_back([&, c]() {
+      auto next = start + interval * c / clientNum;
+      int seq = 0;
+      while (next < end) {
+        if (std::chrono::steady_clock::now() > next + interval) {
+          late[c]++;
+        }
+        std::this_thread::sleep_until(next);
+        next += interval;
+        auto begin = std::chrono::steady_clock::now();
+        clients[c]->Put("bench" + std::to_string(c), std::to_string(seq++));
+        latencies[c].push_back(
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count());
+      }
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+  double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::vector<double> all;
+  LoadResult r{};
+  for (int c = 0; c < clientNum; ++c) {
+    all.insert(all.end(), latencies[c].begin(), latencies[c].end());
+    r.late += late[c];
+  }
+  if (all.empty()) {
+    return r;
+  }
+  std::sort(all.begin(), all.end());
+  r.opsPerSec = all.size() / elapsed;
+  r.p50Ms = all[all.size() / 2];
+  r.p99Ms = all[all.size() * 99 / 100];
+  return r;
+}
+
+int main(int argc, char **argv) {
+  signal(SIGPIPE, SIG_IGN);
+  std::string configFileName = "test.conf";
+  int clientNum = 16;
+  int seconds = 5;
+  std::vector<int> rates{20, 100, 500, 2000};
+  int c = 0;
+  while ((c = getopt(argc, argv, "f:c:s:r:")) != -1) {
+    switch (c) {
+      case 'f':
+        configFileName = optarg;
+        break;
+      case 'c':
+        clientNum = atoi(optarg);
+        break;
+      case 's':
+        seconds = atoi(optarg);
+        break;
+      case 'r': {
+        // 逗号分隔的多档负载，例如 -r 20,100,500
+        rates.clear();
+        std::stringstream ss(optarg);
+        std::string item;
+        while (std::getline(ss, item, ',')) {
+          rates.push_back(atoi(item.c_str()));
+        }
+        break;
+      }
+      default:
+        ShowArgsHelp();
+        exit(EXIT_FAILURE);
+    }
+  }
+
+  std::vector<Clerk *> clients;
+  for (int i = 0; i < clientNum; ++i) {
+    clients.push_back(new Clerk());
+    clients.back()->Init(configFileName);
+  }
+  std::cout << "clients:" << clientNum << " seconds per load:" << seconds << std::endl;
+  for (int rate : rates) {
+    LoadResult r = runLoad(clients, rate, seconds);
+    std::cout << "offered " << rate << " ops/s : achieved " << (long)r.opsPerSec << " ops/s, put p50 " << r.p50Ms
+              << " ms, p99 " << r.p99Ms << " ms, late " << r.late << std::endl;
+  }
+  for (auto client : clients) {
+    delete client;
+  }
+  return 0;
+}
+
+void ShowArgsHelp() {
+  std::cout << "format: command [-f <configFileName>] [-c <clientNum>] [-s <seconds>] [-r <rate1,rate2,...>]"
+            << std::endl;
+}
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3014000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3014000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -43,26 +42,18 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_friend_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[3]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_friend_2eproto;
 namespace fixbug {
 class GetFriendsListRequest;
-class GetFriendsListRequestDefaultTypeInternal;
+struct GetFriendsListRequestDefaultTypeInternal;
 extern GetFriendsListRequestDefaultTypeInternal _GetFriendsListRequest_default_instance_;
 class GetFriendsListResponse;
-class GetFriendsListResponseDefaultTypeInternal;
+struct GetFriendsListResponseDefaultTypeInternal;
 extern GetFriendsListResponseDefaultTypeInternal _GetFriendsListResponse_default_instance_;
 class ResultCode;
-class ResultCodeDefaultTypeInternal;
+struct ResultCodeDefaultTypeInternal;
 extern ResultCodeDefaultTypeInternal _ResultCode_default_instance_;
 }  // namespace fixbug
 PROTOBUF_NAMESPACE_OPEN
@@ -74,11 +65,12 @@ namespace fixbug {
 
 // ===================================================================
 
-class ResultCode PROTOBUF_FINAL :
+class ResultCode final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fixbug.ResultCode) */ {
  public:
   inline ResultCode() : ResultCode(nullptr) {}
-  virtual ~ResultCode();
+  ~ResultCode() override;
+  explicit PROTOBUF_CONSTEXPR ResultCode(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ResultCode(const ResultCode& from);
   ResultCode(ResultCode&& from) noexcept
@@ -91,8 +83,13 @@ class ResultCode PROTOBUF_FINAL :
     return *this;
   }
   inline ResultCode& operator=(ResultCode&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -103,13 +100,14 @@ class ResultCode PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResultCode& default_instance() {
+    return *internal_default_instance();
   }
-  static const ResultCode& default_instance();
-
   static inline const ResultCode* internal_default_instance() {
     return reinterpret_cast<const ResultCode*>(
                &_ResultCode_default_instance_);
@@ -122,7 +120,12 @@ class ResultCode PROTOBUF_FINAL :
   }
   inline void Swap(ResultCode* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -130,56 +133,53 @@ class ResultCode PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(ResultCode* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ResultCode* New() const final {
-    return CreateMaybeMessage<ResultCode>(nullptr);
-  }
-
-  ResultCode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ResultCode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ResultCode>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ResultCode& from);
-  void MergeFrom(const ResultCode& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResultCode& from) {
+    ResultCode::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ResultCode* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "fixbug.ResultCode";
   }
   protected:
-  explicit ResultCode(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ResultCode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_friend_2eproto);
-    return ::descriptor_table_friend_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -192,26 +192,24 @@ class ResultCode PROTOBUF_FINAL :
   // bytes errmsg = 2;
   void clear_errmsg();
   const std::string& errmsg() const;
-  void set_errmsg(const std::string& value);
-  void set_errmsg(std::string&& value);
-  void set_errmsg(const char* value);
-  void set_errmsg(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_errmsg(ArgT0&& arg0, ArgT... args);
   std::string* mutable_errmsg();
-  std::string* release_errmsg();
+  PROTOBUF_NODISCARD std::string* release_errmsg();
   void set_allocated_errmsg(std::string* errmsg);
   private:
   const std::string& _internal_errmsg() const;
-  void _internal_set_errmsg(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_errmsg(const std::string& value);
   std::string* _internal_mutable_errmsg();
   public:
 
   // int32 errcode = 1;
   void clear_errcode();
-  ::PROTOBUF_NAMESPACE_ID::int32 errcode() const;
-  void set_errcode(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t errcode() const;
+  void set_errcode(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_errcode() const;
-  void _internal_set_errcode(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_errcode() const;
+  void _internal_set_errcode(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:fixbug.ResultCode)
@@ -221,18 +219,22 @@ class ResultCode PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr errmsg_;
-  ::PROTOBUF_NAMESPACE_ID::int32 errcode_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr errmsg_;
+    int32_t errcode_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_friend_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetFriendsListRequest PROTOBUF_FINAL :
+class GetFriendsListRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fixbug.GetFriendsListRequest) */ {
  public:
   inline GetFriendsListRequest() : GetFriendsListRequest(nullptr) {}
-  virtual ~GetFriendsListRequest();
+  ~GetFriendsListRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetFriendsListRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetFriendsListRequest(const GetFriendsListRequest& from);
   GetFriendsListRequest(GetFriendsListRequest&& from) noexcept
@@ -245,8 +247,13 @@ class GetFriendsListRequest PROTOBUF_FINAL :
     return *this;
   }
   inline GetFriendsListRequest& operator=(GetFriendsListRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -257,13 +264,14 @@ class GetFriendsListRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetFriendsListRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetFriendsListRequest& default_instance();
-
   static inline const GetFriendsListRequest* internal_default_instance() {
     return reinterpret_cast<const GetFriendsListRequest*>(
                &_GetFriendsListRequest_default_instance_);
@@ -276,7 +284,12 @@ class GetFriendsListRequest PROTOBUF_FINAL :
   }
   inline void Swap(GetFriendsListRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -284,56 +297,53 @@ class GetFriendsListRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetFriendsListRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetFriendsListRequest* New() const final {
-    return CreateMaybeMessage<GetFriendsListRequest>(nullptr);
-  }
-
-  GetFriendsListRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetFriendsListRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetFriendsListRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetFriendsListRequest& from);
-  void MergeFrom(const GetFriendsListRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetFriendsListRequest& from) {
+    GetFriendsListRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetFriendsListRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "fixbug.GetFriendsListRequest";
   }
   protected:
-  explicit GetFriendsListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetFriendsListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_friend_2eproto);
-    return ::descriptor_table_friend_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -344,11 +354,11 @@ class GetFriendsListRequest PROTOBUF_FINAL :
   };
   // uint32 userid = 1;
   void clear_userid();
-  ::PROTOBUF_NAMESPACE_ID::uint32 userid() const;
-  void set_userid(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t userid() const;
+  void set_userid(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_userid() const;
-  void _internal_set_userid(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_userid() const;
+  void _internal_set_userid(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:fixbug.GetFriendsListRequest)
@@ -358,17 +368,21 @@ class GetFriendsListRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 userid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    uint32_t userid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_friend_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetFriendsListResponse PROTOBUF_FINAL :
+class GetFriendsListResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fixbug.GetFriendsListResponse) */ {
  public:
   inline GetFriendsListResponse() : GetFriendsListResponse(nullptr) {}
-  virtual ~GetFriendsListResponse();
+  ~GetFriendsListResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetFriendsListResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetFriendsListResponse(const GetFriendsListResponse& from);
   GetFriendsListResponse(GetFriendsListResponse&& from) noexcept
@@ -381,8 +395,13 @@ class GetFriendsListResponse PROTOBUF_FINAL :
     return *this;
   }
   inline GetFriendsListResponse& operator=(GetFriendsListResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -393,13 +412,14 @@ class GetFriendsListResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetFriendsListResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetFriendsListResponse& default_instance();
-
   static inline const GetFriendsListResponse* internal_default_instance() {
     return reinterpret_cast<const GetFriendsListResponse*>(
                &_GetFriendsListResponse_default_instance_);
@@ -412,7 +432,12 @@ class GetFriendsListResponse PROTOBUF_FINAL :
   }
   inline void Swap(GetFriendsListResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -420,56 +445,53 @@ class GetFriendsListResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetFriendsListResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetFriendsListResponse* New() const final {
-    return CreateMaybeMessage<GetFriendsListResponse>(nullptr);
-  }
-
-  GetFriendsListResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetFriendsListResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetFriendsListResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetFriendsListResponse& from);
-  void MergeFrom(const GetFriendsListResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetFriendsListResponse& from) {
+    GetFriendsListResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetFriendsListResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "fixbug.GetFriendsListResponse";
   }
   protected:
-  explicit GetFriendsListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetFriendsListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_friend_2eproto);
-    return ::descriptor_table_friend_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -510,7 +532,7 @@ class GetFriendsListResponse PROTOBUF_FINAL :
   public:
   void clear_result();
   const ::fixbug::ResultCode& result() const;
-  ::fixbug::ResultCode* release_result();
+  PROTOBUF_NODISCARD ::fixbug::ResultCode* release_result();
   ::fixbug::ResultCode* mutable_result();
   void set_allocated_result(::fixbug::ResultCode* result);
   private:
@@ -528,9 +550,12 @@ class GetFriendsListResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> friends_;
-  ::fixbug::ResultCode* result_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> friends_;
+    ::fixbug::ResultCode* result_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_friend_2eproto;
 };
 // ===================================================================
@@ -605,73 +630,58 @@ class FiendServiceRpc_Stub : public FiendServiceRpc {
 
 // int32 errcode = 1;
 inline void ResultCode::clear_errcode() {
-  errcode_ = 0;
+  _impl_.errcode_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 ResultCode::_internal_errcode() const {
-  return errcode_;
+inline int32_t ResultCode::_internal_errcode() const {
+  return _impl_.errcode_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 ResultCode::errcode() const {
+inline int32_t ResultCode::errcode() const {
   // @@protoc_insertion_point(field_get:fixbug.ResultCode.errcode)
   return _internal_errcode();
 }
-inline void ResultCode::_internal_set_errcode(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void ResultCode::_internal_set_errcode(int32_t value) {
   
-  errcode_ = value;
+  _impl_.errcode_ = value;
 }
-inline void ResultCode::set_errcode(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void ResultCode::set_errcode(int32_t value) {
   _internal_set_errcode(value);
   // @@protoc_insertion_point(field_set:fixbug.ResultCode.errcode)
 }
 
 // bytes errmsg = 2;
 inline void ResultCode::clear_errmsg() {
-  errmsg_.ClearToEmpty();
+  _impl_.errmsg_.ClearToEmpty();
 }
 inline const std::string& ResultCode::errmsg() const {
   // @@protoc_insertion_point(field_get:fixbug.ResultCode.errmsg)
   return _internal_errmsg();
 }
-inline void ResultCode::set_errmsg(const std::string& value) {
-  _internal_set_errmsg(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResultCode::set_errmsg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.errmsg_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:fixbug.ResultCode.errmsg)
 }
 inline std::string* ResultCode::mutable_errmsg() {
+  std::string* _s = _internal_mutable_errmsg();
   // @@protoc_insertion_point(field_mutable:fixbug.ResultCode.errmsg)
-  return _internal_mutable_errmsg();
+  return _s;
 }
 inline const std::string& ResultCode::_internal_errmsg() const {
-  return errmsg_.Get();
+  return _impl_.errmsg_.Get();
 }
 inline void ResultCode::_internal_set_errmsg(const std::string& value) {
   
-  errmsg_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void ResultCode::set_errmsg(std::string&& value) {
-  
-  errmsg_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:fixbug.ResultCode.errmsg)
-}
-inline void ResultCode::set_errmsg(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  errmsg_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:fixbug.ResultCode.errmsg)
-}
-inline void ResultCode::set_errmsg(const void* value,
-    size_t size) {
-  
-  errmsg_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:fixbug.ResultCode.errmsg)
+  _impl_.errmsg_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ResultCode::_internal_mutable_errmsg() {
   
-  return errmsg_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.errmsg_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ResultCode::release_errmsg() {
   // @@protoc_insertion_point(field_release:fixbug.ResultCode.errmsg)
-  return errmsg_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.errmsg_.Release();
 }
 inline void ResultCode::set_allocated_errmsg(std::string* errmsg) {
   if (errmsg != nullptr) {
@@ -679,8 +689,12 @@ inline void ResultCode::set_allocated_errmsg(std::string* errmsg) {
   } else {
     
   }
-  errmsg_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), errmsg,
-      GetArena());
+  _impl_.errmsg_.SetAllocated(errmsg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.errmsg_.IsDefault()) {
+    _impl_.errmsg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:fixbug.ResultCode.errmsg)
 }
 
@@ -690,20 +704,20 @@ inline void ResultCode::set_allocated_errmsg(std::string* errmsg) {
 
 // uint32 userid = 1;
 inline void GetFriendsListRequest::clear_userid() {
-  userid_ = 0u;
+  _impl_.userid_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 GetFriendsListRequest::_internal_userid() const {
-  return userid_;
+inline uint32_t GetFriendsListRequest::_internal_userid() const {
+  return _impl_.userid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 GetFriendsListRequest::userid() const {
+inline uint32_t GetFriendsListRequest::userid() const {
   // @@protoc_insertion_point(field_get:fixbug.GetFriendsListRequest.userid)
   return _internal_userid();
 }
-inline void GetFriendsListRequest::_internal_set_userid(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void GetFriendsListRequest::_internal_set_userid(uint32_t value) {
   
-  userid_ = value;
+  _impl_.userid_ = value;
 }
-inline void GetFriendsListRequest::set_userid(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void GetFriendsListRequest::set_userid(uint32_t value) {
   _internal_set_userid(value);
   // @@protoc_insertion_point(field_set:fixbug.GetFriendsListRequest.userid)
 }
@@ -714,19 +728,19 @@ inline void GetFriendsListRequest::set_userid(::PROTOBUF_NAMESPACE_ID::uint32 va
 
 // .fixbug.ResultCode result = 1;
 inline bool GetFriendsListResponse::_internal_has_result() const {
-  return this != internal_default_instance() && result_ != nullptr;
+  return this != internal_default_instance() && _impl_.result_ != nullptr;
 }
 inline bool GetFriendsListResponse::has_result() const {
   return _internal_has_result();
 }
 inline void GetFriendsListResponse::clear_result() {
-  if (GetArena() == nullptr && result_ != nullptr) {
-    delete result_;
+  if (GetArenaForAllocation() == nullptr && _impl_.result_ != nullptr) {
+    delete _impl_.result_;
   }
-  result_ = nullptr;
+  _impl_.result_ = nullptr;
 }
 inline const ::fixbug::ResultCode& GetFriendsListResponse::_internal_result() const {
-  const ::fixbug::ResultCode* p = result_;
+  const ::fixbug::ResultCode* p = _impl_.result_;
   return p != nullptr ? *p : reinterpret_cast<const ::fixbug::ResultCode&>(
       ::fixbug::_ResultCode_default_instance_);
 }
@@ -736,10 +750,10 @@ inline const ::fixbug::ResultCode& GetFriendsListResponse::result() const {
 }
 inline void GetFriendsListResponse::unsafe_arena_set_allocated_result(
     ::fixbug::ResultCode* result) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.result_);
   }
-  result_ = result;
+  _impl_.result_ = result;
   if (result) {
     
   } else {
@@ -749,40 +763,47 @@ inline void GetFriendsListResponse::unsafe_arena_set_allocated_result(
 }
 inline ::fixbug::ResultCode* GetFriendsListResponse::release_result() {
   
-  ::fixbug::ResultCode* temp = result_;
-  result_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::fixbug::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::fixbug::ResultCode* GetFriendsListResponse::unsafe_arena_release_result() {
   // @@protoc_insertion_point(field_release:fixbug.GetFriendsListResponse.result)
   
-  ::fixbug::ResultCode* temp = result_;
-  result_ = nullptr;
+  ::fixbug::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
   return temp;
 }
 inline ::fixbug::ResultCode* GetFriendsListResponse::_internal_mutable_result() {
   
-  if (result_ == nullptr) {
-    auto* p = CreateMaybeMessage<::fixbug::ResultCode>(GetArena());
-    result_ = p;
+  if (_impl_.result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fixbug::ResultCode>(GetArenaForAllocation());
+    _impl_.result_ = p;
   }
-  return result_;
+  return _impl_.result_;
 }
 inline ::fixbug::ResultCode* GetFriendsListResponse::mutable_result() {
+  ::fixbug::ResultCode* _msg = _internal_mutable_result();
   // @@protoc_insertion_point(field_mutable:fixbug.GetFriendsListResponse.result)
-  return _internal_mutable_result();
+  return _msg;
 }
 inline void GetFriendsListResponse::set_allocated_result(::fixbug::ResultCode* result) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete result_;
+    delete _impl_.result_;
   }
   if (result) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(result);
     if (message_arena != submessage_arena) {
       result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, result, submessage_arena);
@@ -791,26 +812,27 @@ inline void GetFriendsListResponse::set_allocated_result(::fixbug::ResultCode* r
   } else {
     
   }
-  result_ = result;
+  _impl_.result_ = result;
   // @@protoc_insertion_point(field_set_allocated:fixbug.GetFriendsListResponse.result)
 }
 
 // repeated bytes friends = 2;
 inline int GetFriendsListResponse::_internal_friends_size() const {
-  return friends_.size();
+  return _impl_.friends_.size();
 }
 inline int GetFriendsListResponse::friends_size() const {
   return _internal_friends_size();
 }
 inline void GetFriendsListResponse::clear_friends() {
-  friends_.Clear();
+  _impl_.friends_.Clear();
 }
 inline std::string* GetFriendsListResponse::add_friends() {
+  std::string* _s = _internal_add_friends();
   // @@protoc_insertion_point(field_add_mutable:fixbug.GetFriendsListResponse.friends)
-  return _internal_add_friends();
+  return _s;
 }
 inline const std::string& GetFriendsListResponse::_internal_friends(int index) const {
-  return friends_.Get(index);
+  return _impl_.friends_.Get(index);
 }
 inline const std::string& GetFriendsListResponse::friends(int index) const {
   // @@protoc_insertion_point(field_get:fixbug.GetFriendsListResponse.friends)
@@ -818,55 +840,55 @@ inline const std::string& GetFriendsListResponse::friends(int index) const {
 }
 inline std::string* GetFriendsListResponse::mutable_friends(int index) {
   // @@protoc_insertion_point(field_mutable:fixbug.GetFriendsListResponse.friends)
-  return friends_.Mutable(index);
+  return _impl_.friends_.Mutable(index);
 }
 inline void GetFriendsListResponse::set_friends(int index, const std::string& value) {
+  _impl_.friends_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:fixbug.GetFriendsListResponse.friends)
-  friends_.Mutable(index)->assign(value);
 }
 inline void GetFriendsListResponse::set_friends(int index, std::string&& value) {
+  _impl_.friends_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:fixbug.GetFriendsListResponse.friends)
-  friends_.Mutable(index)->assign(std::move(value));
 }
 inline void GetFriendsListResponse::set_friends(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  friends_.Mutable(index)->assign(value);
+  _impl_.friends_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:fixbug.GetFriendsListResponse.friends)
 }
 inline void GetFriendsListResponse::set_friends(int index, const void* value, size_t size) {
-  friends_.Mutable(index)->assign(
+  _impl_.friends_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:fixbug.GetFriendsListResponse.friends)
 }
 inline std::string* GetFriendsListResponse::_internal_add_friends() {
-  return friends_.Add();
+  return _impl_.friends_.Add();
 }
 inline void GetFriendsListResponse::add_friends(const std::string& value) {
-  friends_.Add()->assign(value);
+  _impl_.friends_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:fixbug.GetFriendsListResponse.friends)
 }
 inline void GetFriendsListResponse::add_friends(std::string&& value) {
-  friends_.Add(std::move(value));
+  _impl_.friends_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:fixbug.GetFriendsListResponse.friends)
 }
 inline void GetFriendsListResponse::add_friends(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  friends_.Add()->assign(value);
+  _impl_.friends_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:fixbug.GetFriendsListResponse.friends)
 }
 inline void GetFriendsListResponse::add_friends(const void* value, size_t size) {
-  friends_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.friends_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:fixbug.GetFriendsListResponse.friends)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 GetFriendsListResponse::friends() const {
   // @@protoc_insertion_point(field_list:fixbug.GetFriendsListResponse.friends)
-  return friends_;
+  return _impl_.friends_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 GetFriendsListResponse::mutable_friends() {
   // @@protoc_insertion_point(field_mutable_list:fixbug.GetFriendsListResponse.friends)
-  return &friends_;
+  return &_impl_.friends_;
 }
 
 #ifdef __GNUC__
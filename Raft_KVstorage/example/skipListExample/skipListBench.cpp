@@ -0,0 +1,106 @@
+//
+// 跳表 + 点查哈希索引 的性能对比
+// 分别在 关闭/开启 哈希索引 的情况下跑几种读写组合，输出 ops/s
+//
+
+#include <unistd.h>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "skipList.h"
+
+void ShowArgsHelp();
+
+struct Workload {
+  std::string name;
+  int getPercent;   // 点查比例
+  int scanPercent;  // 范围扫描比例，剩下的是写（insert_set_element）
+  int scanLength;
+};
+
+std::string makeKey(int i) {
+  // 定长key，保证字典序和数字序一致，方便构造范围扫描
+  char buf[32];
+  snprintf(buf, sizeof(buf), "key%010d", i);
+  return buf;
+}
+
+double runWorkload(SkipList<std::string, std::string> &skipList, const Workload &w, int keyNum, int opNum) {
+  std::mt19937 gen(12345);
+  std::uniform_int_distribution<> keyDis(0, keyNum - 1);
+  std::uniform_int_distribution<> opDis(0, 99);
+  std::vector<std::pair<std::string, std::string>> scanResult;
+  std::string value;
+  long found = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < opNum; i++) {
+    int op = opDis(gen);
+    int k = keyDis(gen);
+    if (op < w.getPercent) {
+      found += skipList.search_element(makeKey(k), value);
+    } else if (op < w.getPercent + w.scanPercent) {
+      scanResult.clear();
+      found += skipList.scan_element(makeKey(k), makeKey(k + w.scanLength), w.scanLength, scanResult);
+    } else {
+      std::string key = makeKey(k);
+      value = std::to_string(i);
+      skipList.insert_set_element(key, value);
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  double seconds = std::chrono::duration<double>(end - start).count();
+  if (found < 0) {
+    std::cout << found << std::endl;  // 防止编译器把查询优化掉
+  }
+  return opNum / seconds;
+}
+
+int main(int argc, char **argv) {
+  int keyNum = 200000;
+  int opNum = 1000000;
+  int maxLevel = 18;
+  int c = 0;
+  while ((c = getopt(argc, argv, "k:o:l:")) != -1) {
+    switch (c) {
+      case 'k':
+        keyNum = atoi(optarg);
+        break;
+      case 'o':
+        opNum = atoi(optarg);
+        break;
+      case 'l':
+        maxLevel = atoi(optarg);
+        break;
+      default:
+        ShowArgsHelp();
+        exit(EXIT_FAILURE);
+    }
+  }
+
+  std::vector<Workload> workloads = {
+      {"point 100% get", 100, 0, 0},
+      {"point 95% get / 5% put", 95, 0, 0},
+      {"scan 95% scan(10) / 5% put", 0, 95, 10},
+      {"mixed 50% get / 45% scan(10) / 5% put", 50, 45, 10},
+  };
+
+  std::cout << "keys:" << keyNum << " ops:" << opNum << " maxLevel:" << maxLevel << std::endl;
+  for (bool useIndex : {false, true}) {
+    SkipList<std::string, std::string> skipList(maxLevel);
+    skipList.enable_hash_index(useIndex);
+    for (int i = 0; i < keyNum; i++) {
+      skipList.insert_element(makeKey(i), std::to_string(i));
+    }
+    for (const auto &w : workloads) {
+      double opsPerSec = runWorkload(skipList, w, keyNum, opNum);
+      std::cout << (useIndex ? "[hashIndex on ] " : "[hashIndex off] ") << w.name << " : " << (long)opsPerSec
+                << " ops/s" << std::endl;
+    }
+  }
+  return 0;
+}
+
+void ShowArgsHelp() { std::cout << "format: command [-k <keyNum>] [-o <opNum>] [-l <maxLevel>]" << std::endl; }
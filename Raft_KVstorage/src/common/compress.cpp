@@ -0,0 +1,58 @@
+#include "compress.h"
+#include <zlib.h>
+#include <atomic>
+#include "config.h"
+#include "util.h"
+
+namespace {
+std::atomic<bool> g_compressEnabled{COMPRESS_DEFAULT_ENABLED};
+// zlib（deflate）的最大压缩比约为1032:1，声称的原始长度超过这个倍数的数据一定是坏的
+const uint64_t kMaxDeflateRatio = 1032;
+}  // namespace
+
+bool Compress(CompressType type, const std::string &in, std::string *out) {
+  if (type != kCompressZlib) {
+    return false;
+  }
+  out->clear();
+  putVarint(out, in.size());
+  size_t headerLen = out->size();
+  uLongf bound = compressBound(in.size());
+  out->resize(headerLen + bound);
+  // 复制日志在关键路径上，用最快的压缩级别
+  int rc = compress2(reinterpret_cast<Bytef *>(&(*out)[headerLen]), &bound,
+                     reinterpret_cast<const Bytef *>(in.data()), in.size(), Z_BEST_SPEED);
+  if (rc != Z_OK || headerLen + bound >= in.size()) {
+    return false;
+  }
+  out->resize(headerLen + bound);
+  return true;
+}
+
+bool Decompress(CompressType type, const std::string &in, std::string *out) {
+  if (type != kCompressZlib) {
+    return false;
+  }
+  size_t pos = 0;
+  uint64_t rawSize = 0;
+  if (!getVarint(in, &pos, &rawSize)) {
+    return false;
+  }
+  // rawSize来自网络或文件，先检查再分配，坏数据不能让进程因为分配失败而退出
+  if (rawSize > COMPRESS_MAX_RAW_BYTES || rawSize > (in.size() - pos) * kMaxDeflateRatio + 64) {
+    return false;
+  }
+  out->resize(rawSize);
+  uLongf destLen = rawSize;
+  int rc = uncompress(reinterpret_cast<Bytef *>(out->data()), &destLen,
+                      reinterpret_cast<const Bytef *>(in.data() + pos), in.size() - pos);
+  return rc == Z_OK && destLen == rawSize;
+}
+
+void SetCompressEnabled(bool enabled) { g_compressEnabled = enabled; }
+
+void SetCompressEnabledFromConfig(const std::string &value) {
+  SetCompressEnabled(value.empty() ? COMPRESS_DEFAULT_ENABLED : value != "0");
+}
+
+bool CompressEnabled() { return g_compressEnabled; }
@@ -0,0 +1,136 @@
+#ifndef COMPLETIONRING_H
+#define COMPLETIONRING_H
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+
+/**
+ * \brief 按raftIndex定位的完成槽位环，替代 waitApplyCh 中每个请求 new 一个 LockQueue 的做法。
+ * 槽位预先分配好，raftIndex & mask 直接定位，rpc handler 在槽位上登记后用 futex 睡眠等待，
+ * apply 线程填入结果后唤醒，全程不需要全局锁、堆分配和哈希表操作。
+ * 两个同时在等待的 raftIndex 落到同一个槽位时，后来者 Acquire 失败，由调用方让客户端向同一节点重试（ErrTimeout）。
+ * 每个槽位同一时刻只有一个等待者，Acquire/Wait 必须成对在同一个线程中调用。
+ */
+template <typename T>
+class CompletionRing {
+ public:
+  explicit CompletionRing(size_t capacity);
+
+  // 登记等待index，槽位被其他index占用时返回false
+  bool Acquire(int64_t index);
+  // 等待index完成，超时返回false；返回后槽位已经释放
+  bool Wait(int64_t index, int timeoutMs, T *value);
+  // apply时调用：如果有请求在等index就把结果交给它并唤醒，没有返回false
+  bool Complete(int64_t index, const T &value);
+
+ private:
+  enum State : uint32_t {
+    kEmpty = 0,
+    kClaiming = 1,  // 正在登记，tag还没写好
+    kWaiting = 2,
+    kFilling = 3,   // apply线程正在写入结果
+    kDone = 4,
+  };
+
+  // 独占cache line，避免相邻槽位的等待者和apply线程互相干扰
+  struct alignas(64) Slot {
+    std::atomic<uint32_t> state{kEmpty};
+    std::atomic<int64_t> tag{-1};
+    T value;
+  };
+
+  Slot &slotOf(int64_t index) { return m_slots[static_cast<size_t>(index) & m_mask]; }
+
+  static void futexWait(std::atomic<uint32_t> *addr, uint32_t expected, const timespec *timeout) {
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(addr), FUTEX_WAIT_PRIVATE, expected, timeout, nullptr, 0);
+  }
+  static void futexWake(std::atomic<uint32_t> *addr) {
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(addr), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+  }
+
+ private:
+  std::unique_ptr<Slot[]> m_slots;
+  size_t m_mask;
+};
+
+template <typename T>
+CompletionRing<T>::CompletionRing(size_t capacity) {
+  size_t cap = 1;
+  while (cap < capacity) {
+    cap <<= 1;
+  }
+  m_slots.reset(new Slot[cap]);
+  m_mask = cap - 1;
+}
+
+template <typename T>
+bool CompletionRing<T>::Acquire(int64_t index) {
+  Slot &slot = slotOf(index);
+  uint32_t expected = kEmpty;
+  if (!slot.state.compare_exchange_strong(expected, kClaiming, std::memory_order_acquire)) {
+    return false;
+  }
+  slot.tag.store(index, std::memory_order_relaxed);
+  slot.state.store(kWaiting, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+bool CompletionRing<T>::Wait(int64_t index, int timeoutMs, T *value) {
+  Slot &slot = slotOf(index);
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+  while (true) {
+    uint32_t state = slot.state.load(std::memory_order_acquire);
+    if (state == kDone) {
+      *value = std::move(slot.value);
+      slot.tag.store(-1, std::memory_order_relaxed);
+      slot.state.store(kEmpty, std::memory_order_release);
+      return true;
+    }
+    if (state == kFilling) {
+      // apply线程已经拿到了槽位，马上就会写完
+      futexWait(&slot.state, kFilling, nullptr);
+      continue;
+    }
+    auto left = deadline - std::chrono::steady_clock::now();
+    if (left <= std::chrono::nanoseconds(0)) {
+      uint32_t expected = kWaiting;
+      if (slot.state.compare_exchange_strong(expected, kEmpty, std::memory_order_acq_rel)) {
+        return false;
+      }
+      continue;  // 超时的同时被填入了结果，等它写完
+    }
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(left).count();
+    timespec ts{static_cast<time_t>(ns / 1000000000), static_cast<long>(ns % 1000000000)};
+    futexWait(&slot.state, kWaiting, &ts);
+  }
+}
+
+template <typename T>
+bool CompletionRing<T>::Complete(int64_t index, const T &value) {
+  Slot &slot = slotOf(index);
+  uint32_t expected = kWaiting;
+  if (slot.tag.load(std::memory_order_relaxed) != index ||
+      !slot.state.compare_exchange_strong(expected, kFilling, std::memory_order_acquire)) {
+    return false;
+  }
+  if (slot.tag.load(std::memory_order_relaxed) != index) {
+    // CAS之前槽位被释放并由另一个index重新登记了，还回去
+    slot.state.store(kWaiting, std::memory_order_release);
+    futexWake(&slot.state);
+    return false;
+  }
+  slot.value = value;
+  slot.state.store(kDone, std::memory_order_release);
+  futexWake(&slot.state);
+  return true;
+}
+
+#endif  // COMPLETIONRING_H
@@ -0,0 +1,34 @@
+//
+// 数据压缩：rpc的请求/响应，以及持久化的raft状态和快照共用
+//
+
+#ifndef COMPRESS_H
+#define COMPRESS_H
+
+#include <cstdint>
+#include <string>
+
+// 压缩算法的编号会写进rpc头和持久化文件，只能追加，不能修改
+enum CompressType : uint32_t {
+  kCompressNone = 0,
+  kCompressZlib = 1,
+};
+
+// 本进程能解压的算法（按位），rpc协商时告诉对方
+const uint32_t kSupportedCompressMask = 1u << kCompressZlib;
+
+/**
+ * 压缩in，输出格式为 varint原始长度 + 压缩数据
+ * @return 压缩失败或者压缩后没有变小时返回false，调用方应该发送/保存原始数据
+ */
+bool Compress(CompressType type, const std::string &in, std::string *out);
+// 解压Compress的输出，数据损坏时返回false
+bool Decompress(CompressType type, const std::string &in, std::string *out);
+
+// 进程级开关：是否压缩发出的rpc和持久化的数据（解压总是支持的），启动时按配置文件中的 compress=0/1 设置
+void SetCompressEnabled(bool enabled);
+// 按配置项的值设置开关：没有配置时用COMPRESS_DEFAULT_ENABLED，"0"关闭，其他值开启
+void SetCompressEnabledFromConfig(const std::string &value);
+bool CompressEnabled();
+
+#endif  // COMPRESS_H
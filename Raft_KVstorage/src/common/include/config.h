@@ -16,9 +16,71 @@ const int maxRandomizedElectionTime = 500 * debugMul;  // ms
 
 const int CONSENSUS_TIMEOUT = 500 * debugMul;  // ms
 
+// 选举前先预投票，与网络断开又恢复的节点不会带着增大的term打断正常的leader；可在节点配置文件中用 preVote=0/1 覆盖
+const bool RAFT_PRE_VOTE_DEFAULT = true;
+// leader在一个最小选举超时内没有收到多数节点的回复就主动退位；可在节点配置文件中用 checkQuorum=0/1 覆盖
+const bool RAFT_CHECK_QUORUM_DEFAULT = true;
+// leader转移的超时时间：超时后放弃转移，重新接受写请求
+const int RAFT_TRANSFER_LEADER_TIMEOUT = minRandomizedElectionTime;  // ms
+
+// 新日志的复制合并窗口：距上一轮复制超过这个时间的新日志立即发送，否则最多等这么久再和后续日志一起发
+const int RAFT_REPLICATE_MAX_DELAY_US = 500 * debugMul;  // us
+// 攒够这么多条新日志时不再等待窗口结束，直接发送
+const int RAFT_REPLICATE_MAX_BATCH = 64;
+
+// 每个AE最多携带的日志条数和字节数（超过字节数时也至少带一条），落后很多的follower分批追赶，不会构造出巨大的消息
+const int RAFT_MAX_APPEND_ENTRIES = 1024;
+const int RAFT_MAX_APPEND_BYTES = 1024 * 1024;
+// 每个follower已发出、还没有收到回复的AE最多这么多个、这么多字节，满了之后只发心跳，等回复腾出窗口
+const int RAFT_MAX_INFLIGHT_MSGS = 16;
+const int RAFT_MAX_INFLIGHT_BYTES = 8 * 1024 * 1024;
+// 每个follower一个AE发送线程，排队（含正在发送）的AE最多这么多个：在途窗口加上试探和心跳，满了就跳过这一次
+const int RAFT_APPEND_QUEUE_SIZE = RAFT_MAX_INFLIGHT_MSGS + 2;
+
+// kv存储相关设置
+
+// 跳表之外是否额外维护点查哈希索引（Get由O(log n)变为O(1)），可在节点配置文件中用 node{i}hashIndex=0/1 按节点覆盖
+const bool KV_HASH_INDEX_DEFAULT = false;
+
+// 状态机分片数：key按哈希分到不同分片，每个分片独立的跳表和锁
+const int KV_SHARD_NUM = 8;
+// 每次从applyChan最多取出多少条消息一起apply
+const int KV_APPLY_BATCH_SIZE = 256;
+// 一批中待执行的写操作不少于这个数时才多线程并行apply各分片，少量操作开线程得不偿失
+const int KV_APPLY_PARALLEL_THRESHOLD = 64;
+// 等待apply结果的槽位数（按raftIndex取模），同时在等待的请求的raftIndex恰好相差它的整数倍时后来者会失败重试
+const int KV_WAIT_SLOT_NUM = 4096;
+// 客户端会话超过这么久没有任何请求/续期就会被淘汰，时间以日志中的时间戳为准
+const int KV_SESSION_TTL = 60 * 1000 * debugMul;  // ms
+// clerk对已注册会话的续期间隔，需要明显小于KV_SESSION_TTL
+const int CLERK_KEEPALIVE_INTERVAL = KV_SESSION_TTL / 4;  // ms
+
+// multi-raft相关设置
+
+// 同一对节点之间各raft组的纯心跳最多攒这么久再合并成一个rpc发送，需要远小于选举超时
+const int MULTI_RAFT_HEARTBEAT_BATCH_INTERVAL = 5 * debugMul;  // ms
+
+// 压缩相关设置
+
+// 是否压缩rpc请求/响应（对方支持时）以及持久化的raft状态和快照，可在节点配置文件中用 compress=0/1 覆盖
+const bool COMPRESS_DEFAULT_ENABLED = false;
+// 小于这个字节数的数据不压缩，压缩的收益抵不上开销
+const int COMPRESS_MIN_BYTES = 256;
+// 解压后的大小上限，长度是从网络或文件里读出来的，超过的当作数据损坏，不按它分配内存
+const unsigned long long COMPRESS_MAX_RAW_BYTES = 1024ULL * 1024 * 1024;
+
+// 持久化相关设置
+
+// 每次持久化之后是否fdatasync落盘；在调度协程里调用时由io_uring或阻塞IO线程池执行，不会卡住调度线程
+const bool PERSIST_SYNC = false;
+
 // 协程相关设置
 
 const int FIBER_THREAD_NUM = 1;              // 协程库中线程池大小
 const bool FIBER_USE_CALLER_THREAD = false;  // 是否使用caller_thread执行调度任务
+const bool FIBER_USE_IO_URING = false;       // hook的socket IO是否走io_uring（内核不支持时自动退回epoll）
+const int FIBER_EPOLL_SHARD = 0;             // 0：所有调度线程共用一个epoll；1：每个线程一个epoll，fd轮流分配；2：fd分给fd最少的线程
+// 选举定时器到期时是否把调度器的统计（各线程计数、调度延迟分布）打到日志里，排查心跳延迟用
+const bool FIBER_METRICS_ON_ELECTION = false;
 
 #endif  // CONFIG_H
@@ -0,0 +1,87 @@
+#ifndef SERIALEXECUTOR_H
+#define SERIALEXECUTOR_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * \brief 一个后台线程按提交顺序依次执行任务，队列有界。
+ * 发往同一个节点的阻塞rpc交给同一个SerialExecutor，请求按提交顺序发出、回复也按这个顺序处理，
+ * 不用每个rpc单独起一个线程。排队和正在执行的任务数达到capacity时TrySubmit返回false，由调用方跳过或稍后再发。
+ * 析构时只通知线程退出、不等待：正在执行的任务（可能阻塞在rpc上）结束后线程自行退出，还没执行的任务被丢弃。
+ */
+class SerialExecutor {
+ public:
+  explicit SerialExecutor(size_t capacity) : m_state(std::make_shared<State>()) {
+    m_state->capacity = capacity;
+    std::thread t(&SerialExecutor::loop, m_state);
+    t.detach();
+  }
+
+  ~SerialExecutor() {
+    std::lock_guard<std::mutex> lg(m_state->mtx);
+    m_state->stop = true;
+    m_state->tasks.clear();
+    m_state->cv.notify_one();
+  }
+
+  SerialExecutor(const SerialExecutor &) = delete;
+  SerialExecutor &operator=(const SerialExecutor &) = delete;
+
+  // 队列满了返回false，任务不会执行
+  bool TrySubmit(std::function<void()> task) {
+    std::lock_guard<std::mutex> lg(m_state->mtx);
+    if (m_state->stop || m_state->tasks.size() + (m_state->running ? 1 : 0) >= m_state->capacity) {
+      return false;
+    }
+    m_state->tasks.push_back(std::move(task));
+    m_state->cv.notify_one();
+    return true;
+  }
+
+  // 排队和正在执行的任务数
+  size_t Pending() const {
+    std::lock_guard<std::mutex> lg(m_state->mtx);
+    return m_state->tasks.size() + (m_state->running ? 1 : 0);
+  }
+
+  size_t Capacity() const { return m_state->capacity; }
+
+ private:
+  // 线程和SerialExecutor各持有一份，析构后线程仍可以安全地访问
+  struct State {
+    mutable std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<std::function<void()>> tasks;
+    size_t capacity = 1;
+    bool running = false;
+    bool stop = false;
+  };
+
+  static void loop(std::shared_ptr<State> state) {
+    std::unique_lock<std::mutex> lock(state->mtx);
+    while (true) {
+      state->cv.wait(lock, [&state]() { return state->stop || !state->tasks.empty(); });
+      if (state->stop) {
+        return;
+      }
+      std::function<void()> task = std::move(state->tasks.front());
+      state->tasks.pop_front();
+      state->running = true;
+      lock.unlock();
+      task();
+      task = nullptr;  // 任务持有的资源在解锁状态下释放
+      lock.lock();
+      state->running = false;
+    }
+  }
+
+  std::shared_ptr<State> m_state;
+};
+
+#endif  // SERIALEXECUTOR_H
@@ -9,6 +9,7 @@
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/serialization/access.hpp>
 #include <condition_variable>  // pthread_condition_t
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <mutex>  // pthread_mutex_t
@@ -16,6 +17,7 @@
 #include <random>
 #include <sstream>
 #include <thread>
+#include <vector>
 #include "config.h"
 
 template <class F>
@@ -105,6 +107,18 @@ class LockQueue {
     return true;
   }
 
+  // 阻塞直到至少有一个元素，然后一次性取走队列中的元素（最多maxNum个），减少加锁和唤醒的次数
+  void PopBatch(std::vector<T>* out, size_t maxNum) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_queue.empty()) {
+      m_condvariable.wait(lock);
+    }
+    while (!m_queue.empty() && out->size() < maxNum) {
+      out->push_back(std::move(m_queue.front()));
+      m_queue.pop();
+    }
+  }
+
  private:
   std::queue<T> m_queue;
   std::mutex m_mutex;
@@ -120,59 +134,142 @@ class LockQueue {
 // lock()、unlock()、try_lock() 等方法手动控制锁的状态。当然，std::unique_lock 也支持 RAII
 // 技术，即在对象被销毁时会自动解锁。另外， std::unique_lock 还支持超时等待和可中断等待的操作。
 
+////////////////////////////////////varint编码，Op和快照中的会话表等紧凑二进制格式共用
+
+inline void putVarint(std::string* out, uint64_t v) {
+  while (v >= 0x80) {
+    out->push_back(static_cast<char>(v | 0x80));
+    v >>= 7;
+  }
+  out->push_back(static_cast<char>(v));
+}
+
+inline bool getVarint(const std::string& in, size_t* pos, uint64_t* v) {
+  *v = 0;
+  for (int shift = 0; shift < 64 && *pos < in.size(); shift += 7) {
+    uint8_t byte = static_cast<uint8_t>(in[(*pos)++]);
+    *v |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// 长度前缀 + 内容
+inline void putLengthPrefixed(std::string* out, const std::string& str) {
+  putVarint(out, str.size());
+  out->append(str);
+}
+
+inline bool getLengthPrefixed(const std::string& in, size_t* pos, std::string* str) {
+  uint64_t len = 0;
+  if (!getVarint(in, pos, &len) || len > in.size() - *pos) {
+    return false;
+  }
+  str->assign(in, *pos, len);
+  *pos += len;
+  return true;
+}
+
+// 64位FNV-1a哈希。结果会写进持久化格式（如快照按分片存放），不能用实现相关的std::hash
+inline uint64_t fnv1aHash(const std::string& str) {
+  uint64_t hash = 14695981039346656037ull;
+  for (unsigned char c : str) {
+    hash ^= c;
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+// Op的操作类型，写进日志时只占一个字节
+enum class OpType : uint8_t {
+  Get = 0,
+  Put = 1,
+  Append = 2,
+  RegisterSession = 3,
+  KeepAlive = 4,
+};
+
+inline const char* opTypeName(OpType type) {
+  switch (type) {
+    case OpType::Get:
+      return "Get";
+    case OpType::Put:
+      return "Put";
+    case OpType::Append:
+      return "Append";
+    case OpType::RegisterSession:
+      return "RegisterSession";
+    case OpType::KeepAlive:
+      return "KeepAlive";
+  }
+  return "Unknown";
+}
+
 // 这个Op是kv传递给raft的command
 class Op {
  public:
   // Your definitions here.
   // Field names must start with capital letters,
   // otherwise RPC will break.
-  std::string Operation;  // "Get" "Put" "Append"
+  OpType Operation = OpType::Get;
   std::string Key;
   std::string Value;
   std::string ClientId;  //客户端号码
-  int RequestId;         //客户端号码请求的Request的序列号，为了保证线性一致性
+  int RequestId = 0;     //客户端号码请求的Request的序列号，为了保证线性一致性
                          // IfDuplicate bool // Duplicate command can't be applied twice , but only for PUT and APPEND
+  int64_t Timestamp = 0;  // leader发起时打的时间戳(ms)，状态机只用它推进会话时钟，保证各副本淘汰会话的结果一致
+  int64_t SessionEpoch = 0;  // Put/Append所属会话的epoch，和会话表中的不一致时不执行
 
  public:
-  // todo
-  //为了协调raftRPC中的command只设置成了string,这个的限制就是正常字符中不能包含|
-  //当然后期可以换成更高级的序列化方法，比如protobuf
-  std::string asString() const {
-    std::stringstream ss;
-    boost::archive::text_oarchive oa(ss);
-
-    // write class instance to archive
-    oa << *this;
-    // close archive
+  // 每条日志都要编码一次、apply时解码一次，因此用手写的二进制格式代替boost的text archive：
+  // [版本 1B][操作类型 1B][RequestId varint][Timestamp varint][SessionEpoch varint][Key][Value][ClientId]，
+  // 字符串均为 长度varint + 内容
+  static const uint8_t kCodecVersion = 2;
 
-    return ss.str();
+  std::string asString() const {
+    std::string out;
+    out.reserve(2 + 5 + 10 + 10 + 3 * 2 + Key.size() + Value.size() + ClientId.size());
+    out.push_back(static_cast<char>(kCodecVersion));
+    out.push_back(static_cast<char>(Operation));
+    putVarint(&out, static_cast<uint32_t>(RequestId));
+    putVarint(&out, static_cast<uint64_t>(Timestamp));
+    putVarint(&out, static_cast<uint64_t>(SessionEpoch));
+    putLengthPrefixed(&out, Key);
+    putLengthPrefixed(&out, Value);
+    putLengthPrefixed(&out, ClientId);
+    return out;
   }
 
-  bool parseFromString(std::string str) {
-    std::stringstream iss(str);
-    boost::archive::text_iarchive ia(iss);
-    // read class state from archive
-    ia >> *this;
-    return true;  // todo : 解析失敗如何處理，要看一下boost庫了
+  bool parseFromString(const std::string& str) {
+    if (str.size() < 2 || static_cast<uint8_t>(str[0]) != kCodecVersion ||
+        static_cast<uint8_t>(str[1]) > static_cast<uint8_t>(OpType::KeepAlive)) {
+      return false;
+    }
+    Operation = static_cast<OpType>(str[1]);
+    size_t pos = 2;
+    uint64_t requestId = 0;
+    uint64_t timestamp = 0;
+    uint64_t sessionEpoch = 0;
+    if (!getVarint(str, &pos, &requestId) || !getVarint(str, &pos, &timestamp) ||
+        !getVarint(str, &pos, &sessionEpoch) || !getLengthPrefixed(str, &pos, &Key) ||
+        !getLengthPrefixed(str, &pos, &Value) || !getLengthPrefixed(str, &pos, &ClientId)) {
+      return false;
+    }
+    RequestId = static_cast<int>(requestId);
+    Timestamp = static_cast<int64_t>(timestamp);
+    SessionEpoch = static_cast<int64_t>(sessionEpoch);
+    return true;
   }
 
  public:
   friend std::ostream& operator<<(std::ostream& os, const Op& obj) {
-    os << "[MyClass:Operation{" + obj.Operation + "},Key{" + obj.Key + "},Value{" + obj.Value + "},ClientId{" +
-              obj.ClientId + "},RequestId{" + std::to_string(obj.RequestId) + "}";  // 在这里实现自定义的输出格式
+    os << "[MyClass:Operation{" + std::string(opTypeName(obj.Operation)) + "},Key{" + obj.Key + "},Value{" +
+              obj.Value + "},ClientId{" + obj.ClientId + "},RequestId{" + std::to_string(obj.RequestId) +
+              "}";  // 在这里实现自定义的输出格式
     return os;
   }
-
- private:
-  friend class boost::serialization::access;
-  template <class Archive>
-  void serialize(Archive& ar, const unsigned int version) {
-    ar& Operation;
-    ar& Key;
-    ar& Value;
-    ar& ClientId;
-    ar& RequestId;
-  }
 };
 
 ///////////////////////////////////////////////kvserver reply err to clerk
@@ -180,6 +277,13 @@ class Op {
 const std::string OK = "OK";
 const std::string ErrNoKey = "ErrNoKey";
 const std::string ErrWrongLeader = "ErrWrongLeader";
+const std::string ErrSessionExpired = "ErrSessionExpired";          // 会话未注册或已过期，clerk需要重新注册
+const std::string ErrUnknownOp = "ErrUnknownOp";                    // PutAppend的op既不是Put也不是Append
+const std::string ErrInvalidTarget = "ErrInvalidTarget";            // leader转移的目标节点不存在或者就是自己
+const std::string ErrTransferTimeout = "ErrTransferTimeout";        // leader转移超时，已放弃，原leader继续服务
+const std::string ErrConfChangeRejected = "ErrConfChangeRejected";  // 上一次成员变更还没提交，或者变更后没有投票成员
+const std::string ErrStale = "ErrStale";                            // 本地读时本节点落后太多，换节点或者改走leader读
+const std::string ErrTimeout = "ErrTimeout";                        // leader暂时没法等待这条请求的结果，向同一节点重试
 
 ////////////////////////////////////获取可用端口
 
@@ -0,0 +1,85 @@
+#include "blocking_io.hpp"
+#include <errno.h>
+#include "fiber.hpp"
+#include "hook.hpp"
+#include "scheduler.hpp"
+
+namespace monsoon {
+// 交给线程池的一次操作，放在发起协程的栈上，完成之前协程不会恢复
+struct BlockingIoPool::Job {
+  const Task *task = nullptr;
+  ssize_t result = 0;
+  int err = 0;
+  Fiber::ptr fiber;
+  Scheduler *scheduler = nullptr;
+};
+
+BlockingIoPool::BlockingIoPool(size_t threads) : threadCnt_(threads) {}
+
+BlockingIoPool::~BlockingIoPool() {
+  {
+    Mutex::Lock lock(mutex_);
+    stopping_ = true;
+  }
+  for (size_t i = 0; i < threads_.size(); ++i) {
+    jobSem_.notify();
+  }
+  for (auto &thread : threads_) {
+    thread->join();
+  }
+}
+
+ssize_t BlockingIoPool::Run(const Task &task) {
+  // hook只在调度线程上打开，先判断它，普通线程上不会因为Fiber::GetThis()多建一个主协程
+  Scheduler *scheduler = Scheduler::GetThis();
+  if (!is_hook_enable() || scheduler == nullptr || !Fiber::GetThis()->isRunInScheduler()) {
+    return task();
+  }
+  Job job;
+  job.task = &task;
+  job.scheduler = scheduler;
+  job.fiber = Fiber::GetThis();
+  Scheduler::Park(&BlockingIoPool::Post, &job);
+  errno = job.err;
+  return job.result;
+}
+
+void BlockingIoPool::Post(void *arg) {
+  BlockingIoPool *pool = BlockingIoMgr::GetInstance();
+  {
+    Mutex::Lock lock(pool->mutex_);
+    if (pool->threads_.empty()) {
+      for (size_t i = 0; i < pool->threadCnt_; ++i) {
+        pool->threads_.push_back(
+            std::make_shared<Thread>(std::bind(&BlockingIoPool::worker, pool), "blocking_io_" + std::to_string(i)));
+      }
+    }
+    pool->jobs_.push_back(static_cast<Job *>(arg));
+  }
+  pool->jobSem_.notify();
+}
+
+void BlockingIoPool::worker() {
+  while (true) {
+    jobSem_.wait();
+    Job *job = nullptr;
+    {
+      Mutex::Lock lock(mutex_);
+      if (jobs_.empty()) {
+        // 只有析构时才会多出通知
+        if (stopping_) {
+          return;
+        }
+        continue;
+      }
+      job = jobs_.front();
+      jobs_.pop_front();
+    }
+    job->result = (*job->task)();
+    job->err = errno;
+    // 交回调度器之后job所在的栈随时可能被恢复的协程改写，不能再访问
+    Scheduler *scheduler = job->scheduler;
+    scheduler->scheduler(&job->fiber);
+  }
+}
+}  // namespace monsoon
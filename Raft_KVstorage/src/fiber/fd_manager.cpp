@@ -21,87 +21,79 @@ FdCtx::FdCtx(int fd)
 FdCtx::~FdCtx() {}
 
 bool FdCtx::init() {
-  if (m_isInit) {
-    return true;
-  }
-  m_recvTimeout = -1;
-  m_sendTimeout = -1;
+  m_recvTimeout.store(-1, std::memory_order_relaxed);
+  m_sendTimeout.store(-1, std::memory_order_relaxed);
 
   // 获取文件状态信息
   struct stat fd_stat;
-  if (-1 == fstat(m_fd, &fd_stat)) {
-    m_isInit = false;
-    m_isSocket = false;
-  } else {
-    m_isInit = true;
+  bool isInit = false;
+  bool isSocket = false;
+  if (-1 != fstat(m_fd, &fd_stat)) {
+    isInit = true;
     // 判断是否是socket
-    m_isSocket = S_ISSOCK(fd_stat.st_mode);
+    isSocket = S_ISSOCK(fd_stat.st_mode);
   }
 
   // 对socket设置非阻塞
-  if (m_isSocket) {
+  if (isSocket) {
     int flags = fcntl_f(m_fd, F_GETFL, 0);
     if (!(flags & O_NONBLOCK)) {
       fcntl_f(m_fd, F_SETFL, flags | O_NONBLOCK);
     }
-    m_sysNonblock = true;
-  } else {
-    m_sysNonblock = false;
   }
-
-  m_userNonblock = false;
-  m_isClosed = false;
-  return m_isInit;
+  m_isInit.store(isInit, std::memory_order_relaxed);
+  m_isSocket.store(isSocket, std::memory_order_relaxed);
+  m_sysNonblock.store(isSocket, std::memory_order_relaxed);
+  m_userNonblock.store(false, std::memory_order_relaxed);
+  // 最后再标记打开，别的线程看到打开时上面的字段都已经写好
+  m_isClosed.store(false, std::memory_order_release);
+  return isInit;
 }
 
 void FdCtx::setTimeout(int type, uint64_t v) {
   if (type == SO_RCVTIMEO) {
-    m_recvTimeout = v;
+    m_recvTimeout.store(v, std::memory_order_relaxed);
   } else {
-    m_sendTimeout = v;
+    m_sendTimeout.store(v, std::memory_order_relaxed);
   }
 }
 
 uint64_t FdCtx::getTimeout(int type) {
   if (type == SO_RCVTIMEO) {
-    return m_recvTimeout;
+    return m_recvTimeout.load(std::memory_order_relaxed);
   } else {
-    return m_sendTimeout;
+    return m_sendTimeout.load(std::memory_order_relaxed);
   }
 }
 
-FdManager::FdManager() { m_datas.resize(64); }
+FdManager::FdManager() {}
 
-FdCtx::ptr FdManager::get(int fd, bool auto_create) {
+FdCtx *FdManager::get(int fd, bool auto_create) {
   if (fd == -1) {
     return nullptr;
   }
-  RWMutexType::ReadLock lock(m_mutex);
-  if ((int)m_datas.size() <= fd) {
-    if (auto_create == false) {
-      return nullptr;
-    }
-  } else {
-    if (m_datas[fd] || !auto_create) {
-      return m_datas[fd];
-    }
+  FdCtx *ctx = m_datas.get(fd);
+  if (ctx && !ctx->isClose()) {
+    return ctx;
+  }
+  if (!auto_create) {
+    return nullptr;
   }
-  lock.unlock();
 
-  RWMutexType::WriteLock lock2(m_mutex);
-  FdCtx::ptr ctx(new FdCtx(fd));
-  if (fd >= (int)m_datas.size()) {
-    m_datas.resize(fd * 1.5);
+  Mutex::Lock lock(m_mutex);
+  ctx = m_datas.getOrCreate(fd);
+  if (ctx->isClose()) {
+    // 同号的fd关闭过，按新的fd重新初始化；还拿着旧指针的线程读到的是原子字段，不会和这里冲突
+    ctx->init();
   }
-  m_datas[fd] = ctx;
   return ctx;
 }
 
 void FdManager::del(int fd) {
-  RWMutexType::WriteLock lock(m_mutex);
-  if ((int)m_datas.size() <= fd) {
-    return;
+  Mutex::Lock lock(m_mutex);
+  FdCtx *ctx = m_datas.get(fd);
+  if (ctx) {
+    ctx->m_isClosed.store(true, std::memory_order_release);
   }
-  m_datas[fd].reset();
 }
 }  // namespace monsoon
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <assert.h>
 #include <atomic>
 #include "scheduler.hpp"
+#include "stack_allocator.hpp"
 #include "utils.hpp"
 
 namespace monsoon {
@@ -17,11 +18,6 @@ static std::atomic<uint64_t> fiber_count{0};
 // 协议栈默认大小 128k
 static int g_fiber_stack_size = 128 * 1024;
 
-class StackAllocator {
- public:
-  static void *Alloc(size_t size) { return malloc(size); }
-  static void Delete(void *vp, size_t size) { return free(vp); }
-};
 // only for GetThis
 Fiber::Fiber() {
   SetThis(this);
@@ -51,7 +47,8 @@ Fiber::ptr Fiber::GetThis() {
 Fiber::Fiber(std::function<void()> cb, size_t stacksize, bool run_inscheduler)
     : id_(cur_fiber_id++), cb_(cb), isRunInScheduler_(run_inscheduler) {
   ++fiber_count;
-  stackSize_ = stacksize > 0 ? stacksize : g_fiber_stack_size;
+  // 按分级取整后的大小使用整个栈
+  stackSize_ = StackAllocator::RoundUp(stacksize > 0 ? stacksize : g_fiber_stack_size);
   stack_ptr = StackAllocator::Alloc(stackSize_);
   CondPanic(getcontext(&ctx_) == 0, "getcontext error");
   // 初始化协程上下文
@@ -0,0 +1,234 @@
+#include "fiber_sync.hpp"
+#include <sched.h>
+#include "scheduler.hpp"
+
+namespace monsoon {
+// 拿不到资源时挂起之前的自旋次数
+static const int kSpinCount = 100;
+
+// 普通线程阻塞等待用的信号量，跟线程同生命周期，唤醒方notify返回前等待方不会把它销毁
+static Semaphore &ThreadSemaphore() {
+  static thread_local Semaphore sem;
+  return sem;
+}
+
+static void UnlockSpinlock(void *arg) { static_cast<Spinlock *>(arg)->unlock(); }
+
+void FiberWaitQueue::wait(void (*unlock)(void *), void *arg) {
+  Scheduler *scheduler = Scheduler::GetThis();
+  Fiber::ptr cur = Fiber::GetThis();
+  if (scheduler != nullptr && cur->isRunInScheduler()) {
+    waiters_.push_back(FiberWaiter{cur, scheduler, nullptr});
+    cur.reset();
+    // 切回调度协程之后才释放锁，唤醒方拿到锁时协程已经挂起
+    Scheduler::Park(unlock, arg);
+    return;
+  }
+  Semaphore &sem = ThreadSemaphore();
+  waiters_.push_back(FiberWaiter{nullptr, nullptr, &sem});
+  unlock(arg);
+  sem.wait();
+}
+
+void FiberWaitQueue::wait(Spinlock &lock) { wait(&UnlockSpinlock, &lock); }
+
+bool FiberWaitQueue::pop(FiberWaiter *waiter) {
+  if (waiters_.empty()) {
+    return false;
+  }
+  *waiter = std::move(waiters_.front());
+  waiters_.pop_front();
+  return true;
+}
+
+void FiberWaitQueue::Wake(FiberWaiter &waiter) {
+  if (waiter.fiber) {
+    waiter.scheduler->scheduler(&waiter.fiber);
+  } else {
+    waiter.sem->notify();
+  }
+}
+
+static void WakeAll(std::deque<FiberWaiter> &waiters) {
+  for (FiberWaiter &waiter : waiters) {
+    FiberWaitQueue::Wake(waiter);
+  }
+}
+
+void FiberMutex::lock() {
+  // 临界区很短时持有者大概率马上释放，先自旋，比挂起再唤醒便宜
+  for (int i = 0; i < kSpinCount; ++i) {
+    if (tryLock()) {
+      return;
+    }
+  }
+  lockSlow();
+}
+
+bool FiberMutex::tryLock() {
+  uint32_t s = state_.load(std::memory_order_relaxed);
+  while (!(s & kLocked)) {
+    if (state_.compare_exchange_weak(s, s | kLocked, std::memory_order_acquire, std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void FiberMutex::lockQueue() {
+  for (int spins = 0;; ++spins) {
+    uint32_t s = state_.load(std::memory_order_relaxed);
+    if (!(s & kQueueLocked) &&
+        state_.compare_exchange_weak(s, s | kQueueLocked, std::memory_order_acquire, std::memory_order_relaxed)) {
+      return;
+    }
+    if (spins >= 64) {
+      sched_yield();
+      spins = 0;
+    }
+  }
+}
+
+void FiberMutex::UnlockQueue(void *arg) {
+  static_cast<FiberMutex *>(arg)->state_.fetch_and(~kQueueLocked, std::memory_order_release);
+}
+
+void FiberMutex::lockSlow() {
+  while (true) {
+    lockQueue();
+    uint32_t s = state_.load(std::memory_order_relaxed);
+    while (!(s & kLocked)) {
+      // 拿队列锁的时候锁已经放开了，直接抢，顺便放开队列锁
+      if (state_.compare_exchange_weak(s, (s | kLocked) & ~kQueueLocked, std::memory_order_acquire,
+                                       std::memory_order_relaxed)) {
+        return;
+      }
+    }
+    // 先标记有等待者再挂起，unlock看到标记就会来队列里唤醒
+    state_.fetch_or(kWaiters, std::memory_order_relaxed);
+    waiters_.wait(&FiberMutex::UnlockQueue, this);
+    // 被唤醒之后和新来的一起抢锁
+    if (tryLock()) {
+      return;
+    }
+  }
+}
+
+void FiberMutex::unlock() {
+  for (int spins = 0;; ++spins) {
+    uint32_t s = state_.load(std::memory_order_relaxed);
+    if (!(s & kWaiters)) {
+      if (state_.compare_exchange_weak(s, s & ~kLocked, std::memory_order_release, std::memory_order_relaxed)) {
+        return;
+      }
+      continue;
+    }
+    if (!(s & kQueueLocked) &&
+        state_.compare_exchange_weak(s, s | kQueueLocked, std::memory_order_acquire, std::memory_order_relaxed)) {
+      FiberWaiter waiter;
+      bool woken = waiters_.pop(&waiter);
+      // 一次store同时放开互斥锁和队列锁，之后不再访问this
+      state_.store(waiters_.empty() ? 0 : kWaiters, std::memory_order_release);
+      if (woken) {
+        FiberWaitQueue::Wake(waiter);
+      }
+      return;
+    }
+    if (spins >= 64) {
+      sched_yield();
+      spins = 0;
+    }
+  }
+}
+
+void FiberCondVar::wait(FiberMutex &mutex) {
+  waitLock_.lock();
+  // 先进等待队列再放锁，放锁之后的notify不会漏掉
+  mutex.unlock();
+  waiters_.wait(waitLock_);
+  mutex.lock();
+}
+
+void FiberCondVar::notifyOne() {
+  FiberWaiter waiter;
+  bool woken = false;
+  {
+    Spinlock::Lock lock(waitLock_);
+    woken = waiters_.pop(&waiter);
+  }
+  if (woken) {
+    FiberWaitQueue::Wake(waiter);
+  }
+}
+
+void FiberCondVar::notifyAll() {
+  std::deque<FiberWaiter> waiters;
+  {
+    Spinlock::Lock lock(waitLock_);
+    waiters_.popAll(&waiters);
+  }
+  WakeAll(waiters);
+}
+
+bool FiberSemaphore::tryWait() {
+  uint32_t count = count_.load(std::memory_order_relaxed);
+  while (count > 0) {
+    if (count_.compare_exchange_weak(count, count - 1, std::memory_order_acquire)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void FiberSemaphore::wait() {
+  for (int i = 0; i < kSpinCount; ++i) {
+    if (tryWait()) {
+      return;
+    }
+  }
+  waitLock_.lock();
+  if (tryWait()) {
+    waitLock_.unlock();
+    return;
+  }
+  // 被唤醒时notify已经把计数直接交给了自己
+  waiters_.wait(waitLock_);
+}
+
+void FiberSemaphore::notify() {
+  FiberWaiter waiter;
+  bool woken = false;
+  {
+    Spinlock::Lock lock(waitLock_);
+    woken = waiters_.pop(&waiter);
+    if (!woken) {
+      count_.fetch_add(1, std::memory_order_release);
+    }
+  }
+  if (woken) {
+    FiberWaitQueue::Wake(waiter);
+  }
+}
+
+void WaitGroup::add(int64_t n) {
+  std::deque<FiberWaiter> waiters;
+  {
+    Spinlock::Lock lock(waitLock_);
+    count_ += n;
+    CondPanic(count_ >= 0, "WaitGroup count < 0");
+    if (count_ == 0) {
+      waiters_.popAll(&waiters);
+    }
+  }
+  WakeAll(waiters);
+}
+
+void WaitGroup::wait() {
+  waitLock_.lock();
+  if (count_ == 0) {
+    waitLock_.unlock();
+    return;
+  }
+  waiters_.wait(waitLock_);
+}
+}  // namespace monsoon
@@ -2,6 +2,7 @@
 #include <dlfcn.h>
 #include <cstdarg>
 #include <string>
+#include "blocking_io.hpp"
 #include "fd_manager.hpp"
 #include "fiber.hpp"
 #include "iomanager.hpp"
@@ -27,6 +28,10 @@ static int g_tcp_connect_timeout = 5000;
   XX(send)           \
   XX(sendto)         \
   XX(sendmsg)        \
+  XX(pread)          \
+  XX(pwrite)         \
+  XX(fsync)          \
+  XX(fdatasync)      \
   XX(close)          \
   XX(fcntl)          \
   XX(ioctl)          \
@@ -70,7 +75,7 @@ static ssize_t do_io(int fd, OriginFun fun, const char *hook_fun_name, uint32_t
     return fun(fd, std::forward<Args>(args)...);
   }
   // 为当前文件描述符创建上下文ctx
-  FdCtx::ptr ctx = FdMgr::GetInstance()->get(fd);
+  FdCtx *ctx = FdMgr::GetInstance()->get(fd);
   if (!ctx) {
     return fun(fd, std::forward<Args>(args)...);
   }
@@ -113,7 +118,7 @@ retry:
           winfo);
     }
 
-    int rt = iom->addEvent(fd, (Event)(event));
+    int rt = iom->waitEvent(fd, (Event)(event));
     if (rt) {
       std::cout << hook_fun_name << " addEvent(" << fd << ", " << event << ")";
       if (timer) {
@@ -121,7 +126,6 @@ retry:
       }
       return -1;
     } else {
-      Fiber::GetThis()->yield();
       if (timer) {
         timer->cancel();
       }
@@ -136,6 +140,78 @@ retry:
   return n;
 }
 
+/**
+ * io_uring后端：把IO直接作为SQE提交，内核完成时恢复协程，不用先试一次、等就绪、再调一次系统调用。
+ * prep只填操作相关的字段，fd由这里填。返回false表示这次不能走io_uring（没启用、当前线程还没有ring、
+ * fd不是hook管理的阻塞socket等），调用方继续走原来的epoll流程。
+ * timeout_so为0时（connect）用timeout_ms作超时
+ */
+template <typename Prep>
+static bool uring_io(int fd, int timeout_so, Prep prep, ssize_t *result, uint64_t timeout_ms = -1) {
+  if (!t_hook_enable) {
+    return false;
+  }
+  IOManager *iom = IOManager::GetThis();
+  if (!iom || !iom->isUseIoUring()) {
+    return false;
+  }
+  FdCtx *ctx = FdMgr::GetInstance()->get(fd);
+  if (!ctx || ctx->isClose() || !ctx->isSocket() || ctx->getUserNonblock()) {
+    return false;
+  }
+  io_uring_sqe *sqe = iom->getSqe();
+  if (!sqe) {
+    return false;
+  }
+  prep(sqe);
+  sqe->fd = fd;
+  if (timeout_so) {
+    timeout_ms = ctx->getTimeout(timeout_so);
+  }
+  ctx->addInflightIo(1);
+  int res = iom->submitIo(sqe, timeout_ms);
+  ctx->addInflightIo(-1);
+  if (res < 0) {
+    errno = -res;
+    *result = -1;
+  } else {
+    *result = res;
+  }
+  return true;
+}
+
+/**
+ * 普通文件的IO：当前线程有io_uring时提交给它（内核在自己的工作线程里做阻塞的部分），
+ * 否则交给阻塞IO线程池，调用的协程挂起直到完成，调度线程不会被磁盘IO卡住。
+ * hook没开时直接在当前线程执行
+ */
+template <typename Prep, typename Fun>
+static ssize_t file_io(int fd, Prep prep, Fun fun) {
+  if (!t_hook_enable) {
+    return fun();
+  }
+  IOManager *iom = IOManager::GetThis();
+  io_uring_sqe *sqe = iom && iom->isUseIoUring() ? iom->getSqe() : nullptr;
+  if (!sqe) {
+    return BlockingIoPool::Run(fun);
+  }
+  prep(sqe);
+  sqe->fd = fd;
+  int res = iom->submitIo(sqe);
+  if (res < 0) {
+    errno = -res;
+    return -1;
+  }
+  return res;
+}
+
+static void prep_rw(io_uring_sqe *sqe, uint8_t opcode, const void *addr, uint32_t len, uint64_t off) {
+  sqe->opcode = opcode;
+  sqe->addr = reinterpret_cast<uint64_t>(addr);
+  sqe->len = len;
+  sqe->off = off;
+}
+
 extern "C" {
 #define XX(name) name##_fun name##_f = nullptr;
 HOOK_FUN(XX);
@@ -214,7 +290,7 @@ int connect_with_timeout(int fd, const struct sockaddr *addr, socklen_t addrlen,
   if (!t_hook_enable) {
     return connect_f(fd, addr, addrlen);
   }
-  FdCtx::ptr ctx = FdMgr::GetInstance()->get(fd);
+  FdCtx *ctx = FdMgr::GetInstance()->get(fd);
   if (!ctx || ctx->isClose()) {
     errno = EBADF;
     return -1;
@@ -229,6 +305,12 @@ int connect_with_timeout(int fd, const struct sockaddr *addr, socklen_t addrlen,
     return connect_f(fd, addr, addrlen);
   }
 
+  ssize_t res = 0;
+  if (uring_io(
+          fd, 0, [&](io_uring_sqe *sqe) { prep_rw(sqe, IORING_OP_CONNECT, addr, 0, addrlen); }, &res, timeout_ms)) {
+    return res;
+  }
+
   // 系统调用connect(fd为非阻塞)
   int n = connect_f(fd, addr, addrlen);
   if (n == 0) {
@@ -259,10 +341,9 @@ int connect_with_timeout(int fd, const struct sockaddr *addr, socklen_t addrlen,
         winfo);
   }
 
-  // 添加WRITE事件，并yield,等待WRITE事件触发再往下执行
-  int rt = iom->addEvent(fd, WRITE);
+  // 添加WRITE事件并挂起，等待WRITE事件触发再往下执行
+  int rt = iom->waitEvent(fd, WRITE);
   if (rt == 0) {
-    Fiber::GetThis()->yield();
     // 等待超时or套接字可写，协程返回
     if (timer) {
       timer->cancel();
@@ -299,20 +380,52 @@ int connect(int sockfd, const struct sockaddr *addr, socklen_t addrlen) {
 }
 
 int accept(int s, struct sockaddr *addr, socklen_t *addrlen) {
-  int fd = do_io(s, accept_f, "accept", READ, SO_RCVTIMEO, addr, addrlen);
+  ssize_t res = 0;
+  int fd = 0;
+  if (uring_io(
+          s, SO_RCVTIMEO,
+          [&](io_uring_sqe *sqe) { prep_rw(sqe, IORING_OP_ACCEPT, addr, 0, reinterpret_cast<uint64_t>(addrlen)); },
+          &res)) {
+    fd = res;
+  } else {
+    fd = do_io(s, accept_f, "accept", READ, SO_RCVTIMEO, addr, addrlen);
+  }
   if (fd >= 0) {
     FdMgr::GetInstance()->get(fd, true);
   }
   return fd;
 }
 
-ssize_t read(int fd, void *buf, size_t count) { return do_io(fd, read_f, "read", READ, SO_RCVTIMEO, buf, count); }
+ssize_t read(int fd, void *buf, size_t count) {
+  ssize_t res = 0;
+  // socket上的偏移量没有意义，-1表示用文件当前位置
+  if (uring_io(
+          fd, SO_RCVTIMEO, [&](io_uring_sqe *sqe) { prep_rw(sqe, IORING_OP_READ, buf, count, -1); }, &res)) {
+    return res;
+  }
+  return do_io(fd, read_f, "read", READ, SO_RCVTIMEO, buf, count);
+}
 
 ssize_t readv(int fd, const struct iovec *iov, int iovcnt) {
+  ssize_t res = 0;
+  if (uring_io(
+          fd, SO_RCVTIMEO, [&](io_uring_sqe *sqe) { prep_rw(sqe, IORING_OP_READV, iov, iovcnt, -1); }, &res)) {
+    return res;
+  }
   return do_io(fd, readv_f, "readv", READ, SO_RCVTIMEO, iov, iovcnt);
 }
 
 ssize_t recv(int sockfd, void *buf, size_t len, int flags) {
+  ssize_t res = 0;
+  if (uring_io(
+          sockfd, SO_RCVTIMEO,
+          [&](io_uring_sqe *sqe) {
+            prep_rw(sqe, IORING_OP_RECV, buf, len, 0);
+            sqe->msg_flags = flags;
+          },
+          &res)) {
+    return res;
+  }
   return do_io(sockfd, recv_f, "recv", READ, SO_RCVTIMEO, buf, len, flags);
 }
 
@@ -321,18 +434,48 @@ ssize_t recvfrom(int sockfd, void *buf, size_t len, int flags, struct sockaddr *
 }
 
 ssize_t recvmsg(int sockfd, struct msghdr *msg, int flags) {
+  ssize_t res = 0;
+  if (uring_io(
+          sockfd, SO_RCVTIMEO,
+          [&](io_uring_sqe *sqe) {
+            prep_rw(sqe, IORING_OP_RECVMSG, msg, 1, 0);
+            sqe->msg_flags = flags;
+          },
+          &res)) {
+    return res;
+  }
   return do_io(sockfd, recvmsg_f, "recvmsg", READ, SO_RCVTIMEO, msg, flags);
 }
 
 ssize_t write(int fd, const void *buf, size_t count) {
+  ssize_t res = 0;
+  if (uring_io(
+          fd, SO_SNDTIMEO, [&](io_uring_sqe *sqe) { prep_rw(sqe, IORING_OP_WRITE, buf, count, -1); }, &res)) {
+    return res;
+  }
   return do_io(fd, write_f, "write", WRITE, SO_SNDTIMEO, buf, count);
 }
 
 ssize_t writev(int fd, const struct iovec *iov, int iovcnt) {
+  ssize_t res = 0;
+  if (uring_io(
+          fd, SO_SNDTIMEO, [&](io_uring_sqe *sqe) { prep_rw(sqe, IORING_OP_WRITEV, iov, iovcnt, -1); }, &res)) {
+    return res;
+  }
   return do_io(fd, writev_f, "writev", WRITE, SO_SNDTIMEO, iov, iovcnt);
 }
 
 ssize_t send(int s, const void *msg, size_t len, int flags) {
+  ssize_t res = 0;
+  if (uring_io(
+          s, SO_SNDTIMEO,
+          [&](io_uring_sqe *sqe) {
+            prep_rw(sqe, IORING_OP_SEND, msg, len, 0);
+            sqe->msg_flags = flags;
+          },
+          &res)) {
+    return res;
+  }
   return do_io(s, send_f, "send", WRITE, SO_SNDTIMEO, msg, len, flags);
 }
 
@@ -341,20 +484,61 @@ ssize_t sendto(int s, const void *msg, size_t len, int flags, const struct socka
 }
 
 ssize_t sendmsg(int s, const struct msghdr *msg, int flags) {
+  ssize_t res = 0;
+  if (uring_io(
+          s, SO_SNDTIMEO,
+          [&](io_uring_sqe *sqe) {
+            prep_rw(sqe, IORING_OP_SENDMSG, msg, 1, 0);
+            sqe->msg_flags = flags;
+          },
+          &res)) {
+    return res;
+  }
   return do_io(s, sendmsg_f, "sendmsg", WRITE, SO_SNDTIMEO, msg, flags);
 }
 
+ssize_t pread(int fd, void *buf, size_t count, off_t offset) {
+  return file_io(
+      fd, [&](io_uring_sqe *sqe) { prep_rw(sqe, IORING_OP_READ, buf, count, offset); },
+      [&]() { return pread_f(fd, buf, count, offset); });
+}
+
+ssize_t pwrite(int fd, const void *buf, size_t count, off_t offset) {
+  return file_io(
+      fd, [&](io_uring_sqe *sqe) { prep_rw(sqe, IORING_OP_WRITE, buf, count, offset); },
+      [&]() { return pwrite_f(fd, buf, count, offset); });
+}
+
+int fsync(int fd) {
+  return file_io(
+      fd, [&](io_uring_sqe *sqe) { sqe->opcode = IORING_OP_FSYNC; }, [&]() { return (ssize_t)fsync_f(fd); });
+}
+
+int fdatasync(int fd) {
+  return file_io(
+      fd,
+      [&](io_uring_sqe *sqe) {
+        sqe->opcode = IORING_OP_FSYNC;
+        sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+      },
+      [&]() { return (ssize_t)fdatasync_f(fd); });
+}
+
 int close(int fd) {
   if (!t_hook_enable) {
     return close_f(fd);
   }
 
-  FdCtx::ptr ctx = FdMgr::GetInstance()->get(fd);
+  FdCtx *ctx = FdMgr::GetInstance()->get(fd);
   if (ctx) {
     auto iom = IOManager::GetThis();
     if (iom) {
       iom->cancelAll(fd);
     }
+    // 提交到io_uring的操作持有文件的引用，close之后也不会结束，先shutdown让它们马上返回（读到EOF或者出错）
+    if (ctx->hasInflightIo()) {
+      shutdown(fd, SHUT_RDWR);
+    }
     FdMgr::GetInstance()->del(fd);
   }
   return close_f(fd);
@@ -366,7 +550,7 @@ int fcntl(int fd, int cmd, ... /* arg */) {
     case F_SETFL: {
       int arg = va_arg(va, int);
       va_end(va);
-      FdCtx::ptr ctx = FdMgr::GetInstance()->get(fd);
+      FdCtx *ctx = FdMgr::GetInstance()->get(fd);
       if (!ctx || ctx->isClose() || !ctx->isSocket()) {
         return fcntl_f(fd, cmd, arg);
       }
@@ -381,7 +565,7 @@ int fcntl(int fd, int cmd, ... /* arg */) {
     case F_GETFL: {
       va_end(va);
       int arg = fcntl_f(fd, cmd);
-      FdCtx::ptr ctx = FdMgr::GetInstance()->get(fd);
+      FdCtx *ctx = FdMgr::GetInstance()->get(fd);
       if (!ctx || ctx->isClose() || !ctx->isSocket()) {
         return arg;
       }
@@ -444,7 +628,7 @@ int ioctl(int d, unsigned long int request, ...) {
 
   if (FIONBIO == request) {
     bool user_nonblock = !!*(int *)arg;
-    FdCtx::ptr ctx = FdMgr::GetInstance()->get(d);
+    FdCtx *ctx = FdMgr::GetInstance()->get(d);
     if (!ctx || ctx->isClose() || !ctx->isSocket()) {
       return ioctl_f(d, request, arg);
     }
@@ -463,7 +647,7 @@ int setsockopt(int sockfd, int level, int optname, const void *optval, socklen_t
   }
   if (level == SOL_SOCKET) {
     if (optname == SO_RCVTIMEO || optname == SO_SNDTIMEO) {
-      FdCtx::ptr ctx = FdMgr::GetInstance()->get(sockfd);
+      FdCtx *ctx = FdMgr::GetInstance()->get(sockfd);
       if (ctx) {
         const timeval *v = (const timeval *)optval;
         ctx->setTimeout(optname, v->tv_sec * 1000 + v->tv_usec / 1000);
@@ -0,0 +1,50 @@
+#ifndef __MONSOON_BLOCKING_IO_H__
+#define __MONSOON_BLOCKING_IO_H__
+
+#include <sys/types.h>
+#include <deque>
+#include <functional>
+#include <vector>
+#include "mutex.hpp"
+#include "noncopyable.hpp"
+#include "singleton.hpp"
+#include "thread.hpp"
+
+namespace monsoon {
+/**
+ * 阻塞IO线程池
+ * 普通文件没有“就绪”的概念，epoll帮不上忙，pread/pwrite/fsync在磁盘慢的时候会把整个调度线程卡住。
+ * 调度器里的协程通过Run把操作交给这里的线程执行并挂起自己，执行完由线程池把协程交回原来的调度器。
+ * hook的pread/pwrite/fsync/fdatasync在没有io_uring时走这里，其他阻塞操作（比如ftruncate）可以显式调用Run
+ */
+class BlockingIoPool : Nonecopyable {
+ public:
+  typedef std::function<ssize_t()> Task;
+
+  explicit BlockingIoPool(size_t threads = 4);
+  ~BlockingIoPool();
+
+  // 执行task并返回它的返回值，返回后errno是task刚执行完时的errno。
+  // 在调度器的协程里调用时交给线程池执行、当前协程挂起直到完成；否则直接在当前线程执行
+  static ssize_t Run(const Task &task);
+
+ private:
+  struct Job;
+  // 协程切出去之后再把任务放进队列
+  static void Post(void *arg);
+  void worker();
+
+  Mutex mutex_;
+  std::deque<Job *> jobs_;
+  // 队列里的任务数
+  Semaphore jobSem_;
+  // 第一次有任务时才创建线程
+  size_t threadCnt_;
+  std::vector<Thread::ptr> threads_;
+  bool stopping_ = false;
+};
+
+typedef Singleton<BlockingIoPool> BlockingIoMgr;
+}  // namespace monsoon
+
+#endif
@@ -1,76 +1,85 @@
 #ifndef __FD_MANAGER_H__
 #define __FD_MANAGER_H__
 
-#include <memory>
-#include <vector>
+#include <atomic>
+#include "fd_table.hpp"
 #include "mutex.hpp"
 #include "singleton.hpp"
 #include "thread.hpp"
 
 namespace monsoon {
 // 文件句柄上下文，管理文件句柄类型，阻塞，关闭，读写超时
-class FdCtx : public std::enable_shared_from_this<FdCtx> {
- public:
-  typedef std::shared_ptr<FdCtx> ptr;
+// 每个fd号一个，关闭后不释放，之后同号的fd重新初始化后复用。
+// 查找不加锁，重新初始化时别的线程可能还在读旧fd的状态，所以字段都是原子的（relaxed即可，发布靠m_isClosed）
+class FdCtx {
+  friend class FdManager;
 
+ public:
   FdCtx(int fd);
   ~FdCtx();
   // 是否完成初始化
-  bool isInit() const { return m_isInit; }
+  bool isInit() const { return m_isInit.load(std::memory_order_relaxed); }
   // 是否是socket
-  bool isSocket() const { return m_isSocket; }
+  bool isSocket() const { return m_isSocket.load(std::memory_order_relaxed); }
   // 是否已经关闭
-  bool isClose() const { return m_isClosed; }
+  bool isClose() const { return m_isClosed.load(std::memory_order_acquire); }
   // 用户主动设置非阻塞
-  void setUserNonblock(bool v) { m_userNonblock = v; }
+  void setUserNonblock(bool v) { m_userNonblock.store(v, std::memory_order_relaxed); }
   // 用户是否主动设置了非阻塞
-  bool getUserNonblock() const { return m_userNonblock; }
+  bool getUserNonblock() const { return m_userNonblock.load(std::memory_order_relaxed); }
   // 设置系统非阻塞
-  void setSysNonblock(bool v) { m_sysNonblock = v; }
+  void setSysNonblock(bool v) { m_sysNonblock.store(v, std::memory_order_relaxed); }
   // 获取系统是否非阻塞
-  bool getSysNonblock() const { return m_sysNonblock; }
+  bool getSysNonblock() const { return m_sysNonblock.load(std::memory_order_relaxed); }
   // 设置超时时间
   void setTimeout(int type, uint64_t v);
   uint64_t getTimeout(int type);
+  // 登记/注销一个提交到io_uring还没完成的操作
+  void addInflightIo(int n) { m_inflightIo.fetch_add(n, std::memory_order_relaxed); }
+  // 是否有提交到io_uring还没完成的操作
+  bool hasInflightIo() const { return m_inflightIo.load(std::memory_order_relaxed) > 0; }
 
  private:
+  // 按fd当前的状态初始化，重新打开同号的fd时再调用一次
   bool init();
 
  private:
   /// 是否初始化
-  bool m_isInit : 1;
+  std::atomic<bool> m_isInit;
   /// 是否socket
-  bool m_isSocket : 1;
+  std::atomic<bool> m_isSocket;
   /// 是否hook非阻塞
-  bool m_sysNonblock : 1;
+  std::atomic<bool> m_sysNonblock;
   /// 是否用户主动设置非阻塞
-  bool m_userNonblock : 1;
-  /// 是否关闭
-  bool m_isClosed : 1;
+  std::atomic<bool> m_userNonblock;
+  /// 是否关闭，查找时先acquire读它
+  std::atomic<bool> m_isClosed;
   /// 文件句柄
   int m_fd;
   /// 读超时时间毫秒
-  uint64_t m_recvTimeout;
+  std::atomic<uint64_t> m_recvTimeout;
   /// 写超时时间毫秒
-  uint64_t m_sendTimeout;
+  std::atomic<uint64_t> m_sendTimeout;
+  /// 提交到io_uring还没完成的操作数，可能跨过关闭和重新打开，init不清零
+  std::atomic<int> m_inflightIo = {0};
 };
 // 文件句柄管理
+// hook的每次IO都要查一次，查找走无锁的FdTable，只有创建和删除加锁
 class FdManager {
  public:
-  typedef RWMutex RWMutexType;
-
   FdManager();
-  // 获取/创建文件句柄类
+  // 获取/创建文件句柄类，fd没有打开（没有创建或者已经删除）时返回nullptr
   // auto_create 是否自动创建
-  FdCtx::ptr get(int fd, bool auto_create = false);
+  // 返回的指针一直有效，fd关闭之后可能指向同号的新fd
+  FdCtx *get(int fd, bool auto_create = false);
   // 删除文件句柄
   void del(int fd);
 
  private:
-  /// 读写锁
-  RWMutexType m_mutex;
+  /// 创建和删除的锁
+  Mutex m_mutex;
   /// 文件句柄集合
-  std::vector<FdCtx::ptr> m_datas;
+  FdTable<FdCtx> m_datas;
 };
 
 /// 文件句柄单例
@@ -0,0 +1,94 @@
+#ifndef __MONSOON_FD_TABLE_H__
+#define __MONSOON_FD_TABLE_H__
+
+#include <atomic>
+#include "noncopyable.hpp"
+#include "utils.hpp"
+
+namespace monsoon {
+/**
+ * 按fd下标的两级无锁表，只增不删
+ * 一级是定长的块指针数组，二级块第一次用到时分配；块和装进槽里的对象在表析构之前都不会移动或释放，
+ * 拿到的指针一直有效。查找是两次load，不加锁；装入用CAS，多个线程同时装同一个位置时只有一个成功，
+ * 其余的删掉自己创建的对象，改用已经装入的。
+ * fd关闭时对象不删，由使用方标记，之后同号的fd复用它
+ */
+template <class T>
+class FdTable : Nonecopyable {
+ public:
+  static const int kBlockBits = 10;
+  static const int kBlockSize = 1 << kBlockBits;
+  static const int kBlockCount = 1024;
+  // 能放下的fd上限，和Linux默认的nr_open（1048576）一致
+  static const int kMaxFd = kBlockSize * kBlockCount;
+
+  FdTable() {
+    for (auto &block : blocks_) {
+      block.store(nullptr, std::memory_order_relaxed);
+    }
+  }
+  ~FdTable() {
+    for (auto &block : blocks_) {
+      std::atomic<T *> *slots = block.load(std::memory_order_relaxed);
+      if (slots == nullptr) {
+        continue;
+      }
+      for (int i = 0; i < kBlockSize; ++i) {
+        delete slots[i].load(std::memory_order_relaxed);
+      }
+      delete[] slots;
+    }
+  }
+
+  // fd上的对象，还没有创建时返回nullptr
+  T *get(int fd) const {
+    if (fd < 0 || fd >= kMaxFd) {
+      return nullptr;
+    }
+    std::atomic<T *> *slots = blocks_[fd >> kBlockBits].load(std::memory_order_acquire);
+    if (slots == nullptr) {
+      return nullptr;
+    }
+    return slots[fd & (kBlockSize - 1)].load(std::memory_order_acquire);
+  }
+
+  // fd上的对象，还没有时用new T(fd)创建并装入
+  T *getOrCreate(int fd) {
+    T *obj = get(fd);
+    if (obj != nullptr) {
+      return obj;
+    }
+    CondPanic(fd >= 0 && fd < kMaxFd, "fd out of range");
+    std::atomic<T *> &slot = block(fd >> kBlockBits)[fd & (kBlockSize - 1)];
+    T *created = new T(fd);
+    if (!slot.compare_exchange_strong(obj, created, std::memory_order_acq_rel, std::memory_order_acquire)) {
+      // 别的线程先装上了
+      delete created;
+      return obj;
+    }
+    return created;
+  }
+
+ private:
+  // 第i个二级块，没有时分配
+  std::atomic<T *> *block(int i) {
+    std::atomic<T *> *slots = blocks_[i].load(std::memory_order_acquire);
+    if (slots != nullptr) {
+      return slots;
+    }
+    std::atomic<T *> *created = new std::atomic<T *>[kBlockSize];
+    for (int j = 0; j < kBlockSize; ++j) {
+      created[j].store(nullptr, std::memory_order_relaxed);
+    }
+    if (!blocks_[i].compare_exchange_strong(slots, created, std::memory_order_acq_rel, std::memory_order_acquire)) {
+      delete[] created;
+      return slots;
+    }
+    return created;
+  }
+
+  std::atomic<std::atomic<T *> *> blocks_[kBlockCount];
+};
+}  // namespace monsoon
+
+#endif
@@ -41,6 +41,8 @@ class Fiber : public std::enable_shared_from_this<Fiber> {
   uint64_t getId() const { return id_; }
   // 获取协程状态
   State getState() const { return state_; }
+  // 是否参与调度器调度（yield后回到调度协程）
+  bool isRunInScheduler() const { return isRunInScheduler_; }
 
   // 设置当前正在运行的协程
   static void SetThis(Fiber *f);
@@ -69,7 +71,7 @@ class Fiber : public std::enable_shared_from_this<Fiber> {
   // 协程回调函数
   std::function<void()> cb_;
   // 本协程是否参与调度器调度
-  bool isRunInScheduler_;
+  bool isRunInScheduler_ = false;
 };
 }  // namespace monsoon
 
@@ -0,0 +1,111 @@
+#ifndef __MONSOON_FIBER_SYNC_H__
+#define __MONSOON_FIBER_SYNC_H__
+
+#include <stdint.h>
+#include <atomic>
+#include <deque>
+#include "fiber.hpp"
+#include "mutex.hpp"
+#include "noncopyable.hpp"
+
+namespace monsoon {
+class Scheduler;
+
+/**
+ * 协程级同步原语
+ * mutex.hpp里的锁基于pthread，协程在上面阻塞时整个调度线程都被阻塞，线程上其他协程也跟着不能执行。
+ * 这里的原语在拿不到资源时先短暂自旋，还拿不到就把当前协程挂进等待队列、让出调度线程，
+ * 被唤醒时由唤醒方把协程重新交给调度器（锁和信号量直接转交给被唤醒的协程）。
+ * 不在调度器协程里调用时（比如普通线程）退化为阻塞线程，协程和普通线程可以混用同一个对象
+ */
+
+// 等待者：调度器里的协程，或者阻塞等待的普通线程
+struct FiberWaiter {
+  Fiber::ptr fiber;
+  Scheduler *scheduler = nullptr;
+  Semaphore *sem = nullptr;
+};
+
+// 等待队列，本身不加锁，由使用者的锁保护
+class FiberWaitQueue {
+ public:
+  // 进入时持有锁，挂起（或阻塞）之后调用unlock(arg)释放锁，被唤醒后返回
+  void wait(void (*unlock)(void *), void *arg);
+  void wait(Spinlock &lock);
+  // 取出一个等待者，在释放锁之后再调用Wake唤醒，唤醒之后不再访问同步对象，被唤醒方可以马上销毁它
+  bool pop(FiberWaiter *waiter);
+  void popAll(std::deque<FiberWaiter> *waiters) { waiters->swap(waiters_); }
+  bool empty() const { return waiters_.empty(); }
+
+  static void Wake(FiberWaiter &waiter);
+
+ private:
+  std::deque<FiberWaiter> waiters_;
+};
+
+// 等不到锁时挂起协程的互斥锁，不保证公平：被唤醒的协程和新来的协程一起抢锁
+class FiberMutex : Nonecopyable {
+ public:
+  typedef ScopedLockImpl<FiberMutex> Lock;
+
+  void lock();
+  bool tryLock();
+  void unlock();
+
+ private:
+  // state_的各位：
+  static const uint32_t kLocked = 1;       // 已加锁
+  static const uint32_t kWaiters = 2;      // 等待队列非空
+  static const uint32_t kQueueLocked = 4;  // 等待队列被锁住（代替单独的自旋锁）
+  // 队列锁和互斥锁放在同一个字里，unlock用一次store同时释放，之后不再访问this
+  void lockQueue();
+  static void UnlockQueue(void *arg);
+  void lockSlow();
+
+  std::atomic<uint32_t> state_ = {0};
+  FiberWaitQueue waiters_;
+};
+
+class FiberCondVar : Nonecopyable {
+ public:
+  // 调用前需要持有mutex（可以是FiberMutex::Lock持有的），返回时重新持有
+  void wait(FiberMutex &mutex);
+  void notifyOne();
+  void notifyAll();
+
+ private:
+  Spinlock waitLock_;
+  FiberWaitQueue waiters_;
+};
+
+// 计数信号量，notify在有等待者时直接把计数交给它
+class FiberSemaphore : Nonecopyable {
+ public:
+  explicit FiberSemaphore(uint32_t count = 0) : count_(count) {}
+
+  void wait();
+  bool tryWait();
+  void notify();
+
+ private:
+  std::atomic<uint32_t> count_;
+  Spinlock waitLock_;
+  FiberWaitQueue waiters_;
+};
+
+// 等待一组任务完成：add(n)登记，每个任务结束时done()，wait()等到计数归零
+class WaitGroup : Nonecopyable {
+ public:
+  void add(int64_t n = 1);
+  void done() { add(-1); }
+  void wait();
+
+ private:
+  // 计数只在锁内修改，wait看到归零时done已经放开了锁，返回后可以马上销毁WaitGroup
+  int64_t count_ = 0;
+  Spinlock waitLock_;
+  FiberWaitQueue waiters_;
+};
+}  // namespace monsoon
+
+#endif
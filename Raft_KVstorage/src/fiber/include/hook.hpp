@@ -72,6 +72,19 @@ extern sendto_fun sendto_f;
 typedef ssize_t (*sendmsg_fun)(int s, const struct msghdr *msg, int flags);
 extern sendmsg_fun sendmsg_f;
 
+// file
+typedef ssize_t (*pread_fun)(int fd, void *buf, size_t count, off_t offset);
+extern pread_fun pread_f;
+
+typedef ssize_t (*pwrite_fun)(int fd, const void *buf, size_t count, off_t offset);
+extern pwrite_fun pwrite_f;
+
+typedef int (*fsync_fun)(int fd);
+extern fsync_fun fsync_f;
+
+typedef int (*fdatasync_fun)(int fd);
+extern fdatasync_fun fdatasync_f;
+
 typedef int (*close_fun)(int fd);
 extern close_fun close_f;
 
@@ -0,0 +1,79 @@
+#ifndef __MONSOON_IO_URING_H__
+#define __MONSOON_IO_URING_H__
+
+#include <linux/io_uring.h>
+#include <stdint.h>
+#include <atomic>
+#include "noncopyable.hpp"
+
+namespace monsoon {
+/**
+ * io_uring的最小封装，直接用io_uring_setup/io_uring_enter系统调用和mmap出来的共享队列，不依赖liburing。
+ * 只由创建它的线程使用，不加锁：
+ *   - getSqe()取出SQE填好之后并不马上提交，攒到submit()时一次io_uring_enter全部交给内核
+ *   - reap()遍历已完成的CQE，不需要系统调用
+ */
+class IoUring : Nonecopyable {
+ public:
+  IoUring() = default;
+  ~IoUring();
+
+  // 创建ring，内核不支持io_uring或者不支持带超时的等待（IORING_FEAT_EXT_ARG，5.11以上）时返回false
+  bool init(unsigned entries);
+  // 取一个空闲的SQE（已清零），SQ满了返回nullptr
+  io_uring_sqe *getSqe();
+  // SQ里还能取出的SQE数
+  unsigned sqSpace() const;
+  // 已经填好但还没有交给内核的SQE数
+  unsigned pending() const { return sqeTail_ - sqeHead_; }
+  // 提交所有填好的SQE，wait_nr > 0时同时等待CQE，最多等timeout_ms毫秒（小于0为一直等）
+  // 返回-1表示io_uring_enter出错，超时和被信号打断不算出错
+  int submit(unsigned wait_nr = 0, int timeout_ms = -1);
+  // 依次对已完成的CQE调用fn，返回处理的个数
+  template <typename Fn>
+  unsigned reap(Fn &&fn) {
+    unsigned head = *cqHead_;
+    unsigned tail = __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE);
+    unsigned n = 0;
+    while (head != tail) {
+      io_uring_cqe cqe = cqes_[head & cqMask_];
+      ++head;
+      ++n;
+      // 先把CQE还给内核再处理，处理函数里可能会再提交
+      __atomic_store_n(cqHead_, head, __ATOMIC_RELEASE);
+      fn(cqe);
+    }
+    return n;
+  }
+  // 调用io_uring_enter的次数
+  uint64_t enterCount() const { return enterCnt_.load(std::memory_order_relaxed); }
+
+ private:
+  int ringFd_ = -1;
+  // 映射出来的队列内存
+  void *sqRing_ = nullptr;
+  size_t sqRingSize_ = 0;
+  void *cqRing_ = nullptr;
+  size_t cqRingSize_ = 0;
+  io_uring_sqe *sqes_ = nullptr;
+  size_t sqesSize_ = 0;
+  // SQ
+  unsigned *sqHead_ = nullptr;
+  unsigned *sqTail_ = nullptr;
+  unsigned *sqArray_ = nullptr;
+  unsigned sqMask_ = 0;
+  unsigned sqEntries_ = 0;
+  // 本地的SQ位置：[sqeHead_, sqeTail_)是取出了但还没写进内核队列尾的SQE
+  unsigned sqeHead_ = 0;
+  unsigned sqeTail_ = 0;
+  // CQ
+  unsigned *cqHead_ = nullptr;
+  unsigned *cqTail_ = nullptr;
+  io_uring_cqe *cqes_ = nullptr;
+  unsigned cqMask_ = 0;
+  // 统计用，其他线程也会读
+  std::atomic<uint64_t> enterCnt_ = {0};
+};
+}  // namespace monsoon
+
+#endif
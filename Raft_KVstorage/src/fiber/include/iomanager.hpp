@@ -2,6 +2,8 @@
 #define __SYLAR_IOMANAGER_H__
 
 #include "fcntl.h"
+#include "fd_table.hpp"
+#include "io_uring.hpp"
 #include "scheduler.hpp"
 #include "string.h"
 #include "sys/epoll.h"
@@ -14,6 +16,16 @@ enum Event {
   WRITE = 0x4,
 };
 
+// 多个调度线程时fd的就绪事件在哪里等待
+enum class EpollShard {
+  // 所有调度线程共用一个epoll，就绪事件可能交给任意一个线程
+  SHARED = 0,
+  // 每个调度线程一个epoll，fd第一次注册事件时轮流分给各线程
+  ROUND_ROBIN = 1,
+  // 每个调度线程一个epoll，fd第一次注册事件时分给当前fd最少的线程
+  LEAST_LOADED = 2,
+};
+
 struct EventContext {
   Scheduler *scheduler = nullptr;
   Fiber::ptr fiber;
@@ -24,6 +36,7 @@ class FdContext {
   friend class IOManager;
 
  public:
+  explicit FdContext(int fd) : fd(fd) {}
   // 获取事件上下文
   EventContext &getEveContext(Event event);
   // 重置事件上下文
@@ -36,17 +49,33 @@ class FdContext {
   EventContext write;
   int fd = 0;
   Event events = NONE;
+  // 分片模式下负责这个fd的调度线程（worker下标），-1为还没分配；关闭fd时释放
+  int owner = -1;
   Mutex mutex;
 };
 
+/**
+ * IO协程调度器
+ * 默认用epoll（边缘触发）等待fd就绪。use_io_uring=true时每个调度线程再建一个io_uring：
+ * hook的socket读写、accept、connect直接作为SQE提交，内核完成时恢复协程，不用先等就绪再调一次系统调用；
+ * SQE先攒着，本线程没有别的可运行任务、攒够一批或者进入idle时一次io_uring_enter提交。
+ * epoll fd本身也挂在ring上（IORING_OP_POLL_ADD），addEvent注册的事件和tickle照常工作。
+ * 内核不支持io_uring时自动退回epoll。
+ * shard不为SHARED时每个调度线程有自己的epoll，fd第一次addEvent时分给一个线程，之后它的就绪事件只在这个线程上处理，
+ * 唤醒的协程也进这个线程的本地队列，同一个连接的IO不会在线程之间来回跳
+ */
 class IOManager : public Scheduler, public TimerManager {
  public:
   typedef std::shared_ptr<IOManager> ptr;
 
-  IOManager(size_t threads = 1, bool use_caller = true, const std::string &name = "IOManager");
+  IOManager(size_t threads = 1, bool use_caller = true, const std::string &name = "IOManager",
+            bool use_io_uring = false, EpollShard shard = EpollShard::SHARED);
   ~IOManager();
   // 添加事件
   int addEvent(int fd, Event event, std::function<void()> cb = nullptr);
+  // 在fd上等待事件：挂起当前协程，事件就绪或者被取消后返回0，注册失败返回-1。
+  // 协程完整切出去之后才注册事件，别的线程收到事件时不会去恢复一个还没切走的协程
+  int waitEvent(int fd, Event event);
   // 删除事件
   bool delEvent(int fd, Event event);
   // 取消事件
@@ -55,6 +84,23 @@ class IOManager : public Scheduler, public TimerManager {
   bool cancelAll(int fd);
   static IOManager *GetThis();
 
+  // 是否在用io_uring（要求了但内核不支持时为false）
+  bool isUseIoUring() const { return useIoUring_; }
+  EpollShard getEpollShard() const { return shard_; }
+  // 分片模式下fd所属的调度线程（worker下标），没有分配或者不是分片模式返回-1
+  int getFdOwner(int fd);
+  // 取当前线程ring上的一个SQE，当前线程不能提交io_uring（没启用、不在调度协程里、线程还没有ring）时返回nullptr
+  io_uring_sqe *getSqe();
+  // 提交getSqe()取出并填好的SQE，挂起当前协程直到完成，返回CQE的结果（出错为-errno）。
+  // timeout_ms不为-1时超时取消操作，返回-ETIMEDOUT
+  int submitIo(io_uring_sqe *sqe, uint64_t timeout_ms = -1);
+  // 所有调度线程调用io_uring_enter的总次数
+  uint64_t ringEnterCount();
+  // 唤醒空闲线程（写eventfd）的总次数
+  uint64_t wakeupCount() const { return wakeupCnt_.load(std::memory_order_relaxed); }
+  // 分片模式下各调度线程分到的fd数
+  std::vector<size_t> fdCountPerThread();
+
  protected:
   // 通知调度器有任务要调度
   void tickle() override;
@@ -65,16 +111,65 @@ class IOManager : public Scheduler, public TimerManager {
   // 判断是否可以停止，同时获取最近一个定时超时时间
   bool stopping(uint64_t &timeout);
 
-  void OnTimerInsertedAtFront() override;
-  void contextResize(size_t size);
+  void tickleThread(int thread) override;
+  void OnTimerInsertedAtFront(int thread) override;
 
  private:
+  // 每个调度线程一份的等待状态：等哪个epoll、怎么唤醒它、io_uring模式下的ring
+  struct Poller;
+  // 当前线程的poller，线程第一次进入idle时认领
+  static thread_local Poller *t_poller;
+  // 当前线程的poller，只在它已经建好ring时返回
+  Poller *currentRing();
+  // 认领当前线程的poller，io_uring模式下创建ring，内核不支持时整个IOManager退回epoll
+  void attachPoller();
+  // 把ring上已完成的操作交给调度器，返回epoll fd是否有就绪事件
+  bool reapRing(Poller *ring);
+  // idle里代替epoll_wait：提交SQE并等待ring上的完成事件，返回取到的epoll就绪事件数
+  int waitRing(Poller *ring, epoll_event *events, int max_events, int timeout_ms);
+  // 挂起的协程切出去之后提交SQE
+  static void FlushRing(void *arg);
+  // 事件就绪时执行cb，cb为空时调度fiber
+  int registerEvent(int fd, Event event, std::function<void()> cb, Fiber::ptr fiber);
+  // waitEvent挂起的协程切出去之后注册事件
+  static void ArmEvent(void *arg);
+  // 能否唤醒指定的线程：每个线程都睡在自己的eventfd上（io_uring或者分片模式）
+  bool canWakeThread() const override { return useIoUring_ || shard_ != EpollShard::SHARED; }
+  // 睡下之前登记为空闲，tickle从这里挑线程唤醒；醒来之后撤销登记。
+  // 返回true表示登记之前有tickle没找到睡着的线程，这次不能阻塞
+  bool beginSleep(Poller *poller);
+  void endSleep(Poller *poller);
+  // 写eventfd唤醒睡在上面的线程
+  void wake(int fd);
+  // 分片模式下给还没有分配的fd挑一个调度线程
+  void assignOwner(FdContext *fd_ctx);
+  // fd的事件注册在哪个epoll上
+  int epfdOf(FdContext *fd_ctx);
+
   int epfd_ = 0;
-  int tickleFds_[2];
+  // 共享epoll模式下唤醒空闲线程的eventfd，注册在epfd_上，一次写入内核只唤醒一个阻塞在epoll_wait上的线程
+  int tickleFd_ = -1;
+  // 已经发出、对方还没醒来的唤醒；在这期间的tickle直接合并掉，
+  // 被唤醒的线程取到任务后发现还有剩余会接着唤醒下一个，一轮调度里再多的任务也只会唤醒一次
+  std::atomic<bool> wakePending_ = {false};
+  // 能定向唤醒时，tickle没有找到已经登记睡下的线程（线程已经计入空闲但还没登记），
+  // 下一个登记的线程不再阻塞，醒来重新找一遍任务；由idleLock_保护
+  bool missedWake_ = false;
+  std::atomic<uint64_t> wakeupCnt_ = {0};
   // 正在等待执行的IO事件数量
   std::atomic<size_t> pendingEventCnt_ = {0};
-  RWMutex mutex_;
-  std::vector<FdContext *> fdContexts_;
+  // 每个fd的事件上下文，查找不加锁
+  FdTable<FdContext> fdContexts_;
+  std::atomic<bool> useIoUring_ = {false};
+  EpollShard shard_;
+  // 按worker下标创建好，之后不再增减；ring由各线程自己创建，ringMutex_保护其他线程读取
+  std::vector<std::unique_ptr<Poller>> pollers_;
+  Mutex ringMutex_;
+  // 轮流分配fd的计数
+  std::atomic<size_t> nextOwner_ = {0};
+  // 能定向唤醒时正睡着的线程，tickle只唤醒最后睡下的一个（缓存还热）
+  Spinlock idleLock_;
+  std::vector<Poller *> idlePollers_;
 };
 }  // namespace monsoon
 
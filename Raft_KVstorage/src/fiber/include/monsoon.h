@@ -1,10 +1,13 @@
 #ifndef __MONSOON_MONSOON_H__
 #define __MONSOON_MONSOON_H__
 
+#include "blocking_io.hpp"
 #include "fd_manager.hpp"
 #include "fiber.hpp"
+#include "fiber_sync.hpp"
 #include "hook.hpp"
 #include "iomanager.hpp"
+#include "stack_allocator.hpp"
 #include "thread.hpp"
 #include "utils.hpp"
 
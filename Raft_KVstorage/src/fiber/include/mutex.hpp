@@ -2,6 +2,7 @@
 #define __MONSOON_MUTEX_H_
 
 #include <pthread.h>
+#include <sched.h>
 #include <semaphore.h>
 #include <stdint.h>
 #include <atomic>
@@ -16,7 +17,6 @@
 #include "utils.hpp"
 
 namespace monsoon {
-// TODO:具体实现
 // 信号量
 class Semaphore : Nonecopyable {
  public:
@@ -141,6 +141,27 @@ class Mutex : Nonecopyable {
   pthread_mutex_t m_;
 };
 
+// 自旋锁，只用来保护很短的临界区（比如协程同步原语的等待队列）
+class Spinlock : Nonecopyable {
+ public:
+  typedef ScopedLockImpl<Spinlock> Lock;
+
+  void lock() {
+    for (int spins = 0; flag_.test_and_set(std::memory_order_acquire); ++spins) {
+      // 持有者可能被切走了，自旋一会儿还拿不到就让出CPU
+      if (spins >= 64) {
+        sched_yield();
+        spins = 0;
+      }
+    }
+  }
+
+  void unlock() { flag_.clear(std::memory_order_release); }
+
+ private:
+  std::atomic_flag flag_ = ATOMIC_FLAG_INIT;
+};
+
 class RWMutex : Nonecopyable {
  public:
   // 局部读锁
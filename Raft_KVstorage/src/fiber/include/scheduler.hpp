@@ -3,15 +3,17 @@
 
 #include <atomic>
 #include <boost/type_index.hpp>
+#include <deque>
 #include <functional>
-#include <list>
 #include <memory>
 #include <mutex>
 #include <vector>
 #include "fiber.hpp"
 #include "mutex.hpp"
+#include "scheduler_metrics.hpp"
 #include "thread.hpp"
 #include "utils.hpp"
+#include "work_stealing_queue.hpp"
 
 namespace monsoon {
 // 调度任务
@@ -40,9 +42,19 @@ class SchedulerTask {
   Fiber::ptr fiber_;
   std::function<void()> cb_;
   int thread_;
+  // 入队时间（GetElapsedNS），统计调度延迟
+  uint64_t enqueueNs_ = 0;
 };
 
-// N->M协程调度器
+/**
+ * N->M协程调度器
+ * 每个调度线程（worker）有自己的任务队列，互不加锁：
+ *   - Chase-Lev无锁双端队列：本线程提交的任务放在这里，空闲的线程从别的线程的队列里偷任务
+ *   - LIFO槽：本线程唤醒的协程放在这里，下一个就执行，它用到的数据大概率还在缓存里
+ *   - 指定线程的任务单独一个队列，只有目标线程会取
+ * 不在调度线程上提交的任务放进全局的注入队列，由各线程定期取走
+ * 各线程的任务数、偷取数、切换数、等IO的时间和延迟分布一直在统计，getMetrics()取快照
+ */
 class Scheduler {
  public:
   typedef std::shared_ptr<Scheduler> ptr;
@@ -54,6 +66,9 @@ class Scheduler {
   static Scheduler *GetThis();
   // 获取当前线程的调度器协程
   static Fiber *GetMainFiber();
+  // 挂起当前协程：先切回调度协程，再在调度协程上调用after(arg)。
+  // 等待队列的锁放在after里释放，别的线程从队列里取出协程重新调度时，它一定已经完整地切换出去了
+  static void Park(void (*after)(void *), void *arg);
 
   /**
    * \brief 添加调度任务
@@ -63,15 +78,18 @@ class Scheduler {
    */
   template <class TaskType>
   void scheduler(TaskType task, int thread = -1) {
-    bool isNeedTickle = false;
-    {
-      Mutex::Lock lock(mutex_);
-      isNeedTickle = schedulerNoLock(task, thread);
-      // std::cout << "isNeedTickle: " << isNeedTickle << std::endl;
+    SchedulerTask *t = new SchedulerTask(task, thread);
+    if (!t->fiber_ && !t->cb_) {
+      delete t;
+      return;
     }
-
-    if (isNeedTickle) {
-      tickle();  // 唤醒idle协程
+    if (enqueue(t)) {
+      // 唤醒idle协程
+      if (thread == -1) {
+        tickle();
+      } else {
+        tickleThread(thread);
+      }
     }
     // log
     // std::string tp = "[Callback Func]";
@@ -86,10 +104,16 @@ class Scheduler {
   void start();
   // 停止调度器,等待所有任务结束
   void stop();
+  // 各调度线程的计数、队列深度和延迟分布的快照，任何线程都可以调用
+  SchedulerMetrics getMetrics() const;
 
  protected:
   // 通知调度器任务到达
   virtual void tickle();
+  // 通知指定的调度线程有只能由它执行的任务，不能定向唤醒的调度器退化成tickle
+  virtual void tickleThread(int thread) { tickle(); }
+  // tickleThread能否只唤醒指定的线程
+  virtual bool canWakeThread() const { return false; }
   /**
    * \brief  协程调度函数,
    * 默认会启用hook
@@ -103,29 +127,52 @@ class Scheduler {
   void setThis();
   // 返回是否有空闲进程
   bool isHasIdleThreads() { return idleThreadCnt_ > 0; }
+  // 队列里是否还有等待执行的任务
+  bool hasPendingTasks() const { return pendingTasks_ > 0; }
+  // 调度线程数（包括use_caller的主线程）
+  size_t workerCount() const { return workers_.size(); }
+  // 当前线程在本调度器里认领的worker下标，不是本调度器的调度线程时返回-1
+  int currentWorkerIndex() const;
+  // 记录当前调度线程阻塞等待IO的时间，由子类的idle调用
+  void recordPollTime(uint64_t ns);
 
  private:
-  // 无锁下，添加调度任务
-  // todo 可以加入使用clang的锁检查
-  template <class TaskType>
-  bool schedulerNoLock(TaskType t, int thread) {
-    bool isNeedTickle = tasks_.empty();
-    SchedulerTask task(t, thread);
-    if (task.fiber_ || task.cb_) {
-      // std::cout << "有效task" << std::endl;
-      tasks_.push_back(task);
-    }
-    // std::cout << "scheduler noblock: isNeedTickle = " << isNeedTickle << std::endl;
-    return isNeedTickle;
-  }
+  struct Worker;
+  // 当前线程认领的worker
+  static thread_local Worker *t_worker;
+
+  // 把任务放进合适的队列，返回是否需要唤醒空闲线程
+  bool enqueue(SchedulerTask *task);
+  // 按 指定本线程的任务 -> LIFO槽 -> 本线程队列 -> 注入队列 -> 偷别的线程 的顺序取一个任务，
+  // 每隔一段时间先看一次注入队列
+  SchedulerTask *nextTask(Worker *self);
+  SchedulerTask *popInject();
+  SchedulerTask *popPinned();
+  SchedulerTask *steal(Worker *self);
+  // 睡下之前检查指定线程的任务：有给本线程的返回true；
+  // 不能定向唤醒时，之前的唤醒可能落到了别的线程上，目标线程还睡着就把唤醒传下去（目标线程在忙时它自己会取）
+  bool checkPinnedTasks(Worker *self);
+
   // 调度器名称
   std::string name_;
-  // 互斥锁
+  // 互斥锁，保护线程池和注入队列
   Mutex mutex_;
   // 线程池
   std::vector<Thread::ptr> threadPool_;
-  // 任务队列
-  std::list<SchedulerTask> tasks_;
+  // 各调度线程的任务队列，启动前按线程数创建好，run()开始时每个线程认领一个
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::atomic<size_t> nextWorker_ = {0};
+  // 不在调度线程上提交的任务
+  std::deque<SchedulerTask *> injectQueue_;
+  std::atomic<size_t> injectCnt_ = {0};
+  // 不在调度线程上提交的任务总数
+  std::atomic<uint64_t> injectedTotal_ = {0};
+  // 指定线程的任务，很少用到，所有线程共用一个链表
+  std::deque<SchedulerTask *> pinnedTasks_;
+  // 所有队列里等待执行的任务数（不含指定线程的任务），空闲前用它确认没有漏掉任务
+  std::atomic<size_t> pendingTasks_ = {0};
+  // 等待执行的指定线程的任务数
+  std::atomic<size_t> pendingPinnedTasks_ = {0};
   // 线程池id数组
   std::vector<int> threadIds_;
   // 工作线程数量（不包含use_caller的主线程）
@@ -0,0 +1,93 @@
+#ifndef __MONSOON_SCHEDULER_METRICS_H__
+#define __MONSOON_SCHEDULER_METRICS_H__
+
+#include <stdint.h>
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace monsoon {
+/**
+ * HDR风格的延迟直方图（纳秒）
+ * 小于32的值每个一格；更大的值按2的幂分段，每段再线性分成16格，记录的相对误差不超过1/16，
+ * 覆盖整个uint64_t范围，一共976格。
+ * 只能由一个线程record（调度线程各有一个），其他线程随时可以读，读到的是近似一致的快照
+ */
+class LatencyHistogram {
+ public:
+  static const int kSubBits = 4;
+  static const int kSubCount = 1 << kSubBits;
+  static const int kBucketCount = (64 - kSubBits + 1) * kSubCount;
+
+  LatencyHistogram();
+  LatencyHistogram(const LatencyHistogram &other);
+  LatencyHistogram &operator=(const LatencyHistogram &other);
+
+  // 只能由所属线程调用
+  void record(uint64_t ns);
+  // 把other的计数加到自己上，用于汇总各线程的快照
+  void merge(const LatencyHistogram &other);
+
+  uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+  uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+  double mean() const;
+  // 第p（0~1）分位数，返回所在格子的上界（不超过max）
+  uint64_t percentile(double p) const;
+  // count p50 p90 p99 p999 max，单位微秒
+  std::string toString() const;
+
+ private:
+  static int bucketOf(uint64_t ns);
+  // 第i格能放的最大值
+  static uint64_t bucketUpper(int i);
+
+  std::atomic<uint64_t> buckets_[kBucketCount];
+  std::atomic<uint64_t> count_;
+  std::atomic<uint64_t> sum_;
+  std::atomic<uint64_t> max_;
+};
+
+// 一个调度线程的计数，都是从调度器启动开始的累计值
+struct WorkerMetrics {
+  // 调度线程id，还没有线程认领时为-1
+  int thread = -1;
+  // 本线程提交的任务数
+  uint64_t scheduled = 0;
+  // 本线程执行的任务数（协程每恢复一次算一次）
+  uint64_t run = 0;
+  // 其中从别的线程偷来的
+  uint64_t stolen = 0;
+  // 调度协程切换出去的次数（执行任务和进入idle）
+  uint64_t switches = 0;
+  // 阻塞在epoll_wait/io_uring_enter上的时间
+  uint64_t pollNs = 0;
+  // 本线程队列（含LIFO槽）里等待的任务数
+  size_t queueDepth = 0;
+};
+
+// 调度器的快照，Scheduler::getMetrics()返回
+struct SchedulerMetrics {
+  std::string name;
+  std::vector<WorkerMetrics> workers;
+  // 不在调度线程上提交的任务数
+  uint64_t injected = 0;
+  // 注入队列、指定线程队列里等待的任务数
+  size_t injectDepth = 0;
+  size_t pinnedDepth = 0;
+  // 所有队列里等待的任务数
+  size_t pending = 0;
+  size_t activeThreads = 0;
+  size_t idleThreads = 0;
+  // 下面两个分布每sampleInterval个任务取一个，计数是样本数
+  uint32_t sampleInterval = 1;
+  // 提交到开始执行的时间
+  LatencyHistogram scheduleDelay;
+  // 每次执行（到协程结束或者让出）的时间
+  LatencyHistogram runTime;
+
+  // 多行文本，方便打到日志里
+  std::string toString() const;
+};
+}  // namespace monsoon
+
+#endif
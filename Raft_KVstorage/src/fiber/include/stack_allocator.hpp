@@ -0,0 +1,36 @@
+#ifndef __MONSOON_STACK_ALLOCATOR_H__
+#define __MONSOON_STACK_ALLOCATOR_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace monsoon {
+/**
+ * 协程栈分配器
+ * 栈用mmap按slab批量分配，每个栈的低地址端有一个PROT_NONE的保护页，栈溢出时直接SIGSEGV，而不是悄悄踩坏堆。
+ * 栈按大小分级（16K起按2的幂向上取整），释放的栈先放回本线程的空闲链表，超过上限时一半移到全局链表，
+ * 本线程没有空闲栈时先从全局链表批量取，都没有再分配新的slab。
+ * 每个保护页会让栈多占一个内存映射（VMA），受vm.max_map_count限制，超出预算之后新的栈不再带保护页
+ */
+class StackAllocator {
+ public:
+  struct Stats {
+    uint64_t mappedBytes;      // mmap出的总字节数（含保护页）
+    uint64_t liveStacks;       // 正在被协程使用的栈
+    uint64_t cachedStacks;     // 各线程和全局空闲链表中的栈
+    uint64_t guardedStacks;    // 带保护页的栈
+    uint64_t unguardedStacks;  // 超出保护页预算、不带保护页的栈
+  };
+
+  // 分级之后实际分配的栈大小，协程按这个大小使用栈
+  static size_t RoundUp(size_t size);
+  // size需要是RoundUp的结果
+  static void *Alloc(size_t size);
+  static void Delete(void *vp, size_t size);
+  // 栈移到全局空闲链表时是否MADV_DONTNEED把物理页还给系统，默认开启
+  static void SetReleaseUnused(bool release);
+  static Stats GetStats();
+};
+}  // namespace monsoon
+
+#endif
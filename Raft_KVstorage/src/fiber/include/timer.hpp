@@ -1,16 +1,18 @@
 #ifndef __MONSOON_TIMER_H__
 #  define __MONSSON_TIMER_H__
 
+#  include <functional>
 #  include <memory>
-#  include <set>
 #  include <vector>
 #  include "mutex.hpp"
 
 namespace monsoon {
 class TimerManager;
+class TimerWheel;
 
 class Timer : public std::enable_shared_from_this<Timer> {
   friend class TimerManager;
+  friend class TimerWheel;
 
  public:
   typedef std::shared_ptr<Timer> ptr;
@@ -21,7 +23,6 @@ class Timer : public std::enable_shared_from_this<Timer> {
 
  private:
   Timer(uint64_t ms, std::function<void()> cb, bool recuring, TimerManager *manager);
-  Timer(uint64_t next);
 
   // 是否是循环定时器
   bool recurring_ = false;
@@ -34,12 +35,26 @@ class Timer : public std::enable_shared_from_this<Timer> {
   // 管理器
   TimerManager *manager_ = nullptr;
 
- private:
-  struct Comparator {
-    bool operator()(const Timer::ptr &lhs, const Timer::ptr &rhs) const;
-  };
+  // 以下由所在时间轮的锁保护
+  // 所在的时间轮，创建时确定，之后refresh/reset也还在这个时间轮上
+  TimerWheel *wheel_ = nullptr;
+  // 时间轮槽内的双向链表（侵入式，插入删除不用额外分配内存）
+  Timer *prevTimer_ = nullptr;
+  Timer *nextTimer_ = nullptr;
+  // 所在的槽，不在时间轮上时为nullptr
+  Timer **slot_ = nullptr;
+  // 在时间轮上时持有自己，调用方不保留Timer::ptr时定时器也会照常触发
+  Timer::ptr self_;
 };
 
+/**
+ * 定时器管理
+ * 定时器放在分层时间轮上（见timer.cpp），添加、取消、重置都是O(1)。
+ * 调度线程调用attachThreadWheel()后有自己的时间轮，在这个线程上添加的定时器（比如hook的IO超时）只锁自己的时间轮，
+ * 到期后也由这个线程取出；其他线程添加的定时器放在共享时间轮上，所有调度线程都会处理。
+ * 线程自己的时间轮上的定时器被别的线程提前时必须能唤醒属主线程，所以只有支持定向唤醒（OnTimerInsertedAtFront
+ * 能唤醒指定线程）的子类才应该调用attachThreadWheel()
+ */
 class TimerManager {
   friend class Timer;
 
@@ -49,31 +64,33 @@ class TimerManager {
   Timer::ptr addTimer(uint64_t ms, std::function<void()> cb, bool recuring = false);
   Timer::ptr addConditionTimer(uint64_t ms, std::function<void()> cb, std::weak_ptr<void> weak_cond,
                                bool recurring = false);
-  // 到最近一个定时器的时间间隔（ms）
+  // 当前线程到最近一个定时器的时间间隔（ms）
   uint64_t getNextTimer();
-  // 获取需要执行的定时器的回调函数列表
+  // 获取当前线程需要执行的定时器的回调函数列表
   void listExpiredCb(std::vector<std::function<void()>> &cbs);
   // 是否有定时器
   bool hasTimer();
 
  protected:
   // 当有新的定时器插入到定时器首部，执行该函数
-  virtual void OnTimerInsertedAtFront() = 0;
-  // 将定时器添加到管理器
-  void addTimer(Timer::ptr val, RWMutex::WriteLock &lock);
+  // thread：定时器在这个调度线程自己的时间轮上，只有它会处理，需要唤醒的就是它；-1表示任意一个调度线程都可以
+  virtual void OnTimerInsertedAtFront(int thread) = 0;
+  // 给当前线程创建自己的时间轮，只在调度线程上调用
+  void attachThreadWheel();
 
  private:
-  // 检测服务器时间是否被调后了
-  bool detectClockRolllover(uint64_t now_ms);
+  // 当前线程添加定时器时使用的时间轮
+  TimerWheel *currentWheel();
+  // 把定时器（重新）放到它的时间轮上，需要时唤醒调度线程
+  void schedule(Timer *timer, Mutex::Lock &lock);
 
-  RWMutex mutex_;
-  // 定时器集合
-  std::set<Timer::ptr, Timer::Comparator> timers_;
-  // 是否触发OnTimerInsertedAtFront
-  bool tickled_ = false;
-  // 上次执行时间
-  uint64_t previouseTime_ = 0;
+  // 非调度线程添加的定时器
+  std::unique_ptr<TimerWheel> sharedWheel_;
+  // 保护threadWheels_
+  Mutex mutex_;
+  // 各调度线程自己的时间轮
+  std::vector<std::unique_ptr<TimerWheel>> threadWheels_;
 };
 }  // namespace monsoon
 
-#endif
\ No newline at end of file
+#endif
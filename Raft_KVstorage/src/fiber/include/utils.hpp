@@ -25,6 +25,12 @@ static uint64_t GetElapsedMS() {
   clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
   return ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
 }
+// 系统从启动到当前时刻的纳秒数，走vDSO不进内核，用于调度器的计时
+inline uint64_t GetElapsedNS() {
+  struct timespec ts = {0};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
 
 // 将原始函数名解析为可读函数名
 static std::string demangle(const char *str) {
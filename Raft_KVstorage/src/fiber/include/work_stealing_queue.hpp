@@ -0,0 +1,110 @@
+#ifndef __MONSOON_WORK_STEALING_QUEUE_H__
+#define __MONSOON_WORK_STEALING_QUEUE_H__
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "noncopyable.hpp"
+
+namespace monsoon {
+/**
+ * Chase-Lev无锁双端队列（按Lê等人C11内存模型版本实现）
+ * 只有所属线程可以push/pop（从bottom端，后进先出），其他线程用steal从top端偷（先进先出）。
+ * 容量不够时翻倍，旧数组可能还在被steal读，保留到队列析构时再释放
+ */
+template <class T>
+class WorkStealingQueue : Nonecopyable {
+ public:
+  explicit WorkStealingQueue(int64_t capacity = 256) : top_(0), bottom_(0) {
+    arrays_.emplace_back(new Array(capacity));
+    array_.store(arrays_.back().get(), std::memory_order_relaxed);
+  }
+
+  // 只能由所属线程调用
+  void push(T *item) {
+    int64_t b = bottom_.load(std::memory_order_relaxed);
+    int64_t t = top_.load(std::memory_order_acquire);
+    Array *a = array_.load(std::memory_order_relaxed);
+    if (b - t > a->capacity - 1) {
+      a = grow(a, b, t);
+    }
+    a->put(b, item);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+  }
+
+  // 只能由所属线程调用，队列空返回nullptr
+  T *pop() {
+    int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    Array *a = array_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top_.load(std::memory_order_relaxed);
+    if (t > b) {
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    T *item = a->get(b);
+    if (t == b) {
+      // 只剩最后一个，和steal竞争
+      if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        item = nullptr;
+      }
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return item;
+  }
+
+  // 任意线程调用，队列空或者和别的线程竞争失败都返回nullptr
+  T *steal() {
+    int64_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = bottom_.load(std::memory_order_acquire);
+    if (t >= b) {
+      return nullptr;
+    }
+    Array *a = array_.load(std::memory_order_acquire);
+    T *item = a->get(t);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return item;
+  }
+
+  // 近似的元素个数，只用于判断是否值得去偷
+  int64_t size() const {
+    int64_t b = bottom_.load(std::memory_order_relaxed);
+    int64_t t = top_.load(std::memory_order_relaxed);
+    return b > t ? b - t : 0;
+  }
+
+ private:
+  struct Array {
+    explicit Array(int64_t cap) : capacity(cap), mask(cap - 1), items(new std::atomic<T *>[cap]) {}
+    T *get(int64_t i) const { return items[i & mask].load(std::memory_order_relaxed); }
+    void put(int64_t i, T *item) { items[i & mask].store(item, std::memory_order_relaxed); }
+
+    int64_t capacity;  // 2的幂
+    int64_t mask;
+    std::unique_ptr<std::atomic<T *>[]> items;
+  };
+
+  Array *grow(Array *old, int64_t b, int64_t t) {
+    Array *a = new Array(old->capacity * 2);
+    for (int64_t i = t; i < b; ++i) {
+      a->put(i, old->get(i));
+    }
+    arrays_.emplace_back(a);
+    array_.store(a, std::memory_order_release);
+    return a;
+  }
+
+  alignas(64) std::atomic<int64_t> top_;
+  alignas(64) std::atomic<int64_t> bottom_;
+  std::atomic<Array *> array_;
+  // 所有用过的数组，只有所属线程修改
+  std::vector<std::unique_ptr<Array>> arrays_;
+};
+}  // namespace monsoon
+
+#endif
@@ -0,0 +1,138 @@
+#include "io_uring.hpp"
+#include <errno.h>
+#include <algorithm>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace monsoon {
+static int io_uring_setup(unsigned entries, io_uring_params *p) { return syscall(__NR_io_uring_setup, entries, p); }
+
+static int io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags, void *arg, size_t argsz) {
+  return syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, arg, argsz);
+}
+
+IoUring::~IoUring() {
+  if (sqes_) {
+    munmap(sqes_, sqesSize_);
+  }
+  if (cqRing_ && cqRing_ != sqRing_) {
+    munmap(cqRing_, cqRingSize_);
+  }
+  if (sqRing_) {
+    munmap(sqRing_, sqRingSize_);
+  }
+  if (ringFd_ >= 0) {
+    close(ringFd_);
+  }
+}
+
+bool IoUring::init(unsigned entries) {
+  io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  int fd = io_uring_setup(entries, &params);
+  if (fd < 0) {
+    // 内核太老、被seccomp禁用或者sysctl关掉了
+    return false;
+  }
+  ringFd_ = fd;
+  if (!(params.features & IORING_FEAT_EXT_ARG)) {
+    return false;
+  }
+
+  sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+  if (single_mmap) {
+    // SQ和CQ共用一块映射
+    sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+  }
+  sqRing_ = mmap(nullptr, sqRingSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  if (sqRing_ == MAP_FAILED) {
+    sqRing_ = nullptr;
+    return false;
+  }
+  if (single_mmap) {
+    cqRing_ = sqRing_;
+  } else {
+    cqRing_ = mmap(nullptr, cqRingSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+    if (cqRing_ == MAP_FAILED) {
+      cqRing_ = nullptr;
+      return false;
+    }
+  }
+  sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+  void *sqes = mmap(nullptr, sqesSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+  if (sqes == MAP_FAILED) {
+    return false;
+  }
+  sqes_ = static_cast<io_uring_sqe *>(sqes);
+
+  char *sq = static_cast<char *>(sqRing_);
+  sqHead_ = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+  sqTail_ = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+  sqArray_ = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+  sqMask_ = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+  sqEntries_ = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_entries);
+  // SQE按顺序使用，索引数组固定成一一对应，提交时只需要移动队尾
+  for (unsigned i = 0; i < sqEntries_; ++i) {
+    sqArray_[i] = i;
+  }
+  sqeHead_ = sqeTail_ = *sqTail_;
+
+  char *cq = static_cast<char *>(cqRing_);
+  cqHead_ = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+  cqTail_ = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+  cqMask_ = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+  cqes_ = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+  return true;
+}
+
+unsigned IoUring::sqSpace() const { return sqEntries_ - (sqeTail_ - __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE)); }
+
+io_uring_sqe *IoUring::getSqe() {
+  if (sqSpace() == 0) {
+    return nullptr;
+  }
+  io_uring_sqe *sqe = &sqes_[sqeTail_ & sqMask_];
+  ++sqeTail_;
+  memset(sqe, 0, sizeof(*sqe));
+  return sqe;
+}
+
+int IoUring::submit(unsigned wait_nr, int timeout_ms) {
+  if (sqeHead_ != sqeTail_) {
+    // SQE写完之后再移动队尾，内核看到队尾时SQE的内容一定已经可见
+    __atomic_store_n(sqTail_, sqeTail_, __ATOMIC_RELEASE);
+    sqeHead_ = sqeTail_;
+  }
+  // 之前因为CQ溢出等原因没被内核取走的SQE也一起提交
+  unsigned to_submit = sqeTail_ - __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE);
+  if (to_submit == 0 && wait_nr == 0) {
+    return 0;
+  }
+  unsigned flags = 0;
+  io_uring_getevents_arg arg;
+  __kernel_timespec ts;
+  memset(&arg, 0, sizeof(arg));
+  if (wait_nr > 0) {
+    flags |= IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+    arg.sigmask_sz = _NSIG / 8;
+    if (timeout_ms >= 0) {
+      ts.tv_sec = timeout_ms / 1000;
+      ts.tv_nsec = (timeout_ms % 1000) * 1000000LL;
+      arg.ts = reinterpret_cast<uint64_t>(&ts);
+    }
+  }
+  enterCnt_.fetch_add(1, std::memory_order_relaxed);
+  int ret = io_uring_enter(ringFd_, to_submit, wait_nr, flags, wait_nr > 0 ? &arg : nullptr,
+                           wait_nr > 0 ? sizeof(arg) : 0);
+  if (ret < 0 && (errno == ETIME || errno == EINTR || errno == EAGAIN || errno == EBUSY)) {
+    // 等待超时或者被信号打断；EAGAIN/EBUSY是内核暂时收不下，SQE还在队列里，下次再提交
+    return 0;
+  }
+  return ret;
+}
+}  // namespace monsoon
@@ -1,6 +1,56 @@
 #include "iomanager.hpp"
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <algorithm>
 
 namespace monsoon {
+// 每个线程的io_uring队列深度
+static const unsigned kRingEntries = 256;
+// 攒够这么多SQE就提交，不再等本线程的其他协程
+static const unsigned kRingBatch = 32;
+// CQE的user_data：链接在操作后面的超时和挂在epoll fd上的poll用这两个值，其他的是UringOp的地址
+static const uint64_t kTimeoutData = 0;
+static const uint64_t kEpollPollData = 1;
+// 挂在线程自己的唤醒eventfd上的poll
+static const uint64_t kWakePollData = 2;
+
+// 提交到io_uring的一次操作，放在发起协程的栈上，完成之前协程不会恢复
+struct UringOp {
+  Fiber::ptr fiber;
+  int res = 0;
+};
+
+struct IOManager::Poller {
+  ~Poller() {
+    if (wakeFd >= 0) {
+      close(wakeFd);
+    }
+    if (ownEpfd) {
+      close(epfd);
+    }
+  }
+
+  IOManager *manager = nullptr;
+  // 认领它的调度线程
+  std::atomic<int> thread = {-1};
+  // 等待的epoll：共享模式下是manager的epfd_，分片模式下是自己的
+  int epfd = -1;
+  bool ownEpfd = false;
+  // 唤醒这个线程的eventfd：分片模式下注册在自己的epoll上，否则挂在ring上
+  int wakeFd = -1;
+  // 分片模式下分到的fd数
+  std::atomic<size_t> fdCnt = {0};
+  // 是否在idlePollers_里，由idleLock_保护
+  bool sleeping = false;
+  // io_uring模式下线程自己的ring
+  std::unique_ptr<IoUring> uring;
+  // epoll fd和唤醒eventfd上的poll是否还挂在ring上
+  bool epollArmed = false;
+  bool wakeArmed = false;
+};
+
+thread_local IOManager::Poller *IOManager::t_poller = nullptr;
+
 // 获取事件上下文
 EventContext &FdContext::getEveContext(Event event) {
   switch (event) {
@@ -33,56 +83,107 @@ void FdContext::triggerEvent(Event event) {
   return;
 }
 
-IOManager::IOManager(size_t threads, bool use_caller, const std::string &name) : Scheduler(threads, use_caller, name) {
+IOManager::IOManager(size_t threads, bool use_caller, const std::string &name, bool use_io_uring,
+                     EpollShard shard)
+    : Scheduler(threads, use_caller, name), shard_(shard) {
+  if (use_io_uring) {
+    // 先试着建一个小的ring，内核不支持就一直用epoll
+    IoUring probe;
+    useIoUring_ = probe.init(8);
+    if (!useIoUring_) {
+      std::cout << "io_uring unavailable, fall back to epoll" << std::endl;
+    }
+  }
   epfd_ = epoll_create(5000);
-  int ret = pipe(tickleFds_);
-  CondPanic(ret == 0, "pipe error");
+  // 边缘触发，设置非阻塞
+  tickleFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  CondPanic(tickleFd_ >= 0, "eventfd error");
 
-  // 注册pipe读句柄的可读事件，用于tickle调度协程
+  // 注册eventfd的可读事件，用于tickle调度协程
   epoll_event event{};
   memset(&event, 0, sizeof(epoll_event));
   event.events = EPOLLIN | EPOLLET;
-  event.data.fd = tickleFds_[0];
-  // 边缘触发，设置非阻塞
-  ret = fcntl(tickleFds_[0], F_SETFL, O_NONBLOCK);
-  CondPanic(ret == 0, "set fd nonblock error");
-  // 注册管道读描述符
-  ret = epoll_ctl(epfd_, EPOLL_CTL_ADD, tickleFds_[0], &event);
+  event.data.fd = tickleFd_;
+  int ret = epoll_ctl(epfd_, EPOLL_CTL_ADD, tickleFd_, &event);
   CondPanic(ret == 0, "epoll_ctl error");
 
-  contextResize(32);
+  // 每个调度线程一个poller，分片模式下各自建epoll并把自己的唤醒eventfd注册上去
+  for (size_t i = 0; i < workerCount(); ++i) {
+    std::unique_ptr<Poller> poller(new Poller);
+    poller->manager = this;
+    poller->wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    CondPanic(poller->wakeFd >= 0, "eventfd error");
+    if (shard_ == EpollShard::SHARED) {
+      poller->epfd = epfd_;
+    } else {
+      poller->epfd = epoll_create(5000);
+      CondPanic(poller->epfd >= 0, "epoll_create error");
+      poller->ownEpfd = true;
+      event.data.fd = poller->wakeFd;
+      ret = epoll_ctl(poller->epfd, EPOLL_CTL_ADD, poller->wakeFd, &event);
+      CondPanic(ret == 0, "epoll_ctl error");
+    }
+    pollers_.push_back(std::move(poller));
+  }
 
   // 启动scheduler，开始进行协程调度
   start();
 }
 IOManager::~IOManager() {
   stop();
-  close(epfd_);
-  close(tickleFds_[0]);
-  close(tickleFds_[1]);
-
-  for (size_t i = 0; i < fdContexts_.size(); i++) {
-    if (fdContexts_[i]) {
-      delete fdContexts_[i];
-    }
+  // 工作线程已经退出，调用线程（use_caller）上可能还留着指向本对象poller的指针
+  if (t_poller != nullptr && t_poller->manager == this) {
+    t_poller = nullptr;
   }
+  close(epfd_);
+  close(tickleFd_);
 }
 
 // 添加事件
 int IOManager::addEvent(int fd, Event event, std::function<void()> cb) {
-  FdContext *fd_ctx = nullptr;
-  RWMutex::ReadLock lock(mutex_);
-  // TODO：可以使用map代替
-  // 找到fd对应的fdCOntext,没有则创建
-  if ((int)fdContexts_.size() > fd) {
-    fd_ctx = fdContexts_[fd];
-    lock.unlock();
-  } else {
-    lock.unlock();
-    RWMutex::WriteLock lock2(mutex_);
-    contextResize(fd * 1.5);
-    fd_ctx = fdContexts_[fd];
+  Fiber::ptr fiber;
+  if (!cb) {
+    // 未设置回调函数，则将当前协程设置为回调任务
+    fiber = Fiber::GetThis();
+    CondPanic(fiber->getState() == Fiber::RUNNING, "state=" + fiber->getState());
   }
+  return registerEvent(fd, event, std::move(cb), std::move(fiber));
+}
+
+// waitEvent放在协程栈上的参数，注册成功之后协程随时可能被恢复，不能再访问
+struct EventWait {
+  IOManager *iom = nullptr;
+  int fd = 0;
+  Event event = NONE;
+  int rt = 0;
+  Fiber::ptr fiber;
+};
+
+int IOManager::waitEvent(int fd, Event event) {
+  EventWait wait;
+  wait.iom = this;
+  wait.fd = fd;
+  wait.event = event;
+  wait.fiber = Fiber::GetThis();
+  Park(&IOManager::ArmEvent, &wait);
+  return wait.rt;
+}
+
+void IOManager::ArmEvent(void *arg) {
+  EventWait *wait = static_cast<EventWait *>(arg);
+  IOManager *iom = wait->iom;
+  // 注册失败时fiber还留在wait里，把协程交回调度器
+  Fiber::ptr fiber = wait->fiber;
+  wait->fiber.reset();
+  if (iom->registerEvent(wait->fd, wait->event, nullptr, fiber) != 0) {
+    wait->rt = -1;
+    iom->scheduler(&fiber);
+  }
+}
+
+int IOManager::registerEvent(int fd, Event event, std::function<void()> cb, Fiber::ptr fiber) {
+  // 找到fd对应的fdCOntext,没有则创建
+  FdContext *fd_ctx = fdContexts_.getOrCreate(fd);
 
   // 同一个fd不允许注册重复事件
   Mutex::Lock ctxLock(fd_ctx->mutex);
@@ -93,7 +194,8 @@ int IOManager::addEvent(int fd, Event event, std::function<void()> cb) {
   epevent.events = EPOLLET | fd_ctx->events | event;
   epevent.data.ptr = fd_ctx;
 
-  int ret = epoll_ctl(epfd_, op, fd, &epevent);
+  assignOwner(fd_ctx);
+  int ret = epoll_ctl(epfdOf(fd_ctx), op, fd, &epevent);
   if (ret) {
     std::cout << "addevent: epoll ctl error" << std::endl;
     return -1;
@@ -111,22 +213,18 @@ int IOManager::addEvent(int fd, Event event, std::function<void()> cb) {
     // 设置了回调函数
     event_ctx.cb.swap(cb);
   } else {
-    // 未设置回调函数，则将当前协程设置为回调任务
-    event_ctx.fiber = Fiber::GetThis();
-    CondPanic(event_ctx.fiber->getState() == Fiber::RUNNING, "state=" + event_ctx.fiber->getState());
+    event_ctx.fiber.swap(fiber);
   }
   std::cout << "add event success,fd = " << fd << std::endl;
   return 0;
 }
 // 删除事件 (删除前不会主动触发事件)
 bool IOManager::delEvent(int fd, Event event) {
-  RWMutex::ReadLock lock(mutex_);
-  if ((int)fdContexts_.size() <= fd) {
+  FdContext *fd_ctx = fdContexts_.get(fd);
+  if (!fd_ctx) {
     // 找不到当前事件，返回
     return false;
   }
-  FdContext *fd_ctx = fdContexts_[fd];
-  lock.unlock();
 
   Mutex::Lock ctxLock(fd_ctx->mutex);
   if (!(fd_ctx->events & event)) {
@@ -139,7 +237,7 @@ bool IOManager::delEvent(int fd, Event event) {
   epevent.events = EPOLLET | new_events;
   epevent.data.ptr = fd_ctx;
   // 注册删除事件
-  int ret = epoll_ctl(epfd_, op, fd, &epevent);
+  int ret = epoll_ctl(epfdOf(fd_ctx), op, fd, &epevent);
   if (ret) {
     std::cout << "delevent: epoll_ctl error" << std::endl;
     return false;
@@ -153,13 +251,11 @@ bool IOManager::delEvent(int fd, Event event) {
 
 // 取消事件 （取消前会主动触发事件）
 bool IOManager::cancelEvent(int fd, Event event) {
-  RWMutex::ReadLock lock(mutex_);
-  if ((int)fdContexts_.size() <= fd) {
+  FdContext *fd_ctx = fdContexts_.get(fd);
+  if (!fd_ctx) {
     // 找不到当前事件，返回
     return false;
   }
-  FdContext *fd_ctx = fdContexts_[fd];
-  lock.unlock();
 
   Mutex::Lock ctxLock(fd_ctx->mutex);
   if (!(fd_ctx->events & event)) {
@@ -172,7 +268,7 @@ bool IOManager::cancelEvent(int fd, Event event) {
   epevent.events = EPOLLET | new_events;
   epevent.data.ptr = fd_ctx;
   // 注册删除事件
-  int ret = epoll_ctl(epfd_, op, fd, &epevent);
+  int ret = epoll_ctl(epfdOf(fd_ctx), op, fd, &epevent);
   if (ret) {
     std::cout << "delevent: epoll_ctl error" << std::endl;
     return false;
@@ -184,15 +280,19 @@ bool IOManager::cancelEvent(int fd, Event event) {
 }
 // 取消fd所有事件
 bool IOManager::cancelAll(int fd) {
-  RWMutex::ReadLock lock(mutex_);
-  if ((int)fdContexts_.size() <= fd) {
+  FdContext *fd_ctx = fdContexts_.get(fd);
+  if (!fd_ctx) {
     // 找不到当前事件，返回
     return false;
   }
-  FdContext *fd_ctx = fdContexts_[fd];
-  lock.unlock();
 
   Mutex::Lock ctxLock(fd_ctx->mutex);
+  // hook的close在关闭fd之前调用，之后这个fd号可能是别的连接，释放分配的线程
+  int epfd = epfdOf(fd_ctx);
+  if (fd_ctx->owner != -1) {
+    --pollers_[fd_ctx->owner]->fdCnt;
+    fd_ctx->owner = -1;
+  }
   if (!fd_ctx->events) {
     return false;
   }
@@ -202,7 +302,7 @@ bool IOManager::cancelAll(int fd) {
   epevent.events = 0;
   epevent.data.ptr = fd_ctx;
   // 注册删除事件
-  int ret = epoll_ctl(epfd_, op, fd, &epevent);
+  int ret = epoll_ctl(epfd, op, fd, &epevent);
   if (ret) {
     std::cout << "delevent: epoll_ctl error" << std::endl;
     return false;
@@ -221,15 +321,261 @@ bool IOManager::cancelAll(int fd) {
 }
 IOManager *IOManager::GetThis() { return dynamic_cast<IOManager *>(Scheduler::GetThis()); }
 
+int IOManager::getFdOwner(int fd) {
+  FdContext *fd_ctx = fdContexts_.get(fd);
+  if (!fd_ctx) {
+    return -1;
+  }
+  Mutex::Lock ctxLock(fd_ctx->mutex);
+  return fd_ctx->owner;
+}
+
+std::vector<size_t> IOManager::fdCountPerThread() {
+  std::vector<size_t> cnts;
+  for (auto &poller : pollers_) {
+    cnts.push_back(poller->fdCnt);
+  }
+  return cnts;
+}
+
+void IOManager::assignOwner(FdContext *fd_ctx) {
+  if (shard_ == EpollShard::SHARED || fd_ctx->owner != -1) {
+    return;
+  }
+  size_t owner = 0;
+  if (shard_ == EpollShard::ROUND_ROBIN) {
+    owner = nextOwner_++ % pollers_.size();
+  } else {
+    // 线程数不多，直接找分到fd最少的
+    for (size_t i = 1; i < pollers_.size(); ++i) {
+      if (pollers_[i]->fdCnt < pollers_[owner]->fdCnt) {
+        owner = i;
+      }
+    }
+  }
+  ++pollers_[owner]->fdCnt;
+  fd_ctx->owner = owner;
+}
+
+int IOManager::epfdOf(FdContext *fd_ctx) { return fd_ctx->owner == -1 ? epfd_ : pollers_[fd_ctx->owner]->epfd; }
+
+IOManager::Poller *IOManager::currentRing() {
+  return t_poller != nullptr && t_poller->manager == this && t_poller->uring ? t_poller : nullptr;
+}
+
+void IOManager::attachPoller() {
+  if (t_poller != nullptr && t_poller->manager == this) {
+    return;
+  }
+  int index = currentWorkerIndex();
+  CondPanic(index >= 0, "idle outside scheduling thread");
+  Poller *poller = pollers_[index].get();
+  poller->thread = GetThreadId();
+  t_poller = poller;
+  if (!useIoUring_) {
+    return;
+  }
+  std::unique_ptr<IoUring> uring(new IoUring);
+  if (!uring->init(kRingEntries)) {
+    // 已经建了ring的线程把手上的操作做完，之后都走epoll
+    std::cout << "io_uring init error, fall back to epoll" << std::endl;
+    useIoUring_ = false;
+    return;
+  }
+  Mutex::Lock lock(ringMutex_);
+  poller->uring = std::move(uring);
+}
+
+io_uring_sqe *IOManager::getSqe() {
+  Poller *ring = currentRing();
+  if (!ring || !useIoUring_ || !Fiber::GetThis()->isRunInScheduler()) {
+    return nullptr;
+  }
+  // 给链接的超时留一个位置，SQ满了先把攒着的提交掉
+  if (ring->uring->sqSpace() < 2) {
+    ring->uring->submit();
+    if (ring->uring->sqSpace() < 2) {
+      return nullptr;
+    }
+  }
+  return ring->uring->getSqe();
+}
+
+int IOManager::submitIo(io_uring_sqe *sqe, uint64_t timeout_ms) {
+  Poller *ring = currentRing();
+  CondPanic(ring != nullptr, "submitIo without io_uring");
+  UringOp op;
+  sqe->user_data = reinterpret_cast<uint64_t>(&op);
+  // 内核在提交时就把超时时间拷走了，提交一定在协程恢复之前
+  __kernel_timespec ts;
+  if (timeout_ms != (uint64_t)-1) {
+    sqe->flags |= IOSQE_IO_LINK;
+    io_uring_sqe *timeout_sqe = ring->uring->getSqe();
+    ts.tv_sec = timeout_ms / 1000;
+    ts.tv_nsec = (timeout_ms % 1000) * 1000000;
+    timeout_sqe->opcode = IORING_OP_LINK_TIMEOUT;
+    timeout_sqe->fd = -1;
+    timeout_sqe->addr = reinterpret_cast<uint64_t>(&ts);
+    timeout_sqe->len = 1;
+    timeout_sqe->user_data = kTimeoutData;
+  }
+  ++pendingEventCnt_;
+  op.fiber = Fiber::GetThis();
+  Park(&IOManager::FlushRing, ring);
+  // 超时先到时操作被取消
+  if (op.res == -ECANCELED && timeout_ms != (uint64_t)-1) {
+    return -ETIMEDOUT;
+  }
+  return op.res;
+}
+
+void IOManager::FlushRing(void *arg) {
+  Poller *ring = static_cast<Poller *>(arg);
+  // 本线程还有别的任务可运行时先不提交，等它们的IO攒在一起，攒够一批就不再等了
+  if (ring->uring->pending() >= kRingBatch || !ring->manager->hasPendingTasks()) {
+    ring->uring->submit();
+  }
+  // 顺便把已经完成的操作交出去，epoll的就绪留给idle处理（重新挂poll时会立即完成）
+  ring->manager->reapRing(ring);
+}
+
+bool IOManager::reapRing(Poller *ring) {
+  bool epoll_ready = false;
+  ring->uring->reap([this, ring, &epoll_ready](const io_uring_cqe &cqe) {
+    if (cqe.user_data == kTimeoutData) {
+      return;
+    }
+    if (cqe.user_data == kEpollPollData) {
+      ring->epollArmed = false;
+      epoll_ready = true;
+      return;
+    }
+    if (cqe.user_data == kWakePollData) {
+      eventfd_t cnt;
+      eventfd_read(ring->wakeFd, &cnt);
+      ring->wakeArmed = false;
+      return;
+    }
+    UringOp *op = reinterpret_cast<UringOp *>(cqe.user_data);
+    op->res = cqe.res;
+    --pendingEventCnt_;
+    // 交给调度器之后op所在的栈随时可能被恢复的协程改写，不能再访问
+    scheduler(&op->fiber);
+  });
+  return epoll_ready;
+}
+
+int IOManager::waitRing(Poller *ring, epoll_event *events, int max_events, int timeout_ms) {
+  if (!ring->epollArmed) {
+    // epoll fd有就绪事件（包括tickle的管道）时poll完成，唤醒阻塞在ring上的线程
+    io_uring_sqe *sqe = ring->uring->getSqe();
+    if (!sqe) {
+      ring->uring->submit();
+      sqe = ring->uring->getSqe();
+    }
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = ring->epfd;
+    sqe->poll32_events = POLLIN;
+    sqe->user_data = kEpollPollData;
+    ring->epollArmed = true;
+  }
+  // 分片模式下唤醒eventfd注册在线程自己的epoll里，不用单独挂
+  if (shard_ == EpollShard::SHARED && !ring->wakeArmed) {
+    io_uring_sqe *sqe = ring->uring->getSqe();
+    if (!sqe) {
+      ring->uring->submit();
+      sqe = ring->uring->getSqe();
+    }
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = ring->wakeFd;
+    sqe->poll32_events = POLLIN;
+    sqe->user_data = kWakePollData;
+    ring->wakeArmed = true;
+  }
+  // 登记之前的tickle找不到睡着的线程时，这次不阻塞
+  if (beginSleep(ring)) {
+    timeout_ms = 0;
+  }
+  // 一次io_uring_enter提交攒下的SQE并等待完成
+  if (ring->uring->submit(1, timeout_ms) < 0) {
+    std::cout << "io_uring_enter errno,err: " << errno << std::endl;
+  }
+  endSleep(ring);
+  if (!reapRing(ring)) {
+    return 0;
+  }
+  return epoll_wait(ring->epfd, events, max_events, 0);
+}
+
+bool IOManager::beginSleep(Poller *poller) {
+  Spinlock::Lock lock(idleLock_);
+  poller->sleeping = true;
+  idlePollers_.push_back(poller);
+  bool missed = missedWake_;
+  missedWake_ = false;
+  return missed;
+}
+
+void IOManager::endSleep(Poller *poller) {
+  Spinlock::Lock lock(idleLock_);
+  if (poller->sleeping) {
+    poller->sleeping = false;
+    idlePollers_.erase(std::find(idlePollers_.begin(), idlePollers_.end(), poller));
+  } else {
+    // 被tickle选中唤醒，之后的tickle可以再去唤醒别的线程
+    wakePending_ = false;
+  }
+}
+
+uint64_t IOManager::ringEnterCount() {
+  Mutex::Lock lock(ringMutex_);
+  uint64_t cnt = 0;
+  for (auto &poller : pollers_) {
+    if (poller->uring) {
+      cnt += poller->uring->enterCount();
+    }
+  }
+  return cnt;
+}
+
 // 通知调度器有任务到来
 void IOManager::tickle() {
   if (!isHasIdleThreads()) {
     // 此时没有空闲的调度线程
     return;
   }
-  // 写pipe管道，使得idle协程凑够epoll_wait退出，开始调度任务
-  int rt = write(tickleFds_[1], "T", 1);
-  CondPanic(rt == 1, "write pipe error");
+  // 已经有一个唤醒在路上
+  if (wakePending_.exchange(true)) {
+    return;
+  }
+  if (!canWakeThread()) {
+    // 写共享的eventfd，使得一个idle协程从epoll_wait退出，开始调度任务
+    wake(tickleFd_);
+    return;
+  }
+  Poller *target = nullptr;
+  {
+    Spinlock::Lock lock(idleLock_);
+    if (!idlePollers_.empty()) {
+      target = idlePollers_.back();
+      idlePollers_.pop_back();
+      target->sleeping = false;
+    } else {
+      // 线程已经计入空闲但还没登记，记下来，它登记时不会睡下去
+      missedWake_ = true;
+    }
+  }
+  if (target == nullptr) {
+    wakePending_ = false;
+    return;
+  }
+  wake(target->wakeFd);
+}
+
+void IOManager::wake(int fd) {
+  ++wakeupCnt_;
+  int rt = eventfd_write(fd, 1);
+  CondPanic(rt == 0, "write eventfd error");
 }
 
 // 调度器无任务则阻塞在idle线程上
@@ -240,6 +586,13 @@ void IOManager::idle() {
   const uint64_t MAX_EVENTS = 256;
   epoll_event *events = new epoll_event[MAX_EVENTS]();
   std::shared_ptr<epoll_event> shared_events(events, [](epoll_event *ptr) { delete[] ptr; });
+  // 能定向唤醒时，之后在本线程上添加的定时器放在本线程自己的时间轮上。共享epoll模式下tickle只能唤醒任意一个线程，
+  // 被唤醒的线程处理不了别人的时间轮，另一个线程重置得更早的定时器要等到属主线程自己醒来才触发，因此都用共享时间轮
+  if (canWakeThread()) {
+    attachThreadWheel();
+  }
+  attachPoller();
+  Poller *poller = t_poller;
 
   while (true) {
     // std::cout << "[IOManager] idle begin..." << std::endl;
@@ -247,6 +600,8 @@ void IOManager::idle() {
     uint64_t next_timeout = 0;
     if (stopping(next_timeout)) {
       std::cout << "name=" << getName() << "idle stopping exit";
+      // 停止时发出的tickle被合并成了一次，把唤醒传给下一个还睡着的线程
+      tickle();
       break;
     }
 
@@ -261,14 +616,27 @@ void IOManager::idle() {
         next_timeout = MAX_TIMEOUT;
       }
       // 阻塞等待事件就绪
-      ret = epoll_wait(epfd_, events, MAX_EVENTS, (int)next_timeout);
+      uint64_t pollStart = GetElapsedNS();
+      Poller *ring = currentRing();
+      if (ring) {
+        ret = waitRing(ring, events, MAX_EVENTS, (int)next_timeout);
+      } else if (canWakeThread()) {
+        if (beginSleep(poller)) {
+          next_timeout = 0;
+        }
+        ret = epoll_wait(poller->epfd, events, MAX_EVENTS, (int)next_timeout);
+        endSleep(poller);
+      } else {
+        ret = epoll_wait(epfd_, events, MAX_EVENTS, (int)next_timeout);
+      }
+      recordPollTime(GetElapsedNS() - pollStart);
       // std::cout << "wait..." << std::endl;
       if (ret < 0) {
         if (errno == EINTR) {
           // 系统调用被信号中断
           continue;
         }
-        std::cout << "epoll_wait [" << epfd_ << "] errno,err: " << errno << std::endl;
+        std::cout << "epoll_wait [" << poller->epfd << "] errno,err: " << errno << std::endl;
         break;
       } else {
         break;
@@ -287,12 +655,17 @@ void IOManager::idle() {
 
     for (int i = 0; i < ret; i++) {
       epoll_event &event = events[i];
-      if (event.data.fd == tickleFds_[0]) {
-        // pipe管道内数据无意义，只是tickle意义,读完即可
-        uint8_t dummy[256];
-        // TODO：ET下阻塞读取可能有问题
-        while (read(tickleFds_[0], dummy, sizeof(dummy)) > 0)
-          ;
+      if (event.data.fd == tickleFd_) {
+        // eventfd的计数无意义，只是tickle意义，一次读完清零；先读再清标记，之后的tickle一定会重新写
+        eventfd_t cnt;
+        eventfd_read(tickleFd_, &cnt);
+        wakePending_ = false;
+        continue;
+      }
+      if (event.data.fd == poller->wakeFd) {
+        // 分片模式下的定向唤醒，标记已经在endSleep里处理
+        eventfd_t cnt;
+        eventfd_read(poller->wakeFd, &cnt);
         continue;
       }
 
@@ -324,9 +697,9 @@ void IOManager::idle() {
       int op = left_events ? EPOLL_CTL_MOD : EPOLL_CTL_DEL;
       event.events = EPOLLET | left_events;
 
-      int ret2 = epoll_ctl(epfd_, op, fd_ctx->fd, &event);
+      int ret2 = epoll_ctl(poller->epfd, op, fd_ctx->fd, &event);
       if (ret2) {
-        std::cout << "epoll_wait [" << epfd_ << "] errno,err: " << errno << std::endl;
+        std::cout << "epoll_wait [" << poller->epfd << "] errno,err: " << errno << std::endl;
         continue;
       }
       // 处理已就绪事件 （加入scheduler tasklist,未调度执行）
@@ -360,15 +733,27 @@ bool IOManager::stopping(uint64_t &timeout) {
   return timeout == ~0ull && pendingEventCnt_ == 0 && Scheduler::stopping();
 }
 
-void IOManager::contextResize(size_t size) {
-  fdContexts_.resize(size);
-  for (size_t i = 0; i < fdContexts_.size(); i++) {
-    if (!fdContexts_[i]) {
-      fdContexts_[i] = new FdContext;
-      fdContexts_[i]->fd = i;
+// io_uring和分片模式下每个线程睡在自己的eventfd上，可以直接唤醒指定线程；
+// 共享epoll模式下所有线程共用一个eventfd，只能唤醒任意一个，由它把唤醒传下去
+void IOManager::tickleThread(int thread) {
+  if (canWakeThread()) {
+    for (auto &poller : pollers_) {
+      if (poller->thread == thread) {
+        wake(poller->wakeFd);
+        return;
+      }
     }
   }
+  tickle();
+}
+
+void IOManager::OnTimerInsertedAtFront(int thread) {
+  // 定时器在某个线程自己的时间轮上时只有它会处理
+  if (thread == -1) {
+    tickle();
+  } else {
+    tickleThread(thread);
+  }
 }
-void IOManager::OnTimerInsertedAtFront() { tickle(); }
 
 }  // namespace monsoon
@@ -0,0 +1,17 @@
+#include "mutex.hpp"
+#include <errno.h>
+
+namespace monsoon {
+Semaphore::Semaphore(uint32_t count) { CondPanic(0 == sem_init(&semaphore_, 0, count), "sem_init error"); }
+
+Semaphore::~Semaphore() { sem_destroy(&semaphore_); }
+
+void Semaphore::wait() {
+  while (sem_wait(&semaphore_) != 0) {
+    // 被信号中断时继续等
+    CondPanic(errno == EINTR, "sem_wait error");
+  }
+}
+
+void Semaphore::notify() { CondPanic(0 == sem_post(&semaphore_), "sem_post error"); }
+}  // namespace monsoon
@@ -8,6 +8,58 @@ static thread_local Scheduler *cur_scheduler = nullptr;
 // 当前线程的调度协程，每个线程一个 (协程级调度器)
 static thread_local Fiber *cur_scheduler_fiber = nullptr;
 
+// 连续从LIFO槽取任务的上限，超过后槽里的任务放回队列，避免两个互相唤醒的协程一直霸占线程
+static const int kMaxLifoRuns = 3;
+// 每隔这么多次调度先看一次注入队列，避免本线程的任务源源不断时外部提交的任务饿死
+static const uint32_t kInjectCheckInterval = 61;
+// 每这么多个任务取一个记录调度延迟和执行时间。取一次时间要三十几纳秒，空任务本身不到1微秒，
+// 每个任务都计时吞吐会掉一成；计数不受影响，每个任务都算
+static const uint32_t kMetricsSampleInterval = 8;
+// 空闲前发现还有任务在计数里但取不到时，最多马上再找这么多遍，之后照常睡下
+static const int kIdleRetries = 2;
+// 本线程提交的任务数，决定哪个任务计时（非调度线程也有）
+static thread_local uint32_t t_sample_tick = 0;
+
+struct Scheduler::Worker {
+  WorkStealingQueue<SchedulerTask> queue;
+  // 本线程刚唤醒的协程，只放一个，新的会把旧的挤进队列
+  std::atomic<SchedulerTask *> lifoSlot = {nullptr};
+  int threadId = -1;
+  // 正在idle里睡着（或者马上要睡），别的线程据此决定是否需要把指定线程的任务的唤醒传给它
+  std::atomic<bool> parked = {false};
+  int index = 0;
+  uint32_t tick = 0;
+  int lifoRuns = 0;
+  uint32_t rand = 0;  // 选择偷取对象的随机数（xorshift）
+
+  // 统计：都只由本线程写，getMetrics()在别的线程读；单独一个缓存行，不和别的线程来偷的字段挤在一起
+  alignas(64) std::atomic<uint64_t> scheduled = {0};
+  std::atomic<uint64_t> run = {0};
+  std::atomic<uint64_t> stolen = {0};
+  std::atomic<uint64_t> switches = {0};
+  std::atomic<uint64_t> pollNs = {0};
+  LatencyHistogram scheduleDelay;
+  LatencyHistogram runTime;
+};
+thread_local Scheduler::Worker *Scheduler::t_worker = nullptr;
+
+// 单写者的计数，不需要原子的读-改-写（lock前缀）
+static inline void Bump(std::atomic<uint64_t> &cnt, uint64_t n = 1) {
+  cnt.store(cnt.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+// Park()挂起协程之后要在调度协程上执行的回调
+static thread_local void (*t_park_after)(void *) = nullptr;
+static thread_local void *t_park_arg = nullptr;
+
+static void RunParkCallback() {
+  if (t_park_after != nullptr) {
+    void (*after)(void *) = t_park_after;
+    t_park_after = nullptr;
+    after(t_park_arg);
+  }
+}
+
 const std::string LOG_HEAD = "[scheduler] ";
 
 Scheduler::Scheduler(size_t threads, bool use_caller, const std::string &name) {
@@ -39,14 +91,45 @@ Scheduler::Scheduler(size_t threads, bool use_caller, const std::string &name) {
     rootThread_ = -1;
   }
   threadCnt_ = threads;
+  for (size_t i = 0; i < threadCnt_ + (use_caller ? 1 : 0); ++i) {
+    workers_.emplace_back(new Worker);
+    workers_.back()->index = i;
+    workers_.back()->rand = i * 2654435761u + 1;
+  }
   std::cout << "-------scheduler init success-------" << std::endl;
 }
 
 Scheduler *Scheduler::GetThis() { return cur_scheduler; }
 Fiber *Scheduler::GetMainFiber() { return cur_scheduler_fiber; }
 void Scheduler::setThis() { cur_scheduler = this; }
+int Scheduler::currentWorkerIndex() const {
+  return cur_scheduler == this && t_worker != nullptr ? t_worker->index : -1;
+}
+void Scheduler::Park(void (*after)(void *), void *arg) {
+  Fiber::ptr cur = Fiber::GetThis();
+  CondPanic(cur->isRunInScheduler(), "park a fiber not run in scheduler");
+  t_park_after = after;
+  t_park_arg = arg;
+  // 和hook里一样，先释放自己的引用再切走，恢复之前由等待队列持有
+  Fiber *raw_ptr = cur.get();
+  cur.reset();
+  raw_ptr->yield();
+}
 Scheduler::~Scheduler() {
   CondPanic(isStopped_, "isstopped is false");
+  // 正常停止时队列都是空的，这里只是兜底
+  for (auto &worker : workers_) {
+    while (SchedulerTask *task = worker->queue.pop()) {
+      delete task;
+    }
+    delete worker->lifoSlot.exchange(nullptr);
+  }
+  for (SchedulerTask *task : injectQueue_) {
+    delete task;
+  }
+  for (SchedulerTask *task : pinnedTasks_) {
+    delete task;
+  }
   if (GetThis() == this) {
     cur_scheduler = nullptr;
   }
@@ -69,6 +152,159 @@ void Scheduler::start() {
   }
 }
 
+bool Scheduler::enqueue(SchedulerTask *task) {
+  if (++t_sample_tick % kMetricsSampleInterval == 0) {
+    task->enqueueNs_ = GetElapsedNS();
+  }
+  Worker *self = cur_scheduler == this ? t_worker : nullptr;
+  if (self != nullptr) {
+    Bump(self->scheduled);
+  } else {
+    injectedTotal_.fetch_add(1, std::memory_order_relaxed);
+  }
+  if (task->thread_ != -1) {
+    Mutex::Lock lock(mutex_);
+    pinnedTasks_.push_back(task);
+    ++pendingPinnedTasks_;
+    return true;
+  }
+  // 先计数再入队：空闲前的检查看到计数就不会睡下去，任务稍后一定能取到。
+  // 原来就有任务在等时不用唤醒，取到任务的线程发现还有剩余会接着唤醒下一个
+  bool wasEmpty = pendingTasks_++ == 0;
+  if (self == nullptr) {
+    Mutex::Lock lock(mutex_);
+    injectQueue_.push_back(task);
+    ++injectCnt_;
+  } else if (task->fiber_) {
+    // 被唤醒的协程放进LIFO槽，原来槽里的任务挤进队列
+    SchedulerTask *prev = self->lifoSlot.exchange(task);
+    if (prev != nullptr) {
+      self->queue.push(prev);
+    }
+  } else {
+    self->queue.push(task);
+  }
+  return wasEmpty && isHasIdleThreads();
+}
+
+SchedulerTask *Scheduler::popInject() {
+  if (injectCnt_ == 0) {
+    return nullptr;
+  }
+  Mutex::Lock lock(mutex_);
+  if (injectQueue_.empty()) {
+    return nullptr;
+  }
+  SchedulerTask *task = injectQueue_.front();
+  injectQueue_.pop_front();
+  --injectCnt_;
+  return task;
+}
+
+SchedulerTask *Scheduler::popPinned() {
+  Mutex::Lock lock(mutex_);
+  for (auto it = pinnedTasks_.begin(); it != pinnedTasks_.end(); ++it) {
+    if ((*it)->thread_ == GetThreadId()) {
+      SchedulerTask *task = *it;
+      pinnedTasks_.erase(it);
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+bool Scheduler::checkPinnedTasks(Worker *self) {
+  bool wakeOther = false;
+  {
+    Mutex::Lock lock(mutex_);
+    for (SchedulerTask *task : pinnedTasks_) {
+      if (task->thread_ == self->threadId) {
+        return true;
+      }
+      if (canWakeThread()) {
+        continue;  // 提交时已经直接唤醒了目标线程
+      }
+      for (const auto &worker : workers_) {
+        if (worker->threadId == task->thread_ && worker->parked) {
+          wakeOther = true;
+        }
+      }
+    }
+  }
+  if (wakeOther) {
+    // 共享唤醒时只能唤醒任意一个线程，不是目标线程的话它会再传一次
+    tickle();
+  }
+  return false;
+}
+
+SchedulerTask *Scheduler::steal(Worker *self) {
+  size_t n = workers_.size();
+  self->rand ^= self->rand << 13;
+  self->rand ^= self->rand >> 17;
+  self->rand ^= self->rand << 5;
+  size_t start = self->rand % n;
+  for (size_t i = 0; i < n; ++i) {
+    Worker *victim = workers_[(start + i) % n].get();
+    if (victim != self) {
+      SchedulerTask *task = victim->queue.steal();
+      if (task != nullptr) {
+        return task;
+      }
+    }
+  }
+  // 队列都空了，最后才拿别的线程LIFO槽里的任务（它的线程正忙）
+  for (size_t i = 0; i < n; ++i) {
+    Worker *victim = workers_[(start + i) % n].get();
+    if (victim != self && victim->lifoSlot.load(std::memory_order_relaxed) != nullptr) {
+      SchedulerTask *task = victim->lifoSlot.exchange(nullptr);
+      if (task != nullptr) {
+        return task;
+      }
+    }
+  }
+  return nullptr;
+}
+
+SchedulerTask *Scheduler::nextTask(Worker *self) {
+  SchedulerTask *task = nullptr;
+  if (pendingPinnedTasks_ > 0 && (task = popPinned()) != nullptr) {
+    // 先计活跃再减等待数，stopping()不会在两者之间看到都为0
+    ++activeThreadCnt_;
+    --pendingPinnedTasks_;
+    return task;
+  }
+  if (++self->tick % kInjectCheckInterval == 0) {
+    task = popInject();
+  }
+  if (task == nullptr) {
+    if (self->lifoRuns < kMaxLifoRuns) {
+      task = self->lifoSlot.exchange(nullptr);
+      self->lifoRuns = task != nullptr ? self->lifoRuns + 1 : 0;
+    } else {
+      SchedulerTask *prev = self->lifoSlot.exchange(nullptr);
+      if (prev != nullptr) {
+        self->queue.push(prev);
+      }
+      self->lifoRuns = 0;
+    }
+  }
+  if (task == nullptr) {
+    task = self->queue.pop();
+  }
+  if (task == nullptr) {
+    task = popInject();
+  }
+  if (task == nullptr && (task = steal(self)) != nullptr) {
+    Bump(self->stolen);
+  }
+  if (task != nullptr) {
+    ++activeThreadCnt_;
+    --pendingTasks_;
+  }
+  return task;
+}
+
 // 调度协程
 void Scheduler::run() {
   std::cout << LOG_HEAD << "begin run" << std::endl;
@@ -78,80 +314,145 @@ void Scheduler::run() {
     // 如果当前线程不是caller线程，则初始化该线程的调度协程
     cur_scheduler_fiber = Fiber::GetThis().get();
   }
+  // 认领一个worker
+  size_t index = nextWorker_++;
+  CondPanic(index < workers_.size(), "more scheduling threads than workers");
+  Worker *self = workers_[index].get();
+  self->threadId = GetThreadId();
+  t_worker = self;
 
   // 创建idle协程
   Fiber::ptr idleFiber(new Fiber(std::bind(&Scheduler::idle, this)));
   Fiber::ptr cbFiber;
+  int idleRetries = 0;
 
-  SchedulerTask task;
   while (true) {
-    task.reset();
-    // 是否通知其他线程进行任务调度
-    bool tickle_me = false;
-    {
-      Mutex::Lock lock(mutex_);
-      auto it = tasks_.begin();
-      while (it != tasks_.end()) {
-        // 发现已经指定调度线程，但是不是在当前线程进行调度
-        // 需要通知其他线程进行调度，并跳过当前任务
-        if (it->thread_ != -1 && it->thread_ != GetThreadId()) {
-          ++it;
-          tickle_me = true;
-          continue;
+    SchedulerTask *task = nextTask(self);
+    if (task != nullptr) {
+      CondPanic(task->fiber_ || task->cb_, "task is nullptr");
+      idleRetries = 0;
+      // 当前线程拿出一个任务后还有任务在等，唤醒空闲线程来偷
+      if (pendingTasks_ > 0) {
+        tickle();
+      }
+      Fiber::ptr fiber;
+      std::function<void()> cb;
+      fiber.swap(task->fiber_);
+      cb.swap(task->cb_);
+      // 不计时的任务start为0
+      uint64_t start = 0;
+      if (task->enqueueNs_ != 0) {
+        start = GetElapsedNS();
+        self->scheduleDelay.record(start - task->enqueueNs_);
+      }
+      delete task;
+      Bump(self->run);
+      Bump(self->switches);
+
+      if (fiber) {
+        CondPanic(fiber->getState() == Fiber::READY, "fiber task state error");
+        // 开始执行 协程任务
+        fiber->resume();
+        if (start != 0) {
+          self->runTime.record(GetElapsedNS() - start);
+        }
+        // 执行结束
+        --activeThreadCnt_;
+        fiber.reset();
+        RunParkCallback();
+      } else {
+        if (cbFiber) {
+          cbFiber->reset(cb);
+        } else {
+          cbFiber.reset(new Fiber(cb));
         }
-        CondPanic(it->fiber_ || it->cb_, "task is nullptr");
-        if (it->fiber_) {
-          CondPanic(it->fiber_->getState() == Fiber::READY, "fiber task state error");
+        cb = nullptr;
+        cbFiber->resume();
+        if (start != 0) {
+          self->runTime.record(GetElapsedNS() - start);
         }
-        // 找到一个可进行任务，准备开始调度，从任务队列取出，活动线程加1
-        task = *it;
-        tasks_.erase(it++);
-        ++activeThreadCnt_;
-        break;
+        --activeThreadCnt_;
+        // 回调执行完了就留着协程（和它的栈）给下一个回调任务复用；
+        // 中途让出的协程已经被别处持有，之后会在别的地方恢复，这里不能再复用
+        if (cbFiber->getState() != Fiber::TERM) {
+          cbFiber.reset();
+        }
+        // 状态检查完之后才能放开挂起的协程，之后它随时可能在别的线程上恢复
+        RunParkCallback();
       }
-      // 当前线程拿出一个任务后，同时任务队列不空，那么告诉其他线程
-      tickle_me |= (it != tasks_.end());
-    }
-    if (tickle_me) {
-      tickle();
+      continue;
     }
 
-    if (task.fiber_) {
-      // 开始执行 协程任务
-      task.fiber_->resume();
-      // 执行结束
-      --activeThreadCnt_;
-      task.reset();
-    } else if (task.cb_) {
-      if (cbFiber) {
-        cbFiber->reset(task.cb_);
-      } else {
-        cbFiber.reset(new Fiber(task.cb_));
-      }
-      task.reset();
-      cbFiber->resume();
-      --activeThreadCnt_;
-      cbFiber.reset();
-    } else {
-      // 任务队列为空
-      if (idleFiber->getState() == Fiber::TERM) {
-        std::cout << "idle fiber term" << std::endl;
-        break;
-      }
-      // idle协程不断空轮转
-      ++idleThreadCnt_;
-      idleFiber->resume();
+    // 任务队列为空
+    if (idleFiber->getState() == Fiber::TERM) {
+      std::cout << "idle fiber term" << std::endl;
+      break;
+    }
+    // 先登记空闲再确认一次没有任务，和enqueue的 先计数、再检查空闲线程 配合，不会漏掉唤醒
+    self->parked = true;
+    ++idleThreadCnt_;
+    if (pendingTasks_ > 0 && idleRetries < kIdleRetries) {
+      // 任务已经计数但还没入队，或者偷的时候和别的线程撞上了，马上再找一遍
+      --idleThreadCnt_;
+      self->parked = false;
+      ++idleRetries;
+      continue;
+    }
+    // 找了几遍还没有的任务在忙碌线程的队列或LIFO槽里（它会自己执行），或者提交方还没入队
+    // （入队后它会看到这里登记的空闲并唤醒），都可以放心睡下，不用空转
+    idleRetries = 0;
+    if (pendingPinnedTasks_ > 0 && checkPinnedTasks(self)) {
       --idleThreadCnt_;
+      self->parked = false;
+      continue;
     }
+    Bump(self->switches);
+    idleFiber->resume();
+    --idleThreadCnt_;
+    self->parked = false;
   }
+  t_worker = nullptr;
   std::cout << "run exit" << std::endl;
 }
 
-void Scheduler::tickle() { std::cout << "tickle" << std::endl; }
+void Scheduler::recordPollTime(uint64_t ns) {
+  if (cur_scheduler == this && t_worker != nullptr) {
+    Bump(t_worker->pollNs, ns);
+  }
+}
+
+SchedulerMetrics Scheduler::getMetrics() const {
+  SchedulerMetrics metrics;
+  metrics.name = name_;
+  metrics.sampleInterval = kMetricsSampleInterval;
+  for (const auto &worker : workers_) {
+    WorkerMetrics w;
+    w.thread = worker->threadId;
+    w.scheduled = worker->scheduled.load(std::memory_order_relaxed);
+    w.run = worker->run.load(std::memory_order_relaxed);
+    w.stolen = worker->stolen.load(std::memory_order_relaxed);
+    w.switches = worker->switches.load(std::memory_order_relaxed);
+    w.pollNs = worker->pollNs.load(std::memory_order_relaxed);
+    int64_t depth = worker->queue.size();
+    w.queueDepth = (depth > 0 ? depth : 0) + (worker->lifoSlot.load(std::memory_order_relaxed) != nullptr ? 1 : 0);
+    metrics.workers.push_back(w);
+    metrics.scheduleDelay.merge(worker->scheduleDelay);
+    metrics.runTime.merge(worker->runTime);
+  }
+  metrics.injected = injectedTotal_.load(std::memory_order_relaxed);
+  metrics.injectDepth = injectCnt_;
+  metrics.pinnedDepth = pendingPinnedTasks_;
+  metrics.pending = pendingTasks_ + pendingPinnedTasks_;
+  metrics.activeThreads = activeThreadCnt_;
+  metrics.idleThreads = idleThreadCnt_;
+  return metrics;
+}
+
+// 基类的idle一直在让出，不会睡下，不需要唤醒
+void Scheduler::tickle() {}
 
 bool Scheduler::stopping() {
-  Mutex::Lock lock(mutex_);
-  return isStopped_ && tasks_.empty() && activeThreadCnt_ == 0;
+  return isStopped_ && pendingTasks_ == 0 && pendingPinnedTasks_ == 0 && activeThreadCnt_ == 0;
 }
 
 void Scheduler::idle() {
@@ -0,0 +1,131 @@
+#include "scheduler_metrics.hpp"
+#include <stdio.h>
+
+namespace monsoon {
+LatencyHistogram::LatencyHistogram() {
+  for (auto &bucket : buckets_) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+  count_.store(0, std::memory_order_relaxed);
+  sum_.store(0, std::memory_order_relaxed);
+  max_.store(0, std::memory_order_relaxed);
+}
+
+LatencyHistogram::LatencyHistogram(const LatencyHistogram &other) : LatencyHistogram() { merge(other); }
+
+LatencyHistogram &LatencyHistogram::operator=(const LatencyHistogram &other) {
+  if (this != &other) {
+    for (auto &bucket : buckets_) {
+      bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+    merge(other);
+  }
+  return *this;
+}
+
+int LatencyHistogram::bucketOf(uint64_t ns) {
+  if (ns < 2 * kSubCount) {
+    return ns;
+  }
+  int shift = 63 - __builtin_clzll(ns) - kSubBits;
+  return (shift + 1) * kSubCount + (int)((ns >> shift) - kSubCount);
+}
+
+uint64_t LatencyHistogram::bucketUpper(int i) {
+  if (i < 2 * kSubCount) {
+    return i;
+  }
+  int shift = i / kSubCount - 1;
+  uint64_t sub = i % kSubCount + kSubCount;
+  return ((sub + 1) << shift) - 1;
+}
+
+// 单写者，不用原子的读-改-写
+void LatencyHistogram::record(uint64_t ns) {
+  std::atomic<uint64_t> &bucket = buckets_[bucketOf(ns)];
+  bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  count_.store(count_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  sum_.store(sum_.load(std::memory_order_relaxed) + ns, std::memory_order_relaxed);
+  if (ns > max_.load(std::memory_order_relaxed)) {
+    max_.store(ns, std::memory_order_relaxed);
+  }
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other) {
+  for (int i = 0; i < kBucketCount; ++i) {
+    uint64_t n = other.buckets_[i].load(std::memory_order_relaxed);
+    if (n != 0) {
+      buckets_[i].store(buckets_[i].load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+  }
+  count_.store(count() + other.count(), std::memory_order_relaxed);
+  sum_.store(sum_.load(std::memory_order_relaxed) + other.sum_.load(std::memory_order_relaxed),
+             std::memory_order_relaxed);
+  if (other.max() > max()) {
+    max_.store(other.max(), std::memory_order_relaxed);
+  }
+}
+
+double LatencyHistogram::mean() const {
+  uint64_t n = count();
+  return n == 0 ? 0 : (double)sum_.load(std::memory_order_relaxed) / n;
+}
+
+uint64_t LatencyHistogram::percentile(double p) const {
+  // 各格子和count不是同一时刻读的，按格子重新数一遍总数
+  uint64_t total = 0;
+  for (const auto &bucket : buckets_) {
+    total += bucket.load(std::memory_order_relaxed);
+  }
+  if (total == 0) {
+    return 0;
+  }
+  uint64_t rank = (uint64_t)(p * total);
+  if (rank >= total) {
+    rank = total - 1;
+  }
+  uint64_t seen = 0;
+  for (int i = 0; i < kBucketCount; ++i) {
+    seen += buckets_[i].load(std::memory_order_relaxed);
+    if (seen > rank) {
+      uint64_t upper = bucketUpper(i);
+      return upper < max() ? upper : max();
+    }
+  }
+  return max();
+}
+
+std::string LatencyHistogram::toString() const {
+  char buf[256];
+  snprintf(buf, sizeof(buf), "count %lu, mean %.1f, p50 %.1f, p90 %.1f, p99 %.1f, p999 %.1f, max %.1f (us)",
+           (unsigned long)count(), mean() / 1000, percentile(0.5) / 1000.0, percentile(0.9) / 1000.0,
+           percentile(0.99) / 1000.0, percentile(0.999) / 1000.0, max() / 1000.0);
+  return buf;
+}
+
+std::string SchedulerMetrics::toString() const {
+  std::string out;
+  char buf[256];
+  snprintf(buf, sizeof(buf), "[scheduler %s] pending %zu (inject %zu, pinned %zu), active %zu, idle %zu, injected %lu\n",
+           name.c_str(), pending, injectDepth, pinnedDepth, activeThreads, idleThreads, (unsigned long)injected);
+  out += buf;
+  snprintf(buf, sizeof(buf), "  %-6s %8s %12s %12s %10s %12s %6s %10s\n", "worker", "thread", "scheduled", "run",
+           "stolen", "switches", "queue", "poll_ms");
+  out += buf;
+  for (size_t i = 0; i < workers.size(); ++i) {
+    const WorkerMetrics &w = workers[i];
+    snprintf(buf, sizeof(buf), "  %-6zu %8d %12lu %12lu %10lu %12lu %6zu %10.1f\n", i, w.thread,
+             (unsigned long)w.scheduled, (unsigned long)w.run, (unsigned long)w.stolen, (unsigned long)w.switches,
+             w.queueDepth, w.pollNs / 1e6);
+    out += buf;
+  }
+  snprintf(buf, sizeof(buf), "  latency sampled 1/%u\n", sampleInterval);
+  out += buf;
+  out += "  schedule->run: " + scheduleDelay.toString() + "\n";
+  out += "  run time:      " + runTime.toString() + "\n";
+  return out;
+}
+}  // namespace monsoon
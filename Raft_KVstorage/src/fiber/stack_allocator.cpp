@@ -0,0 +1,226 @@
+#include "stack_allocator.hpp"
+#include <sys/mman.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <unordered_set>
+#include <vector>
+#include "mutex.hpp"
+#include "utils.hpp"
+
+namespace monsoon {
+// 最小的栈，更小的请求向上取整到这里
+static const size_t kMinStackSize = 16 * 1024;
+// 分级数：16K、32K ... 1M，更大的栈不缓存，单独mmap/munmap
+static const int kClassNum = 7;
+// 一次mmap出的栈个数
+static const size_t kSlabStacks = 16;
+// 每个线程每一级最多缓存的空闲栈，超出时一半移到全局链表
+static const size_t kThreadCacheStacks = 32;
+// 线程从全局链表一次取回的栈个数
+static const size_t kBatchStacks = 16;
+
+static std::atomic<uint64_t> g_mapped_bytes{0};
+static std::atomic<uint64_t> g_live_stacks{0};
+static std::atomic<uint64_t> g_cached_stacks{0};
+static std::atomic<uint64_t> g_guarded_stacks{0};
+static std::atomic<uint64_t> g_unguarded_stacks{0};
+static std::atomic<bool> g_release_unused{true};
+
+static size_t PageSize() {
+  static const size_t page = sysconf(_SC_PAGESIZE);
+  return page;
+}
+
+// 保护页预算：每个带保护页的栈最多多占2个VMA，只用vm.max_map_count的一半，剩下的留给堆、线程栈等
+static std::atomic<int64_t> &GuardBudget() {
+  static std::atomic<int64_t> budget([]() -> int64_t {
+    int64_t maxMapCount = 65530;
+    std::ifstream in("/proc/sys/vm/max_map_count");
+    in >> maxMapCount;
+    return maxMapCount / 4;
+  }());
+  return budget;
+}
+
+// 从保护页预算中取出一个，预算用完时返回false，不会扣成负数
+static bool TakeGuardBudget() {
+  std::atomic<int64_t> &budget = GuardBudget();
+  int64_t left = budget.load(std::memory_order_relaxed);
+  while (left > 0) {
+    if (budget.compare_exchange_weak(left, left - 1, std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static int ClassOf(size_t size) {
+  int cls = 0;
+  for (size_t s = kMinStackSize; cls < kClassNum; s <<= 1, ++cls) {
+    if (size == s) {
+      return cls;
+    }
+  }
+  return -1;
+}
+
+// 全局空闲链表，进程退出时不释放，避免和线程缓存的析构顺序问题
+struct GlobalStackList {
+  Mutex mutex;
+  std::vector<void *> free[kClassNum];
+  // 超出保护页预算、单独分配的大栈，munmap时用来确定统计项
+  std::unordered_set<void *> unguardedLarge;
+};
+
+static GlobalStackList &Global() {
+  static GlobalStackList *global = new GlobalStackList;
+  return *global;
+}
+
+// 把stacks最前面（最早放回、最冷）的n个空闲栈移到全局链表，按设置把物理页还给系统
+static void PushGlobal(int cls, std::vector<void *> &stacks, size_t n) {
+  n = std::min(n, stacks.size());
+  if (n == 0) {
+    return;
+  }
+  if (g_release_unused) {
+    size_t size = kMinStackSize << cls;
+    for (size_t i = 0; i < n; ++i) {
+      madvise(stacks[i], size, MADV_DONTNEED);
+    }
+  }
+  {
+    GlobalStackList &global = Global();
+    Mutex::Lock lock(global.mutex);
+    global.free[cls].insert(global.free[cls].end(), stacks.begin(), stacks.begin() + n);
+  }
+  stacks.erase(stacks.begin(), stacks.begin() + n);
+}
+
+struct ThreadStackCache {
+  std::vector<void *> free[kClassNum];
+  ~ThreadStackCache();
+};
+
+static thread_local bool t_cache_destroyed = false;
+
+ThreadStackCache::~ThreadStackCache() {
+  for (int cls = 0; cls < kClassNum; ++cls) {
+    PushGlobal(cls, free[cls], free[cls].size());
+  }
+  t_cache_destroyed = true;
+}
+
+static thread_local ThreadStackCache t_cache;
+
+// mmap出n个size大小的栈，每个栈的低地址端是保护页（栈向低地址增长）
+static void MapStacks(size_t size, size_t n, std::vector<void *> *out) {
+  size_t page = PageSize();
+  size_t slot = size + page;
+  void *base = mmap(nullptr, slot * n, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  CondPanic(base != MAP_FAILED, "mmap fiber stack failed");
+  g_mapped_bytes += slot * n;
+  for (size_t i = 0; i < n; ++i) {
+    char *guard = static_cast<char *>(base) + slot * i;
+    bool guarded = TakeGuardBudget();
+    if (guarded && mprotect(guard, page, PROT_NONE) != 0) {
+      ++GuardBudget();  // 没装上，预算还回去
+      guarded = false;
+    }
+    if (guarded) {
+      ++g_guarded_stacks;
+    } else {
+      ++g_unguarded_stacks;
+      if (n == 1) {
+        GlobalStackList &global = Global();
+        Mutex::Lock lock(global.mutex);
+        global.unguardedLarge.insert(guard + page);
+      }
+    }
+    out->push_back(guard + page);
+  }
+}
+
+size_t StackAllocator::RoundUp(size_t size) {
+  size_t maxClassSize = kMinStackSize << (kClassNum - 1);
+  if (size <= maxClassSize) {
+    size_t s = kMinStackSize;
+    while (s < size) {
+      s <<= 1;
+    }
+    return s;
+  }
+  // 超出分级的大栈按页对齐
+  size_t page = PageSize();
+  return (size + page - 1) / page * page;
+}
+
+void *StackAllocator::Alloc(size_t size) {
+  ++g_live_stacks;
+  int cls = ClassOf(size);
+  std::vector<void *> stacks;
+  if (cls == -1) {
+    MapStacks(size, 1, &stacks);
+    return stacks.back();
+  }
+  // 线程退出阶段线程缓存已经析构，用临时链表，剩下的栈最后放回全局
+  std::vector<void *> &list = t_cache_destroyed ? stacks : t_cache.free[cls];
+  if (list.empty()) {
+    GlobalStackList &global = Global();
+    Mutex::Lock lock(global.mutex);
+    std::vector<void *> &globalList = global.free[cls];
+    size_t n = std::min(kBatchStacks, globalList.size());
+    list.insert(list.end(), globalList.end() - n, globalList.end());
+    globalList.resize(globalList.size() - n);
+  }
+  if (list.empty()) {
+    MapStacks(size, kSlabStacks, &list);
+    g_cached_stacks += kSlabStacks;
+  }
+  void *stack = list.back();
+  list.pop_back();
+  --g_cached_stacks;
+  PushGlobal(cls, stacks, stacks.size());
+  return stack;
+}
+
+void StackAllocator::Delete(void *vp, size_t size) {
+  --g_live_stacks;
+  int cls = ClassOf(size);
+  if (cls == -1) {
+    size_t page = PageSize();
+    {
+      GlobalStackList &global = Global();
+      Mutex::Lock lock(global.mutex);
+      if (global.unguardedLarge.erase(vp) != 0) {
+        --g_unguarded_stacks;
+      } else {
+        --g_guarded_stacks;
+        ++GuardBudget();
+      }
+    }
+    munmap(static_cast<char *>(vp) - page, size + page);
+    g_mapped_bytes -= size + page;
+    return;
+  }
+  ++g_cached_stacks;
+  if (t_cache_destroyed) {
+    std::vector<void *> stacks{vp};
+    PushGlobal(cls, stacks, 1);
+    return;
+  }
+  std::vector<void *> &list = t_cache.free[cls];
+  list.push_back(vp);
+  if (list.size() > kThreadCacheStacks) {
+    PushGlobal(cls, list, kThreadCacheStacks / 2);
+  }
+}
+
+void StackAllocator::SetReleaseUnused(bool release) { g_release_unused = release; }
+
+StackAllocator::Stats StackAllocator::GetStats() {
+  return Stats{g_mapped_bytes, g_live_stacks, g_cached_stacks, g_guarded_stacks, g_unguarded_stacks};
+}
+}  // namespace monsoon
@@ -1,52 +1,225 @@
 #include "timer.hpp"
+#include <algorithm>
 #include "utils.hpp"
 
 namespace monsoon {
-bool Timer::Comparator::operator()(const Timer::ptr &lhs, const Timer::ptr &rhs) const {
-  if (!lhs && !rhs) {
-    return false;
+// 分层时间轮：第0层256个槽，每槽1ms；第1~4层各64个槽，每槽是下一层转一圈的时长，
+// 一共覆盖2^32ms（约49天），更远的定时器先放在最高层，转下来时再按真实时间重新放置
+static const int kLevels = 5;
+static const int kRootBits = 8;
+static const int kLevelBits = 6;
+static const uint64_t kRootSlots = 1ull << kRootBits;
+static const uint64_t kLevelSlots = 1ull << kLevelBits;
+
+// 第level层每个槽的时长是 2^shift ms
+static int ShiftOf(int level) { return level == 0 ? 0 : kRootBits + kLevelBits * (level - 1); }
+
+class TimerWheel {
+ public:
+  explicit TimerWheel(uint64_t now) : current_(now) {
+    std::fill(root_, root_ + kRootSlots, nullptr);
+    std::fill(&levels_[0][0], &levels_[0][0] + (kLevels - 1) * kLevelSlots, nullptr);
+    std::fill(counts_, counts_ + kLevels, 0);
   }
-  if (!lhs) {
-    return true;
+
+  // 放到到期时间对应的槽里
+  void add(Timer *timer) {
+    int level = 0;
+    Timer **slot = slotFor(timer->next_, &level);
+    timer->slot_ = slot;
+    timer->prevTimer_ = nullptr;
+    timer->nextTimer_ = *slot;
+    if (*slot != nullptr) {
+      (*slot)->prevTimer_ = timer;
+    }
+    *slot = timer;
+    ++counts_[level];
+    ++size_;
   }
-  if (!rhs) {
-    return false;
+
+  void remove(Timer *timer) {
+    if (timer->prevTimer_ != nullptr) {
+      timer->prevTimer_->nextTimer_ = timer->nextTimer_;
+    } else {
+      *timer->slot_ = timer->nextTimer_;
+    }
+    if (timer->nextTimer_ != nullptr) {
+      timer->nextTimer_->prevTimer_ = timer->prevTimer_;
+    }
+    --counts_[levelOf(timer->slot_)];
+    --size_;
+    timer->slot_ = nullptr;
+    timer->prevTimer_ = nullptr;
+    timer->nextTimer_ = nullptr;
   }
-  if (lhs->next_ < rhs->next_) {
-    return true;
+
+  // 下一次需要推进时间轮的时刻：第0层最近的定时器，或者高层最近一个非空槽往下转的时刻（定时器实际到期时间的下界）
+  uint64_t nextExpire() const {
+    if (size_ == 0) {
+      return ~0ull;
+    }
+    uint64_t base = current_ + 1;
+    uint64_t next = ~0ull;
+    if (counts_[0] > 0) {
+      for (uint64_t i = 0; i < kRootSlots; ++i) {
+        if (root_[(base + i) & (kRootSlots - 1)] != nullptr) {
+          next = base + i;
+          break;
+        }
+      }
+    }
+    for (int level = 1; level < kLevels; ++level) {
+      if (counts_[level] == 0) {
+        continue;
+      }
+      int shift = ShiftOf(level);
+      // 不早于base的第一个本层槽边界
+      uint64_t boundary = ((base + (1ull << shift) - 1) >> shift) << shift;
+      for (uint64_t i = 0; i < kLevelSlots && boundary + (i << shift) < next; ++i) {
+        if (levels_[level - 1][((boundary >> shift) + i) & (kLevelSlots - 1)] != nullptr) {
+          next = boundary + (i << shift);
+          break;
+        }
+      }
+    }
+    return next;
   }
-  if (rhs->next_ < lhs->next_) {
-    return false;
+
+  // 把时间轮推进到now，到期的定时器从时间轮上取下来，连同持有的引用一起放进expired
+  void advance(uint64_t now, std::vector<Timer::ptr> &expired) {
+    while (current_ < now && size_ > 0) {
+      // 中间没有定时器的时刻直接跳过
+      uint64_t tick = nextExpire();
+      if (tick > now) {
+        break;
+      }
+      current_ = tick - 1;
+      // tick是第1层的槽边界时把第1层对应槽的定时器往下放，第1层转完一圈时再放第2层的，依此类推
+      for (int level = 1; level < kLevels; ++level) {
+        int shift = ShiftOf(level);
+        if ((tick & ((1ull << shift) - 1)) != 0) {
+          break;
+        }
+        cascade(level, (tick >> shift) & (kLevelSlots - 1));
+      }
+      Timer *&slot = root_[tick & (kRootSlots - 1)];
+      while (slot != nullptr) {
+        Timer *timer = slot;
+        remove(timer);
+        expired.push_back(std::move(timer->self_));
+      }
+      current_ = tick;
+    }
+    current_ = std::max(current_, now);
   }
-  return lhs.get() < rhs.get();
-}
+
+  // 取下所有定时器，放进timers里由调用方在锁外释放
+  void clear(std::vector<Timer::ptr> &timers) {
+    for (Timer **slot = root_; slot != root_ + kRootSlots; ++slot) {
+      clearSlot(slot, timers);
+    }
+    for (Timer **slot = &levels_[0][0]; slot != &levels_[0][0] + (kLevels - 1) * kLevelSlots; ++slot) {
+      clearSlot(slot, timers);
+    }
+  }
+
+  size_t size() const { return size_; }
+
+  Mutex mutex;
+  // 处理这个时间轮的线程最近一次按哪个时刻睡下，比它更早的定时器插入时需要唤醒
+  uint64_t waitUntil = ~0ull;
+  // 睡下之后是否已经唤醒过
+  bool tickled = false;
+  // 调度线程自己的时间轮所属的线程，共享时间轮为-1
+  int ownerThread = -1;
+
+ private:
+  Timer **slotFor(uint64_t expire, int *level) {
+    // 已经过期的定时器在下一个tick触发
+    uint64_t base = current_ + 1;
+    uint64_t e = std::max(expire, base);
+    uint64_t delta = e - base;
+    if (delta < kRootSlots) {
+      *level = 0;
+      return &root_[e & (kRootSlots - 1)];
+    }
+    for (int l = 1; l < kLevels; ++l) {
+      int shift = ShiftOf(l);
+      uint64_t range = 1ull << (shift + kLevelBits);
+      if (delta < range || l == kLevels - 1) {
+        if (delta >= range) {
+          e = base + range - 1;
+        }
+        *level = l;
+        return &levels_[l - 1][(e >> shift) & (kLevelSlots - 1)];
+      }
+    }
+    return nullptr;
+  }
+
+  int levelOf(Timer **slot) const {
+    if (slot >= root_ && slot < root_ + kRootSlots) {
+      return 0;
+    }
+    return (slot - &levels_[0][0]) / kLevelSlots + 1;
+  }
+
+  void cascade(int level, uint64_t index) {
+    Timer *timer = levels_[level - 1][index];
+    while (timer != nullptr) {
+      Timer *next = timer->nextTimer_;
+      remove(timer);
+      add(timer);
+      timer = next;
+    }
+  }
+
+  void clearSlot(Timer **slot, std::vector<Timer::ptr> &timers) {
+    while (*slot != nullptr) {
+      Timer *timer = *slot;
+      remove(timer);
+      timers.push_back(std::move(timer->self_));
+    }
+  }
+
+  Timer *root_[kRootSlots];
+  Timer *levels_[kLevels - 1][kLevelSlots];
+  // 每层的定时器个数，跳过空层
+  size_t counts_[kLevels];
+  size_t size_ = 0;
+  // 已经处理到的时刻（ms）
+  uint64_t current_;
+};
+
+// 当前线程自己的时间轮及其所属的管理器
+static thread_local TimerManager *t_wheel_manager = nullptr;
+static thread_local TimerWheel *t_wheel = nullptr;
+
 Timer::Timer(uint64_t ms, std::function<void()> cb, bool recuring, TimerManager *manager)
     : recurring_(recuring), ms_(ms), cb_(cb), manager_(manager) {
   next_ = GetElapsedMS() + ms_;
 }
-Timer::Timer(uint64_t next) : next_(next) {}
 bool Timer::cancel() {
-  RWMutex::WriteLock lock(manager_->mutex_);
+  Mutex::Lock lock(wheel_->mutex);
   if (cb_) {
     cb_ = nullptr;
-    auto it = manager_->timers_.find(shared_from_this());
-    manager_->timers_.erase(it);
+    if (slot_ != nullptr) {
+      wheel_->remove(this);
+    }
+    // 调用方还持有Timer::ptr，这里不会析构自己
+    self_.reset();
     return true;
   }
   return false;
 }
 bool Timer::refresh() {
-  RWMutex::RWMutex::WriteLock lock(manager_->mutex_);
-  if (!cb_) {
-    return false;
-  }
-  auto it = manager_->timers_.find(shared_from_this());
-  if (it == manager_->timers_.end()) {
+  Mutex::Lock lock(wheel_->mutex);
+  if (!cb_ || slot_ == nullptr) {
     return false;
   }
-  manager_->timers_.erase(it);
+  wheel_->remove(this);
   next_ = GetElapsedMS() + ms_;
-  manager_->timers_.insert(shared_from_this());
+  manager_->schedule(this, lock);
   return true;
 }
 
@@ -57,15 +230,14 @@ bool Timer::reset(uint64_t ms, bool from_now) {
   if (ms == ms_ && !from_now) {
     return true;
   }
-  RWMutex::WriteLock lock(manager_->mutex_);
+  Mutex::Lock lock(wheel_->mutex);
   if (!cb_) {
     return true;
   }
-  auto it = manager_->timers_.find(shared_from_this());
-  if (it == manager_->timers_.end()) {
+  if (slot_ == nullptr) {
     return false;
   }
-  manager_->timers_.erase(it);
+  wheel_->remove(this);
   uint64_t start = 0;
   if (from_now) {
     start = GetElapsedMS();
@@ -74,18 +246,47 @@ bool Timer::reset(uint64_t ms, bool from_now) {
   }
   ms_ = ms;
   next_ = start + ms_;
-  manager_->addTimer(shared_from_this(), lock);
+  manager_->schedule(this, lock);
   return true;
 }
 
-TimerManager::TimerManager() { previouseTime_ = GetElapsedMS(); }
+TimerManager::TimerManager() : sharedWheel_(new TimerWheel(GetElapsedMS())) {}
 
-TimerManager::~TimerManager() {}
+TimerManager::~TimerManager() {
+  // 还在时间轮上的定时器持有自己，取下来打断循环引用
+  std::vector<Timer::ptr> timers;
+  sharedWheel_->clear(timers);
+  for (auto &wheel : threadWheels_) {
+    wheel->clear(timers);
+  }
+  if (t_wheel_manager == this) {
+    t_wheel_manager = nullptr;
+    t_wheel = nullptr;
+  }
+}
+
+void TimerManager::attachThreadWheel() {
+  if (t_wheel_manager == this) {
+    return;
+  }
+  TimerWheel *wheel = new TimerWheel(GetElapsedMS());
+  wheel->ownerThread = GetThreadId();
+  {
+    Mutex::Lock lock(mutex_);
+    threadWheels_.emplace_back(wheel);
+  }
+  t_wheel_manager = this;
+  t_wheel = wheel;
+}
+
+TimerWheel *TimerManager::currentWheel() { return t_wheel_manager == this ? t_wheel : sharedWheel_.get(); }
 
 Timer::ptr TimerManager::addTimer(uint64_t ms, std::function<void()> cb, bool recurring) {
   Timer::ptr timer(new Timer(ms, cb, recurring, this));
-  RWMutex::WriteLock lock(mutex_);
-  addTimer(timer, lock);
+  timer->wheel_ = currentWheel();
+  Mutex::Lock lock(timer->wheel_->mutex);
+  timer->self_ = timer;
+  schedule(timer.get(), lock);
   return timer;
 }
 
@@ -101,87 +302,80 @@ Timer::ptr TimerManager::addConditionTimer(uint64_t ms, std::function<void()> cb
   return addTimer(ms, std::bind(&OnTimer, weak_cond, cb), recurring);
 }
 
+void TimerManager::schedule(Timer *timer, Mutex::Lock &lock) {
+  TimerWheel *wheel = timer->wheel_;
+  wheel->add(timer);
+  // 比处理线程睡下时等待的时刻更早才需要唤醒；线程给自己的时间轮添加时还没睡，睡之前会重新计算
+  bool at_front = wheel != t_wheel && timer->next_ < wheel->waitUntil && !wheel->tickled;
+  if (at_front) {
+    wheel->tickled = true;
+  }
+  int owner = wheel->ownerThread;
+  lock.unlock();
+  if (at_front) {
+    OnTimerInsertedAtFront(owner);
+  }
+}
+
 uint64_t TimerManager::getNextTimer() {
-  RWMutex::ReadLock lock(mutex_);
-  tickled_ = false;
-  if (timers_.empty()) {
+  uint64_t next = ~0ull;
+  TimerWheel *wheels[] = {t_wheel_manager == this ? t_wheel : nullptr, sharedWheel_.get()};
+  for (TimerWheel *wheel : wheels) {
+    if (wheel == nullptr) {
+      continue;
+    }
+    Mutex::Lock lock(wheel->mutex);
+    wheel->tickled = false;
+    wheel->waitUntil = wheel->nextExpire();
+    next = std::min(next, wheel->waitUntil);
+  }
+  if (next == ~0ull) {
     return ~0ull;
   }
-  const Timer::ptr &next = *timers_.begin();
   uint64_t now_ms = GetElapsedMS();
-  if (now_ms >= next->next_) {
-    return 0;
-  } else {
-    return next->next_ - now_ms;
-  }
+  return now_ms >= next ? 0 : next - now_ms;
 }
 
 void TimerManager::listExpiredCb(std::vector<std::function<void()>> &cbs) {
   uint64_t now_ms = GetElapsedMS();
-  std::vector<Timer::ptr> expired;
-  {
-    RWMutex::ReadLock lock(mutex_);
-    if (timers_.empty()) {
-      return;
+  TimerWheel *wheels[] = {t_wheel_manager == this ? t_wheel : nullptr, sharedWheel_.get()};
+  for (TimerWheel *wheel : wheels) {
+    if (wheel == nullptr) {
+      continue;
     }
-  }
-  RWMutex::WriteLock lock(mutex_);
-  if (timers_.empty()) {
-    return;
-  }
-  bool rollover = false;
-  if (detectClockRolllover(now_ms)) {
-    rollover = true;
-  }
-  if (!rollover && ((*timers_.begin())->next_ > now_ms)) {
-    return;
-  }
-
-  Timer::ptr now_timer(new Timer(now_ms));
-  auto it = rollover ? timers_.end() : timers_.lower_bound(now_timer);
-  while (it != timers_.end() && (*it)->next_ == now_ms) {
-    ++it;
-  }
-  expired.insert(expired.begin(), timers_.begin(), it);
-  timers_.erase(timers_.begin(), it);
-
-  cbs.reserve(expired.size());
-  for (auto &timer : expired) {
-    cbs.push_back(timer->cb_);
-    if (timer->recurring_) {
-      // 循环计时，重新加入堆中
-      timer->next_ = now_ms + timer->ms_;
-      timers_.insert(timer);
-    } else {
-      timer->cb_ = nullptr;
+    // 先于锁声明，不再循环的定时器在锁外释放
+    std::vector<Timer::ptr> expired;
+    Mutex::Lock lock(wheel->mutex);
+    wheel->advance(now_ms, expired);
+    for (auto &timer : expired) {
+      cbs.push_back(timer->cb_);
+      if (timer->recurring_) {
+        // 循环计时，重新放回时间轮
+        timer->next_ = now_ms + timer->ms_;
+        timer->self_ = timer;
+        wheel->add(timer.get());
+      } else {
+        timer->cb_ = nullptr;
+      }
     }
   }
 }
 
-void TimerManager::addTimer(Timer::ptr val, RWMutex::WriteLock &lock) {
-  auto it = timers_.insert(val).first;
-  bool at_front = (it == timers_.begin()) && !tickled_;
-  if (at_front) {
-    tickled_ = true;
-  }
-  lock.unlock();
-  if (at_front) {
-    OnTimerInsertedAtFront();
+bool TimerManager::hasTimer() {
+  {
+    Mutex::Lock lock(sharedWheel_->mutex);
+    if (sharedWheel_->size() > 0) {
+      return true;
+    }
   }
-}
-
-bool TimerManager::detectClockRolllover(uint64_t now_ms) {
-  bool rollover = false;
-  if (now_ms < previouseTime_ && now_ms < (previouseTime_ - 60 * 60 * 1000)) {
-    rollover = true;
+  Mutex::Lock lock(mutex_);
+  for (auto &wheel : threadWheels_) {
+    Mutex::Lock wheelLock(wheel->mutex);
+    if (wheel->size() > 0) {
+      return true;
+    }
   }
-  previouseTime_ = now_ms;
-  return rollover;
-}
-
-bool TimerManager::hasTimer() {
-  RWMutex::ReadLock lock(mutex_);
-  return !timers_.empty();
+  return false;
 }
 
-}  // namespace monsoon
\ No newline at end of file
+}  // namespace monsoon
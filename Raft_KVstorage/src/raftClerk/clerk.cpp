@@ -3,16 +3,126 @@
 //
 #include "clerk.h"
 
+#include "compress.h"
 #include "raftServerRpcUtil.h"
 
 #include "util.h"
 
 #include <string>
 #include <vector>
+int Clerk::GroupOf(const std::string& key) {
+  // 最后一个起始key <= key 的组
+  auto it = m_groupRanges.upper_bound(key);
+  --it;
+  return it->second;
+}
+
+int Clerk::EnsureSession(int group, int64_t* epoch) {
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (m_sessionRegistered[group]) {
+      if (epoch != nullptr) {
+        *epoch = m_sessionEpoch[group];
+      }
+      return m_recentLeaderId[group];
+    }
+  }
+  RegisterSession(group);
+  std::lock_guard<std::mutex> lg(m_mtx);
+  if (epoch != nullptr) {
+    *epoch = m_sessionEpoch[group];
+  }
+  return m_recentLeaderId[group];
+}
+
+void Clerk::RegisterSession(int group) {
+  auto& servers = m_servers[group];
+  int server = 0;
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    server = m_recentLeaderId[group];
+  }
+  raftKVRpcProctoc::RegisterSessionArgs args;
+  args.set_clientid(m_clientId);
+  while (true) {
+    raftKVRpcProctoc::RegisterSessionReply reply;
+    bool ok = servers[server]->RegisterSession(&args, &reply);
+    if (ok && reply.err() == OK) {
+      std::lock_guard<std::mutex> lg(m_mtx);
+      m_sessionRegistered[group] = true;
+      m_sessionEpoch[group] = reply.epoch();
+      m_recentLeaderId[group] = server;
+      m_lastActive[group] = std::chrono::steady_clock::now();
+      return;
+    }
+    if (ok && reply.err() == ErrTimeout) {
+      continue;  // 还是leader，只是没等到结果，向同一节点重试
+    }
+    server = (server + 1) % servers.size();
+  }
+}
+
+void Clerk::OnSuccess(int group, int server) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  m_recentLeaderId[group] = server;
+  m_lastActive[group] = std::chrono::steady_clock::now();
+}
+
+int64_t Clerk::OnSessionExpired(int group) {
+  DPrintf("【Clerk::OnSessionExpired】组{%d}上的会话已过期，重新注册", group);
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    m_sessionRegistered[group] = false;
+  }
+  RegisterSession(group);
+  std::lock_guard<std::mutex> lg(m_mtx);
+  return m_sessionEpoch[group];
+}
+
+void Clerk::KeepAliveLoop() {
+  std::unique_lock<std::mutex> lock(m_mtx);
+  while (!m_stop) {
+    m_cv.wait_for(lock, std::chrono::milliseconds(CLERK_KEEPALIVE_INTERVAL));
+    if (m_stop) {
+      break;
+    }
+    auto deadline = std::chrono::steady_clock::now() - std::chrono::milliseconds(CLERK_KEEPALIVE_INTERVAL);
+    for (int group = 0; group < m_servers.size(); ++group) {
+      // 最近有过请求的组不需要额外续期，请求本身就会续期
+      if (!m_sessionRegistered[group] || m_lastActive[group] > deadline) {
+        continue;
+      }
+      int server = m_recentLeaderId[group];
+      lock.unlock();
+      raftKVRpcProctoc::KeepAliveArgs args;
+      args.set_clientid(m_clientId);
+      std::string err;
+      // 只试一轮，没有leader就等下一次，不阻塞析构
+      for (int i = 0; i < m_servers[group].size() && !m_stop; ++i) {
+        raftKVRpcProctoc::KeepAliveReply reply;
+        if (m_servers[group][server]->KeepAlive(&args, &reply) && reply.err() != ErrWrongLeader) {
+          err = reply.err();
+          break;
+        }
+        server = (server + 1) % m_servers[group].size();
+      }
+      lock.lock();
+      if (err == OK) {
+        m_recentLeaderId[group] = server;
+        m_lastActive[group] = std::chrono::steady_clock::now();
+      } else if (err == ErrSessionExpired) {
+        m_sessionRegistered[group] = false;  // 下一次请求时重新注册
+      }
+    }
+  }
+}
+
 std::string Clerk::Get(std::string key) {
   m_requestId++;
   auto requestId = m_requestId;
-  int server = m_recentLeaderId;
+  int group = GroupOf(key);
+  auto& servers = m_servers[group];
+  int server = EnsureSession(group);
   raftKVRpcProctoc::GetArgs args;
   args.set_key(key);
   args.set_clientid(m_clientId);
@@ -20,29 +130,108 @@ std::string Clerk::Get(std::string key) {
 
   while (true) {
     raftKVRpcProctoc::GetReply reply;
-    bool ok = m_servers[server]->Get(&args, &reply);
+    bool ok = servers[server]->Get(&args, &reply);
     if (!ok ||
         reply.err() ==
             ErrWrongLeader) {  //会一直重试，因为requestId没有改变，因此可能会因为RPC的丢失或者其他情况导致重试，kvserver层来保证不重复执行（线性一致性）
-      server = (server + 1) % m_servers.size();
+      server = (server + 1) % servers.size();
       continue;
     }
+    if (reply.err() == ErrTimeout) {
+      continue;  // 还是leader，只是没等到结果，向同一节点重试
+    }
     if (reply.err() == ErrNoKey) {
+      OnSuccess(group, server);
       return "";
     }
     if (reply.err() == OK) {
-      m_recentLeaderId = server;
+      OnSuccess(group, server);
       return reply.value();
     }
   }
   return "";
 }
 
-void Clerk::PutAppend(std::string key, std::string value, std::string op) {
+std::string Clerk::TransferLeadership(int target, int group) {
+  auto& servers = m_servers[group];
+  int server = 0;
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    server = m_recentLeaderId[group];
+  }
+  raftKVRpcProctoc::TransferLeadershipArgs args;
+  args.set_target(target);
+  while (true) {
+    raftKVRpcProctoc::TransferLeadershipReply reply;
+    bool ok = servers[server]->TransferLeadership(&args, &reply);
+    if (!ok || reply.err() == ErrWrongLeader) {
+      server = (server + 1) % servers.size();
+      continue;
+    }
+    if (reply.err() == OK) {
+      std::lock_guard<std::mutex> lg(m_mtx);
+      m_recentLeaderId[group] = target;
+    }
+    return reply.err();
+  }
+}
+
+std::string Clerk::ChangeMembership(raftKVRpcProctoc::ConfChangeType type, int nodeId, const std::string& ip,
+                                    short port, int group) {
+  auto& servers = m_servers[group];
+  int server = 0;
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    server = m_recentLeaderId[group];
+  }
+  raftKVRpcProctoc::ChangeMembershipArgs args;
+  args.set_type(type);
+  args.set_nodeid(nodeId);
+  args.set_ip(ip);
+  args.set_port(port);
+  while (true) {
+    raftKVRpcProctoc::ChangeMembershipReply reply;
+    bool ok = servers[server]->ChangeMembership(&args, &reply);
+    if (!ok || reply.err() == ErrWrongLeader) {
+      server = (server + 1) % servers.size();
+      continue;
+    }
+    if (reply.err() == OK) {
+      std::lock_guard<std::mutex> lg(m_mtx);
+      m_recentLeaderId[group] = server;
+    }
+    return reply.err();
+  }
+}
+
+std::string Clerk::GetStale(std::string key, int maxStaleMs, int server) {
+  int group = GroupOf(key);
+  auto& servers = m_servers[group];
+  raftKVRpcProctoc::GetArgs args;
+  args.set_key(key);
+  args.set_clientid(m_clientId);
+  args.set_maxstalems(maxStaleMs);
+  raftKVRpcProctoc::GetReply reply;
+  bool ok = servers[server % servers.size()]->Get(&args, &reply);
+  if (ok && reply.err() == OK) {
+    return reply.value();
+  }
+  if (ok && reply.err() == ErrNoKey) {
+    return "";
+  }
+  return Get(key);
+}
+
+std::string Clerk::PutAppend(std::string key, std::string value, std::string op) {
   // You will have to modify this function.
   m_requestId++;
   auto requestId = m_requestId;
-  auto server = m_recentLeaderId;
+  int group = GroupOf(key);
+  auto& servers = m_servers[group];
+  int64_t epoch = 0;
+  auto server = EnsureSession(group, &epoch);
+  // 之前的某次尝试可能已经在leader上Start了（rpc失败、超时、leader变更），之后它是否被执行无法确定
+  bool maybeStarted = false;
   while (true) {
     raftKVRpcProctoc::PutAppendArgs args;
     args.set_key(key);
@@ -50,8 +239,9 @@ void Clerk::PutAppend(std::string key, std::string value, std::string op) {
     args.set_op(op);
     args.set_clientid(m_clientId);
     args.set_requestid(requestId);
+    args.set_sessionepoch(epoch);
     raftKVRpcProctoc::PutAppendReply reply;
-    bool ok = m_servers[server]->PutAppend(&args, &reply);
+    bool ok = servers[server]->PutAppend(&args, &reply);
     if (!ok || reply.err() == ErrWrongLeader) {
       DPrintf("【Clerk::PutAppend】原以为的leader：{%d}请求失败，向新leader{%d}重试  ，操作：{%s}", server, server + 1,
               op.c_str());
@@ -61,19 +251,37 @@ void Clerk::PutAppend(std::string key, std::string value, std::string op) {
       if (reply.err() == ErrWrongLeader) {
         DPrintf("重試原因：非leader");
       }
-      server = (server + 1) % m_servers.size();  // try the next server
+      server = (server + 1) % servers.size();  // try the next server
+      maybeStarted = true;
+      continue;
+    }
+    if (reply.err() == ErrTimeout) {
+      maybeStarted = true;
+      continue;  // 还是leader，只是没等到结果，向同一节点重试
+    }
+    if (reply.err() == ErrSessionExpired) {
+      if (maybeStarted) {
+        // 之前的尝试可能在会话过期前已经执行了，判重信息随会话一起丢弃，用新会话重试可能重复执行；
+        // 旧epoch的请求之后也不会再被执行，因此直接放弃，下一个请求重新注册
+        DPrintf("【Clerk::PutAppend】组{%d}上的会话在重试期间过期，请求{%d}是否执行未知，放弃重试", group, requestId);
+        std::lock_guard<std::mutex> lg(m_mtx);
+        m_sessionRegistered[group] = false;
+        return ErrSessionExpired;
+      }
+      // 第一次尝试就发现会话过期，这条请求肯定没有执行，重新注册后用新的epoch重试
+      epoch = OnSessionExpired(group);
       continue;
     }
     if (reply.err() == OK) {  //什么时候reply errno为ok呢？？？
-      m_recentLeaderId = server;
-      return;
+      OnSuccess(group, server);
+      return OK;
     }
   }
 }
 
-void Clerk::Put(std::string key, std::string value) { PutAppend(key, value, "Put"); }
+std::string Clerk::Put(std::string key, std::string value) { return PutAppend(key, value, "Put"); }
 
-void Clerk::Append(std::string key, std::string value) { PutAppend(key, value, "Append"); }
+std::string Clerk::Append(std::string key, std::string value) { return PutAppend(key, value, "Append"); }
 //初始化客户端
 void Clerk::Init(std::string configFileName) {
   //获取所有raft节点ip、port ，并进行连接
@@ -90,14 +298,46 @@ void Clerk::Init(std::string configFileName) {
     }
     ipPortVt.emplace_back(nodeIp, atoi(nodePortStr.c_str()));  //沒有atos方法，可以考慮自己实现
   }
-  //进行连接
+  // multi-raft：groupNum个组，组g负责 [group{g}startKey, group{g+1}startKey) 的key，组0从空串开始
+  int groupNum = std::max(1, atoi(config.Load("groupNum").c_str()));
+  // 开启后clerk发出的较大请求会压缩，服务端也会压缩较大的回复
+  SetCompressEnabledFromConfig(config.Load("compress"));
+  m_groupRanges[""] = 0;
+  for (int g = 1; g < groupNum; ++g) {
+    m_groupRanges[config.Load("group" + std::to_string(g) + "startKey")] = g;
+  }
+  //进行连接，每个节点一个连接，各组共用
+  std::vector<std::shared_ptr<MprpcChannel>> channels;
   for (const auto& item : ipPortVt) {
     std::string ip = item.first;
     short port = item.second;
     // 2024-01-04 todo：bug fix
-    auto* rpc = new raftServerRpcUtil(ip, port);
-    m_servers.push_back(std::shared_ptr<raftServerRpcUtil>(rpc));
+    channels.push_back(std::make_shared<MprpcChannel>(ip, port, false));
+  }
+  std::lock_guard<std::mutex> lg(m_mtx);
+  m_servers.resize(groupNum);
+  m_recentLeaderId.assign(groupNum, 0);
+  m_sessionRegistered.assign(groupNum, false);
+  m_sessionEpoch.assign(groupNum, 0);
+  m_lastActive.assign(groupNum, std::chrono::steady_clock::now());
+  for (int g = 0; g < groupNum; ++g) {
+    for (const auto& channel : channels) {
+      m_servers[g].push_back(std::make_shared<raftServerRpcUtil>(channel, g));
+    }
   }
+  // 会话按需注册（第一次访问某个组时），这里只启动续期线程
+  m_keepAliveThread = std::thread(&Clerk::KeepAliveLoop, this);
 }
 
-Clerk::Clerk() : m_clientId(Uuid()), m_requestId(0), m_recentLeaderId(0) {}
+Clerk::Clerk() : m_clientId(Uuid()), m_requestId(0), m_stop(false) {}
+
+Clerk::~Clerk() {
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    m_stop = true;
+  }
+  m_cv.notify_all();
+  if (m_keepAliveThread.joinable()) {
+    m_keepAliveThread.join();
+  }
+}
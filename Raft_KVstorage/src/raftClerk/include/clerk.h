@@ -10,36 +10,82 @@
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <atomic>
 #include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 #include "kvServerRPC.pb.h"
 #include "mprpcconfig.h"
 class Clerk {
  private:
-  std::vector<std::shared_ptr<raftServerRpcUtil>>
+  // m_servers[group][node]：到每个raft组每个节点的rpc，同一节点上的各组共用一个连接
+  std::vector<std::vector<std::shared_ptr<raftServerRpcUtil>>>
       m_servers;  //保存所有raft节点的fd //todo：全部初始化为-1，表示没有连接上
   std::string m_clientId;
   int m_requestId;
-  int m_recentLeaderId;  //只是有可能是领导
+  std::vector<int> m_recentLeaderId;  //每个组的leader，只是有可能是领导
+  // multi-raft：key范围 -> raft组，key为该组负责的起始key（含），单raft时只有 "" -> 0
+  std::map<std::string, int> m_groupRanges;
+
+  // 会话：每个raft组各自维护会话表，因此按组注册；后台线程给空闲的组续期
+  // m_mtx 保护 m_recentLeaderId、m_sessionRegistered、m_sessionEpoch、m_lastActive，rpc期间不持有
+  std::mutex m_mtx;
+  std::condition_variable m_cv;
+  std::vector<bool> m_sessionRegistered;
+  std::vector<int64_t> m_sessionEpoch;  // 注册时服务端返回的会话epoch，PutAppend要带上
+  std::vector<std::chrono::steady_clock::time_point> m_lastActive;  // 最近一次向该组成功发出请求的时间
+  std::atomic<bool> m_stop;
+  std::thread m_keepAliveThread;
+
+  int GroupOf(const std::string &key);
+
+  // 确保在group上已经注册了会话，返回当前认为的leader，epoch（可以为nullptr）带回会话的epoch
+  int EnsureSession(int group, int64_t *epoch = nullptr);
+  void RegisterSession(int group);
+  void OnSuccess(int group, int server);
+  // 重新注册会话，返回新的epoch
+  int64_t OnSessionExpired(int group);
+  void KeepAliveLoop();
 
   std::string Uuid() {
     return std::to_string(rand()) + std::to_string(rand()) + std::to_string(rand()) + std::to_string(rand());
   }  //用于返回随机的clientId
 
   //    MakeClerk  todo
-  void PutAppend(std::string key, std::string value, std::string op);
+  std::string PutAppend(std::string key, std::string value, std::string op);
 
  public:
   //对外暴露的三个功能和初始化
   void Init(std::string configFileName);
   std::string Get(std::string key);
+  /**
+   * 有界陈旧读：直接在server节点（可以是follower或learner）上读本地数据，最多落后约maxStaleMs毫秒；
+   * 该节点落后太多或者不可用时退化为普通的Get
+   */
+  std::string GetStale(std::string key, int maxStaleMs, int server);
+
+  /**
+   * 写成功返回OK。重试期间会话过期时，之前的尝试是否执行过已经无法判断，这时放弃重试并返回ErrSessionExpired：
+   * 请求最多执行一次，但可能没有执行。Put可以由调用方直接再调用一次，Append需要调用方先读出当前值再决定
+   */
+  std::string Put(std::string key, std::string value);
+  std::string Append(std::string key, std::string value);
+
+  // 运维接口：让group的leader把leadership转移给target节点（滚动重启前使用），返回Err
+  std::string TransferLeadership(int target, int group = 0);
 
-  void Put(std::string key, std::string value);
-  void Append(std::string key, std::string value);
+  // 运维接口：一次增加/删除一个节点，变更提交后返回Err。新节点先以learner加入，追上日志后再改成voter
+  std::string ChangeMembership(raftKVRpcProctoc::ConfChangeType type, int nodeId, const std::string& ip = "",
+                               short port = 0, int group = 0);
 
  public:
   Clerk();
+  ~Clerk();
 };
 
 #endif  // SKIP_LIST_ON_RAFT_CLERK_H
@@ -6,6 +6,7 @@
 #define RAFTSERVERRPC_H
 
 #include <iostream>
+#include <memory>
 #include "kvServerRPC.pb.h"
 #include "mprpcchannel.h"
 #include "mprpccontroller.h"
@@ -15,7 +16,9 @@
 // 对于一个节点来说，对于任意其他的节点都要维护一个rpc连接，
 class raftServerRpcUtil {
  private:
+  std::shared_ptr<MprpcChannel> channel;
   raftKVRpcProctoc::kvServerRpc_Stub* stub;
+  uint32_t groupId;  // multi-raft：请求发往对端节点上的哪个raft组
 
  public:
   //主动调用其他节点的三个方法,可以按照mit6824来调用，但是别的节点调用自己的好像就不行了，要继承protoc提供的service类才行
@@ -23,8 +26,15 @@ class raftServerRpcUtil {
   //响应其他节点的方法
   bool Get(raftKVRpcProctoc::GetArgs* GetArgs, raftKVRpcProctoc::GetReply* reply);
   bool PutAppend(raftKVRpcProctoc::PutAppendArgs* args, raftKVRpcProctoc::PutAppendReply* reply);
+  bool RegisterSession(raftKVRpcProctoc::RegisterSessionArgs* args, raftKVRpcProctoc::RegisterSessionReply* reply);
+  bool KeepAlive(raftKVRpcProctoc::KeepAliveArgs* args, raftKVRpcProctoc::KeepAliveReply* reply);
+  bool TransferLeadership(raftKVRpcProctoc::TransferLeadershipArgs* args,
+                          raftKVRpcProctoc::TransferLeadershipReply* reply);
+  bool ChangeMembership(raftKVRpcProctoc::ChangeMembershipArgs* args, raftKVRpcProctoc::ChangeMembershipReply* reply);
 
   raftServerRpcUtil(std::string ip, short port);
+  // multi-raft：同一节点上的多个raft组共用一个channel
+  raftServerRpcUtil(std::shared_ptr<MprpcChannel> channel, uint32_t groupId);
   ~raftServerRpcUtil();
 };
 
@@ -5,27 +5,64 @@
 
 // kvserver不同于raft节点之间，kvserver的rpc是用于clerk向kvserver调用，不会被调用，因此只用写caller功能，不用写callee功能
 //先开启服务器，再尝试连接其他的节点，中间给一个间隔时间，等待其他的rpc服务器节点启动
-raftServerRpcUtil::raftServerRpcUtil(std::string ip, short port) {
+raftServerRpcUtil::raftServerRpcUtil(std::string ip, short port)
+    : raftServerRpcUtil(std::make_shared<MprpcChannel>(ip, port, false), 0) {}
+
+raftServerRpcUtil::raftServerRpcUtil(std::shared_ptr<MprpcChannel> channel, uint32_t groupId)
+    : channel(std::move(channel)), groupId(groupId) {
   //*********************************************  */
   // 接收rpc设置
   //*********************************************  */
   //发送rpc设置
-  stub = new raftKVRpcProctoc::kvServerRpc_Stub(new MprpcChannel(ip, port, false));
+  stub = new raftKVRpcProctoc::kvServerRpc_Stub(this->channel.get());
 }
 
 raftServerRpcUtil::~raftServerRpcUtil() { delete stub; }
 
 bool raftServerRpcUtil::Get(raftKVRpcProctoc::GetArgs *GetArgs, raftKVRpcProctoc::GetReply *reply) {
   MprpcController controller;
+  controller.SetGroupId(groupId);
   stub->Get(&controller, GetArgs, reply, nullptr);
   return !controller.Failed();
 }
 
 bool raftServerRpcUtil::PutAppend(raftKVRpcProctoc::PutAppendArgs *args, raftKVRpcProctoc::PutAppendReply *reply) {
   MprpcController controller;
+  controller.SetGroupId(groupId);
   stub->PutAppend(&controller, args, reply, nullptr);
   if (controller.Failed()) {
     std::cout << controller.ErrorText() << endl;
   }
   return !controller.Failed();
 }
+
+bool raftServerRpcUtil::RegisterSession(raftKVRpcProctoc::RegisterSessionArgs *args,
+                                        raftKVRpcProctoc::RegisterSessionReply *reply) {
+  MprpcController controller;
+  controller.SetGroupId(groupId);
+  stub->RegisterSession(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::KeepAlive(raftKVRpcProctoc::KeepAliveArgs *args, raftKVRpcProctoc::KeepAliveReply *reply) {
+  MprpcController controller;
+  controller.SetGroupId(groupId);
+  stub->KeepAlive(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::TransferLeadership(raftKVRpcProctoc::TransferLeadershipArgs *args,
+                                           raftKVRpcProctoc::TransferLeadershipReply *reply) {
+  MprpcController controller;
+  controller.SetGroupId(groupId);
+  stub->TransferLeadership(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::ChangeMembership(raftKVRpcProctoc::ChangeMembershipArgs *args,
+                                         raftKVRpcProctoc::ChangeMembershipReply *reply) {
+  MprpcController controller;
+  controller.SetGroupId(groupId);
+  stub->ChangeMembership(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
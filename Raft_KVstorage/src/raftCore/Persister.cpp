@@ -2,120 +2,177 @@
 // Created by swx on 23-5-30.
 //
 #include "Persister.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "blocking_io.hpp"
+#include "compress.h"
+#include "config.h"
 #include "util.h"
 
-// todo:会涉及反复打开文件的操作，没有考虑如果文件出现问题会怎么办？？
-void Persister::Save(const std::string raftstate, const std::string snapshot) {
-  std::lock_guard<std::mutex> lg(m_mtx);
-  clearRaftStateAndSnapshot();
-  // 将raftstate和snapshot写入本地文件
-  m_raftStateOutStream << raftstate;
-  m_snapshotOutStream << snapshot;
-}
+namespace {
+// 压缩过的文件以这个前缀开头，后面一个字节是压缩算法；raft状态和快照都是boost text archive，不会以\0开头，
+// 因此开启、关闭压缩前后写的文件都能读
+const std::string kCompressedFileMagic("\0CZ", 3);
 
-std::string Persister::ReadSnapshot() {
-  std::lock_guard<std::mutex> lg(m_mtx);
-  if (m_snapshotOutStream.is_open()) {
-    m_snapshotOutStream.close();
+std::string encodeForFile(const std::string &data) {
+  std::string compressed;
+  if (CompressEnabled() && data.size() >= COMPRESS_MIN_BYTES && Compress(kCompressZlib, data, &compressed)) {
+    return kCompressedFileMagic + static_cast<char>(kCompressZlib) + compressed;
   }
+  return data;
+}
 
-  DEFER {
-    m_snapshotOutStream.open(m_snapshotFileName);  //默认是追加
-  };
-  std::fstream ifs(m_snapshotFileName, std::ios_base::in);
-  if (!ifs.good()) {
-    return "";
+// 文件损坏（解压失败）时返回false
+bool decodeFromFile(const std::string &data, std::string *out) {
+  if (data.compare(0, kCompressedFileMagic.size(), kCompressedFileMagic) != 0) {
+    *out = data;
+    return true;
+  }
+  size_t headerLen = kCompressedFileMagic.size() + 1;
+  if (data.size() < headerLen ||
+      !Decompress(static_cast<CompressType>(data[kCompressedFileMagic.size()]), data.substr(headerLen), out)) {
+    DPrintf("[func-Persister] 持久化文件解压失败，文件大小:%d", data.size());
+    out->clear();
+    return false;
   }
-  std::string snapshot;
-  ifs >> snapshot;
-  ifs.close();
-  return snapshot;
+  return true;
 }
+}  // namespace
 
-void Persister::SaveRaftState(const std::string &data) {
-  std::lock_guard<std::mutex> lg(m_mtx);
+void Persister::Save(const std::string raftstate, const std::string snapshot) {
+  monsoon::FiberMutex::Lock lock(m_mtx);
   // 将raftstate和snapshot写入本地文件
-  clearRaftState();
-  m_raftStateOutStream << data;
-  m_raftStateSize += data.size();
+  writeFile(m_raftStateFileName, &m_raftStateFd, encodeForFile(raftstate));
+  writeFile(m_snapshotFileName, &m_snapshotFd, encodeForFile(snapshot));
+  m_raftStateSize = raftstate.size();
+}
+
+bool Persister::ReadSnapshot(std::string *snapshot) {
+  monsoon::FiberMutex::Lock lock(m_mtx);
+  return decodeFromFile(readFile(m_snapshotFd), snapshot);
+}
+
+void Persister::SaveRaftState(const std::string &data) {
+  monsoon::FiberMutex::Lock lock(m_mtx);
+  writeFile(m_raftStateFileName, &m_raftStateFd, encodeForFile(data));
+  m_raftStateSize = data.size();  // 按压缩前的大小计算，上层据此决定何时制作快照
 }
 
 long long Persister::RaftStateSize() {
-  std::lock_guard<std::mutex> lg(m_mtx);
+  monsoon::FiberMutex::Lock lock(m_mtx);
 
   return m_raftStateSize;
 }
 
-std::string Persister::ReadRaftState() {
-  std::lock_guard<std::mutex> lg(m_mtx);
-
-  std::fstream ifs(m_raftStateFileName, std::ios_base::in);
-  if (!ifs.good()) {
-    return "";
-  }
-  std::string snapshot;
-  ifs >> snapshot;
-  ifs.close();
-  return snapshot;
+bool Persister::ReadRaftState(std::string *raftState) {
+  monsoon::FiberMutex::Lock lock(m_mtx);
+  return decodeFromFile(readFile(m_raftStateFd), raftState);
 }
 
-Persister::Persister(const int me)
-    : m_raftStateFileName("raftstatePersist" + std::to_string(me) + ".txt"),
-      m_snapshotFileName("snapshotPersist" + std::to_string(me) + ".txt"),
+Persister::Persister(const int me, uint32_t groupId)
+    : m_raftStateFileName("raftstatePersist" + std::to_string(me) +
+                          (groupId == 0 ? "" : "_group" + std::to_string(groupId)) + ".txt"),
+      m_snapshotFileName("snapshotPersist" + std::to_string(me) +
+                         (groupId == 0 ? "" : "_group" + std::to_string(groupId)) + ".txt"),
       m_raftStateSize(0) {
   /**
-   * 检查文件状态并清空文件
+   * 打开并清空文件
    */
-  bool fileOpenFlag = true;
-  std::fstream file(m_raftStateFileName, std::ios::out | std::ios::trunc);
-  if (file.is_open()) {
-    file.close();
-  } else {
-    fileOpenFlag = false;
-  }
-  file = std::fstream(m_snapshotFileName, std::ios::out | std::ios::trunc);
-  if (file.is_open()) {
-    file.close();
-  } else {
-    fileOpenFlag = false;
-  }
-  if (!fileOpenFlag) {
+  m_raftStateFd = open(m_raftStateFileName.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  m_snapshotFd = open(m_snapshotFileName.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (m_raftStateFd < 0 || m_snapshotFd < 0) {
     DPrintf("[func-Persister::Persister] file open error");
   }
-  /**
-   * 绑定流
-   */
-  m_raftStateOutStream.open(m_raftStateFileName);
-  m_snapshotOutStream.open(m_snapshotFileName);
 }
 
 Persister::~Persister() {
-  if (m_raftStateOutStream.is_open()) {
-    m_raftStateOutStream.close();
+  if (m_raftStateFd >= 0) {
+    close(m_raftStateFd);
   }
-  if (m_snapshotOutStream.is_open()) {
-    m_snapshotOutStream.close();
+  if (m_snapshotFd >= 0) {
+    close(m_snapshotFd);
   }
 }
 
-void Persister::clearRaftState() {
-  m_raftStateSize = 0;
-  // 关闭文件流
-  if (m_raftStateOutStream.is_open()) {
-    m_raftStateOutStream.close();
+void Persister::writeFile(const std::string &fileName, int *fd, const std::string &data) {
+  // 新内容完整写进临时文件后再rename替换原文件，rename是原子的：进程在任何时候崩溃，文件要么是旧内容要么是新内容。
+  // 开启PERSIST_SYNC时rename之前先fdatasync临时文件、之后fsync目录，掉电时也不会换成没落盘的内容
+  // open/rename没有hook，显式交给阻塞IO线程池
+  std::string tmpName = fileName + ".tmp";
+  int tmpFd = monsoon::BlockingIoPool::Run(
+      [&tmpName]() -> ssize_t { return open(tmpName.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644); });
+  if (tmpFd < 0) {
+    DPrintf("[func-Persister::writeFile] open %s error, errno:%d", tmpName.c_str(), errno);
+    return;
   }
-  // 重新打开文件流并清空文件内容
-  m_raftStateOutStream.open(m_raftStateFileName, std::ios::out | std::ios::trunc);
-}
-
-void Persister::clearSnapshot() {
-  if (m_snapshotOutStream.is_open()) {
-    m_snapshotOutStream.close();
+  size_t done = 0;
+  while (done < data.size()) {
+    ssize_t n = pwrite(tmpFd, data.data() + done, data.size() - done, done);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      DPrintf("[func-Persister::writeFile] pwrite error, errno:%d", errno);
+      close(tmpFd);
+      return;
+    }
+    done += n;
   }
-  m_snapshotOutStream.open(m_snapshotFileName, std::ios::out | std::ios::trunc);
+  if (PERSIST_SYNC && fdatasync(tmpFd) != 0) {
+    DPrintf("[func-Persister::writeFile] fdatasync error, errno:%d", errno);
+    close(tmpFd);
+    return;
+  }
+  if (monsoon::BlockingIoPool::Run([&tmpName, &fileName]() -> ssize_t {
+        return rename(tmpName.c_str(), fileName.c_str());
+      }) != 0) {
+    DPrintf("[func-Persister::writeFile] rename error, errno:%d", errno);
+    close(tmpFd);
+    return;
+  }
+  if (PERSIST_SYNC) {
+    monsoon::BlockingIoPool::Run([]() -> ssize_t {
+      int dirFd = open(".", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+      if (dirFd < 0) {
+        return -1;
+      }
+      ssize_t rc = fsync(dirFd);
+      ::close(dirFd);
+      return rc;
+    });
+  }
+  // 临时文件已经成了新的原文件，之后就读它
+  if (*fd >= 0) {
+    close(*fd);
+  }
+  *fd = tmpFd;
 }
 
-void Persister::clearRaftStateAndSnapshot() {
-  clearRaftState();
-  clearSnapshot();
+std::string Persister::readFile(int fd) {
+  // 文件只在持锁时修改，按当前大小一次读完；协程栈不大，不在栈上开缓冲区
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    DPrintf("[func-Persister::readFile] fstat error, errno:%d", errno);
+    return "";
+  }
+  std::string data(st.st_size, '\0');
+  size_t done = 0;
+  while (done < data.size()) {
+    ssize_t n = pread(fd, &data[done], data.size() - done, done);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      DPrintf("[func-Persister::readFile] pread error, errno:%d", errno);
+      break;
+    }
+    if (n == 0) {
+      break;
+    }
+    done += n;
+  }
+  data.resize(done);
+  return data;
 }
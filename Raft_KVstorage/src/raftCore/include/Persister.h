@@ -4,11 +4,13 @@
 
 #ifndef SKIP_LIST_ON_RAFT_PERSISTER_H
 #define SKIP_LIST_ON_RAFT_PERSISTER_H
-#include <fstream>
-#include <mutex>
+#include <cstdint>
+#include <string>
+#include "fiber_sync.hpp"
 class Persister {
  private:
-  std::mutex m_mtx;
+  // 在调度协程里读写文件时协程会挂起等IO完成，用协程锁，等锁的协程不会卡住调度线程
+  monsoon::FiberMutex m_mtx;
   std::string m_raftState;
   std::string m_snapshot;
   /**
@@ -20,13 +22,13 @@ class Persister {
    */
   const std::string m_snapshotFileName;
   /**
-   * 保存raftState的输出流
+   * raftState文件，用pread读（协程里由hook交给io_uring或阻塞IO线程池）；每次写入都换成新写好的文件
    */
-  std::ofstream m_raftStateOutStream;
+  int m_raftStateFd;
   /**
-   * 保存snapshot的输出流
+   * snapshot文件
    */
-  std::ofstream m_snapshotOutStream;
+  int m_snapshotFd;
   /**
    * 保存raftStateSize的大小
    * 避免每次都读取文件来获取具体的大小
@@ -35,17 +37,19 @@ class Persister {
 
  public:
   void Save(std::string raftstate, std::string snapshot);
-  std::string ReadSnapshot();
+  // 文件损坏时返回false，out为空
+  bool ReadSnapshot(std::string* snapshot);
   void SaveRaftState(const std::string& data);
   long long RaftStateSize();
-  std::string ReadRaftState();
-  explicit Persister(int me);
+  bool ReadRaftState(std::string* raftState);
+  // groupId：multi-raft时同一进程中的每个raft组各用一组文件，0号组沿用原来的文件名
+  explicit Persister(int me, uint32_t groupId = 0);
   ~Persister();
 
  private:
-  void clearRaftState();
-  void clearSnapshot();
-  void clearRaftStateAndSnapshot();
+  // 用data替换文件的全部内容：写临时文件再rename，成功后*fd换成新文件
+  void writeFile(const std::string& fileName, int* fd, const std::string& data);
+  std::string readFile(int fd);
 };
 
 #endif  // SKIP_LIST_ON_RAFT_PERSISTER_H
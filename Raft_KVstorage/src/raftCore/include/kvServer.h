@@ -15,13 +15,20 @@
 #include <boost/serialization/serialization.hpp>
 #include <boost/serialization/unordered_map.hpp>
 #include <boost/serialization/vector.hpp>
+#include <boost/serialization/version.hpp>
 #include <iostream>
 #include <mutex>
 #include <unordered_map>
+#include "completionRing.h"
 #include "kvServerRPC.pb.h"
 #include "raft.h"
+#include "serialExecutor.h"
+#include "sessionTable.h"
 #include "skipList.h"
 
+class RpcProvider;
+class MprpcConfig;
+
 class KvServer : raftKVRpcProctoc::kvServerRpc {
  private:
   std::mutex m_mtx;
@@ -31,23 +38,64 @@ class KvServer : raftKVRpcProctoc::kvServerRpc {
   int m_maxRaftState;                               // snapshot if log grows this big
 
   // Your definitions here.
-  std::string m_serializedKVData;  // todo ： 序列化后的kv数据，理论上可以不用，但是目前没有找到特别好的替代方法
-  SkipList<std::string, std::string> m_skipList;
-  std::unordered_map<std::string, std::string> m_kvDB;
-
-  std::unordered_map<int, LockQueue<Op> *> waitApplyCh;
-  // index(raft) -> chan  //？？？字段含义   waitApplyCh是一个map，键是int，值是Op类型的管道
-
-  std::unordered_map<std::string, int> m_lastRequestId;  // clientid -> requestID  //一个kV服务器可能连接多个client
+  // 快照时每个分片各自dump出的数据，按分片顺序拼在一起序列化
+  std::vector<std::string> m_serializedShardData;
+
+  // 状态机按key哈希分成 KV_SHARD_NUM 个分片，每个分片有自己的跳表和锁，不同分片的读写/apply互不阻塞
+  // m_mtx 只用于快照的制作/安装；需要同时持有时，按 m_mtx -> m_sessionMtx -> 分片锁 的顺序加锁
+  struct KvShard {
+    std::mutex mtx;
+    std::unique_ptr<SkipList<std::string, std::string>> skipList;
+  };
+  std::vector<std::unique_ptr<KvShard>> m_shards;
+  // 并行apply时分片i(i>=1)交给m_applyWorkers[i-1]执行，分片0由apply线程自己执行
+  // 线程随分片一起创建，之后一直复用
+  std::vector<std::unique_ptr<SerialExecutor>> m_applyWorkers;
+  bool m_useHashIndex;  // 跳表是否附带点查哈希索引，见 KV_HASH_INDEX_DEFAULT
+
+  // index(raft) -> 等待该日志apply的rpc handler，预分配的槽位环，登记/唤醒都不需要拿m_mtx
+  CompletionRing<Op> m_applyWaiters;
+
+  // 客户端会话：clientId -> 最后执行的requestId/活跃时间，过期会话在apply日志时淘汰，见SessionTable
+  std::mutex m_sessionMtx;
+  SessionTable m_sessions;
+  std::string m_serializedSessions;  // 快照时会话表的二进制编码
+  // 加载的快照中各分片是否按ShardIndexOf划分（版本1起），旧快照按std::hash划分，需要按key重新分片
+  bool m_shardDataStable = false;
 
   // last SnapShot point , raftIndex
   int m_lastSnapShotRaftLogIndex;
 
+  // multi-raft：本KvServer所属的raft组，单raft时为0、m_multiRaftNode为空
+  uint32_t m_groupId;
+  MultiRaftNode *m_multiRaftNode;
+
  public:
   KvServer() = delete;
 
   KvServer(int me, int maxraftstate, std::string nodeInforFileName, short port);
 
+  /**
+   * multi-raft：rpc服务、到其他节点的连接、协程调度器都由MultiRaftNode统一创建，这里只创建本组的raft节点和状态机。
+   * 构造函数不阻塞，先RegisterRpcService注册rpc服务，等连接建立后再调用StartInGroup启动。
+   * node为空时不注册rpc服务、不合并心跳，raft节点自己创建调度器，用于进程内的模拟集群（见simNetwork.h）
+   */
+  KvServer(int me, int maxraftstate, uint32_t groupId, MultiRaftNode *node);
+
+  // 把本组的kvServerRpc和raftRpc以组号注册到进程共享的RpcProvider上
+  void RegisterRpcService(RpcProvider &provider);
+
+  void StartInGroup(raftRpcProctoc::ClusterConfig bootstrapConfig, Raft::PeerFactory peerFactory, bool useHashIndex);
+
+  /**
+   * 从配置文件读出初始集群配置：node{i}ip/port给出的所有节点，node{i}learner=1的是learner，
+   * node{i}join=1的节点是之后通过成员变更加入的，不在初始配置中。自己是新加入的节点时返回空配置。
+   * 启动脚本在启动节点之前就把地址写好，因此节点启动时不需要再等待其他节点
+   */
+  static raftRpcProctoc::ClusterConfig LoadBootstrapConfig(MprpcConfig &config, int me);
+
+  std::shared_ptr<Raft> GetRaftNode() { return m_raftNode; }
+
   void StartKVServer();
 
   void DprintfKVDB();
@@ -58,6 +106,13 @@ class KvServer : raftKVRpcProctoc::kvServerRpc {
 
   void ExecutePutOpOnKVDB(Op op);
 
+  // 重新创建所有分片（清空状态机），安装快照前使用
+  void ResetShards();
+
+  // key所在的分片，用稳定的fnv1aHash：分片划分也是快照格式的一部分，换编译器或标准库后必须不变
+  size_t ShardIndexOf(const std::string &key) const;
+  KvShard &ShardOf(const std::string &key);
+
   void Get(const raftKVRpcProctoc::GetArgs *args,
            raftKVRpcProctoc::GetReply
                *reply);  //将 GetArgs 改为rpc调用的，因为是远程客户端，即服务器宕机对客户端来说是无感的
@@ -67,8 +122,38 @@ class KvServer : raftKVRpcProctoc::kvServerRpc {
    */
   void GetCommandFromRaft(ApplyMsg message);
 
+  /**
+   * 批量apply一组连续的command：先按日志顺序判重，再把需要执行的写操作按分片分组，
+   * 各分片交给常驻的m_applyWorkers并行执行
+   * （同一个key一定落在同一个分片，分片内保持日志顺序，因此结果与逐条apply一致）
+   */
+  void GetCommandsFromRaft(std::vector<ApplyMsg> &messages);
+
   bool ifRequestDuplicate(std::string ClientId, int RequestId);
 
+  // ClientId当前会话的epoch，会话不存在返回0
+  int64_t sessionEpoch(const std::string &ClientId);
+
+  // clerk 注册会话/续期，两者都要走raft日志
+  void RegisterSession(const raftKVRpcProctoc::RegisterSessionArgs *args, raftKVRpcProctoc::RegisterSessionReply *reply);
+  void KeepAlive(const raftKVRpcProctoc::KeepAliveArgs *args, raftKVRpcProctoc::KeepAliveReply *reply);
+
+  /**
+   * 把leader转移给组内的target节点，用于滚动重启前主动让出leader。
+   * 阻塞到转移完成（自己不再是leader）或者超时
+   */
+  void TransferLeadership(const raftKVRpcProctoc::TransferLeadershipArgs *args,
+                          raftKVRpcProctoc::TransferLeadershipReply *reply);
+
+  // 成员变更，阻塞到新配置提交或者超时
+  void ChangeMembership(const raftKVRpcProctoc::ChangeMembershipArgs *args,
+                        raftKVRpcProctoc::ChangeMembershipReply *reply);
+
+  /**
+   * 把会话类的op提交给raft并等待apply，返回值为Err；成功时epoch（可以为nullptr）带回会话当前的epoch
+   */
+  std::string StartSessionOp(Op op, int64_t *epoch);
+
   // clerk 使用RPC远程调用
   void PutAppend(const raftKVRpcProctoc::PutAppendArgs *args, raftKVRpcProctoc::PutAppendReply *reply);
 
@@ -94,6 +179,22 @@ class KvServer : raftKVRpcProctoc::kvServerRpc {
   void Get(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::GetArgs *request,
            ::raftKVRpcProctoc::GetReply *response, ::google::protobuf::Closure *done) override;
 
+  void RegisterSession(google::protobuf::RpcController *controller,
+                       const ::raftKVRpcProctoc::RegisterSessionArgs *request,
+                       ::raftKVRpcProctoc::RegisterSessionReply *response, ::google::protobuf::Closure *done) override;
+
+  void KeepAlive(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::KeepAliveArgs *request,
+                 ::raftKVRpcProctoc::KeepAliveReply *response, ::google::protobuf::Closure *done) override;
+
+  void TransferLeadership(google::protobuf::RpcController *controller,
+                          const ::raftKVRpcProctoc::TransferLeadershipArgs *request,
+                          ::raftKVRpcProctoc::TransferLeadershipReply *response,
+                          ::google::protobuf::Closure *done) override;
+
+  void ChangeMembership(google::protobuf::RpcController *controller,
+                        const ::raftKVRpcProctoc::ChangeMembershipArgs *request,
+                        ::raftKVRpcProctoc::ChangeMembershipReply *response, ::google::protobuf::Closure *done) override;
+
   /////////////////serialiazation start ///////////////////////////////
   // notice ： func serialize
  private:
@@ -105,18 +206,31 @@ class KvServer : raftKVRpcProctoc::kvServerRpc {
   template <class Archive>
   void serialize(Archive &ar, const unsigned int version)  //这里面写需要序列话和反序列化的字段
   {
-    ar &m_serializedKVData;
+    ar &m_serializedShardData;
 
     // ar & m_kvDB;
-    ar &m_lastRequestId;
+    ar &m_serializedSessions;
+    if (Archive::is_loading::value) {
+      m_shardDataStable = version >= 1;
+    }
   }
 
   std::string getSnapshotData() {
-    m_serializedKVData = m_skipList.dump_file();
+    // 逐个分片加锁dump，不需要把整个状态机停下来
+    m_serializedShardData.clear();
+    for (auto &shard : m_shards) {
+      std::lock_guard<std::mutex> lg(shard->mtx);
+      m_serializedShardData.push_back(shard->skipList->dump_file());
+    }
+    {
+      std::lock_guard<std::mutex> lg(m_sessionMtx);
+      m_serializedSessions = m_sessions.Encode();
+    }
     std::stringstream ss;
     boost::archive::text_oarchive oa(ss);
     oa << *this;
-    m_serializedKVData.clear();
+    m_serializedShardData.clear();
+    m_serializedSessions.clear();
     return ss.str();
   }
 
@@ -124,11 +238,38 @@ class KvServer : raftKVRpcProctoc::kvServerRpc {
     std::stringstream ss(str);
     boost::archive::text_iarchive ia(ss);
     ia >> *this;
-    m_skipList.load_file(m_serializedKVData);
-    m_serializedKVData.clear();
+    {
+      std::lock_guard<std::mutex> lg(m_sessionMtx);
+      myAssert(m_sessions.Decode(m_serializedSessions), "快照中的会话表解析失败");
+    }
+    m_serializedSessions.clear();
+    ResetShards();
+    if (m_shardDataStable && m_serializedShardData.size() == m_shards.size()) {
+      for (size_t i = 0; i < m_shards.size(); ++i) {
+        m_shards[i]->skipList->load_file(m_serializedShardData[i]);
+      }
+    } else {
+      // 分片数与制作快照时不同（修改了KV_SHARD_NUM），或者是按std::hash分片的旧快照，需要按key重新分片
+      for (const auto &data : m_serializedShardData) {
+        if (data.empty()) {
+          continue;
+        }
+        SkipListDump<std::string, std::string> dumper;
+        std::stringstream iss(data);
+        boost::archive::text_iarchive dumpIa(iss);
+        dumpIa >> dumper;
+        for (size_t i = 0; i < dumper.keyDumpVt_.size(); ++i) {
+          ShardOf(dumper.keyDumpVt_[i]).skipList->insert_set_element(dumper.keyDumpVt_[i], dumper.valDumpVt_[i]);
+        }
+      }
+    }
+    m_serializedShardData.clear();
   }
 
   /////////////////serialiazation end ///////////////////////////////
 };
 
+// 版本1：各分片按fnv1aHash划分
+BOOST_CLASS_VERSION(KvServer, 1)
+
 #endif  // SKIP_LIST_ON_RAFT_KVSERVER_H
@@ -0,0 +1,68 @@
+#ifndef SKIP_LIST_ON_RAFT_MULTIRAFT_H
+#define SKIP_LIST_ON_RAFT_MULTIRAFT_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "kvServer.h"
+#include "mprpcchannel.h"
+#include "raftRPC.pb.h"
+#include "serialExecutor.h"
+
+/// @brief multi-raft：一个进程中运行多个raft组，每个组是一个 Raft + KvServer，负责一段key范围
+/// 进程内所有组共用一个RpcProvider（按RpcHeader中的group_id分发）、一个协程调度器，持久化文件按组号区分。
+/// 同一对节点之间各组的纯心跳在这里攒一小段时间，合并成一个BatchAppendEntries，走到该节点的一条共用连接发送，
+/// 每个节点同一时间最多一个合并心跳在途。带日志的AE、InstallSnapshot和投票请求每个组用自己的连接，
+/// 一个组的大快照或者慢请求不会卡住其他组的复制和心跳
+class MultiRaftNode : public raftRpcProctoc::multiRaftRpc {
+ public:
+  using HeartbeatCallback = std::function<void(std::shared_ptr<raftRpcProctoc::AppendEntriesReply>)>;
+
+  /**
+   * 与KvServer的构造函数类似：启动rpc服务，等待其他节点启动后建立连接，再启动所有raft组。构造函数返回后各组在后台运行
+   * @param groupNum  本进程运行的raft组数量，组号为 0 ~ groupNum-1，每个节点都有每个组的一个副本
+   */
+  MultiRaftNode(int me, int groupNum, int maxraftstate, std::string nodeInforFileName, short port);
+
+  // raft组的leader把发给server节点的纯心跳交给这里，合并发送后在rpc线程中回调callback处理回复。
+  // 同一个组还没发出的旧心跳被新的取代，旧的callback不会被调用
+  void AddHeartbeat(int server, uint32_t groupId, std::shared_ptr<raftRpcProctoc::AppendEntriesArgs> args,
+                    HeartbeatCallback callback);
+
+  std::shared_ptr<monsoon::IOManager> GetIOManager() { return m_ioManager; }
+  std::shared_ptr<KvServer> GetKvServer(uint32_t groupId) { return m_kvServers[groupId]; }
+
+ public:  // for rpc
+  void BatchAppendEntries(google::protobuf::RpcController *controller,
+                          const ::raftRpcProctoc::BatchAppendEntriesArgs *request,
+                          ::raftRpcProctoc::BatchAppendEntriesReply *response, ::google::protobuf::Closure *done) override;
+
+ private:
+  struct PendingHeartbeat {
+    uint32_t groupId;
+    std::shared_ptr<raftRpcProctoc::AppendEntriesArgs> args;
+    HeartbeatCallback callback;
+  };
+
+  // 定时器回调，把每个节点积攒的心跳各合并成一个rpc发出去；上一批还在途的节点这次跳过，心跳留到下次
+  void flushHeartbeats();
+  void sendHeartbeatBatch(int server, std::shared_ptr<raftRpcProctoc::multiRaftRpc_Stub> stub,
+                          std::vector<PendingHeartbeat> batch);
+  // 确保有到member节点的合并心跳连接和发送线程，没有就创建（延迟连接），各组的raft成员变更时也会调用
+  void ensureHeartbeatChannel(const raftRpcProctoc::Member &member);
+
+ private:
+  std::mutex m_mtx;  // 保护m_pendingHeartbeats、m_channels、m_batchStubs、m_heartbeatSenders
+  int m_me;
+  std::shared_ptr<monsoon::IOManager> m_ioManager;
+  std::vector<std::shared_ptr<KvServer>> m_kvServers;  // 下标即组号
+  std::vector<std::shared_ptr<MprpcChannel>> m_channels;  // 到每个节点的合并心跳连接，所有组共用，下标为节点号
+  std::vector<std::shared_ptr<raftRpcProctoc::multiRaftRpc_Stub>> m_batchStubs;
+  // 每个节点一个发送线程，队列只放一批：rpc是阻塞的，对方不通时不会积压线程和请求
+  std::vector<std::shared_ptr<SerialExecutor>> m_heartbeatSenders;
+  std::vector<std::vector<PendingHeartbeat>> m_pendingHeartbeats;  // 下标为目标节点号
+};
+
+#endif  // SKIP_LIST_ON_RAFT_MULTIRAFT_H
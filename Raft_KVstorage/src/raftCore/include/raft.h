@@ -5,6 +5,9 @@
 #include <boost/serialization/vector.hpp>
 #include <chrono>
 #include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -18,6 +21,7 @@
 #include "config.h"
 #include "monsoon.h"
 #include "raftRpcUtil.h"
+#include "serialExecutor.h"
 #include "util.h"
 /// @brief //////////// 网络状态表示  todo：可以在rpc中删除该字段，实际生产中是用不到的.
 constexpr int Disconnected =
@@ -31,10 +35,19 @@ constexpr int Voted = 1;   //本轮已经投过票了
 constexpr int Expire = 2;  //投票（消息、竞选者）过期
 constexpr int Normal = 3;
 
+class MultiRaftNode;
+
 class Raft : public raftRpcProctoc::raftRpc {
+ public:
+  // 集群配置中出现新成员时，用它创建到该成员的rpc
+  using PeerFactory = std::function<std::shared_ptr<RaftRpcUtil>(const raftRpcProctoc::Member &)>;
+
  private:
-  std::mutex m_mtx;
+  // 选举定时器的回调在协程里持锁持久化，写文件时协程会挂起；用协程锁，定时器协程等锁时不会卡住调度线程
+  monsoon::FiberMutex m_mtx;
   std::vector<std::shared_ptr<RaftRpcUtil>> m_peers;
+  // 每个follower一个AE发送线程：AE按构造的顺序发出，回复也按这个顺序处理
+  std::vector<std::shared_ptr<SerialExecutor>> m_appendSenders;
   std::shared_ptr<Persister> m_persister;
   int m_me;
   int m_currentTerm;
@@ -48,6 +61,19 @@ class Raft : public raftRpcProctoc::raftRpc {
   std::vector<int>
       m_nextIndex;  // 这两个状态的下标1开始，因为通常commitIndex和lastApplied从0开始，应该是一个无效的index，因此下标从1开始
   std::vector<int> m_matchIndex;
+  // leader维护的每个follower的复制状态：
+  //   Probe：不确定follower的日志和自己从哪里开始一致，一次只发一个AE试探，收到回复后再发下一个
+  //   Replicate：日志已经对上，发出AE后立即推进nextIndex继续发送，在途的AE个数和字节数受窗口限制
+  //   Snapshot：follower需要的日志已经被压缩，正在发送快照，期间不发AE
+  enum class ProgressState { Probe, Replicate, Snapshot };
+  struct Progress {
+    ProgressState state = ProgressState::Probe;
+    bool probeSent = false;  // Probe状态下有一个AE还没有收到回复
+    std::chrono::_V2::system_clock::time_point probeSentTime;
+    std::deque<std::pair<int, int64_t>> inflights;  // Replicate状态下在途的AE：最后一条日志的index、字节数
+    int64_t inflightBytes = 0;
+  };
+  std::vector<Progress> m_progress;
   enum Status { Follower, Candidate, Leader };
   // 身份
   Status m_status;
@@ -60,39 +86,129 @@ class Raft : public raftRpcProctoc::raftRpc {
   std::chrono::_V2::system_clock::time_point m_lastResetElectionTime;
   // 心跳超时，用于leader
   std::chrono::_V2::system_clock::time_point m_lastResetHearBeatTime;
+  // 选举/心跳定时器，挂在m_ioManager的TimerManager上，重置时间时直接重新调度，不需要轮询
+  monsoon::Timer::ptr m_electionTimer;
+  monsoon::Timer::ptr m_heartBeatTimer;
+
+  // 立即复制：Start()追加日志后通知复制线程，由它按自适应窗口合并后发出AE，不再等待下一次心跳
+  std::condition_variable_any m_replicateCv;
+  int m_pendingReplicate = 0;  // 上次发送之后新追加、还没有发出的日志数
+  std::chrono::steady_clock::time_point m_lastReplicateTime;
+  // commitIndex推进时唤醒applierTicker
+  std::condition_variable_any m_applyCv;
+
+  // PreVote / CheckQuorum，init之前由SetElectionOptions设置，之后只读
+  bool m_preVote = RAFT_PRE_VOTE_DEFAULT;
+  bool m_checkQuorum = RAFT_CHECK_QUORUM_DEFAULT;
+  int m_preVoteRound = 0;  // 每发起一轮预投票加一，用来丢弃之前轮次迟到的回复
+  // 最近一次收到当前leader的AE/快照的时间，在这之后一个最小选举超时内认为leader还活着，不支持别人选举
+  std::chrono::_V2::system_clock::time_point m_lastLeaderContact;
+  // leader：最近一次收到各节点当前term回复的时间，CheckQuorum用
+  std::vector<std::chrono::_V2::system_clock::time_point> m_lastAckTime;
+
+  // 集群成员保存在日志中：追加ConfChange日志后立即按新配置工作（不等提交），日志被截断时重新计算。
+  // m_peers、m_isMember、m_isLearner以及复制状态都以节点号为下标，不是成员的位置m_peers为空
+  PeerFactory m_peerFactory;
+  raftRpcProctoc::ClusterConfig m_config;          // 日志中最新的配置
+  int m_configIndex = 0;                           // m_config所在日志的index，来自快照时为快照点
+  raftRpcProctoc::ClusterConfig m_snapshotConfig;  // 快照点上的配置，随快照持久化
+  std::vector<bool> m_isMember;
+  // learner（不投票的成员）照常接收AE和快照，但是不参与选举，也不计入提交日志、CheckQuorum的多数派
+  std::vector<bool> m_isLearner;
+
+  // leader转移：不为-1时正在把leader转移给该节点，期间不接受新的Start()
+  int m_leadTransferee = -1;
+  bool m_timeoutNowSent = false;
+  std::chrono::_V2::system_clock::time_point m_transferDeadline;
 
   // 2D中用于传入快照点
   // 储存了快照中的最后一个日志的Index和Term
   int m_lastSnapshotIncludeIndex;
   int m_lastSnapshotIncludeTerm;
 
-  // 协程
-  std::unique_ptr<monsoon::IOManager> m_ioManager = nullptr;
+  // 协程，multi-raft时同一进程中的所有raft组共用一个
+  std::shared_ptr<monsoon::IOManager> m_ioManager = nullptr;
+
+  // multi-raft：本raft所属的组，以及负责合并心跳的节点对象（不为空时纯心跳交给它合并发送）
+  uint32_t m_groupId = 0;
+  MultiRaftNode *m_multiRaftNode = nullptr;
 
  public:
   void AppendEntries1(const raftRpcProctoc::AppendEntriesArgs *args, raftRpcProctoc::AppendEntriesReply *reply);
   void applierTicker();
+  // 复制线程：等待Start()的通知，按自适应窗口合并后调用doHeartBeat发出日志
+  void replicatorLoop();
   bool CondInstallSnapshot(int lastIncludedTerm, int lastIncludedIndex, std::string snapshot);
   void doElection();
+  // 发起选举：term+1、给自己投票并发送RequestVote，调用方需持有m_mtx
+  // leadershipTransfer为true表示是收到TimeoutNow后发起的，投票方不检查leader lease
+  void startElection(bool leadershipTransfer = false);
+  // 预投票：以term+1询问其他节点是否会投票，得到多数同意才调用startElection，不修改自己的term
+  void doPreVote();
   /**
-   * \brief 发起心跳，只有leader才需要发起心跳
+   * \brief 向各follower发送AE，只有leader才需要发送
+   * @param heartbeat  true时没有日志可发的follower也发一个心跳；false时只发送有新日志、并且复制窗口允许的
    */
-  void doHeartBeat();
-  // 每隔一段时间检查睡眠时间内有没有重置定时器，没有则说明超时了
-  // 如果有则设置合适睡眠时间：睡眠到重置时间+超时时间
-  void electionTimeOutTicker();
+  void doHeartBeat(bool heartbeat = true);
+  // 按server的复制状态构造并发出一个AE（或者开始发送快照），什么都没有发返回false，调用方需持有m_mtx
+  bool replicateTo(int server, bool heartbeat);
+  // 复制状态切换，都会丢弃在途记录、把nextIndex退回matchIndex+1，调用方需持有m_mtx
+  void becomeProbe(int server);
+  void becomeReplicate(int server);
+  // AE没有送达：Probe状态可以重新试探，Replicate状态下丢了日志，退回Probe重新确定位置
+  void onAppendEntriesFailed(int server, const raftRpcProctoc::AppendEntriesArgs &args);
+  // 通知复制线程有日志要发送，调用方需持有m_mtx
+  void notifyReplicate();
+  // 重置选举时间并重新调度选举定时器，调用方需持有m_mtx
+  void resetElectionTimer();
+  // 选举定时器到期：不是leader就发起选举
+  void onElectionTimeout();
   std::vector<ApplyMsg> getApplyLogs();
   int getNewCommandIndex();
   void getPrevLogInfo(int server, int *preIndex, int *preTerm);
   void GetState(int *term, bool *isLeader);
+  /**
+   * 本地读是否满足新鲜度要求：leader要求最近maxStaleMs内多数节点回复过它；其他节点（包括learner）要求最近maxStaleMs内收到过leader的消息，
+   * 并且已经把当时知道的commitIndex都交给了上层，这样读到的数据最多落后leader约maxStaleMs
+   */
+  bool StaleReadReady(int maxStaleMs);
   void InstallSnapshot(const raftRpcProctoc::InstallSnapshotRequest *args,
                        raftRpcProctoc::InstallSnapshotResponse *reply);
-  void leaderHearBeatTicker();
+  // 当选leader时创建心跳定时器，调用方需持有m_mtx
+  void startHeartBeatTimer();
+  // 心跳定时器到期：是leader就发送心跳，否则取消定时器
+  void onHeartBeatTimeout();
+  // CheckQuorum：leader在最近一个最小选举超时内没有收到多数节点（含自己）的回复，调用方需持有m_mtx
+  bool leaderLostQuorum();
+  // 最近ms毫秒内是否有多数投票节点（含自己）回复过本leader，调用方需持有m_mtx
+  bool quorumAckedWithin(int ms);
+  // 自己是leader，或者最近一个最小选举超时内收到过leader的消息，调用方需持有m_mtx
+  bool inLeaderLease();
+  bool isVoter(int server) { return server < m_isMember.size() && m_isMember[server] && !m_isLearner[server]; }
+  // 投票成员的多数
+  int quorumSize();
+  // 切换到新配置：为新成员创建rpc和复制状态，去掉被移除的成员，调用方需持有m_mtx
+  void applyConfig(const raftRpcProctoc::ClusterConfig &config, int configIndex);
+  // 日志被截断、安装快照或者压缩日志之后，按日志中最后一条ConfChange（没有就是快照中的配置）重新确定配置
+  void rebuildConfig();
+  // logIndex（已经提交）时生效的配置，制作快照时使用
+  raftRpcProctoc::ClusterConfig configAt(int logIndex);
+  // leader追加一条ConfChange日志并立即使用新配置，调用方需持有m_mtx
+  void appendConfigEntry(const raftRpcProctoc::ClusterConfig &config);
+  // 发送rpc的线程不持有m_mtx，通过它取得目标节点的rpc，节点已经被移除时返回空
+  std::shared_ptr<RaftRpcUtil> getPeer(int server);
+  // 正在转移leader且目标节点的日志已经追平，就给它发TimeoutNow，调用方需持有m_mtx
+  void maybeSendTimeoutNow(int server);
+  void sendTimeoutNow(int server, std::shared_ptr<raftRpcProctoc::TimeoutNowArgs> args);
   void leaderSendSnapShot(int server);
+  // 按各投票成员的matchIndex推进commitIndex，调用方需持有m_mtx。
+  // leader推进commitIndex只走这里（AE和快照的回复），把自己移出投票成员的配置提交后也在这里退位
   void leaderUpdateCommitIndex();
   bool matchLog(int logIndex, int logTerm);
   void persist();
   void RequestVote(const raftRpcProctoc::RequestVoteArgs *args, raftRpcProctoc::RequestVoteReply *reply);
+  void RequestPreVote(const raftRpcProctoc::RequestVoteArgs *args, raftRpcProctoc::RequestVoteReply *reply);
+  void TimeoutNow(const raftRpcProctoc::TimeoutNowArgs *args, raftRpcProctoc::TimeoutNowReply *reply);
   bool UpToDate(int index, int term);
   int getLastLogIndex();
   int getLastLogTerm();
@@ -103,8 +219,14 @@ class Raft : public raftRpcProctoc::raftRpc {
 
   bool sendRequestVote(int server, std::shared_ptr<raftRpcProctoc::RequestVoteArgs> args,
                        std::shared_ptr<raftRpcProctoc::RequestVoteReply> reply, std::shared_ptr<int> votedNum);
+  bool sendRequestPreVote(int server, std::shared_ptr<raftRpcProctoc::RequestVoteArgs> args,
+                          std::shared_ptr<raftRpcProctoc::RequestVoteReply> reply, std::shared_ptr<int> grantedNum,
+                          int round);
   bool sendAppendEntries(int server, std::shared_ptr<raftRpcProctoc::AppendEntriesArgs> args,
-                         std::shared_ptr<raftRpcProctoc::AppendEntriesReply> reply, std::shared_ptr<int> appendNums);
+                         std::shared_ptr<raftRpcProctoc::AppendEntriesReply> reply);
+  // 处理AE的回复，直接发送的AE和multi-raft合并发送的心跳共用
+  void handleAppendEntriesReply(int server, std::shared_ptr<raftRpcProctoc::AppendEntriesArgs> args,
+                                std::shared_ptr<raftRpcProctoc::AppendEntriesReply> reply);
 
   // rf.applyChan <- msg //不拿锁执行  可以单独创建一个线程执行，但是为了同意使用std:thread
   // ，避免使用pthread_create，因此专门写一个函数来执行
@@ -112,7 +234,30 @@ class Raft : public raftRpcProctoc::raftRpc {
   void readPersist(std::string data);
   std::string persistData();
 
-  void Start(Op command, int *newLogIndex, int *newLogTerm, bool *isLeader);
+  /**
+   * leader追加一条日志。reserve不为空时在追加之前（仍持有锁、日志还不可能被提交）用新日志的index调用它，
+   * 供上层先登记等待结果，避免apply比登记还快；reserve返回false时不追加，isLeader为true而newLogIndex为-1
+   */
+  void Start(Op command, int *newLogIndex, int *newLogTerm, bool *isLeader,
+             const std::function<bool(int)> &reserve = nullptr);
+  /**
+   * 开始把leader转移给target：停止接受新的Start()，把target的日志追平后发送TimeoutNow让它立即发起选举。
+   * 只负责发起，转移是否完成看自己是否还是leader；RAFT_TRANSFER_LEADER_TIMEOUT内没有完成就放弃
+   * @return 自己不是leader或者target不合法时返回false
+   */
+  bool TransferLeadership(int target);
+  /**
+   * 成员变更：一次只增加、删除或者改变一个节点（单节点变更，新旧配置的多数派一定相交），
+   * 追加一条ConfChange日志，提交后变更完成，用IsCommitted确认。
+   * 上一次变更还没有提交、当选后还没提交过本term的日志、或者变更后没有投票成员时拒绝；
+   * 配置已经是目标状态时直接返回这个配置所在的日志
+   * @param remove  true删除member.Id，false增加member或者修改它的角色
+   * @return 接受返回true，index和term为配置日志的位置
+   */
+  bool ChangeMembership(const raftRpcProctoc::Member &member, bool remove, int *index, int *term, bool *isLeader);
+  // 日志(index, term)是否已经提交
+  bool IsCommitted(int index, int term);
+  raftRpcProctoc::ClusterConfig GetConfig();
 
   // Snapshot the service says it has created a snapshot that has
   // all info up to and including index. this means the
@@ -133,10 +278,27 @@ class Raft : public raftRpcProctoc::raftRpc {
                        ::raftRpcProctoc::InstallSnapshotResponse *response, ::google::protobuf::Closure *done) override;
   void RequestVote(google::protobuf::RpcController *controller, const ::raftRpcProctoc::RequestVoteArgs *request,
                    ::raftRpcProctoc::RequestVoteReply *response, ::google::protobuf::Closure *done) override;
+  void RequestPreVote(google::protobuf::RpcController *controller, const ::raftRpcProctoc::RequestVoteArgs *request,
+                      ::raftRpcProctoc::RequestVoteReply *response, ::google::protobuf::Closure *done) override;
+  void TimeoutNow(google::protobuf::RpcController *controller, const ::raftRpcProctoc::TimeoutNowArgs *request,
+                  ::raftRpcProctoc::TimeoutNowReply *response, ::google::protobuf::Closure *done) override;
 
  public:
-  void init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::shared_ptr<Persister> persister,
-            std::shared_ptr<LockQueue<ApplyMsg>> applyCh);
+  /**
+   * @param ioManager 运行选举、心跳定时器的协程调度器，为空则自己创建一个；multi-raft时传入进程共享的调度器
+   */
+  /**
+   * @param bootstrapConfig 初始集群配置，只在没有持久化状态时使用；新加入的节点传入空配置，等待leader把日志复制过来
+   * @param peerFactory 创建到其他成员的rpc
+   */
+  void init(raftRpcProctoc::ClusterConfig bootstrapConfig, PeerFactory peerFactory, int me,
+            std::shared_ptr<Persister> persister, std::shared_ptr<LockQueue<ApplyMsg>> applyCh,
+            std::shared_ptr<monsoon::IOManager> ioManager = nullptr);
+
+  // multi-raft：在init之前调用，设置组号和合并心跳的节点对象
+  void SetMultiRaft(uint32_t groupId, MultiRaftNode *node);
+  // 在init之前调用，是否开启预投票和CheckQuorum
+  void SetElectionOptions(bool preVote, bool checkQuorum);
 
  private:
   // for persist
@@ -153,12 +315,14 @@ class Raft : public raftRpcProctoc::raftRpc {
       ar &m_votedFor;
       ar &m_lastSnapshotIncludeIndex;
       ar &m_lastSnapshotIncludeTerm;
+      ar &m_snapshotConfig;
       ar &m_logs;
     }
     int m_currentTerm;
     int m_votedFor;
     int m_lastSnapshotIncludeIndex;
     int m_lastSnapshotIncludeTerm;
+    std::string m_snapshotConfig;
     std::vector<std::string> m_logs;
     std::unordered_map<std::string, int> umap;
 
@@ -5,19 +5,33 @@
 #ifndef RAFTRPC_H
 #define RAFTRPC_H
 
+#include <memory>
 #include "raftRPC.pb.h"
 
+class MprpcChannel;
+
 /// @brief 维护当前节点对其他某一个结点的所有rpc发送通信的功能
 // 对于一个raft节点来说，对于任意其他的节点都要维护一个rpc连接，即MprpcChannel
+// multi-raft时每个raft组到同一个节点各有自己的RaftRpcUtil和channel，组号不同（合并心跳另走MultiRaftNode的连接）
+// 各方法是虚函数，进程内模拟集群时由SimRaftRpcUtil替换成直接调用目标节点（见simNetwork.h）
 class RaftRpcUtil {
  private:
+  std::shared_ptr<MprpcChannel> channel_;
   raftRpcProctoc::raftRpc_Stub *stub_;
+  uint32_t groupId_;
+
+ protected:
+  // 给不走真实网络的子类使用，不创建channel和stub
+  RaftRpcUtil() : stub_(nullptr), groupId_(0) {}
 
  public:
   //主动调用其他节点的三个方法,可以按照mit6824来调用，但是别的节点调用自己的好像就不行了，要继承protoc提供的service类才行
-  bool AppendEntries(raftRpcProctoc::AppendEntriesArgs *args, raftRpcProctoc::AppendEntriesReply *response);
-  bool InstallSnapshot(raftRpcProctoc::InstallSnapshotRequest *args, raftRpcProctoc::InstallSnapshotResponse *response);
-  bool RequestVote(raftRpcProctoc::RequestVoteArgs *args, raftRpcProctoc::RequestVoteReply *response);
+  virtual bool AppendEntries(raftRpcProctoc::AppendEntriesArgs *args, raftRpcProctoc::AppendEntriesReply *response);
+  virtual bool InstallSnapshot(raftRpcProctoc::InstallSnapshotRequest *args,
+                               raftRpcProctoc::InstallSnapshotResponse *response);
+  virtual bool RequestVote(raftRpcProctoc::RequestVoteArgs *args, raftRpcProctoc::RequestVoteReply *response);
+  virtual bool RequestPreVote(raftRpcProctoc::RequestVoteArgs *args, raftRpcProctoc::RequestVoteReply *response);
+  virtual bool TimeoutNow(raftRpcProctoc::TimeoutNowArgs *args, raftRpcProctoc::TimeoutNowReply *response);
   //响应其他节点的方法
   /**
    *
@@ -25,7 +39,13 @@ class RaftRpcUtil {
    * @param port  远端端口
    */
   RaftRpcUtil(std::string ip, short port);
-  ~RaftRpcUtil();
+  /**
+   * multi-raft：复用已有的到对端节点的连接
+   * @param channel  到对端节点的channel
+   * @param groupId  本RaftRpcUtil所属的raft组
+   */
+  RaftRpcUtil(std::shared_ptr<MprpcChannel> channel, uint32_t groupId);
+  virtual ~RaftRpcUtil();
 };
 
 #endif  // RAFTRPC_H
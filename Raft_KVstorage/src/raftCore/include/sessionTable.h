@@ -0,0 +1,66 @@
+#ifndef SESSIONTABLE_H
+#define SESSIONTABLE_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+/**
+ * \brief 客户端会话表，替代原来只增不减的 clientId -> lastRequestId。
+ * clerk先通过RegisterSession注册会话，之后的请求按会话判重，空闲时用KeepAlive续期。
+ * 表的所有修改都只在apply日志时发生，时间也只用日志里leader打上的时间戳（Advance推进），
+ * 因此各副本按同样的日志得到完全相同的淘汰结果，不依赖本地时钟。
+ * 会话过期后判重信息随之丢弃，clerk重新注册得到的是一个新的会话，epoch（创建它的日志index）不同；
+ * Put/Append带着发出时的epoch，epoch对不上的一律不执行，
+ * 这样过期前可能已经执行过的请求不会在新会话里被当成新请求再执行一次。
+ * 本身不加锁，由KvServer的m_sessionMtx保护。
+ */
+class SessionTable {
+ public:
+  enum CheckResult {
+    kApply,      // 新请求，已记录，需要执行
+    kDuplicate,  // 重复请求，不执行
+    kNoSession,  // 会话不存在（未注册或已过期），不执行
+  };
+
+  explicit SessionTable(int64_t ttl);
+
+  // 推进状态机时钟（只增不减），并淘汰 lastActive + ttl < 时钟 的会话
+  void Advance(int64_t timestamp);
+  // 注册会话，epoch为这条注册日志的index；已存在时只续期，保留原来的epoch（注册请求可能被clerk重试）
+  void Register(const std::string &clientId, int64_t epoch);
+  // 续期，会话不存在返回false
+  bool Touch(const std::string &clientId);
+  // 按日志顺序判重并记录requestId，同时续期；epoch和当前会话不一致时按会话不存在处理
+  CheckResult CheckAndRecord(const std::string &clientId, int64_t epoch, int requestId);
+
+  // 当前会话的epoch，会话不存在返回0（日志index从1开始）
+  int64_t Epoch(const std::string &clientId) const;
+  bool IsDuplicate(const std::string &clientId, int requestId) const;
+  size_t Size() const { return m_sessions.size(); }
+  int64_t Clock() const { return m_clock; }
+
+  // 快照用的紧凑二进制编码：varint + 按活跃时间排序的会话，活跃时间存与时钟的差值
+  std::string Encode() const;
+  bool Decode(const std::string &data);
+
+ private:
+  struct Session {
+    int64_t epoch;
+    int lastRequestId;
+    int64_t lastActive;
+    std::multimap<int64_t, std::string>::iterator expiryIt;
+  };
+
+  void touch(Session &session);
+
+ private:
+  int64_t m_ttl;
+  int64_t m_clock;  // 最近apply的日志中的最大时间戳
+  std::unordered_map<std::string, Session> m_sessions;
+  // lastActive -> clientId，按活跃时间有序，淘汰时只需要从头部弹出；时钟单调，续期总是插到尾部
+  std::multimap<int64_t, std::string> m_expiry;
+};
+
+#endif  // SESSIONTABLE_H
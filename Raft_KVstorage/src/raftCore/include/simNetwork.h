@@ -0,0 +1,114 @@
+#ifndef SIMNETWORK_H
+#define SIMNETWORK_H
+
+#include <google/protobuf/message.h>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <set>
+#include <unordered_map>
+#include "raftRpcUtil.h"
+
+class Raft;
+
+/**
+ * \brief 进程内的模拟网络：rpc不经过socket，直接在调用方线程里执行目标节点的处理函数，
+ * 请求和回复各经过一次可配置的单程延迟，并可以按概率丢包、按链路制造分区。
+ * 和真实的传输一样，处理函数拿到的是请求的副本、填写的是单独的回复对象，不会和调用方共用消息。
+ * 用来在一个进程里启动整个集群做测试和压测，不需要配置文件，节点也不需要等待彼此启动。
+ * 延迟和丢包取自同一个带种子的随机数发生器。节点和clerk都跑在真实的线程上，消息的先后由线程调度决定，
+ * 同一个种子也不能重现同样的运行过程，种子只用来改变故障分布
+ */
+class SimNetwork {
+ public:
+  // clerk等集群外的调用方使用的节点号，不受Isolate影响
+  static const int kClient = -1;
+
+  explicit SimNetwork(uint64_t seed = 1);
+
+  // 节点注册后其他节点才能访问到它，raft init之前注册
+  void AddNode(int id, Raft *raft);
+  // 创建from访问to的RaftRpcUtil，作为Raft::PeerFactory的返回值
+  std::shared_ptr<RaftRpcUtil> NewPeer(int from, int to);
+
+  // 单程延迟在[minUs, maxUs]之间均匀分布
+  void SetLatency(int minUs, int maxUs);
+  // 请求和回复各自按rate的概率丢失
+  void SetLossRate(double rate);
+  // from发往to的消息是否能送达，只影响这一个方向
+  void SetLink(int from, int to, bool up);
+  // 断开/恢复node和所有其他节点（包括clerk）之间的链路
+  void Isolate(int node, bool isolated);
+
+  /**
+   * 模拟一次rpc：请求经过单程延迟后在目标节点上执行handler(Request *, Response *)，回复再经过一次单程延迟。
+   * 发送时复制一份请求交给handler，handler填写新的回复对象，送达后才复制到response，
+   * 调用方和处理方之间共用消息的错误（真实网络上会暴露出来）在这里也会暴露。
+   * 链路不通或者丢包时，调用方同样要等待延迟之后才知道失败（没有连接错误这种快速失败），response不变
+   * @param replication 是否是日志复制（AppendEntries/InstallSnapshot），计入ReplicatedBytes
+   * @return 回复送达返回true
+   */
+  template <class Request, class Response, class Handler>
+  bool Call(int from, int to, const Request &request, Response *response, Handler handler, bool replication = false) {
+    Request delivered;
+    delivered.CopyFrom(request);
+    Response reply;
+    if (!transfer(from, to, delivered, reply, [&]() { handler(&delivered, &reply); }, replication)) {
+      return false;
+    }
+    response->CopyFrom(reply);
+    return true;
+  }
+
+  Raft *GetRaft(int id);
+
+  int64_t RpcCount() const { return m_rpcCount; }
+  int64_t DroppedCount() const { return m_droppedCount; }
+  // 所有送达的请求和回复的字节数（protobuf编码后的大小）
+  int64_t BytesSent() const { return m_bytesSent; }
+  int64_t ReplicatedBytes() const { return m_replicatedBytes; }
+
+ private:
+  // 按当前的分区和丢包率判断这一条消息能否送达，并返回它的单程延迟
+  bool deliver(int from, int to, int *delayUs);
+  // 请求、回复各走一趟：请求送达后执行handler，回复送达返回true
+  bool transfer(int from, int to, const google::protobuf::Message &request, const google::protobuf::Message &response,
+                const std::function<void()> &handler, bool replication);
+
+  std::mutex m_mtx;
+  std::mt19937_64 m_rand;
+  int m_minLatencyUs;
+  int m_maxLatencyUs;
+  double m_lossRate;
+  std::unordered_map<int, Raft *> m_nodes;
+  std::set<std::pair<int, int>> m_downLinks;
+  std::set<int> m_isolated;
+
+  std::atomic<int64_t> m_rpcCount;
+  std::atomic<int64_t> m_droppedCount;
+  std::atomic<int64_t> m_bytesSent;
+  std::atomic<int64_t> m_replicatedBytes;
+};
+
+/// @brief 通过SimNetwork访问同一进程中其他raft节点的RaftRpcUtil
+class SimRaftRpcUtil : public RaftRpcUtil {
+ public:
+  SimRaftRpcUtil(SimNetwork *network, int from, int to) : m_network(network), m_from(from), m_to(to) {}
+
+  bool AppendEntries(raftRpcProctoc::AppendEntriesArgs *args, raftRpcProctoc::AppendEntriesReply *response) override;
+  bool InstallSnapshot(raftRpcProctoc::InstallSnapshotRequest *args,
+                       raftRpcProctoc::InstallSnapshotResponse *response) override;
+  bool RequestVote(raftRpcProctoc::RequestVoteArgs *args, raftRpcProctoc::RequestVoteReply *response) override;
+  bool RequestPreVote(raftRpcProctoc::RequestVoteArgs *args, raftRpcProctoc::RequestVoteReply *response) override;
+  bool TimeoutNow(raftRpcProctoc::TimeoutNowArgs *args, raftRpcProctoc::TimeoutNowReply *response) override;
+
+ private:
+  SimNetwork *m_network;
+  int m_from;
+  int m_to;
+};
+
+#endif  // SIMNETWORK_H
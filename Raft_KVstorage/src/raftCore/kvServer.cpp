@@ -1,57 +1,89 @@
 #include "kvServer.h"
 
 #include <rpcprovider.h>
+#include <latch>
 
+#include "compress.h"
+#include "mprpcchannel.h"
 #include "mprpcconfig.h"
+#include "multiRaft.h"
+
+// leader发起op时打的时间戳，只用于推进会话时钟
+static int64_t opTimestamp() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(now().time_since_epoch()).count();
+}
 
 void KvServer::DprintfKVDB() {
   if (!Debug) {
     return;
   }
-  std::lock_guard<std::mutex> lg(m_mtx);
-  DEFER {
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lg(shard->mtx);
     // for (const auto &item: m_kvDB) {
     //     DPrintf("[DBInfo ----]Key : %s, Value : %s", &item.first, &item.second);
     // }
-    m_skipList.display_list();
-  };
+    shard->skipList->display_list();
+  }
+}
+
+void KvServer::ResetShards() {
+  if (m_shards.empty()) {
+    for (int i = 0; i < KV_SHARD_NUM; ++i) {
+      m_shards.push_back(std::make_unique<KvShard>());
+    }
+    // 每批apply都要等所有分片执行完才提交下一批，同一个worker上最多还有一个上一批刚count_down、
+    // 尚未返回的任务，容量2足够
+    for (int i = 1; i < KV_SHARD_NUM; ++i) {
+      m_applyWorkers.push_back(std::make_unique<SerialExecutor>(2));
+    }
+  }
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lg(shard->mtx);
+    shard->skipList = std::make_unique<SkipList<std::string, std::string> >(6);
+    shard->skipList->enable_hash_index(m_useHashIndex);
+  }
 }
 
+size_t KvServer::ShardIndexOf(const std::string &key) const { return fnv1aHash(key) % m_shards.size(); }
+
+KvServer::KvShard &KvServer::ShardOf(const std::string &key) { return *m_shards[ShardIndexOf(key)]; }
+
+// 会话表在GetCommandsFromRaft判重时已经按日志顺序更新，这里只负责改分片里的数据
 void KvServer::ExecuteAppendOpOnKVDB(Op op) {
   // if op.IfDuplicate {   //get请求是可重复执行的，因此可以不用判复
   //	return
   // }
-  m_mtx.lock();
+  KvShard &shard = ShardOf(op.Key);
+  std::lock_guard<std::mutex> lg(shard.mtx);
 
-  m_skipList.insert_set_element(op.Key, op.Value);
+  shard.skipList->insert_set_element(op.Key, op.Value);
 
   // if (m_kvDB.find(op.Key) != m_kvDB.end()) {
   //     m_kvDB[op.Key] = m_kvDB[op.Key] + op.Value;
   // } else {
   //     m_kvDB.insert(std::make_pair(op.Key, op.Value));
   // }
-  m_lastRequestId[op.ClientId] = op.RequestId;
-  m_mtx.unlock();
 
   //    DPrintf("[KVServerExeAPPEND-----]ClientId :%d ,RequestID :%d ,Key : %v, value : %v", op.ClientId, op.RequestId,
   //    op.Key, op.Value)
-  DprintfKVDB();
 }
 
 void KvServer::ExecuteGetOpOnKVDB(Op op, std::string *value, bool *exist) {
-  m_mtx.lock();
   *value = "";
   *exist = false;
-  if (m_skipList.search_element(op.Key, *value)) {
-    *exist = true;
-    // *value = m_skipList.se //value已经完成赋值了
+  {
+    KvShard &shard = ShardOf(op.Key);
+    std::lock_guard<std::mutex> lg(shard.mtx);
+    if (shard.skipList->search_element(op.Key, *value)) {
+      *exist = true;
+      // *value = m_skipList.se //value已经完成赋值了
+    }
   }
   // if (m_kvDB.find(op.Key) != m_kvDB.end()) {
   //     *exist = true;
   //     *value = m_kvDB[op.Key];
   // }
-  m_lastRequestId[op.ClientId] = op.RequestId;
-  m_mtx.unlock();
+  // get可以重复执行，不需要记录requestId
 
   if (*exist) {
     //                DPrintf("[KVServerExeGET----]ClientId :%d ,RequestID :%d ,Key : %v, value :%v", op.ClientId,
@@ -60,56 +92,63 @@ void KvServer::ExecuteGetOpOnKVDB(Op op, std::string *value, bool *exist) {
     //        DPrintf("[KVServerExeGET----]ClientId :%d ,RequestID :%d ,Key : %v, But No KEY!!!!", op.ClientId,
     //        op.RequestId, op.Key)
   }
-  DprintfKVDB();
 }
 
 void KvServer::ExecutePutOpOnKVDB(Op op) {
-  m_mtx.lock();
-  m_skipList.insert_set_element(op.Key, op.Value);
+  KvShard &shard = ShardOf(op.Key);
+  std::lock_guard<std::mutex> lg(shard.mtx);
+  shard.skipList->insert_set_element(op.Key, op.Value);
   // m_kvDB[op.Key] = op.Value;
-  m_lastRequestId[op.ClientId] = op.RequestId;
-  m_mtx.unlock();
 
   //    DPrintf("[KVServerExePUT----]ClientId :%d ,RequestID :%d ,Key : %v, value : %v", op.ClientId, op.RequestId,
   //    op.Key, op.Value)
-  DprintfKVDB();
 }
 
 // 处理来自clerk的Get RPC
 void KvServer::Get(const raftKVRpcProctoc::GetArgs *args, raftKVRpcProctoc::GetReply *reply) {
   Op op;
-  op.Operation = "Get";
+  op.Operation = OpType::Get;
   op.Key = args->key();
   op.Value = "";
   op.ClientId = args->clientid();
   op.RequestId = args->requestid();
+  op.Timestamp = opTimestamp();
+
+  if (args->maxstalems() > 0) {
+    // 有界陈旧读：不走raft日志，直接读本地状态机，follower和learner都可以服务
+    if (!m_raftNode->StaleReadReady(args->maxstalems())) {
+      reply->set_err(ErrStale);
+      return;
+    }
+    std::string value;
+    bool exist = false;
+    ExecuteGetOpOnKVDB(op, &value, &exist);
+    reply->set_err(exist ? OK : ErrNoKey);
+    reply->set_value(value);
+    return;
+  }
 
   int raftIndex = -1;
   int _ = -1;
   bool isLeader = false;
-  m_raftNode->Start(op, &raftIndex, &_,
-                    &isLeader);  // raftIndex：raft预计的logIndex
-                                 // ，虽然是预计，但是正确情况下是准确的，op的具体内容对raft来说 是隔离的
+  // op的具体内容对raft来说 是隔离的；追加日志前先在新index对应的槽位上登记，apply再快也不会错过
+  m_raftNode->Start(op, &raftIndex, &_, &isLeader, [this](int index) { return m_applyWaiters.Acquire(index); });
 
   if (!isLeader) {
     reply->set_err(ErrWrongLeader);
     return;
   }
 
-  // create waitForCh
-  m_mtx.lock();
-
-  if (waitApplyCh.find(raftIndex) == waitApplyCh.end()) {
-    waitApplyCh.insert(std::make_pair(raftIndex, new LockQueue<Op>()));
+  // 槽位被占用（极少见）时日志没有追加，让clerk向本节点重试，本节点仍是leader
+  if (raftIndex == -1) {
+    reply->set_err(ErrTimeout);
+    return;
   }
-  auto chForRaftIndex = waitApplyCh[raftIndex];
-
-  m_mtx.unlock();  //直接解锁，等待任务执行完成，不能一直拿锁等待
 
   // timeout
   Op raftCommitOp;
 
-  if (!chForRaftIndex->timeOutPop(CONSENSUS_TIMEOUT, &raftCommitOp)) {
+  if (!m_applyWaiters.Wait(raftIndex, CONSENSUS_TIMEOUT, &raftCommitOp)) {
     //        DPrintf("[GET TIMEOUT!!!]From Client %d (Request %d) To Server %d, key %v, raftIndex %d", args.ClientId,
     //        args.RequestId, kv.me, op.Key, raftIndex)
     // todo 2023年06月01日
@@ -156,54 +195,120 @@ void KvServer::Get(const raftKVRpcProctoc::GetArgs *args, raftKVRpcProctoc::GetR
       //            == op.RequestId{%v}", raftCommitOp.ClientId, op.ClientId, raftCommitOp.RequestId, op.RequestId)
     }
   }
-  m_mtx.lock();  // todo 這個可以先弄一個defer，因爲刪除優先級並不高，先把rpc發回去更加重要
-  auto tmp = waitApplyCh[raftIndex];
-  waitApplyCh.erase(raftIndex);
-  delete tmp;
-  m_mtx.unlock();
 }
 
 void KvServer::GetCommandFromRaft(ApplyMsg message) {
-  Op op;
-  op.parseFromString(message.Command);
+  std::vector<ApplyMsg> messages{std::move(message)};
+  GetCommandsFromRaft(messages);
+}
 
-  DPrintf(
-      "[KvServer::GetCommandFromRaft-kvserver{%d}] , Got Command --> Index:{%d} , ClientId {%s}, RequestId {%d}, "
-      "Opreation {%s}, Key :{%s}, Value :{%s}",
-      m_me, message.CommandIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
-  if (message.CommandIndex <= m_lastSnapShotRaftLogIndex) {
-    return;
+void KvServer::GetCommandsFromRaft(std::vector<ApplyMsg> &messages) {
+  std::vector<Op> ops(messages.size());
+  std::vector<bool> needReply(messages.size(), false);
+  std::vector<std::vector<Op *> > shardOps(m_shards.size());  // 每个分片需要执行的写操作，保持日志顺序
+  int writeNum = 0;
+  int lastIndex = -1;  // 本批中真正apply的最后一条日志
+  {
+    // 判重只需要会话表的锁，不和rpc handler争用m_mtx
+    std::lock_guard<std::mutex> lg(m_sessionMtx);
+    for (size_t i = 0; i < messages.size(); ++i) {
+      Op &op = ops[i];
+      if (!op.parseFromString(messages[i].Command)) {
+        // 所有副本的日志相同，跳过的结果也相同
+        DPrintf("[KvServer::GetCommandFromRaft-kvserver{%d}] Index:{%d} 的command无法解析，跳过", m_me,
+                messages[i].CommandIndex);
+        continue;
+      }
+      DPrintf(
+          "[KvServer::GetCommandFromRaft-kvserver{%d}] , Got Command --> Index:{%d} , ClientId {%s}, RequestId {%d}, "
+          "Opreation {%s}, Key :{%s}, Value :{%s}",
+          m_me, messages[i].CommandIndex, &op.ClientId, op.RequestId, opTypeName(op.Operation), &op.Key, &op.Value);
+      if (messages[i].CommandIndex <= m_lastSnapShotRaftLogIndex) {
+        continue;
+      }
+      needReply[i] = true;
+      lastIndex = messages[i].CommandIndex;
+
+      // 会话时钟只由日志中的时间戳推进，过期会话的淘汰在这里按日志顺序发生，各副本结果一致
+      m_sessions.Advance(op.Timestamp);
+
+      // State Machine (KVServer solute the duplicate problem)
+      // duplicate command will not be exed
+      // 判重必须按日志顺序串行进行，同一批里后出现的重复请求也要能识别出来，因此这里直接更新会话表
+      if (op.Operation == OpType::Put || op.Operation == OpType::Append) {
+        if (m_sessions.CheckAndRecord(op.ClientId, op.SessionEpoch, op.RequestId) == SessionTable::kApply) {
+          shardOps[ShardIndexOf(op.Key)].push_back(&op);
+          writeNum++;
+        }
+      } else if (op.Operation == OpType::RegisterSession) {
+        m_sessions.Register(op.ClientId, messages[i].CommandIndex);
+      } else {
+        // Get、KeepAlive 只续期
+        m_sessions.Touch(op.ClientId);
+      }
+    }
   }
 
-  // State Machine (KVServer solute the duplicate problem)
-  // duplicate command will not be exed
-  if (!ifRequestDuplicate(op.ClientId, op.RequestId)) {
-    // execute command
-    if (op.Operation == "Put") {
-      ExecutePutOpOnKVDB(op);
+  // 同一个key一定在同一个分片，分片内按日志顺序执行，不同分片之间没有冲突，可以并行
+  auto applyShard = [this, &shardOps](size_t idx) {
+    KvShard &shard = *m_shards[idx];
+    std::lock_guard<std::mutex> lg(shard.mtx);
+    for (Op *op : shardOps[idx]) {
+      shard.skipList->insert_set_element(op->Key, op->Value);
     }
-    if (op.Operation == "Append") {
-      ExecuteAppendOpOnKVDB(op);
+  };
+  if (writeNum >= KV_APPLY_PARALLEL_THRESHOLD) {
+    std::vector<size_t> busy;
+    for (size_t idx = 1; idx < shardOps.size(); ++idx) {
+      if (!shardOps[idx].empty()) {
+        busy.push_back(idx);
+      }
+    }
+    std::latch done(static_cast<std::ptrdiff_t>(busy.size()));
+    for (size_t idx : busy) {
+      auto task = [&applyShard, &done, idx]() {
+        applyShard(idx);
+        done.count_down();
+      };
+      if (!m_applyWorkers[idx - 1]->TrySubmit(task)) {
+        task();  // 按上面的容量不会发生，兜底时在本线程执行，不能丢
+      }
+    }
+    applyShard(0);
+    done.wait();
+  } else {
+    for (size_t idx = 0; idx < shardOps.size(); ++idx) {
+      if (!shardOps[idx].empty()) {
+        applyShard(idx);
+      }
     }
-    //  kv.lastRequestId[op.ClientId] = op.RequestId  在Executexxx函数里面更新的
   }
+  if (writeNum > 0) {
+    DprintfKVDB();
+  }
+
   //到这里kvDB已经制作了快照
-  if (m_maxRaftState != -1) {
-    IfNeedToSendSnapShotCommand(message.CommandIndex, 9);
+  if (m_maxRaftState != -1 && lastIndex != -1) {
+    IfNeedToSendSnapShotCommand(lastIndex, 9);
     //如果raft的log太大（大于指定的比例）就把制作快照
   }
 
   // Send message to the chan of op.ClientId
-  SendMessageToWaitChan(op, message.CommandIndex);
+  for (size_t i = 0; i < messages.size(); ++i) {
+    if (needReply[i]) {
+      SendMessageToWaitChan(ops[i], messages[i].CommandIndex);
+    }
+  }
 }
 
 bool KvServer::ifRequestDuplicate(std::string ClientId, int RequestId) {
-  std::lock_guard<std::mutex> lg(m_mtx);
-  if (m_lastRequestId.find(ClientId) == m_lastRequestId.end()) {
-    return false;
-    // todo :不存在这个client就创建
-  }
-  return RequestId <= m_lastRequestId[ClientId];
+  std::lock_guard<std::mutex> lg(m_sessionMtx);
+  return m_sessions.IsDuplicate(ClientId, RequestId);
+}
+
+int64_t KvServer::sessionEpoch(const std::string &ClientId) {
+  std::lock_guard<std::mutex> lg(m_sessionMtx);
+  return m_sessions.Epoch(ClientId);
 }
 
 // get和put//append執行的具體細節是不一樣的
@@ -211,16 +316,25 @@ bool KvServer::ifRequestDuplicate(std::string ClientId, int RequestId) {
 // get函數收到raft消息之後在，因爲get無論是否重複都可以再執行
 void KvServer::PutAppend(const raftKVRpcProctoc::PutAppendArgs *args, raftKVRpcProctoc::PutAppendReply *reply) {
   Op op;
-  op.Operation = args->op();
+  if (args->op() == "Put") {
+    op.Operation = OpType::Put;
+  } else if (args->op() == "Append") {
+    op.Operation = OpType::Append;
+  } else {
+    reply->set_err(ErrUnknownOp);
+    return;
+  }
   op.Key = args->key();
   op.Value = args->value();
   op.ClientId = args->clientid();
   op.RequestId = args->requestid();
+  op.SessionEpoch = args->sessionepoch();
+  op.Timestamp = opTimestamp();
   int raftIndex = -1;
   int _ = -1;
   bool isleader = false;
 
-  m_raftNode->Start(op, &raftIndex, &_, &isleader);
+  m_raftNode->Start(op, &raftIndex, &_, &isleader, [this](int index) { return m_applyWaiters.Acquire(index); });
 
   if (!isleader) {
     DPrintf(
@@ -235,22 +349,20 @@ void KvServer::PutAppend(const raftKVRpcProctoc::PutAppendArgs *args, raftKVRpcP
       "[func -KvServer::PutAppend -kvserver{%d}]From Client %s (Request %d) To Server %d, key %s, raftIndex %d , is "
       "leader ",
       m_me, &args->clientid(), args->requestid(), m_me, &op.Key, raftIndex);
-  m_mtx.lock();
-  if (waitApplyCh.find(raftIndex) == waitApplyCh.end()) {
-    waitApplyCh.insert(std::make_pair(raftIndex, new LockQueue<Op>()));
+  // 槽位被占用（极少见）时日志没有追加，让clerk向本节点重试，本节点仍是leader
+  if (raftIndex == -1) {
+    reply->set_err(ErrTimeout);
+    return;
   }
-  auto chForRaftIndex = waitApplyCh[raftIndex];
-
-  m_mtx.unlock();  //直接解锁，等待任务执行完成，不能一直拿锁等待
 
   // timeout
   Op raftCommitOp;
 
-  if (!chForRaftIndex->timeOutPop(CONSENSUS_TIMEOUT, &raftCommitOp)) {
+  if (!m_applyWaiters.Wait(raftIndex, CONSENSUS_TIMEOUT, &raftCommitOp)) {
     DPrintf(
         "[func -KvServer::PutAppend -kvserver{%d}]TIMEOUT PUTAPPEND !!!! Server %d , get Command <-- Index:%d , "
-        "ClientId %s, RequestId %s, Opreation %s Key :%s, Value :%s",
-        m_me, m_me, raftIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
+        "ClientId %s, RequestId %d, Opreation %s Key :%s, Value :%s",
+        m_me, m_me, raftIndex, &op.ClientId, op.RequestId, opTypeName(op.Operation), &op.Key, &op.Value);
 
     if (ifRequestDuplicate(op.ClientId, op.RequestId)) {
       reply->set_err(OK);  // 超时了,但因为是重复的请求，返回ok，实际上就算没有超时，在真正执行的时候也要判断是否重复
@@ -261,37 +373,168 @@ void KvServer::PutAppend(const raftKVRpcProctoc::PutAppendArgs *args, raftKVRpcP
     DPrintf(
         "[func -KvServer::PutAppend -kvserver{%d}]WaitChanGetRaftApplyMessage<--Server %d , get Command <-- Index:%d , "
         "ClientId %s, RequestId %d, Opreation %s, Key :%s, Value :%s",
-        m_me, m_me, raftIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
+        m_me, m_me, raftIndex, &op.ClientId, op.RequestId, opTypeName(op.Operation), &op.Key, &op.Value);
     if (raftCommitOp.ClientId == op.ClientId && raftCommitOp.RequestId == op.RequestId) {
       //可能发生leader的变更导致日志被覆盖，因此必须检查
-      reply->set_err(OK);
+      // 会话不存在或者已经换了epoch时这条请求在apply时被跳过了，让clerk重新注册
+      reply->set_err(sessionEpoch(op.ClientId) == op.SessionEpoch ? OK : ErrSessionExpired);
     } else {
       reply->set_err(ErrWrongLeader);
     }
   }
+}
+
+std::string KvServer::StartSessionOp(Op op, int64_t *epoch) {
+  op.Timestamp = opTimestamp();
+  int raftIndex = -1;
+  int _ = -1;
+  bool isLeader = false;
+  m_raftNode->Start(op, &raftIndex, &_, &isLeader, [this](int index) { return m_applyWaiters.Acquire(index); });
+  if (!isLeader) {
+    return ErrWrongLeader;
+  }
+  if (raftIndex == -1) {
+    return ErrTimeout;
+  }
+
+  Op raftCommitOp;
+  std::string err = ErrWrongLeader;
+  if (m_applyWaiters.Wait(raftIndex, CONSENSUS_TIMEOUT, &raftCommitOp) && raftCommitOp.ClientId == op.ClientId &&
+      raftCommitOp.Operation == op.Operation) {
+    int64_t current = sessionEpoch(op.ClientId);
+    err = current != 0 ? OK : ErrSessionExpired;
+    if (epoch != nullptr) {
+      *epoch = current;
+    }
+  }
+  return err;
+}
 
-  m_mtx.lock();
+void KvServer::RegisterSession(const raftKVRpcProctoc::RegisterSessionArgs *args,
+                               raftKVRpcProctoc::RegisterSessionReply *reply) {
+  Op op;
+  op.Operation = OpType::RegisterSession;
+  op.ClientId = args->clientid();
+  op.RequestId = 0;
+  int64_t epoch = 0;
+  reply->set_err(StartSessionOp(op, &epoch));
+  reply->set_epoch(epoch);
+}
 
-  auto tmp = waitApplyCh[raftIndex];
-  waitApplyCh.erase(raftIndex);
-  delete tmp;
-  m_mtx.unlock();
+void KvServer::KeepAlive(const raftKVRpcProctoc::KeepAliveArgs *args, raftKVRpcProctoc::KeepAliveReply *reply) {
+  Op op;
+  op.Operation = OpType::KeepAlive;
+  op.ClientId = args->clientid();
+  op.RequestId = 0;
+  reply->set_err(StartSessionOp(op, nullptr));
+}
+
+void KvServer::TransferLeadership(const raftKVRpcProctoc::TransferLeadershipArgs *args,
+                                  raftKVRpcProctoc::TransferLeadershipReply *reply) {
+  int term = -1;
+  bool isLeader = false;
+  m_raftNode->GetState(&term, &isLeader);
+  if (!isLeader) {
+    reply->set_err(ErrWrongLeader);
+    return;
+  }
+  if (!m_raftNode->TransferLeadership(args->target())) {
+    reply->set_err(ErrInvalidTarget);
+    return;
+  }
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(RAFT_TRANSFER_LEADER_TIMEOUT);
+  while (std::chrono::steady_clock::now() < deadline) {
+    m_raftNode->GetState(&term, &isLeader);
+    if (!isLeader) {
+      DPrintf("[KvServer::TransferLeadership] kvserver{%d} 已把leader转移给节点{%d}", m_me, args->target());
+      reply->set_err(OK);
+      return;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  reply->set_err(ErrTransferTimeout);
+}
+
+void KvServer::ChangeMembership(const raftKVRpcProctoc::ChangeMembershipArgs *args,
+                                raftKVRpcProctoc::ChangeMembershipReply *reply) {
+  raftRpcProctoc::Member member;
+  member.set_id(args->nodeid());
+  member.set_ip(args->ip());
+  member.set_port(args->port());
+  member.set_learner(args->type() == raftKVRpcProctoc::AddLearner);
+  int index = -1;
+  int term = -1;
+  bool isLeader = false;
+  if (!m_raftNode->ChangeMembership(member, args->type() == raftKVRpcProctoc::RemoveNode, &index, &term,
+                                    &isLeader)) {
+    reply->set_err(isLeader ? ErrConfChangeRejected : ErrWrongLeader);
+    return;
+  }
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(CONSENSUS_TIMEOUT);
+  while (std::chrono::steady_clock::now() < deadline) {
+    if (m_raftNode->IsCommitted(index, term)) {
+      DPrintf("[KvServer::ChangeMembership] kvserver{%d} 成员变更 type{%d} node{%d} 已提交，index{%d}", m_me,
+              args->type(), args->nodeid(), index);
+      reply->set_err(OK);
+      return;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  reply->set_err(ErrWrongLeader);  // 没有按时提交，让clerk重试，重复的变更请求是幂等的
+}
+
+raftRpcProctoc::ClusterConfig KvServer::LoadBootstrapConfig(MprpcConfig &config, int me) {
+  raftRpcProctoc::ClusterConfig bootstrap;
+  if (config.Load("node" + std::to_string(me) + "join") == "1") {
+    return bootstrap;
+  }
+  for (int i = 0; i < INT_MAX - 1; ++i) {
+    std::string node = "node" + std::to_string(i);
+    std::string nodeIp = config.Load(node + "ip");
+    if (nodeIp.empty()) {
+      break;
+    }
+    if (config.Load(node + "join") == "1") {
+      continue;
+    }
+    auto *member = bootstrap.add_members();
+    member->set_id(i);
+    member->set_ip(nodeIp);
+    member->set_port(atoi(config.Load(node + "port").c_str()));
+    member->set_learner(config.Load(node + "learner") == "1");
+  }
+  return bootstrap;
 }
 
 void KvServer::ReadRaftApplyCommandLoop() {
+  std::vector<ApplyMsg> messages;
+  std::vector<ApplyMsg> commands;
   while (true) {
     //如果只操作applyChan不用拿锁，因为applyChan自己带锁
-    auto message = applyChan->Pop();  //阻塞弹出
+    messages.clear();
+    applyChan->PopBatch(&messages, KV_APPLY_BATCH_SIZE);  //阻塞弹出，一次取走已经积压的一批
     DPrintf(
-        "---------------tmp-------------[func-KvServer::ReadRaftApplyCommandLoop()-kvserver{%d}] 收到了下raft的消息",
-        m_me);
+        "---------------tmp-------------[func-KvServer::ReadRaftApplyCommandLoop()-kvserver{%d}] 收到了下raft的%d条消息",
+        m_me, static_cast<int>(messages.size()));
     // listen to every command applied by its raft ,delivery to relative RPC Handler
 
-    if (message.CommandValid) {
-      GetCommandFromRaft(message);
+    // 连续的command攒成一批apply，遇到snapshot先把之前的command apply完，保证顺序
+    for (auto &message : messages) {
+      if (message.CommandValid) {
+        commands.push_back(std::move(message));
+        continue;
+      }
+      if (!commands.empty()) {
+        GetCommandsFromRaft(commands);
+        commands.clear();
+      }
+      if (message.SnapshotValid) {
+        GetSnapShotFromRaft(message);
+      }
     }
-    if (message.SnapshotValid) {
-      GetSnapShotFromRaft(message);
+    if (!commands.empty()) {
+      GetCommandsFromRaft(commands);
+      commands.clear();
     }
   }
 }
@@ -299,7 +542,7 @@ void KvServer::ReadRaftApplyCommandLoop() {
 // raft会与persist层交互，kvserver层也会，因为kvserver层开始的时候需要恢复kvdb的状态
 //  关于快照raft层与persist的交互：保存kvserver传来的snapshot；生成leaderInstallSnapshot RPC的时候也需要读取snapshot；
 //  因此snapshot的具体格式是由kvserver层来定的，raft只负责传递这个东西
-//  snapShot里面包含kvserver需要维护的persist_lastRequestId 以及kvDB真正保存的数据persist_kvdb
+//  snapShot里面包含kvserver需要维护的会话表 以及kvDB真正保存的数据（各分片的跳表）
 void KvServer::ReadSnapShotToInstall(std::string snapshot) {
   if (snapshot.empty()) {
     // bootstrap without any state?
@@ -322,20 +565,19 @@ void KvServer::ReadSnapShotToInstall(std::string snapshot) {
 }
 
 bool KvServer::SendMessageToWaitChan(const Op &op, int raftIndex) {
-  std::lock_guard<std::mutex> lg(m_mtx);
   DPrintf(
       "[RaftApplyMessageSendToWaitChan--> raftserver{%d}] , Send Command --> Index:{%d} , ClientId {%d}, RequestId "
       "{%d}, Opreation {%v}, Key :{%v}, Value :{%v}",
-      m_me, raftIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
+      m_me, raftIndex, &op.ClientId, op.RequestId, opTypeName(op.Operation), &op.Key, &op.Value);
 
-  if (waitApplyCh.find(raftIndex) == waitApplyCh.end()) {
+  // 没有请求在等这条日志（follower上，或者handler已经超时）时直接返回
+  if (!m_applyWaiters.Complete(raftIndex, op)) {
     return false;
   }
-  waitApplyCh[raftIndex]->Push(op);
   DPrintf(
       "[RaftApplyMessageSendToWaitChan--> raftserver{%d}] , Send Command --> Index:{%d} , ClientId {%d}, RequestId "
       "{%d}, Opreation {%v}, Key :{%v}, Value :{%v}",
-      m_me, raftIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
+      m_me, raftIndex, &op.ClientId, op.RequestId, opTypeName(op.Operation), &op.Key, &op.Value);
   return true;
 }
 
@@ -374,7 +616,41 @@ void KvServer::Get(google::protobuf::RpcController *controller, const ::raftKVRp
   done->Run();
 }
 
-KvServer::KvServer(int me, int maxraftstate, std::string nodeInforFileName, short port) : m_skipList(6) {
+void KvServer::RegisterSession(google::protobuf::RpcController *controller,
+                               const ::raftKVRpcProctoc::RegisterSessionArgs *request,
+                               ::raftKVRpcProctoc::RegisterSessionReply *response, ::google::protobuf::Closure *done) {
+  KvServer::RegisterSession(request, response);
+  done->Run();
+}
+
+void KvServer::KeepAlive(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::KeepAliveArgs *request,
+                         ::raftKVRpcProctoc::KeepAliveReply *response, ::google::protobuf::Closure *done) {
+  KvServer::KeepAlive(request, response);
+  done->Run();
+}
+
+void KvServer::TransferLeadership(google::protobuf::RpcController *controller,
+                                  const ::raftKVRpcProctoc::TransferLeadershipArgs *request,
+                                  ::raftKVRpcProctoc::TransferLeadershipReply *response,
+                                  ::google::protobuf::Closure *done) {
+  KvServer::TransferLeadership(request, response);
+  done->Run();
+}
+
+void KvServer::ChangeMembership(google::protobuf::RpcController *controller,
+                                const ::raftKVRpcProctoc::ChangeMembershipArgs *request,
+                                ::raftKVRpcProctoc::ChangeMembershipReply *response, ::google::protobuf::Closure *done) {
+  KvServer::ChangeMembership(request, response);
+  done->Run();
+}
+
+KvServer::KvServer(int me, int maxraftstate, std::string nodeInforFileName, short port)
+    : m_useHashIndex(KV_HASH_INDEX_DEFAULT),
+      m_applyWaiters(KV_WAIT_SLOT_NUM),
+      m_sessions(KV_SESSION_TTL),
+      m_groupId(0),
+      m_multiRaftNode(nullptr) {
+  ResetShards();
   std::shared_ptr<Persister> persister = std::make_shared<Persister>(me);
 
   m_me = me;
@@ -396,55 +672,83 @@ KvServer::KvServer(int me, int maxraftstate, std::string nodeInforFileName, shor
   });
   t.detach();
 
-  ////开启rpc远程调用能力，需要注意必须要保证所有节点都开启rpc接受功能之后才能开启rpc远程调用能力
-  ////这里使用睡眠来保证
-  std::cout << "raftServer node:" << m_me << " start to sleep to wait all ohter raftnode start!!!!" << std::endl;
-  sleep(6);
-  std::cout << "raftServer node:" << m_me << " wake up!!!! start to connect other raftnode" << std::endl;
-  //获取所有raft节点ip、port ，并进行连接  ,要排除自己
+  // 集群地址由启动脚本在启动节点之前写入配置文件，rpc连接在第一次调用时建立，因此不需要等待其他节点启动
   MprpcConfig config;
   config.LoadConfigFile(nodeInforFileName.c_str());
-  std::vector<std::pair<std::string, short> > ipPortVt;
-  for (int i = 0; i < INT_MAX - 1; ++i) {
-    std::string node = "node" + std::to_string(i);
-
-    std::string nodeIp = config.Load(node + "ip");
-    std::string nodePortStr = config.Load(node + "port");
-    if (nodeIp.empty()) {
-      break;
-    }
-    ipPortVt.emplace_back(nodeIp, atoi(nodePortStr.c_str()));  //沒有atos方法，可以考慮自己实现
+  // 是否开启跳表的点查哈希索引，配置文件中没有写就用默认值
+  std::string hashIndexStr = config.Load("node" + std::to_string(m_me) + "hashIndex");
+  m_useHashIndex = hashIndexStr.empty() ? KV_HASH_INDEX_DEFAULT : hashIndexStr != "0";
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lg(shard->mtx);
+    shard->skipList->enable_hash_index(m_useHashIndex);
   }
-  std::vector<std::shared_ptr<RaftRpcUtil> > servers;
-  //进行连接
-  for (int i = 0; i < ipPortVt.size(); ++i) {
-    if (i == m_me) {
-      servers.push_back(nullptr);
-      continue;
-    }
-    std::string otherNodeIp = ipPortVt[i].first;
-    short otherNodePort = ipPortVt[i].second;
-    auto *rpc = new RaftRpcUtil(otherNodeIp, otherNodePort);
-    servers.push_back(std::shared_ptr<RaftRpcUtil>(rpc));
-
-    std::cout << "node" << m_me << " 连接node" << i << "success!" << std::endl;
-  }
-  sleep(ipPortVt.size() - me);  //等待所有节点相互连接成功，再启动raft
-  m_raftNode->init(servers, m_me, persister, applyChan);
+  std::string preVoteStr = config.Load("preVote");
+  std::string checkQuorumStr = config.Load("checkQuorum");
+  m_raftNode->SetElectionOptions(preVoteStr.empty() ? RAFT_PRE_VOTE_DEFAULT : preVoteStr != "0",
+                                 checkQuorumStr.empty() ? RAFT_CHECK_QUORUM_DEFAULT : checkQuorumStr != "0");
+  // rpc和持久化文件的压缩是进程级的开关，要在raft开始收发日志之前设置
+  SetCompressEnabledFromConfig(config.Load("compress"));
+  // 成员保存在raft日志中，配置文件只提供第一次启动时的初始配置
+  m_raftNode->init(
+      LoadBootstrapConfig(config, m_me),
+      [](const raftRpcProctoc::Member &member) -> std::shared_ptr<RaftRpcUtil> {
+        return std::make_shared<RaftRpcUtil>(std::make_shared<MprpcChannel>(member.ip(), member.port(), false), 0);
+      },
+      m_me, persister, applyChan);
   // kv的server直接与raft通信，但kv不直接与raft通信，所以需要把ApplyMsg的chan传递下去用于通信，两者的persist也是共用的
 
   //////////////////////////////////
 
   // You may need initialization code here.
   // m_kvDB; //kvdb初始化
-  m_skipList;
-  waitApplyCh;
-  m_lastRequestId;
   m_lastSnapShotRaftLogIndex = 0;  // todo:感覺這個函數沒什麼用，不如直接調用raft節點中的snapshot值？？？
-  auto snapshot = persister->ReadSnapshot();
+  std::string snapshot;
+  // raft已经按快照推进了m_lastApplied，跳过快照会丢掉它覆盖的所有写入，只能拒绝启动
+  myAssert(persister->ReadSnapshot(&snapshot), format("[KvServer] server %d 快照文件损坏，拒绝启动", m_me));
   if (!snapshot.empty()) {
     ReadSnapShotToInstall(snapshot);
   }
   std::thread t2(&KvServer::ReadRaftApplyCommandLoop, this);  //马上向其他节点宣告自己就是leader
   t2.join();  //由於ReadRaftApplyCommandLoop一直不會結束，达到一直卡在这的目的
 }
+
+KvServer::KvServer(int me, int maxraftstate, uint32_t groupId, MultiRaftNode *node)
+    : m_me(me),
+      m_maxRaftState(maxraftstate),
+      m_useHashIndex(KV_HASH_INDEX_DEFAULT),
+      m_applyWaiters(KV_WAIT_SLOT_NUM),
+      m_sessions(KV_SESSION_TTL),
+      m_lastSnapShotRaftLogIndex(0),
+      m_groupId(groupId),
+      m_multiRaftNode(node) {
+  ResetShards();
+  applyChan = std::make_shared<LockQueue<ApplyMsg> >();
+  m_raftNode = std::make_shared<Raft>();
+}
+
+void KvServer::RegisterRpcService(RpcProvider &provider) {
+  provider.NotifyService(this, m_groupId);
+  provider.NotifyService(m_raftNode.get(), m_groupId);
+}
+
+void KvServer::StartInGroup(raftRpcProctoc::ClusterConfig bootstrapConfig, Raft::PeerFactory peerFactory,
+                            bool useHashIndex) {
+  std::shared_ptr<Persister> persister = std::make_shared<Persister>(m_me, m_groupId);
+  m_useHashIndex = useHashIndex;
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lg(shard->mtx);
+    shard->skipList->enable_hash_index(m_useHashIndex);
+  }
+  m_raftNode->SetMultiRaft(m_groupId, m_multiRaftNode);
+  m_raftNode->init(std::move(bootstrapConfig), std::move(peerFactory), m_me, persister, applyChan,
+                   m_multiRaftNode == nullptr ? nullptr : m_multiRaftNode->GetIOManager());
+
+  std::string snapshot;
+  // raft已经按快照推进了m_lastApplied，跳过快照会丢掉它覆盖的所有写入，只能拒绝启动
+  myAssert(persister->ReadSnapshot(&snapshot), format("[KvServer] server %d 快照文件损坏，拒绝启动", m_me));
+  if (!snapshot.empty()) {
+    ReadSnapShotToInstall(snapshot);
+  }
+  std::thread t(&KvServer::ReadRaftApplyCommandLoop, this);
+  t.detach();
+}
@@ -0,0 +1,154 @@
+#include "multiRaft.h"
+
+#include <rpcprovider.h>
+#include <unistd.h>
+#include <climits>
+
+#include "compress.h"
+#include "mprpcconfig.h"
+#include "mprpccontroller.h"
+
+MultiRaftNode::MultiRaftNode(int me, int groupNum, int maxraftstate, std::string nodeInforFileName, short port)
+    : m_me(me) {
+  m_ioManager = std::make_shared<monsoon::IOManager>(FIBER_THREAD_NUM, FIBER_USE_CALLER_THREAD, "IOManager",
+                                                    FIBER_USE_IO_URING, (monsoon::EpollShard)FIBER_EPOLL_SHARD);
+  for (int g = 0; g < groupNum; ++g) {
+    m_kvServers.push_back(std::make_shared<KvServer>(me, maxraftstate, static_cast<uint32_t>(g), this));
+  }
+
+  // 整个进程只有一个rpc服务：节点级别的multiRaftRpc，以及每个组各自的kvServerRpc、raftRpc
+  std::thread t([this, port]() -> void {
+    RpcProvider provider;
+    provider.NotifyService(this);
+    for (auto &kvServer : m_kvServers) {
+      kvServer->RegisterRpcService(provider);
+    }
+    provider.Run(m_me, port);
+  });
+  t.detach();
+
+  // 集群地址由启动脚本预先写入配置文件，到各节点的连接在raft组第一次用到时创建，不需要等待其他节点启动
+  MprpcConfig config;
+  config.LoadConfigFile(nodeInforFileName.c_str());
+  std::string hashIndexStr = config.Load("node" + std::to_string(m_me) + "hashIndex");
+  bool useHashIndex = hashIndexStr.empty() ? KV_HASH_INDEX_DEFAULT : hashIndexStr != "0";
+  std::string preVoteStr = config.Load("preVote");
+  std::string checkQuorumStr = config.Load("checkQuorum");
+  bool preVote = preVoteStr.empty() ? RAFT_PRE_VOTE_DEFAULT : preVoteStr != "0";
+  bool checkQuorum = checkQuorumStr.empty() ? RAFT_CHECK_QUORUM_DEFAULT : checkQuorumStr != "0";
+  SetCompressEnabledFromConfig(config.Load("compress"));
+  // 所有组的初始成员相同，之后各组各自在日志中变更
+  raftRpcProctoc::ClusterConfig bootstrapConfig = KvServer::LoadBootstrapConfig(config, m_me);
+
+  for (int g = 0; g < groupNum; ++g) {
+    m_kvServers[g]->GetRaftNode()->SetElectionOptions(preVote, checkQuorum);
+    m_kvServers[g]->StartInGroup(
+        bootstrapConfig,
+        [this, g](const raftRpcProctoc::Member &member) -> std::shared_ptr<RaftRpcUtil> {
+          ensureHeartbeatChannel(member);
+          // 不和其他组共用：MprpcChannel上的请求是串行的，共用时一个组的慢请求会拖住所有组
+          return std::make_shared<RaftRpcUtil>(std::make_shared<MprpcChannel>(member.ip(), member.port(), false), g);
+        },
+        useHashIndex);
+  }
+  m_ioManager->addTimer(
+      MULTI_RAFT_HEARTBEAT_BATCH_INTERVAL, [this]() -> void { flushHeartbeats(); }, true);
+}
+
+void MultiRaftNode::ensureHeartbeatChannel(const raftRpcProctoc::Member &member) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  int id = member.id();
+  if (id >= m_channels.size()) {
+    m_channels.resize(id + 1);
+    m_batchStubs.resize(id + 1);
+    m_heartbeatSenders.resize(id + 1);
+    m_pendingHeartbeats.resize(id + 1);
+  }
+  if (m_channels[id] == nullptr) {
+    m_channels[id] = std::make_shared<MprpcChannel>(member.ip(), member.port(), false);
+    m_batchStubs[id] = std::make_shared<raftRpcProctoc::multiRaftRpc_Stub>(m_channels[id].get());
+    m_heartbeatSenders[id] = std::make_shared<SerialExecutor>(1);
+  }
+}
+
+void MultiRaftNode::AddHeartbeat(int server, uint32_t groupId, std::shared_ptr<raftRpcProctoc::AppendEntriesArgs> args,
+                                 HeartbeatCallback callback) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  for (auto &pending : m_pendingHeartbeats[server]) {
+    if (pending.groupId == groupId) {
+      // 上一批还在途时心跳会留到下次，只需要发最新的；旧的callback不能在这里调用（调用方持有raft的锁），
+      // 丢掉它最多让试探中的follower等到试探超时后再重新试探
+      pending.args = std::move(args);
+      pending.callback = std::move(callback);
+      return;
+    }
+  }
+  m_pendingHeartbeats[server].push_back(PendingHeartbeat{groupId, std::move(args), std::move(callback)});
+}
+
+void MultiRaftNode::flushHeartbeats() {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  for (int server = 0; server < m_pendingHeartbeats.size(); ++server) {
+    // 上一批还没有回复（对方慢或者不通）就不发，心跳留在队列里，下次和新的一起合并
+    if (m_pendingHeartbeats[server].empty() || m_heartbeatSenders[server]->Pending() > 0) {
+      continue;
+    }
+    // rpc是阻塞的，放到该节点的发送线程中，不占用协程调度器
+    auto stub = m_batchStubs[server];
+    auto batch = std::make_shared<std::vector<PendingHeartbeat> >(std::move(m_pendingHeartbeats[server]));
+    m_pendingHeartbeats[server].clear();
+    m_heartbeatSenders[server]->TrySubmit(
+        [this, server, stub, batch]() -> void { sendHeartbeatBatch(server, stub, std::move(*batch)); });
+  }
+}
+
+void MultiRaftNode::sendHeartbeatBatch(int server, std::shared_ptr<raftRpcProctoc::multiRaftRpc_Stub> stub,
+                                       std::vector<PendingHeartbeat> batch) {
+  raftRpcProctoc::BatchAppendEntriesArgs args;
+  for (const auto &item : batch) {
+    auto *entry = args.add_entries();
+    entry->set_groupid(item.groupId);
+    *entry->mutable_args() = *item.args;
+  }
+  raftRpcProctoc::BatchAppendEntriesReply reply;
+  MprpcController controller;
+  stub->BatchAppendEntries(&controller, &args, &reply, nullptr);
+  bool failed = controller.Failed();
+  if (failed) {
+    DPrintf("[func-MultiRaftNode::sendHeartbeatBatch-node{%d}] 向节点{%d}发送合并心跳失败：%s", m_me, server,
+            controller.ErrorText().c_str());
+  } else if (reply.entries_size() != batch.size()) {
+    DPrintf("[func-MultiRaftNode::sendHeartbeatBatch-node{%d}] 节点{%d}回复的心跳数量{%d}与请求{%d}不一致", m_me,
+            server, reply.entries_size(), batch.size());
+    failed = true;
+  }
+  if (failed) {
+    // 回复Disconnected，各组按没有送达处理（试探中的follower可以马上重新试探）
+    for (auto &item : batch) {
+      auto disconnected = std::make_shared<raftRpcProctoc::AppendEntriesReply>();
+      disconnected->set_appstate(Disconnected);
+      item.callback(disconnected);
+    }
+    return;
+  }
+  for (int i = 0; i < batch.size(); ++i) {
+    batch[i].callback(std::make_shared<raftRpcProctoc::AppendEntriesReply>(reply.entries(i).reply()));
+  }
+}
+
+void MultiRaftNode::BatchAppendEntries(google::protobuf::RpcController *controller,
+                                       const ::raftRpcProctoc::BatchAppendEntriesArgs *request,
+                                       ::raftRpcProctoc::BatchAppendEntriesReply *response,
+                                       ::google::protobuf::Closure *done) {
+  for (const auto &entry : request->entries()) {
+    auto *replyEntry = response->add_entries();
+    replyEntry->set_groupid(entry.groupid());
+    if (entry.groupid() >= m_kvServers.size()) {
+      // 没有这个组，回复Disconnected，leader会忽略
+      replyEntry->mutable_reply()->set_appstate(Disconnected);
+      continue;
+    }
+    m_kvServers[entry.groupid()]->GetRaftNode()->AppendEntries1(&entry.args(), replyEntry->mutable_reply());
+  }
+  done->Run();
+}
@@ -3,10 +3,11 @@
 #include <boost/archive/text_oarchive.hpp>
 #include <memory>
 #include "config.h"
+#include "multiRaft.h"
 #include "util.h"
 
 void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpcProctoc::AppendEntriesReply* reply) {
-  std::lock_guard<std::mutex> locker(m_mtx);
+  std::lock_guard<monsoon::FiberMutex> locker(m_mtx);
   reply->set_appstate(AppNormal);  // 能接收到代表网络是正常的
   // Your code here (2A, 2B).
   //	不同的人收到AppendEntries的反应是不同的，要注意无论什么时候收到rpc请求和响应都要检查term
@@ -37,7 +38,8 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
   // 如果发生网络分区，那么candidate可能会收到同一个term的leader的消息，要转变为Follower，为了和上面，因此直接写
   m_status = Follower;  // 这里是有必要的，因为如果candidate收到同一个term的leader的AE，需要变成follower
   // term相等
-  m_lastResetElectionTime = now();
+  resetElectionTimer();
+  m_lastLeaderContact = now();
   //  DPrintf("[	AppendEntries-func-rf(%v)		] 重置了选举超时定时器\n", rf.me);
 
   // 不能无脑的从prevlogIndex开始阶段日志，因为rpc可能会延迟，导致发过来的log是很久之前的
@@ -58,7 +60,8 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
         m_lastSnapshotIncludeIndex +
         1);  // todo 如果想直接弄到最新好像不对，因为是从后慢慢往前匹配的，这里不匹配说明后面的都不匹配
     //  DPrintf("[func-AppendEntries-rf{%v}] 拒绝了节点{%v}，因为log太老，返回值：{%v}\n", rf.me, args.LeaderId, reply)
-    //  return
+    // 新日志立即复制后同时在途的AE变多，过期的AE可能晚于快照到达，这里必须返回，否则下面matchLog会断言失败
+    return;
   }
   //	本机日志有那么长，冲突(same index,different term),截断日志
   // 注意：这里目前当args.PrevLogIndex == rf.lastSnapshotIncludeIndex与不等的时候要分开考虑，可以看看能不能优化这块
@@ -68,10 +71,12 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
     // 那意思是不是可能会有一段发来的AE中的logs中前半是匹配的，后半是不匹配的，这种应该：1.follower如何处理？ 2.如何给leader回复
     // 3. leader如何处理
 
+    bool configChanged = false;  // 追加或者覆盖了ConfChange日志，需要重新确定配置
     for (int i = 0; i < args->entries_size(); i++) {
       auto log = args->entries(i);
       if (log.logindex() > getLastLogIndex()) {
         //超过就直接添加日志
+        configChanged = configChanged || log.confchange();
         m_logs.push_back(log);
       } else {
         //没超过就比较是否匹配，不匹配再更新，而不是直接截断
@@ -90,10 +95,15 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
         }
         if (m_logs[getSlicesIndexFromLogIndex(log.logindex())].logterm() != log.logterm()) {
           //不匹配就更新
+          configChanged =
+              configChanged || log.confchange() || m_logs[getSlicesIndexFromLogIndex(log.logindex())].confchange();
           m_logs[getSlicesIndexFromLogIndex(log.logindex())] = log;
         }
       }
     }
+    if (configChanged) {
+      rebuildConfig();
+    }
 
     // 错误写法like：  rf.shrinkLogsToIndex(args.PrevLogIndex)
     // rf.logs = append(rf.logs, args.Entries...)
@@ -106,9 +116,12 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
     //	fmt.Printf("[func-AppendEntries  rf:{%v}] ] : args.term:%v, rf.term:%v  ,rf.logs的长度：%v\n", rf.me, args.Term,
     // rf.currentTerm, len(rf.logs))
     // }
-    if (args->leadercommit() > m_commitIndex) {
-      m_commitIndex = std::min(args->leadercommit(), getLastLogIndex());
-      // 这个地方不能无脑跟上getLastLogIndex()，因为可能存在args->leadercommit()落后于 getLastLogIndex()的情况
+    // 只能提交到这个AE确认过与leader一致的位置：AE可能只带了一部分日志（或者是prevLog较早的心跳），
+    // 本地更后面的日志可能是旧leader留下、还没有被覆盖的
+    int verifiedIndex = args->prevlogindex() + args->entries_size();
+    if (args->leadercommit() > m_commitIndex && verifiedIndex > m_commitIndex) {
+      m_commitIndex = std::min(args->leadercommit(), verifiedIndex);
+      m_applyCv.notify_one();
     }
 
     // 领导会一次发送完所有的日志
@@ -154,13 +167,16 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
 
 void Raft::applierTicker() {
   while (true) {
-    m_mtx.lock();
+    std::unique_lock<monsoon::FiberMutex> lock(m_mtx);
+    // commitIndex推进时会被立即唤醒，ApplyInterval只是兜底
+    m_applyCv.wait_for(lock, std::chrono::milliseconds(ApplyInterval),
+                       [this]() -> bool { return m_lastApplied < m_commitIndex; });
     if (m_status == Leader) {
       DPrintf("[Raft::applierTicker() - raft{%d}]  m_lastApplied{%d}   m_commitIndex{%d}", m_me, m_lastApplied,
               m_commitIndex);
     }
     auto applyMsgs = getApplyLogs();
-    m_mtx.unlock();
+    lock.unlock();
     //使用匿名函数是因为传递管道的时候不用拿锁
     // todo:好像必须拿锁，因为不拿锁的话如果调用多次applyLog函数，可能会导致应用的顺序不一样
     if (!applyMsgs.empty()) {
@@ -169,8 +185,23 @@ void Raft::applierTicker() {
     for (auto& message : applyMsgs) {
       applyChan->Push(message);
     }
-    // usleep(1000 * ApplyInterval);
-    sleepNMilliseconds(ApplyInterval);
+  }
+}
+
+void Raft::replicatorLoop() {
+  std::unique_lock<monsoon::FiberMutex> lock(m_mtx);
+  while (true) {
+    m_replicateCv.wait(lock, [this]() -> bool { return m_pendingReplicate > 0; });
+    // 自适应窗口：距上一次发送已经超过窗口（低负载）就立即发送；
+    // 上一批刚发出（高负载）则最多再等到 上次发送时间+窗口，或者攒够一批，合并成一轮AE发出
+    auto deadline = m_lastReplicateTime + std::chrono::microseconds(RAFT_REPLICATE_MAX_DELAY_US);
+    m_replicateCv.wait_until(lock, deadline,
+                             [this]() -> bool { return m_pendingReplicate >= RAFT_REPLICATE_MAX_BATCH; });
+    m_pendingReplicate = 0;
+    m_lastReplicateTime = std::chrono::steady_clock::now();
+    lock.unlock();
+    doHeartBeat(false);  // 按各follower的复制状态和窗口发出新日志
+    lock.lock();
   }
 }
 
@@ -200,8 +231,11 @@ bool Raft::CondInstallSnapshot(int lastIncludedTerm, int lastIncludedIndex, std:
 }
 
 void Raft::doElection() {
-  std::lock_guard<std::mutex> g(m_mtx);
+  std::lock_guard<monsoon::FiberMutex> g(m_mtx);
+  startElection();
+}
 
+void Raft::startElection(bool leadershipTransfer) {
   if (m_status == Leader) {
     // fmt.Printf("[       ticker-func-rf(%v)              ] is a Leader,wait the  lock\n", rf.me)
   }
@@ -209,6 +243,13 @@ void Raft::doElection() {
 
   if (m_status != Leader) {
     DPrintf("[       ticker-func-rf(%d)              ]  选举定时器到期且不是leader，开始选举 \n", m_me);
+    if (FIBER_METRICS_ON_ELECTION) {
+      // 没收到心跳可能是调度器忙不过来（心跳协程排队太久），把调度器的状态一起打出来；
+      // 快照要遍历所有直方图，放到单独的任务里做，不占着m_mtx
+      m_ioManager->scheduler([this]() {
+        DPrintf("[       ticker-func-rf(%d)              ]  %s", m_me, m_ioManager->getMetrics().toString().c_str());
+      });
+    }
     //当选举的时候定时器超时就必须重新选举，不然没有选票就会一直卡主
     //重竞选超时，term也会增加的
     m_status = Candidate;
@@ -218,10 +259,10 @@ void Raft::doElection() {
     persist();
     std::shared_ptr<int> votedNum = std::make_shared<int>(1);  // 使用 make_shared 函数初始化 !! 亮点
     //	重新设置定时器
-    m_lastResetElectionTime = now();
-    //	发布RequestVote RPC
+    resetElectionTimer();
+    //	发布RequestVote RPC，learner不投票
     for (int i = 0; i < m_peers.size(); i++) {
-      if (i == m_me) {
+      if (i == m_me || !isVoter(i)) {
         continue;
       }
       int lastLogIndex = -1, lastLogTerm = -1;
@@ -233,6 +274,7 @@ void Raft::doElection() {
       requestVoteArgs->set_candidateid(m_me);
       requestVoteArgs->set_lastlogindex(lastLogIndex);
       requestVoteArgs->set_lastlogterm(lastLogTerm);
+      requestVoteArgs->set_leadershiptransfer(leadershipTransfer);
       auto requestVoteReply = std::make_shared<raftRpcProctoc::RequestVoteReply>();
 
       //使用匿名函数执行避免其拿到锁
@@ -244,117 +286,226 @@ void Raft::doElection() {
   }
 }
 
-void Raft::doHeartBeat() {
-  std::lock_guard<std::mutex> g(m_mtx);
+void Raft::doHeartBeat(bool heartbeat) {
+  std::lock_guard<monsoon::FiberMutex> g(m_mtx);
 
   if (m_status == Leader) {
     DPrintf("[func-Raft::doHeartBeat()-Leader: {%d}] Leader的心跳定时器触发了且拿到mutex，开始发送AE\n", m_me);
-    auto appendNums = std::make_shared<int>(1);  //正确返回的节点的数量
-
-    //对Follower（除了自己外的所有节点发送AE）
-    // todo 这里肯定是要修改的，最好使用一个单独的goruntime来负责管理发送log，因为后面的log发送涉及优化之类的
-    //最少要单独写一个函数来管理，而不是在这一坨
+    bool allSent = true;  // 每个follower都收到了消息，才能推迟下一次心跳
+    //对Follower（除了自己外的所有节点发送AE），每个follower发什么由它的复制状态决定
     for (int i = 0; i < m_peers.size(); i++) {
-      if (i == m_me) {
+      if (i == m_me || m_peers[i] == nullptr) {
         continue;
       }
       DPrintf("[func-Raft::doHeartBeat()-Leader: {%d}] Leader的心跳定时器触发了 index:{%d}\n", m_me, i);
       myAssert(m_nextIndex[i] >= 1, format("rf.nextIndex[%d] = {%d}", i, m_nextIndex[i]));
-      //日志压缩加入后要判断是发送快照还是发送AE
-      if (m_nextIndex[i] <= m_lastSnapshotIncludeIndex) {
-        //                        DPrintf("[func-ticker()-rf{%v}]rf.nextIndex[%v] {%v} <=
-        //                        rf.lastSnapshotIncludeIndex{%v},so leaderSendSnapShot", rf.me, i, rf.nextIndex[i],
-        //                        rf.lastSnapshotIncludeIndex)
-        std::thread t(&Raft::leaderSendSnapShot, this, i);  // 创建新线程并执行b函数，并传递参数
-        t.detach();
-        continue;
+      if (!replicateTo(i, heartbeat)) {
+        allSent = false;
       }
-      //构造发送值
-      int preLogIndex = -1;
-      int PrevLogTerm = -1;
-      getPrevLogInfo(i, &preLogIndex, &PrevLogTerm);
-      std::shared_ptr<raftRpcProctoc::AppendEntriesArgs> appendEntriesArgs =
-          std::make_shared<raftRpcProctoc::AppendEntriesArgs>();
-      appendEntriesArgs->set_term(m_currentTerm);
-      appendEntriesArgs->set_leaderid(m_me);
-      appendEntriesArgs->set_prevlogindex(preLogIndex);
-      appendEntriesArgs->set_prevlogterm(PrevLogTerm);
-      appendEntriesArgs->clear_entries();
-      appendEntriesArgs->set_leadercommit(m_commitIndex);
-      if (preLogIndex != m_lastSnapshotIncludeIndex) {
-        for (int j = getSlicesIndexFromLogIndex(preLogIndex) + 1; j < m_logs.size(); ++j) {
-          raftRpcProctoc::LogEntry* sendEntryPtr = appendEntriesArgs->add_entries();
-          *sendEntryPtr = m_logs[j];  //=是可以点进去的，可以点进去看下protobuf如何重写这个的
-        }
-      } else {
-        for (const auto& item : m_logs) {
-          raftRpcProctoc::LogEntry* sendEntryPtr = appendEntriesArgs->add_entries();
-          *sendEntryPtr = item;  //=是可以点进去的，可以点进去看下protobuf如何重写这个的
-        }
+    }
+    if (heartbeat || allSent) {
+      m_lastResetHearBeatTime = now();  // leader发送心跳，就不是随机时间了
+      if (m_heartBeatTimer != nullptr) {
+        m_heartBeatTimer->reset(HeartBeatTimeout, true);  // 刚发过AE，下一次心跳从现在开始计时
       }
-      int lastLogIndex = getLastLogIndex();
-      // leader对每个节点发送的日志长短不一，但是都保证从prevIndex发送直到最后
-      myAssert(appendEntriesArgs->prevlogindex() + appendEntriesArgs->entries_size() == lastLogIndex,
-               format("appendEntriesArgs.PrevLogIndex{%d}+len(appendEntriesArgs.Entries){%d} != lastLogIndex{%d}",
-                      appendEntriesArgs->prevlogindex(), appendEntriesArgs->entries_size(), lastLogIndex));
-      //构造返回值
-      const std::shared_ptr<raftRpcProctoc::AppendEntriesReply> appendEntriesReply =
-          std::make_shared<raftRpcProctoc::AppendEntriesReply>();
-      appendEntriesReply->set_appstate(Disconnected);
-
-      std::thread t(&Raft::sendAppendEntries, this, i, appendEntriesArgs, appendEntriesReply,
-                    appendNums);  // 创建新线程并执行b函数，并传递参数
-      t.detach();
     }
-    m_lastResetHearBeatTime = now();  // leader发送心跳，就不是随机时间了
   }
 }
 
-void Raft::electionTimeOutTicker() {
-  // Check if a Leader election should be started.
-  while (true) {
-    /**
-     * 如果不睡眠，那么对于leader，这个函数会一直空转，浪费cpu。且加入协程之后，空转会导致其他协程无法运行，对于时间敏感的AE，会导致心跳无法正常发送导致异常
-     */
-    while (m_status == Leader) {
-      usleep(
-          HeartBeatTimeout);  //定时时间没有严谨设置，因为HeartBeatTimeout比选举超时一般小一个数量级，因此就设置为HeartBeatTimeout了
+bool Raft::replicateTo(int server, bool heartbeat) {
+  Progress& pr = m_progress[server];
+  //日志压缩加入后要判断是发送快照还是发送AE
+  if (m_nextIndex[server] <= m_lastSnapshotIncludeIndex) {
+    if (pr.state != ProgressState::Snapshot) {
+      // 同一时间只给一个follower发一份快照，发送结束后再切换状态
+      pr.state = ProgressState::Snapshot;
+      pr.inflights.clear();
+      pr.inflightBytes = 0;
+      std::thread t(&Raft::leaderSendSnapShot, this, server);  // 创建新线程并执行b函数，并传递参数
+      t.detach();
+      return true;
     }
-    std::chrono::duration<signed long int, std::ratio<1, 1000000000>> suitableSleepTime{};
-    std::chrono::system_clock::time_point wakeTime{};
-    {
-      m_mtx.lock();
-      wakeTime = now();
-      suitableSleepTime = getRandomizedElectionTimeout() + m_lastResetElectionTime - wakeTime;
-      m_mtx.unlock();
+    return false;
+  }
+  if (pr.state == ProgressState::Snapshot) {
+    return false;
+  }
+
+  int lastLogIndex = getLastLogIndex();
+  bool paused = false;
+  if (pr.state == ProgressState::Probe) {
+    // 试探的AE丢了也不会一直卡住：超过一个最小选举超时没有回复就重新试探
+    paused = pr.probeSent && now() - pr.probeSentTime < std::chrono::milliseconds(minRandomizedElectionTime);
+    if (paused && !heartbeat) {
+      return false;
     }
+    // 试探还在途时照常发心跳：试探的回复丢了的话，要等到重新试探，follower可能先选举超时
+  } else {
+    paused = pr.inflights.size() >= RAFT_MAX_INFLIGHT_MSGS || pr.inflightBytes >= RAFT_MAX_INFLIGHT_BYTES;
+  }
+  bool sendEntries = !paused && m_nextIndex[server] <= lastLogIndex;
+  if (!sendEntries && !heartbeat && pr.state == ProgressState::Replicate) {
+    return false;
+  }
+  // multi-raft的纯心跳合并发送，其他AE都交给该follower的发送线程；排满了说明对方跟不上或者不通，这次不发
+  bool viaSender = m_multiRaftNode == nullptr || sendEntries;
+  std::shared_ptr<SerialExecutor> sender = m_appendSenders[server];
+  if (viaSender && (sender == nullptr || sender->Pending() >= sender->Capacity())) {
+    return false;
+  }
 
-    if (std::chrono::duration<double, std::milli>(suitableSleepTime).count() > 1) {
-      // 获取当前时间点
-      auto start = std::chrono::steady_clock::now();
+  //构造发送值
+  int preLogIndex = -1;
+  int PrevLogTerm = -1;
+  if ((pr.state == ProgressState::Replicate || paused) && !sendEntries) {
+    // 心跳的prevLog用已经确认匹配的位置：nextIndex之前可能还有在途的日志，follower还没有收到
+    preLogIndex = std::max(m_matchIndex[server], m_lastSnapshotIncludeIndex);
+    PrevLogTerm = getLogTermFromLogIndex(preLogIndex);
+  } else {
+    getPrevLogInfo(server, &preLogIndex, &PrevLogTerm);
+  }
+  std::shared_ptr<raftRpcProctoc::AppendEntriesArgs> appendEntriesArgs =
+      std::make_shared<raftRpcProctoc::AppendEntriesArgs>();
+  appendEntriesArgs->set_term(m_currentTerm);
+  appendEntriesArgs->set_leaderid(m_me);
+  appendEntriesArgs->set_prevlogindex(preLogIndex);
+  appendEntriesArgs->set_prevlogterm(PrevLogTerm);
+  appendEntriesArgs->clear_entries();
+  appendEntriesArgs->set_leadercommit(m_commitIndex);
+  int64_t bytes = 0;
+  if (sendEntries) {
+    // 从nextIndex开始，条数和字节数都不超过上限，但至少带一条；prevLog是快照点时从m_logs的开头发
+    int begin = preLogIndex == m_lastSnapshotIncludeIndex ? 0 : getSlicesIndexFromLogIndex(preLogIndex) + 1;
+    for (int j = begin; j < m_logs.size() && appendEntriesArgs->entries_size() < RAFT_MAX_APPEND_ENTRIES; ++j) {
+      int64_t size = m_logs[j].ByteSizeLong();
+      if (appendEntriesArgs->entries_size() > 0 && bytes + size > RAFT_MAX_APPEND_BYTES) {
+        break;
+      }
+      *appendEntriesArgs->add_entries() = m_logs[j];  //=是可以点进去的，可以点进去看下protobuf如何重写这个的
+      bytes += size;
+    }
+  }
+  int lastSent = preLogIndex + appendEntriesArgs->entries_size();
+  if (pr.state == ProgressState::Probe) {
+    if (!paused) {
+      pr.probeSent = true;
+      pr.probeSentTime = now();
+    }
+  } else if (sendEntries) {
+    // 乐观地认为会成功，下一个AE接着发后面的日志
+    m_nextIndex[server] = lastSent + 1;
+    pr.inflights.emplace_back(lastSent, bytes);
+    pr.inflightBytes += bytes;
+  }
+  //构造返回值
+  const std::shared_ptr<raftRpcProctoc::AppendEntriesReply> appendEntriesReply =
+      std::make_shared<raftRpcProctoc::AppendEntriesReply>();
+  appendEntriesReply->set_appstate(Disconnected);
+
+  if (m_multiRaftNode != nullptr && appendEntriesArgs->entries_size() == 0) {
+    // multi-raft：不带日志的纯心跳交给节点，与其他raft组发往同一节点的心跳合并成一个rpc
+    m_multiRaftNode->AddHeartbeat(
+        server, m_groupId, appendEntriesArgs,
+        [this, server, appendEntriesArgs](std::shared_ptr<raftRpcProctoc::AppendEntriesReply> reply) {
+          handleAppendEntriesReply(server, appendEntriesArgs, reply);
+        });
+    return true;
+  }
+
+  // 只有持有m_mtx的replicateTo会提交，上面检查过没有排满，这里一定能放进去
+  sender->TrySubmit([this, server, appendEntriesArgs, appendEntriesReply]() -> void {
+    sendAppendEntries(server, appendEntriesArgs, appendEntriesReply);
+  });
+  return true;
+}
+
+void Raft::becomeProbe(int server) {
+  Progress& pr = m_progress[server];
+  pr.state = ProgressState::Probe;
+  pr.probeSent = false;
+  pr.inflights.clear();
+  pr.inflightBytes = 0;
+  m_nextIndex[server] = m_matchIndex[server] + 1;
+}
+
+void Raft::becomeReplicate(int server) {
+  Progress& pr = m_progress[server];
+  pr.state = ProgressState::Replicate;
+  pr.probeSent = false;
+  pr.inflights.clear();
+  pr.inflightBytes = 0;
+  m_nextIndex[server] = m_matchIndex[server] + 1;
+}
 
-      usleep(std::chrono::duration_cast<std::chrono::microseconds>(suitableSleepTime).count());
-      // std::this_thread::sleep_for(suitableSleepTime);
+void Raft::onAppendEntriesFailed(int server, const raftRpcProctoc::AppendEntriesArgs& args) {
+  if (m_status != Leader || args.term() != m_currentTerm || server >= m_progress.size()) {
+    return;
+  }
+  Progress& pr = m_progress[server];
+  if (pr.state == ProgressState::Probe) {
+    pr.probeSent = false;
+  } else if (pr.state == ProgressState::Replicate && args.entries_size() > 0) {
+    DPrintf("[func-Raft::onAppendEntriesFailed rf{%d}] 发往节点{%d}的AE没有送达，退回Probe，nextIndex{%d}\n", m_me,
+            server, m_matchIndex[server] + 1);
+    becomeProbe(server);
+  }
+}
 
-      // 获取函数运行结束后的时间点
-      auto end = std::chrono::steady_clock::now();
+void Raft::notifyReplicate() {
+  // 只在需要唤醒复制线程时notify：从无到有，或者攒够了一批
+  if (++m_pendingReplicate == 1 || m_pendingReplicate == RAFT_REPLICATE_MAX_BATCH) {
+    m_replicateCv.notify_one();
+  }
+}
 
-      // 计算时间差并输出结果（单位为毫秒）
-      std::chrono::duration<double, std::milli> duration = end - start;
+void Raft::resetElectionTimer() {
+  m_lastResetElectionTime = now();
+  if (m_electionTimer != nullptr) {
+    // 每次重置都重新随机一个超时时间，定时器从现在开始重新计时，超时前不会有任何唤醒
+    m_electionTimer->reset(getRandomizedElectionTimeout().count(), true);
+  }
+}
 
-      // 使用ANSI控制序列将输出颜色修改为紫色
-      std::cout << "\033[1;35m electionTimeOutTicker();函数设置睡眠时间为: "
-                << std::chrono::duration_cast<std::chrono::milliseconds>(suitableSleepTime).count() << " 毫秒\033[0m"
-                << std::endl;
-      std::cout << "\033[1;35m electionTimeOutTicker();函数实际睡眠时间为: " << duration.count() << " 毫秒\033[0m"
-                << std::endl;
+void Raft::onElectionTimeout() {
+  {
+    std::lock_guard<monsoon::FiberMutex> lg(m_mtx);
+    // leader和learner不需要选举；回调被取出后、执行前定时器可能刚被重置，这种情况不算超时
+    if (m_status == Leader || !isVoter(m_me) ||
+        now() - m_lastResetElectionTime < std::chrono::milliseconds(minRandomizedElectionTime)) {
+      return;
     }
+  }
+  if (m_preVote) {
+    doPreVote();
+  } else {
+    doElection();
+  }
+}
 
-    if (std::chrono::duration<double, std::milli>(m_lastResetElectionTime - wakeTime).count() > 0) {
-      //说明睡眠的这段时间有重置定时器，那么就没有超时，再次睡眠
+void Raft::doPreVote() {
+  std::lock_guard<monsoon::FiberMutex> g(m_mtx);
+  if (m_status == Leader) {
+    return;
+  }
+  DPrintf("[func-Raft::doPreVote rf{%d}] 选举定时器到期，以term{%d}发起预投票\n", m_me, m_currentTerm + 1);
+  // 预投票不改变身份、term和votedFor，失败就等下一次选举超时再试
+  resetElectionTimer();
+  int round = ++m_preVoteRound;
+  auto grantedNum = std::make_shared<int>(1);
+  int lastLogIndex = -1, lastLogTerm = -1;
+  getLastLogIndexAndTerm(&lastLogIndex, &lastLogTerm);
+  for (int i = 0; i < m_peers.size(); i++) {
+    if (i == m_me || !isVoter(i)) {
       continue;
     }
-    doElection();
+    auto preVoteArgs = std::make_shared<raftRpcProctoc::RequestVoteArgs>();
+    preVoteArgs->set_term(m_currentTerm + 1);
+    preVoteArgs->set_candidateid(m_me);
+    preVoteArgs->set_lastlogindex(lastLogIndex);
+    preVoteArgs->set_lastlogterm(lastLogTerm);
+    auto preVoteReply = std::make_shared<raftRpcProctoc::RequestVoteReply>();
+    std::thread t(&Raft::sendRequestPreVote, this, i, preVoteArgs, preVoteReply, grantedNum, round);
+    t.detach();
   }
 }
 
@@ -368,6 +519,9 @@ std::vector<ApplyMsg> Raft::getApplyLogs() {
     myAssert(m_logs[getSlicesIndexFromLogIndex(m_lastApplied)].logindex() == m_lastApplied,
              format("rf.logs[rf.getSlicesIndexFromLogIndex(rf.lastApplied)].LogIndex{%d} != rf.lastApplied{%d} ",
                     m_logs[getSlicesIndexFromLogIndex(m_lastApplied)].logindex(), m_lastApplied));
+    if (m_logs[getSlicesIndexFromLogIndex(m_lastApplied)].confchange()) {
+      continue;  // 配置日志在追加时就已经生效了，不交给kvserver
+    }
     ApplyMsg applyMsg;
     applyMsg.CommandValid = true;
     applyMsg.SnapshotValid = false;
@@ -417,6 +571,16 @@ void Raft::GetState(int* term, bool* isLeader) {
   *isLeader = (m_status == Leader);
 }
 
+bool Raft::StaleReadReady(int maxStaleMs) {
+  std::lock_guard<monsoon::FiberMutex> lg(m_mtx);
+  if (m_status == Leader) {
+    // 被分区的旧leader还以为自己是leader（没开CheckQuorum时不会自己下台），
+    // 要求最近maxStaleMs内多数节点还认可自己，和follower的要求相同
+    return quorumAckedWithin(maxStaleMs) && m_lastApplied >= m_commitIndex;
+  }
+  return now() - m_lastLeaderContact <= std::chrono::milliseconds(maxStaleMs) && m_lastApplied >= m_commitIndex;
+}
+
 void Raft::InstallSnapshot(const raftRpcProctoc::InstallSnapshotRequest* args,
                            raftRpcProctoc::InstallSnapshotResponse* reply) {
   m_mtx.lock();
@@ -436,7 +600,8 @@ void Raft::InstallSnapshot(const raftRpcProctoc::InstallSnapshotRequest* args,
     persist();
   }
   m_status = Follower;
-  m_lastResetElectionTime = now();
+  resetElectionTimer();
+  m_lastLeaderContact = now();
   // outdated snapshot
   if (args->lastsnapshotincludeindex() <= m_lastSnapshotIncludeIndex) {
     //        DPrintf("[func-InstallSnapshot-rf{%v}] leader{%v}.LastSnapShotIncludeIndex{%v} <=
@@ -458,6 +623,8 @@ void Raft::InstallSnapshot(const raftRpcProctoc::InstallSnapshotRequest* args,
   m_lastApplied = std::max(m_lastApplied, args->lastsnapshotincludeindex());
   m_lastSnapshotIncludeIndex = args->lastsnapshotincludeindex();
   m_lastSnapshotIncludeTerm = args->lastsnapshotincludeterm();
+  m_snapshotConfig = args->config();
+  rebuildConfig();
 
   reply->set_term(m_currentTerm);
   ApplyMsg msg;
@@ -477,52 +644,272 @@ void Raft::InstallSnapshot(const raftRpcProctoc::InstallSnapshotRequest* args,
 
 void Raft::pushMsgToKvServer(ApplyMsg msg) { applyChan->Push(msg); }
 
-void Raft::leaderHearBeatTicker() {
-  while (true) {
-    //不是leader的话就没有必要进行后续操作，况且还要拿锁，很影响性能，目前是睡眠，后面再优化优化
-    while (m_status != Leader) {
-      usleep(1000 * HeartBeatTimeout);
-      // std::this_thread::sleep_for(std::chrono::milliseconds(HeartBeatTimeout));
+void Raft::startHeartBeatTimer() {
+  if (m_heartBeatTimer == nullptr) {
+    m_heartBeatTimer = m_ioManager->addTimer(
+        HeartBeatTimeout, [this]() -> void { onHeartBeatTimeout(); }, true);
+  }
+}
+
+void Raft::onHeartBeatTimeout() {
+  {
+    std::lock_guard<monsoon::FiberMutex> lg(m_mtx);
+    if (m_status != Leader) {
+      // 已经不是leader了，停掉心跳定时器，下次当选时再创建
+      if (m_heartBeatTimer != nullptr) {
+        m_heartBeatTimer->cancel();
+        m_heartBeatTimer = nullptr;
+      }
+      return;
     }
-    static std::atomic<int32_t> atomicCount = 0;
-
-    std::chrono::duration<signed long int, std::ratio<1, 1000000000>> suitableSleepTime{};
-    std::chrono::system_clock::time_point wakeTime{};
-    {
-      std::lock_guard<std::mutex> lock(m_mtx);
-      wakeTime = now();
-      suitableSleepTime = std::chrono::milliseconds(HeartBeatTimeout) + m_lastResetHearBeatTime - wakeTime;
+    if (m_leadTransferee != -1 && now() > m_transferDeadline) {
+      DPrintf("[func-Raft::onHeartBeatTimeout rf{%d}] 向节点{%d}转移leader超时，放弃转移\n", m_me, m_leadTransferee);
+      m_leadTransferee = -1;
     }
+    if (m_checkQuorum && leaderLostQuorum()) {
+      // 和多数节点失联（比如自己被分区了），多数派那边很可能已经选出了新leader，退位后不再接受写请求
+      DPrintf("[func-Raft::onHeartBeatTimeout rf{%d}] term{%d} 最近%dms内没有收到多数节点的回复，leader退位\n", m_me,
+              m_currentTerm, minRandomizedElectionTime);
+      m_status = Follower;
+      resetElectionTimer();
+      if (m_heartBeatTimer != nullptr) {
+        m_heartBeatTimer->cancel();
+        m_heartBeatTimer = nullptr;
+      }
+      return;
+    }
+  }
+  // DPrintf("[func-Raft::doHeartBeat()-Leader: {%d}] Leader的心跳定时器触发了\n", m_me);
+  doHeartBeat();
+}
 
-    if (std::chrono::duration<double, std::milli>(suitableSleepTime).count() > 1) {
-      std::cout << atomicCount << "\033[1;35m leaderHearBeatTicker();函数设置睡眠时间为: "
-                << std::chrono::duration_cast<std::chrono::milliseconds>(suitableSleepTime).count() << " 毫秒\033[0m"
-                << std::endl;
-      // 获取当前时间点
-      auto start = std::chrono::steady_clock::now();
+bool Raft::leaderLostQuorum() { return !quorumAckedWithin(minRandomizedElectionTime); }
 
-      usleep(std::chrono::duration_cast<std::chrono::microseconds>(suitableSleepTime).count());
-      // std::this_thread::sleep_for(suitableSleepTime);
+bool Raft::quorumAckedWithin(int ms) {
+  auto deadline = now() - std::chrono::milliseconds(ms);
+  int active = isVoter(m_me) ? 1 : 0;  // 自己
+  for (int i = 0; i < m_peers.size(); i++) {
+    if (i != m_me && isVoter(i) && m_lastAckTime[i] >= deadline) {
+      active++;
+    }
+  }
+  return active >= quorumSize();
+}
+
+int Raft::quorumSize() {
+  int voters = 0;
+  for (int i = 0; i < m_peers.size(); i++) {
+    if (isVoter(i)) {
+      voters++;
+    }
+  }
+  return voters / 2 + 1;
+}
 
-      // 获取函数运行结束后的时间点
-      auto end = std::chrono::steady_clock::now();
+void Raft::applyConfig(const raftRpcProctoc::ClusterConfig& config, int configIndex) {
+  m_config = config;
+  m_configIndex = configIndex;
+  int size = m_me + 1;
+  for (const auto& member : config.members()) {
+    size = std::max(size, member.id() + 1);
+  }
+  if (size > m_peers.size()) {
+    m_peers.resize(size);
+    m_appendSenders.resize(size);
+    m_isMember.resize(size, false);
+    m_isLearner.resize(size, false);
+    m_nextIndex.resize(size, getLastLogIndex() + 1);
+    m_matchIndex.resize(size, 0);
+    m_progress.resize(size);
+    m_lastAckTime.resize(size, now());
+  }
+  std::vector<bool> isMember(m_peers.size(), false);
+  for (const auto& member : config.members()) {
+    int id = member.id();
+    isMember[id] = true;
+    m_isLearner[id] = member.learner();
+    if (id != m_me && !m_isMember[id]) {
+      // 新成员：创建rpc，复制状态从头开始
+      m_peers[id] = m_peerFactory(member);
+      m_appendSenders[id] = std::make_shared<SerialExecutor>(RAFT_APPEND_QUEUE_SIZE);
+      m_nextIndex[id] = getLastLogIndex() + 1;
+      m_matchIndex[id] = 0;
+      m_progress[id] = Progress();
+      m_lastAckTime[id] = now();
+      DPrintf("[func-Raft::applyConfig rf{%d}] 配置index{%d}：加入节点{%d} learner{%d}\n", m_me, configIndex, id,
+              member.learner());
+    }
+  }
+  for (int i = 0; i < m_peers.size(); i++) {
+    if (!isMember[i]) {
+      // 在途的rpc线程各自持有一份shared_ptr，这里只是不再向它发送；发送线程发完当前的AE后退出
+      m_peers[i] = nullptr;
+      m_appendSenders[i] = nullptr;
+      m_isLearner[i] = false;
+    }
+  }
+  m_isMember = isMember;
+}
 
-      // 计算时间差并输出结果（单位为毫秒）
-      std::chrono::duration<double, std::milli> duration = end - start;
+void Raft::rebuildConfig() {
+  for (int i = m_logs.size() - 1; i >= 0; i--) {
+    if (m_logs[i].confchange()) {
+      raftRpcProctoc::ClusterConfig config;
+      config.ParseFromString(m_logs[i].command());
+      applyConfig(config, m_logs[i].logindex());
+      return;
+    }
+  }
+  applyConfig(m_snapshotConfig, m_lastSnapshotIncludeIndex);
+}
 
-      // 使用ANSI控制序列将输出颜色修改为紫色
-      std::cout << atomicCount << "\033[1;35m leaderHearBeatTicker();函数实际睡眠时间为: " << duration.count()
-                << " 毫秒\033[0m" << std::endl;
-      ++atomicCount;
+raftRpcProctoc::ClusterConfig Raft::configAt(int logIndex) {
+  for (int index = logIndex; index > m_lastSnapshotIncludeIndex; index--) {
+    const auto& entry = m_logs[getSlicesIndexFromLogIndex(index)];
+    if (entry.confchange()) {
+      raftRpcProctoc::ClusterConfig config;
+      config.ParseFromString(entry.command());
+      return config;
     }
+  }
+  return m_snapshotConfig;
+}
+
+void Raft::appendConfigEntry(const raftRpcProctoc::ClusterConfig& config) {
+  raftRpcProctoc::LogEntry entry;
+  entry.set_command(config.SerializeAsString());
+  entry.set_logterm(m_currentTerm);
+  entry.set_logindex(getNewCommandIndex());
+  entry.set_confchange(true);
+  m_logs.emplace_back(entry);
+  applyConfig(config, entry.logindex());
+  persist();
+  if (++m_pendingReplicate == 1 || m_pendingReplicate == RAFT_REPLICATE_MAX_BATCH) {
+    m_replicateCv.notify_one();
+  }
+}
+
+std::shared_ptr<RaftRpcUtil> Raft::getPeer(int server) {
+  std::lock_guard<monsoon::FiberMutex> lg(m_mtx);
+  return server < m_peers.size() ? m_peers[server] : nullptr;
+}
 
-    if (std::chrono::duration<double, std::milli>(m_lastResetHearBeatTime - wakeTime).count() > 0) {
-      //睡眠的这段时间有重置定时器，没有超时，再次睡眠
+bool Raft::ChangeMembership(const raftRpcProctoc::Member& member, bool remove, int* index, int* term,
+                            bool* isLeader) {
+  std::lock_guard<monsoon::FiberMutex> lg(m_mtx);
+  *isLeader = m_status == Leader && m_leadTransferee == -1;
+  if (!*isLeader) {
+    return false;
+  }
+  raftRpcProctoc::ClusterConfig newConfig;
+  bool found = false;
+  for (const auto& m : m_config.members()) {
+    if (m.id() != member.id()) {
+      *newConfig.add_members() = m;
       continue;
     }
-    // DPrintf("[func-Raft::doHeartBeat()-Leader: {%d}] Leader的心跳定时器触发了\n", m_me);
-    doHeartBeat();
+    found = true;
+    if (!remove) {
+      auto* updated = newConfig.add_members();
+      *updated = m;
+      updated->set_learner(member.learner());
+    }
+  }
+  if (!found && !remove) {
+    *newConfig.add_members() = member;
+  }
+  if (newConfig.SerializeAsString() == m_config.SerializeAsString()) {
+    // 已经是目标配置（比如clerk重试），等这条配置提交即可
+    *index = m_configIndex;
+    *term = m_configIndex == m_lastSnapshotIncludeIndex ? m_lastSnapshotIncludeTerm
+                                                         : getLogTermFromLogIndex(m_configIndex);
+    return true;
+  }
+  // 上一次变更（包括当选时追加的配置日志）还没有提交，不能开始新的变更
+  if (m_configIndex > m_commitIndex) {
+    return false;
+  }
+  int voters = 0;
+  for (const auto& m : newConfig.members()) {
+    voters += m.learner() ? 0 : 1;
+  }
+  if (voters == 0) {
+    return false;
+  }
+  DPrintf("[func-Raft::ChangeMembership rf{%d}] term{%d} %s节点{%d} learner{%d}\n", m_me, m_currentTerm,
+          remove ? "删除" : "加入/修改", member.id(), member.learner());
+  appendConfigEntry(newConfig);
+  *index = m_configIndex;
+  *term = m_currentTerm;
+  return true;
+}
+
+bool Raft::IsCommitted(int index, int term) {
+  std::lock_guard<monsoon::FiberMutex> lg(m_mtx);
+  if (index > getLastLogIndex() || index > m_commitIndex) {
+    return false;
+  }
+  return index <= m_lastSnapshotIncludeIndex || getLogTermFromLogIndex(index) == term;
+}
+
+raftRpcProctoc::ClusterConfig Raft::GetConfig() {
+  std::lock_guard<monsoon::FiberMutex> lg(m_mtx);
+  return m_config;
+}
+
+bool Raft::inLeaderLease() {
+  return m_status == Leader ||
+         now() - m_lastLeaderContact < std::chrono::milliseconds(minRandomizedElectionTime);
+}
+
+void Raft::maybeSendTimeoutNow(int server) {
+  if (server != m_leadTransferee || m_timeoutNowSent || m_matchIndex[server] != getLastLogIndex()) {
+    return;
   }
+  // 转移期间不接受新日志，追平之后不会再落后
+  m_timeoutNowSent = true;
+  auto args = std::make_shared<raftRpcProctoc::TimeoutNowArgs>();
+  args->set_term(m_currentTerm);
+  args->set_leaderid(m_me);
+  std::thread t(&Raft::sendTimeoutNow, this, server, args);
+  t.detach();
+}
+
+void Raft::sendTimeoutNow(int server, std::shared_ptr<raftRpcProctoc::TimeoutNowArgs> args) {
+  DPrintf("[func-Raft::sendTimeoutNow rf{%d}] 节点{%d}的日志已追平，发送TimeoutNow\n", m_me, server);
+  raftRpcProctoc::TimeoutNowReply reply;
+  auto peer = getPeer(server);
+  bool ok = peer != nullptr && peer->TimeoutNow(args.get(), &reply);
+  std::lock_guard<monsoon::FiberMutex> lg(m_mtx);
+  if (!ok && m_leadTransferee == server && m_currentTerm == args->term()) {
+    m_timeoutNowSent = false;  // 没送到，下一次AE回复时再试
+    return;
+  }
+  if (reply.term() > m_currentTerm) {
+    m_status = Follower;
+    m_currentTerm = reply.term();
+    m_votedFor = -1;
+    persist();
+  }
+}
+
+bool Raft::TransferLeadership(int target) {
+  std::lock_guard<monsoon::FiberMutex> lg(m_mtx);
+  if (m_status != Leader || target < 0 || target >= m_peers.size() || target == m_me || !isVoter(target)) {
+    return false;
+  }
+  DPrintf("[func-Raft::TransferLeadership rf{%d}] term{%d} 开始把leader转移给节点{%d}\n", m_me, m_currentTerm, target);
+  m_leadTransferee = target;
+  m_timeoutNowSent = false;
+  m_transferDeadline = now() + std::chrono::milliseconds(RAFT_TRANSFER_LEADER_TIMEOUT);
+  if (m_matchIndex[target] == getLastLogIndex()) {
+    maybeSendTimeoutNow(target);
+  } else {
+    // 马上把target缺的日志发出去，追平后在AE回复中发送TimeoutNow
+    std::thread t(&Raft::doHeartBeat, this, true);
+    t.detach();
+  }
+  return true;
 }
 
 void Raft::leaderSendSnapShot(int server) {
@@ -532,19 +919,27 @@ void Raft::leaderSendSnapShot(int server) {
   args.set_term(m_currentTerm);
   args.set_lastsnapshotincludeindex(m_lastSnapshotIncludeIndex);
   args.set_lastsnapshotincludeterm(m_lastSnapshotIncludeTerm);
-  args.set_data(m_persister->ReadSnapshot());
+  // 快照文件损坏时这个节点自己也无法再恢复状态机，重试也读不出来，直接退出，不能一直卡在Snapshot状态
+  myAssert(m_persister->ReadSnapshot(args.mutable_data()),
+           format("[func-leaderSendSnapShot-raft{%d}] 持久化的快照文件损坏，无法向server{%d}发送", m_me, server));
+  *args.mutable_config() = m_snapshotConfig;
+  auto peer = m_peers[server];
 
   raftRpcProctoc::InstallSnapshotResponse reply;
   m_mtx.unlock();
-  bool ok = m_peers[server]->InstallSnapshot(&args, &reply);
+  if (peer == nullptr) {
+    return;  // 已经被移出集群
+  }
+  bool ok = peer->InstallSnapshot(&args, &reply);
   m_mtx.lock();
   DEFER { m_mtx.unlock(); };
-  if (!ok) {
-    return;
-  }
   if (m_status != Leader || m_currentTerm != args.term()) {
     return;  //中间释放过锁，可能状态已经改变了
   }
+  if (!ok) {
+    becomeProbe(server);  // 下一次心跳时重新发送快照
+    return;
+  }
   //	无论什么时候都要判断term
   if (reply.term() > m_currentTerm) {
     //三变
@@ -552,37 +947,46 @@ void Raft::leaderSendSnapShot(int server) {
     m_votedFor = -1;
     m_status = Follower;
     persist();
-    m_lastResetElectionTime = now();
+    resetElectionTimer();
     return;
   }
-  m_matchIndex[server] = args.lastsnapshotincludeindex();
-  m_nextIndex[server] = m_matchIndex[server] + 1;
+  m_lastAckTime[server] = now();
+  m_matchIndex[server] = std::max(m_matchIndex[server], args.lastsnapshotincludeindex());
+  becomeReplicate(server);
+  maybeSendTimeoutNow(server);
+  leaderUpdateCommitIndex();
+  if (m_nextIndex[server] <= getLastLogIndex()) {
+    notifyReplicate();  // 快照之后的日志接着发
+  }
 }
 
 void Raft::leaderUpdateCommitIndex() {
-  m_commitIndex = m_lastSnapshotIncludeIndex;
-  // for index := rf.commitIndex+1;index < len(rf.log);index++ {
-  // for index := rf.getLastIndex();index>=rf.commitIndex+1;index--{
-  for (int index = getLastLogIndex(); index >= m_lastSnapshotIncludeIndex + 1; index--) {
-    int sum = 0;
+  // 从后往前找多数投票成员都已经复制了的日志。leader只直接提交本term的日志，之前term的日志随之提交，
+  // 往前遇到之前term的日志就不用再找了
+  for (int index = getLastLogIndex(); index > m_commitIndex; index--) {
+    if (getLogTermFromLogIndex(index) != m_currentTerm) {
+      break;
+    }
+    int sum = isVoter(m_me) ? 1 : 0;  // 正在把自己移出集群的leader不计入多数
     for (int i = 0; i < m_peers.size(); i++) {
-      if (i == m_me) {
-        sum += 1;
-        continue;
-      }
-      if (m_matchIndex[i] >= index) {
+      if (i != m_me && isVoter(i) && m_matchIndex[i] >= index) {
         sum += 1;
       }
     }
-
-    //        !!!只有当前term有新提交的，才会更新commitIndex！！！！
-    // log.Printf("lastSSP:%d, index: %d, commitIndex: %d, lastIndex: %d",rf.lastSSPointIndex, index, rf.commitIndex,
-    // rf.getLastIndex())
-    if (sum >= m_peers.size() / 2 + 1 && getLogTermFromLogIndex(index) == m_currentTerm) {
+    if (sum >= quorumSize()) {
+      DPrintf("[func-leaderUpdateCommitIndex rf{%d}] 多数节点已复制，commitIndex from{%d} to{%d}\n", m_me,
+              m_commitIndex, index);
       m_commitIndex = index;
+      m_applyCv.notify_one();
       break;
     }
   }
+  if (!isVoter(m_me) && m_commitIndex >= m_configIndex) {
+    // 把自己移出集群（或者降为learner）的配置已经提交，退位，剩下的成员会选出新leader
+    DPrintf("[func-leaderUpdateCommitIndex rf{%d}] 已不是投票成员且新配置已提交，leader退位\n", m_me);
+    m_status = Follower;
+    resetElectionTimer();
+  }
   //    DPrintf("[func-leaderUpdateCommitIndex()-rf{%v}] Leader %d(term%d) commitIndex
   //    %d",rf.me,rf.me,rf.currentTerm,rf.commitIndex)
 }
@@ -609,7 +1013,7 @@ void Raft::persist() {
 }
 
 void Raft::RequestVote(const raftRpcProctoc::RequestVoteArgs* args, raftRpcProctoc::RequestVoteReply* reply) {
-  std::lock_guard<std::mutex> lg(m_mtx);
+  std::lock_guard<monsoon::FiberMutex> lg(m_mtx);
 
   // Your code here (2A, 2B).
   DEFER {
@@ -624,6 +1028,14 @@ void Raft::RequestVote(const raftRpcProctoc::RequestVoteArgs* args, raftRpcProct
     reply->set_votegranted(false);
     return;
   }
+  // 开启CheckQuorum时leader失联会自己退位，所以还能收到leader消息时不理会更高term的投票请求，也不跟随它的term，
+  // 防止失联节点恢复后打断正常的leader
+  if (m_checkQuorum && !args->leadershiptransfer() && args->term() > m_currentTerm && inLeaderLease()) {
+    reply->set_term(m_currentTerm);
+    reply->set_votestate(Voted);
+    reply->set_votegranted(false);
+    return;
+  }
   // fig2:右下角，如果任何时候rpc请求或者响应的term大于自己的term，更新term，并变成follower
   if (args->term() > m_currentTerm) {
     //        DPrintf("[	    func-RequestVote-rf(%v)		] : 变成follower且更新term
@@ -672,7 +1084,7 @@ void Raft::RequestVote(const raftRpcProctoc::RequestVoteArgs* args, raftRpcProct
     return;
   } else {
     m_votedFor = args->candidateid();
-    m_lastResetElectionTime = now();  //认为必须要在投出票的时候才重置定时器，
+    resetElectionTimer();  //认为必须要在投出票的时候才重置定时器，
     //        DPrintf("[	    func-RequestVote-rf(%v)		] : voted rf[%v]\n", rf.me, rf.votedFor)
     reply->set_term(m_currentTerm);
     reply->set_votestate(Normal);
@@ -682,6 +1094,46 @@ void Raft::RequestVote(const raftRpcProctoc::RequestVoteArgs* args, raftRpcProct
   }
 }
 
+void Raft::RequestPreVote(const raftRpcProctoc::RequestVoteArgs* args, raftRpcProctoc::RequestVoteReply* reply) {
+  std::lock_guard<monsoon::FiberMutex> lg(m_mtx);
+  // 预投票只回答“如果真的发起选举会不会投票”，不修改term、votedFor，也不重置选举定时器，不需要persist
+  reply->set_term(m_currentTerm);
+  reply->set_votegranted(false);
+  if (args->term() <= m_currentTerm) {
+    reply->set_votestate(Expire);
+    return;
+  }
+  if (inLeaderLease()) {
+    // leader还活着，候选人多半是刚从网络分区中恢复
+    reply->set_votestate(Voted);
+    return;
+  }
+  if (!UpToDate(args->lastlogindex(), args->lastlogterm())) {
+    reply->set_votestate(Voted);
+    return;
+  }
+  reply->set_votestate(Normal);
+  reply->set_votegranted(true);
+}
+
+void Raft::TimeoutNow(const raftRpcProctoc::TimeoutNowArgs* args, raftRpcProctoc::TimeoutNowReply* reply) {
+  std::lock_guard<monsoon::FiberMutex> lg(m_mtx);
+  if (args->term() < m_currentTerm || m_status == Leader) {
+    reply->set_term(m_currentTerm);
+    return;  // 过期的leader发来的
+  }
+  if (args->term() > m_currentTerm) {
+    m_status = Follower;
+    m_currentTerm = args->term();
+    m_votedFor = -1;
+  }
+  reply->set_term(m_currentTerm);
+  DPrintf("[func-Raft::TimeoutNow rf{%d}] 收到leader{%d}的TimeoutNow，立即以term{%d}发起选举\n", m_me,
+          args->leaderid(), m_currentTerm + 1);
+  // 不经过预投票，直接选举；leader已经停止接受新日志，自己的日志一定是最新的
+  startElection(true);
+}
+
 bool Raft::UpToDate(int index, int term) {
   // lastEntry := rf.log[len(rf.log)-1]
 
@@ -765,7 +1217,8 @@ bool Raft::sendRequestVote(int server, std::shared_ptr<raftRpcProctoc::RequestVo
   // todo
   auto start = now();
   DPrintf("[func-sendRequestVote rf{%d}] 向server{%d} 發送 RequestVote 開始", m_me, m_currentTerm, getLastLogIndex());
-  bool ok = m_peers[server]->RequestVote(args.get(), reply.get());
+  auto peer = getPeer(server);
+  bool ok = peer != nullptr && peer->RequestVote(args.get(), reply.get());
   DPrintf("[func-sendRequestVote rf{%d}] 向server{%d} 發送 RequestVote 完畢，耗時:{%d} ms", m_me, m_currentTerm,
           getLastLogIndex(), now() - start);
 
@@ -780,7 +1233,7 @@ bool Raft::sendRequestVote(int server, std::shared_ptr<raftRpcProctoc::RequestVo
   //	//}
   // } //这里是发送出去了，但是不能保证他一定到达
   //对回应进行处理，要记得无论什么时候收到回复就要检查term
-  std::lock_guard<std::mutex> lg(m_mtx);
+  std::lock_guard<monsoon::FiberMutex> lg(m_mtx);
   if (reply->term() > m_currentTerm) {
     m_status = Follower;  //三变：身份，term，和投票
     m_currentTerm = reply->term();
@@ -798,7 +1251,7 @@ bool Raft::sendRequestVote(int server, std::shared_ptr<raftRpcProctoc::RequestVo
   }
 
   *votedNum = *votedNum + 1;
-  if (*votedNum >= m_peers.size() / 2 + 1) {
+  if (*votedNum >= quorumSize()) {
     //变成leader
     *votedNum = 0;
     if (m_status == Leader) {
@@ -816,34 +1269,81 @@ bool Raft::sendRequestVote(int server, std::shared_ptr<raftRpcProctoc::RequestVo
     for (int i = 0; i < m_nextIndex.size(); i++) {
       m_nextIndex[i] = lastLogIndex + 1;  //有效下标从1开始，因此要+1
       m_matchIndex[i] = 0;                //每换一个领导都是从0开始，见fig2
+      m_lastAckTime[i] = now();           // CheckQuorum从当选时开始计时
+      m_progress[i] = Progress();         // 从试探开始
     }
-    std::thread t(&Raft::doHeartBeat, this);  //马上向其他节点宣告自己就是leader
+    m_leadTransferee = -1;
+    // 当选后先追加一条内容不变的配置日志：它提交之后之前term的日志也随之提交，
+    // 也保证了成员变更只在本term提交过日志之后才能开始（见ChangeMembership）
+    appendConfigEntry(m_config);
+    std::thread t(&Raft::doHeartBeat, this, true);  //马上向其他节点宣告自己就是leader
     t.detach();
+    startHeartBeatTimer();
 
     persist();
   }
   return true;
 }
 
+bool Raft::sendRequestPreVote(int server, std::shared_ptr<raftRpcProctoc::RequestVoteArgs> args,
+                              std::shared_ptr<raftRpcProctoc::RequestVoteReply> reply, std::shared_ptr<int> grantedNum,
+                              int round) {
+  auto peer = getPeer(server);
+  bool ok = peer != nullptr && peer->RequestPreVote(args.get(), reply.get());
+  if (!ok) {
+    return ok;
+  }
+  std::lock_guard<monsoon::FiberMutex> lg(m_mtx);
+  // 已经开始了新一轮预投票、已经当选，或者term已经变了，这个回复就过期了
+  if (round != m_preVoteRound || m_status == Leader || args->term() != m_currentTerm + 1) {
+    return true;
+  }
+  if (!reply->votegranted()) {
+    if (reply->term() > m_currentTerm) {
+      // 对方的term比自己大，说明自己落后了，跟上term，等待新leader的消息
+      m_status = Follower;
+      m_currentTerm = reply->term();
+      m_votedFor = -1;
+      persist();
+    }
+    return true;
+  }
+  *grantedNum = *grantedNum + 1;
+  if (*grantedNum >= quorumSize()) {
+    *grantedNum = 0;
+    m_preVoteRound++;  // 本轮已经成功，之后迟到的回复都丢弃
+    DPrintf("[func-sendRequestPreVote rf{%d}] 预投票得到多数同意，以term{%d}发起选举\n", m_me, args->term());
+    startElection();
+  }
+  return true;
+}
+
 bool Raft::sendAppendEntries(int server, std::shared_ptr<raftRpcProctoc::AppendEntriesArgs> args,
-                             std::shared_ptr<raftRpcProctoc::AppendEntriesReply> reply,
-                             std::shared_ptr<int> appendNums) {
+                             std::shared_ptr<raftRpcProctoc::AppendEntriesReply> reply) {
   //这个ok是网络是否正常通信的ok，而不是requestVote rpc是否投票的rpc
-  // 如果网络不通的话肯定是没有返回的，不用一直重试
-  // todo： paper中5.3节第一段末尾提到，如果append失败应该不断的retries ,直到这个log成功的被store
+  // 如果网络不通的话肯定是没有返回的，不用一直重试，由复制状态决定下一次从哪里发
   DPrintf("[func-Raft::sendAppendEntries-raft{%d}] leader 向节点{%d}发送AE rpc開始 ， args->entries_size():{%d}", m_me,
           server, args->entries_size());
-  bool ok = m_peers[server]->AppendEntries(args.get(), reply.get());
+  auto peer = getPeer(server);
+  bool ok = peer != nullptr && peer->AppendEntries(args.get(), reply.get());
 
   if (!ok) {
     DPrintf("[func-Raft::sendAppendEntries-raft{%d}] leader 向节点{%d}发送AE rpc失敗", m_me, server);
-    return ok;
+    reply->set_appstate(Disconnected);
+  } else {
+    DPrintf("[func-Raft::sendAppendEntries-raft{%d}] leader 向节点{%d}发送AE rpc成功", m_me, server);
   }
-  DPrintf("[func-Raft::sendAppendEntries-raft{%d}] leader 向节点{%d}发送AE rpc成功", m_me, server);
+  handleAppendEntriesReply(server, args, reply);
+  return ok;
+}
+
+void Raft::handleAppendEntriesReply(int server, std::shared_ptr<raftRpcProctoc::AppendEntriesArgs> args,
+                                    std::shared_ptr<raftRpcProctoc::AppendEntriesReply> reply) {
+  std::lock_guard<monsoon::FiberMutex> lg1(m_mtx);
   if (reply->appstate() == Disconnected) {
-    return ok;
+    onAppendEntriesFailed(server, *args);
+    return;
   }
-  std::lock_guard<std::mutex> lg1(m_mtx);
 
   //对reply进行处理
   // 对于rpc通信，无论什么时候都要检查term
@@ -851,76 +1351,74 @@ bool Raft::sendAppendEntries(int server, std::shared_ptr<raftRpcProctoc::AppendE
     m_status = Follower;
     m_currentTerm = reply->term();
     m_votedFor = -1;
-    return ok;
+    return;
   } else if (reply->term() < m_currentTerm) {
     DPrintf("[func -sendAppendEntries  rf{%d}]  节点：{%d}的term{%d}<rf{%d}的term{%d}\n", m_me, server, reply->term(),
             m_me, m_currentTerm);
-    return ok;
+    return;
   }
 
-  if (m_status != Leader) {
-    //如果不是leader，那么就不要对返回的情况进行处理了
-    return ok;
+  if (m_status != Leader || server >= m_progress.size() || !m_isMember[server]) {
+    //如果不是leader，那么就不要对返回的情况进行处理了；节点已经被移除也不用处理
+    return;
   }
   // term相等
 
   myAssert(reply->term() == m_currentTerm,
            format("reply.Term{%d} != rf.currentTerm{%d}   ", reply->term(), m_currentTerm));
+  m_lastAckTime[server] = now();  // 不论日志是否匹配，对方都还认可自己是当前term的leader
+  Progress& pr = m_progress[server];
   if (!reply->success()) {
     //日志不匹配，正常来说就是index要往前-1，既然能到这里，第一个日志（idnex =
     // 1）发送后肯定是匹配的，因此不用考虑变成负数 因为真正的环境不会知道是服务器宕机还是发生网络分区了
+    if (args->prevlogindex() < m_matchIndex[server] || pr.state == ProgressState::Snapshot) {
+      return;  // 过期的回复：之后已经确认匹配到更后面了，或者已经在发快照
+    }
     if (reply->updatenextindex() != -100) {
       // todo:待总结，就算term匹配，失败的时候nextIndex也不是照单全收的，因为如果发生rpc延迟，leader的term可能从不符合term要求
       //变得符合term要求
       //但是不能直接赋值reply.UpdateNextIndex
       DPrintf("[func -sendAppendEntries  rf{%d}]  返回的日志term相等，但是不匹配，回缩nextIndex[%d]：{%d}\n", m_me,
               server, reply->updatenextindex());
+      becomeProbe(server);                                 // 之后在途的AE也都会失败，重新试探
       m_nextIndex[server] = reply->updatenextindex();  //失败是不更新mathIndex的
+      notifyReplicate();  // 马上从新的位置再试，不用等下一次心跳
+    } else {
+      pr.probeSent = false;
     }
     //	怎么越写越感觉rf.nextIndex数组是冗余的呢，看下论文fig2，其实不是冗余的
-  } else {
-    *appendNums = *appendNums + 1;
-    DPrintf("---------------------------tmp------------------------- 節點{%d}返回true,當前*appendNums{%d}", server,
-            *appendNums);
-    // rf.matchIndex[server] = len(args.Entries) //只要返回一个响应就对其matchIndex应该对其做出反应，
-    //但是这么修改是有问题的，如果对某个消息发送了多遍（心跳时就会再发送），那么一条消息会导致n次上涨
-    m_matchIndex[server] = std::max(m_matchIndex[server], args->prevlogindex() + args->entries_size());
-    m_nextIndex[server] = m_matchIndex[server] + 1;
-    int lastLogIndex = getLastLogIndex();
-
-    myAssert(m_nextIndex[server] <= lastLogIndex + 1,
-             format("error msg:rf.nextIndex[%d] > lastLogIndex+1, len(rf.logs) = %d   lastLogIndex{%d} = %d", server,
-                    m_logs.size(), server, lastLogIndex));
-    if (*appendNums >= 1 + m_peers.size() / 2) {
-      //可以commit了
-      //两种方法保证幂等性，1.赋值为0 	2.上面≥改为==
-
-      *appendNums = 0;
-      // todo https://578223592-laughing-halibut-wxvpggvw69qh99q4.github.dev/ 不断遍历来统计rf.commitIndex
-      //改了好久！！！！！
-      // leader只有在当前term有日志提交的时候才更新commitIndex，因为raft无法保证之前term的Index是否提交
-      //只有当前term有日志提交，之前term的log才可以被提交，只有这样才能保证“领导人完备性{当选领导人的节点拥有之前被提交的所有log，当然也可能有一些没有被提交的}”
-      // rf.leaderUpdateCommitIndex()
-      if (args->entries_size() > 0) {
-        DPrintf("args->entries(args->entries_size()-1).logterm(){%d}   m_currentTerm{%d}",
-                args->entries(args->entries_size() - 1).logterm(), m_currentTerm);
-      }
-      if (args->entries_size() > 0 && args->entries(args->entries_size() - 1).logterm() == m_currentTerm) {
-        DPrintf(
-            "---------------------------tmp------------------------- 當前term有log成功提交，更新leader的m_commitIndex "
-            "from{%d} to{%d}",
-            m_commitIndex, args->prevlogindex() + args->entries_size());
-
-        m_commitIndex = std::max(m_commitIndex, args->prevlogindex() + args->entries_size());
-      }
-      myAssert(m_commitIndex <= lastLogIndex,
-               format("[func-sendAppendEntries,rf{%d}] lastLogIndex:%d  rf.commitIndex:%d\n", m_me, lastLogIndex,
-                      m_commitIndex));
-      // fmt.Printf("[func-sendAppendEntries,rf{%v}] len(rf.logs):%v  rf.commitIndex:%v\n", rf.me, len(rf.logs),
-      // rf.commitIndex)
+    return;
+  }
+  // rf.matchIndex[server] = len(args.Entries) //只要返回一个响应就对其matchIndex应该对其做出反应，
+  //但是这么修改是有问题的，如果对某个消息发送了多遍（心跳时就会再发送），那么一条消息会导致n次上涨
+  int oldMatch = m_matchIndex[server];
+  m_matchIndex[server] = std::max(m_matchIndex[server], args->prevlogindex() + args->entries_size());
+  if (pr.state == ProgressState::Probe) {
+    becomeReplicate(server);  // 找到了一致的位置，开始连续发送
+  } else if (pr.state == ProgressState::Replicate) {
+    m_nextIndex[server] = std::max(m_nextIndex[server], m_matchIndex[server] + 1);
+    // 带日志的AE都由同一个发送线程按顺序发出并处理回复，确认到的位置之前的在途AE都已经结束，腾出窗口
+    while (!pr.inflights.empty() && pr.inflights.front().first <= m_matchIndex[server]) {
+      pr.inflightBytes -= pr.inflights.front().second;
+      pr.inflights.pop_front();
     }
   }
-  return ok;
+  maybeSendTimeoutNow(server);
+  int lastLogIndex = getLastLogIndex();
+
+  myAssert(m_nextIndex[server] <= lastLogIndex + 1,
+           format("error msg:rf.nextIndex[%d] > lastLogIndex+1, len(rf.logs) = %d   lastLogIndex{%d} = %d", server,
+                  m_logs.size(), server, lastLogIndex));
+  if (isVoter(server) && m_matchIndex[server] > oldMatch) {
+    // leader只有在当前term有日志提交的时候才更新commitIndex，因为raft无法保证之前term的Index是否提交
+    //只有当前term有日志提交，之前term的log才可以被提交，只有这样才能保证“领导人完备性{当选领导人的节点拥有之前被提交的所有log，当然也可能有一些没有被提交的}”
+    // 各follower每次收到的日志范围不同，不能按单个AE的回复数计数，要看各节点的matchIndex
+    // 提交了把自己移出集群的配置时，leader在里面退位
+    leaderUpdateCommitIndex();
+  }
+  if (pr.state == ProgressState::Replicate && m_nextIndex[server] <= lastLogIndex) {
+    notifyReplicate();  // 还有没发完的日志（落后的follower追赶中），窗口腾出来了就接着发
+  }
 }
 
 void Raft::AppendEntries(google::protobuf::RpcController* controller,
@@ -944,32 +1442,54 @@ void Raft::RequestVote(google::protobuf::RpcController* controller, const ::raft
   done->Run();
 }
 
-void Raft::Start(Op command, int* newLogIndex, int* newLogTerm, bool* isLeader) {
-  std::lock_guard<std::mutex> lg1(m_mtx);
+void Raft::RequestPreVote(google::protobuf::RpcController* controller, const ::raftRpcProctoc::RequestVoteArgs* request,
+                          ::raftRpcProctoc::RequestVoteReply* response, ::google::protobuf::Closure* done) {
+  RequestPreVote(request, response);
+  done->Run();
+}
+
+void Raft::TimeoutNow(google::protobuf::RpcController* controller, const ::raftRpcProctoc::TimeoutNowArgs* request,
+                      ::raftRpcProctoc::TimeoutNowReply* response, ::google::protobuf::Closure* done) {
+  TimeoutNow(request, response);
+  done->Run();
+}
+
+void Raft::Start(Op command, int* newLogIndex, int* newLogTerm, bool* isLeader,
+                 const std::function<bool(int)>& reserve) {
+  std::lock_guard<monsoon::FiberMutex> lg1(m_mtx);
   //    m_mtx.lock();
   //    Defer ec1([this]()->void {
   //       m_mtx.unlock();
   //    });
-  if (m_status != Leader) {
-    DPrintf("[func-Start-rf{%d}]  is not leader");
+  // 转移leader期间不再接受新日志，否则目标节点永远追不平
+  if (m_status != Leader || m_leadTransferee != -1) {
+    DPrintf("[func-Start-rf{%d}]  is not leader or transferring leadership\n", m_me);
     *newLogIndex = -1;
     *newLogTerm = -1;
     *isLeader = false;
     return;
   }
 
+  int newIndex = getNewCommandIndex();
+  if (reserve && !reserve(newIndex)) {
+    *newLogIndex = -1;
+    *newLogTerm = -1;
+    *isLeader = true;
+    return;
+  }
+
   raftRpcProctoc::LogEntry newLogEntry;
   newLogEntry.set_command(command.asString());
   newLogEntry.set_logterm(m_currentTerm);
-  newLogEntry.set_logindex(getNewCommandIndex());
+  newLogEntry.set_logindex(newIndex);
   m_logs.emplace_back(newLogEntry);
 
   int lastLogIndex = getLastLogIndex();
 
-  // leader应该不停的向各个Follower发送AE来维护心跳和保持日志同步，目前的做法是新的命令来了不会直接执行，而是等待leader的心跳触发
+  // 新的命令不再等待下一次心跳，而是通知复制线程尽快发出（不能在这里直接调用doHeartBeat，它也要拿m_mtx）
   DPrintf("[func-Start-rf{%d}]  lastLogIndex:%d,command:%s\n", m_me, lastLogIndex, &command);
-  // rf.timer.Reset(10) //接收到命令后马上给follower发送,改成这样不知为何会出现问题，待修正 todo
   persist();
+  notifyReplicate();
   *newLogIndex = newLogEntry.logindex();
   *newLogTerm = newLogEntry.logterm();
   *isLeader = true;
@@ -985,9 +1505,20 @@ void Raft::Start(Op command, int* newLogIndex, int* newLogTerm, bool* isLeader)
 // tester or service expects Raft to send ApplyMsg messages.
 // Make() must return quickly, so it should start goroutines
 // for any long-running work.
-void Raft::init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::shared_ptr<Persister> persister,
-                std::shared_ptr<LockQueue<ApplyMsg>> applyCh) {
-  m_peers = peers;
+void Raft::SetMultiRaft(uint32_t groupId, MultiRaftNode* node) {
+  m_groupId = groupId;
+  m_multiRaftNode = node;
+}
+
+void Raft::SetElectionOptions(bool preVote, bool checkQuorum) {
+  m_preVote = preVote;
+  m_checkQuorum = checkQuorum;
+}
+
+void Raft::init(raftRpcProctoc::ClusterConfig bootstrapConfig, PeerFactory peerFactory, int me,
+                std::shared_ptr<Persister> persister, std::shared_ptr<LockQueue<ApplyMsg>> applyCh,
+                std::shared_ptr<monsoon::IOManager> ioManager) {
+  m_peerFactory = std::move(peerFactory);
   m_persister = persister;
   m_me = me;
   // Your initialization code here (2A, 2B, 2C).
@@ -1001,10 +1532,6 @@ void Raft::init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::sh
   m_commitIndex = 0;
   m_lastApplied = 0;
   m_logs.clear();
-  for (int i = 0; i < m_peers.size(); i++) {
-    m_matchIndex.push_back(0);
-    m_nextIndex.push_back(0);
-  }
   m_votedFor = -1;
 
   m_lastSnapshotIncludeIndex = 0;
@@ -1013,37 +1540,41 @@ void Raft::init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::sh
   m_lastResetHearBeatTime = now();
 
   // initialize from state persisted before a crash
-  readPersist(m_persister->ReadRaftState());
+  m_snapshotConfig = bootstrapConfig;  // 有持久化状态时被覆盖，初始配置只在第一次启动时使用
+  std::string raftState;
+  // 按空状态启动会丢掉term、votedFor和已提交的日志，可能在同一个term投两次票，只能拒绝启动
+  myAssert(m_persister->ReadRaftState(&raftState),
+           format("[Init&ReInit] Sever %d 持久化的raft状态损坏，拒绝启动", m_me));
+  readPersist(raftState);
   if (m_lastSnapshotIncludeIndex > 0) {
     m_lastApplied = m_lastSnapshotIncludeIndex;
     // rf.commitIndex = rf.lastSnapshotIncludeIndex   todo ：崩溃恢复为何不能读取commitIndex
   }
+  rebuildConfig();
 
   DPrintf("[Init&ReInit] Sever %d, term %d, lastSnapshotIncludeIndex {%d} , lastSnapshotIncludeTerm {%d}", m_me,
           m_currentTerm, m_lastSnapshotIncludeIndex, m_lastSnapshotIncludeTerm);
 
   m_mtx.unlock();
 
-  m_ioManager = std::make_unique<monsoon::IOManager>(FIBER_THREAD_NUM, FIBER_USE_CALLER_THREAD);
-
-  // start ticker fiber to start elections
-  // 启动三个循环定时器
-  // todo:原来是启动了三个线程，现在是直接使用了协程，三个函数中leaderHearBeatTicker
-  // 、electionTimeOutTicker执行时间是恒定的，applierTicker时间受到数据库响应延迟和两次apply之间请求数量的影响，这个随着数据量增多可能不太合理，最好其还是启用一个线程。
-  m_ioManager->scheduler([this]() -> void { this->leaderHearBeatTicker(); });
-  m_ioManager->scheduler([this]() -> void { this->electionTimeOutTicker(); });
+  m_ioManager = ioManager != nullptr ? ioManager
+                                     : std::make_shared<monsoon::IOManager>(FIBER_THREAD_NUM, FIBER_USE_CALLER_THREAD,
+                                                                            "IOManager", FIBER_USE_IO_URING,
+                                                                            (monsoon::EpollShard)FIBER_EPOLL_SHARD);
+
+  // 选举超时和心跳都用m_ioManager上的定时器驱动：选举定时器一直存在，每次重置选举时间时重新调度；
+  // 心跳定时器只在当选leader后创建，卸任后在回调中取消，follower不会因为心跳被唤醒。
+  // applierTicker的执行时间受到数据库响应延迟和两次apply之间请求数量的影响，还是启用一个线程。
+  {
+    std::lock_guard<monsoon::FiberMutex> lg(m_mtx);
+    m_electionTimer = m_ioManager->addTimer(
+        getRandomizedElectionTimeout().count(), [this]() -> void { onElectionTimeout(); }, true);
+  }
 
   std::thread t3(&Raft::applierTicker, this);
   t3.detach();
-
-  // std::thread t(&Raft::leaderHearBeatTicker, this);
-  // t.detach();
-  //
-  // std::thread t2(&Raft::electionTimeOutTicker, this);
-  // t2.detach();
-  //
-  // std::thread t3(&Raft::applierTicker, this);
-  // t3.detach();
+  std::thread t4(&Raft::replicatorLoop, this);
+  t4.detach();
 }
 
 std::string Raft::persistData() {
@@ -1052,6 +1583,7 @@ std::string Raft::persistData() {
   boostPersistRaftNode.m_votedFor = m_votedFor;
   boostPersistRaftNode.m_lastSnapshotIncludeIndex = m_lastSnapshotIncludeIndex;
   boostPersistRaftNode.m_lastSnapshotIncludeTerm = m_lastSnapshotIncludeTerm;
+  boostPersistRaftNode.m_snapshotConfig = m_snapshotConfig.SerializeAsString();
   for (auto& item : m_logs) {
     boostPersistRaftNode.m_logs.push_back(item.SerializeAsString());
   }
@@ -1076,6 +1608,7 @@ void Raft::readPersist(std::string data) {
   m_votedFor = boostPersistRaftNode.m_votedFor;
   m_lastSnapshotIncludeIndex = boostPersistRaftNode.m_lastSnapshotIncludeIndex;
   m_lastSnapshotIncludeTerm = boostPersistRaftNode.m_lastSnapshotIncludeTerm;
+  m_snapshotConfig.ParseFromString(boostPersistRaftNode.m_snapshotConfig);
   m_logs.clear();
   for (auto& item : boostPersistRaftNode.m_logs) {
     raftRpcProctoc::LogEntry logEntry;
@@ -1085,7 +1618,7 @@ void Raft::readPersist(std::string data) {
 }
 
 void Raft::Snapshot(int index, std::string snapshot) {
-  std::lock_guard<std::mutex> lg(m_mtx);
+  std::lock_guard<monsoon::FiberMutex> lg(m_mtx);
 
   if (m_lastSnapshotIncludeIndex >= index || index > m_commitIndex) {
     DPrintf(
@@ -1099,6 +1632,7 @@ void Raft::Snapshot(int index, std::string snapshot) {
   //制造完此快照后剩余的所有日志
   int newLastSnapshotIncludeIndex = index;
   int newLastSnapshotIncludeTerm = m_logs[getSlicesIndexFromLogIndex(index)].logterm();
+  m_snapshotConfig = configAt(index);
   std::vector<raftRpcProctoc::LogEntry> trunckedLogs;
   // todo :这种写法有点笨，待改进，而且有内存泄漏的风险
   for (int i = index + 1; i <= getLastLogIndex(); i++) {
@@ -1108,6 +1642,7 @@ void Raft::Snapshot(int index, std::string snapshot) {
   m_lastSnapshotIncludeIndex = newLastSnapshotIncludeIndex;
   m_lastSnapshotIncludeTerm = newLastSnapshotIncludeTerm;
   m_logs = trunckedLogs;
+  rebuildConfig();
   m_commitIndex = std::max(m_commitIndex, index);
   m_lastApplied = std::max(m_lastApplied, index);
 
@@ -9,6 +9,7 @@
 
 bool RaftRpcUtil::AppendEntries(raftRpcProctoc::AppendEntriesArgs *args, raftRpcProctoc::AppendEntriesReply *response) {
   MprpcController controller;
+  controller.SetGroupId(groupId_);
   stub_->AppendEntries(&controller, args, response, nullptr);
   return !controller.Failed();
 }
@@ -16,22 +17,41 @@ bool RaftRpcUtil::AppendEntries(raftRpcProctoc::AppendEntriesArgs *args, raftRpc
 bool RaftRpcUtil::InstallSnapshot(raftRpcProctoc::InstallSnapshotRequest *args,
                                   raftRpcProctoc::InstallSnapshotResponse *response) {
   MprpcController controller;
+  controller.SetGroupId(groupId_);
   stub_->InstallSnapshot(&controller, args, response, nullptr);
   return !controller.Failed();
 }
 
 bool RaftRpcUtil::RequestVote(raftRpcProctoc::RequestVoteArgs *args, raftRpcProctoc::RequestVoteReply *response) {
   MprpcController controller;
+  controller.SetGroupId(groupId_);
   stub_->RequestVote(&controller, args, response, nullptr);
   return !controller.Failed();
 }
 
+bool RaftRpcUtil::RequestPreVote(raftRpcProctoc::RequestVoteArgs *args, raftRpcProctoc::RequestVoteReply *response) {
+  MprpcController controller;
+  controller.SetGroupId(groupId_);
+  stub_->RequestPreVote(&controller, args, response, nullptr);
+  return !controller.Failed();
+}
+
+bool RaftRpcUtil::TimeoutNow(raftRpcProctoc::TimeoutNowArgs *args, raftRpcProctoc::TimeoutNowReply *response) {
+  MprpcController controller;
+  controller.SetGroupId(groupId_);
+  stub_->TimeoutNow(&controller, args, response, nullptr);
+  return !controller.Failed();
+}
+
 //先开启服务器，再尝试连接其他的节点，中间给一个间隔时间，等待其他的rpc服务器节点启动
 
-RaftRpcUtil::RaftRpcUtil(std::string ip, short port) {
+RaftRpcUtil::RaftRpcUtil(std::string ip, short port) : RaftRpcUtil(std::make_shared<MprpcChannel>(ip, port, true), 0) {}
+
+RaftRpcUtil::RaftRpcUtil(std::shared_ptr<MprpcChannel> channel, uint32_t groupId)
+    : channel_(std::move(channel)), groupId_(groupId) {
   //*********************************************  */
   //发送rpc设置
-  stub_ = new raftRpcProctoc::raftRpc_Stub(new MprpcChannel(ip, port, true));
+  stub_ = new raftRpcProctoc::raftRpc_Stub(channel_.get());
 }
 
 RaftRpcUtil::~RaftRpcUtil() { delete stub_; }
@@ -0,0 +1,131 @@
+#include "sessionTable.h"
+
+#include "util.h"
+
+namespace {
+
+const uint8_t kSessionTableVersion = 2;
+
+}  // namespace
+
+SessionTable::SessionTable(int64_t ttl) : m_ttl(ttl), m_clock(0) {}
+
+void SessionTable::Advance(int64_t timestamp) {
+  if (timestamp <= m_clock) {
+    return;
+  }
+  m_clock = timestamp;
+  while (!m_expiry.empty() && m_expiry.begin()->first + m_ttl < m_clock) {
+    m_sessions.erase(m_expiry.begin()->second);
+    m_expiry.erase(m_expiry.begin());
+  }
+}
+
+void SessionTable::touch(Session &session) {
+  if (session.lastActive == m_clock) {
+    return;
+  }
+  std::string clientId = std::move(session.expiryIt->second);
+  m_expiry.erase(session.expiryIt);
+  session.lastActive = m_clock;
+  session.expiryIt = m_expiry.emplace_hint(m_expiry.end(), m_clock, std::move(clientId));
+}
+
+void SessionTable::Register(const std::string &clientId, int64_t epoch) {
+  auto it = m_sessions.find(clientId);
+  if (it != m_sessions.end()) {
+    touch(it->second);
+    return;
+  }
+  auto expiryIt = m_expiry.emplace_hint(m_expiry.end(), m_clock, clientId);
+  m_sessions.emplace(clientId, Session{epoch, 0, m_clock, expiryIt});
+}
+
+bool SessionTable::Touch(const std::string &clientId) {
+  auto it = m_sessions.find(clientId);
+  if (it == m_sessions.end()) {
+    return false;
+  }
+  touch(it->second);
+  return true;
+}
+
+SessionTable::CheckResult SessionTable::CheckAndRecord(const std::string &clientId, int64_t epoch, int requestId) {
+  auto it = m_sessions.find(clientId);
+  if (it == m_sessions.end() || it->second.epoch != epoch) {
+    return kNoSession;
+  }
+  touch(it->second);
+  if (requestId <= it->second.lastRequestId) {
+    return kDuplicate;
+  }
+  it->second.lastRequestId = requestId;
+  return kApply;
+}
+
+int64_t SessionTable::Epoch(const std::string &clientId) const {
+  auto it = m_sessions.find(clientId);
+  return it == m_sessions.end() ? 0 : it->second.epoch;
+}
+
+bool SessionTable::IsDuplicate(const std::string &clientId, int requestId) const {
+  auto it = m_sessions.find(clientId);
+  return it != m_sessions.end() && requestId <= it->second.lastRequestId;
+}
+
+std::string SessionTable::Encode() const {
+  std::string out;
+  out.reserve(16 + m_sessions.size() * 32);
+  out.push_back(static_cast<char>(kSessionTableVersion));
+  putVarint(&out, static_cast<uint64_t>(m_clock));
+  putVarint(&out, m_sessions.size());
+  // 按m_expiry的顺序写出，解码时可以直接在尾部插入重建有序索引
+  for (const auto &item : m_expiry) {
+    const Session &session = m_sessions.at(item.second);
+    putVarint(&out, item.second.size());
+    out.append(item.second);
+    putVarint(&out, static_cast<uint64_t>(session.epoch));
+    putVarint(&out, static_cast<uint32_t>(session.lastRequestId));
+    putVarint(&out, static_cast<uint64_t>(m_clock - session.lastActive));
+  }
+  return out;
+}
+
+bool SessionTable::Decode(const std::string &data) {
+  m_sessions.clear();
+  m_expiry.clear();
+  m_clock = 0;
+  if (data.empty()) {
+    return true;
+  }
+  if (static_cast<uint8_t>(data[0]) != kSessionTableVersion) {
+    return false;
+  }
+  size_t pos = 1;
+  uint64_t clock = 0;
+  uint64_t count = 0;
+  if (!getVarint(data, &pos, &clock) || !getVarint(data, &pos, &count)) {
+    return false;
+  }
+  m_clock = static_cast<int64_t>(clock);
+  m_sessions.reserve(count);
+  for (uint64_t i = 0; i < count; ++i) {
+    uint64_t idLen = 0;
+    uint64_t epoch = 0;
+    uint64_t requestId = 0;
+    uint64_t age = 0;
+    if (!getVarint(data, &pos, &idLen) || idLen > data.size() - pos) {
+      return false;
+    }
+    std::string clientId = data.substr(pos, idLen);
+    pos += idLen;
+    if (!getVarint(data, &pos, &epoch) || !getVarint(data, &pos, &requestId) || !getVarint(data, &pos, &age)) {
+      return false;
+    }
+    int64_t lastActive = m_clock - static_cast<int64_t>(age);
+    auto expiryIt = m_expiry.emplace_hint(m_expiry.end(), lastActive, clientId);
+    m_sessions.emplace(std::move(clientId),
+                       Session{static_cast<int64_t>(epoch), static_cast<int>(requestId), lastActive, expiryIt});
+  }
+  return true;
+}
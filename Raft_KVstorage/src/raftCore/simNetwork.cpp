@@ -0,0 +1,140 @@
+#include "simNetwork.h"
+
+#include <thread>
+#include "raft.h"
+
+SimNetwork::SimNetwork(uint64_t seed)
+    : m_rand(seed),
+      m_minLatencyUs(0),
+      m_maxLatencyUs(0),
+      m_lossRate(0),
+      m_rpcCount(0),
+      m_droppedCount(0),
+      m_bytesSent(0),
+      m_replicatedBytes(0) {}
+
+void SimNetwork::AddNode(int id, Raft *raft) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  m_nodes[id] = raft;
+}
+
+std::shared_ptr<RaftRpcUtil> SimNetwork::NewPeer(int from, int to) {
+  return std::make_shared<SimRaftRpcUtil>(this, from, to);
+}
+
+void SimNetwork::SetLatency(int minUs, int maxUs) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  m_minLatencyUs = minUs;
+  m_maxLatencyUs = std::max(minUs, maxUs);
+}
+
+void SimNetwork::SetLossRate(double rate) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  m_lossRate = rate;
+}
+
+void SimNetwork::SetLink(int from, int to, bool up) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  if (up) {
+    m_downLinks.erase({from, to});
+  } else {
+    m_downLinks.insert({from, to});
+  }
+}
+
+void SimNetwork::Isolate(int node, bool isolated) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  if (isolated) {
+    m_isolated.insert(node);
+  } else {
+    m_isolated.erase(node);
+  }
+}
+
+Raft *SimNetwork::GetRaft(int id) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  auto it = m_nodes.find(id);
+  return it == m_nodes.end() ? nullptr : it->second;
+}
+
+bool SimNetwork::deliver(int from, int to, int *delayUs) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  // 链路不通时调用方同样要等完单程延迟才失败，所以先取延迟再判断链路
+  *delayUs = m_maxLatencyUs > m_minLatencyUs
+                 ? std::uniform_int_distribution<int>(m_minLatencyUs, m_maxLatencyUs)(m_rand)
+                 : m_minLatencyUs;
+  bool lost = m_lossRate > 0 && std::uniform_real_distribution<double>(0, 1)(m_rand) < m_lossRate;
+  if (m_isolated.count(from) != 0 || m_isolated.count(to) != 0 || m_downLinks.count({from, to}) != 0) {
+    return false;
+  }
+  return !lost;
+}
+
+bool SimNetwork::transfer(int from, int to, const google::protobuf::Message &request,
+                          const google::protobuf::Message &response, const std::function<void()> &handler,
+                          bool replication) {
+  m_rpcCount++;
+  int delayUs = 0;
+  bool ok = deliver(from, to, &delayUs);
+  // 调用方可能运行在开启了hook的协程里，这时sleep只会让出协程
+  if (delayUs > 0) {
+    std::this_thread::sleep_for(std::chrono::microseconds(delayUs));
+  }
+  if (!ok) {
+    m_droppedCount++;
+    return false;
+  }
+  int64_t requestBytes = request.ByteSizeLong();
+  m_bytesSent += requestBytes;
+  if (replication) {
+    m_replicatedBytes += requestBytes;
+  }
+  handler();
+
+  ok = deliver(to, from, &delayUs);
+  if (delayUs > 0) {
+    std::this_thread::sleep_for(std::chrono::microseconds(delayUs));
+  }
+  if (!ok) {
+    m_droppedCount++;
+    return false;
+  }
+  m_bytesSent += response.ByteSizeLong();
+  return true;
+}
+
+bool SimRaftRpcUtil::AppendEntries(raftRpcProctoc::AppendEntriesArgs *args,
+                                   raftRpcProctoc::AppendEntriesReply *response) {
+  Raft *target = m_network->GetRaft(m_to);
+  return target != nullptr &&
+         m_network->Call(
+             m_from, m_to, *args, response, [target](auto *a, auto *r) { target->AppendEntries1(a, r); }, true);
+}
+
+bool SimRaftRpcUtil::InstallSnapshot(raftRpcProctoc::InstallSnapshotRequest *args,
+                                     raftRpcProctoc::InstallSnapshotResponse *response) {
+  Raft *target = m_network->GetRaft(m_to);
+  return target != nullptr &&
+         m_network->Call(
+             m_from, m_to, *args, response, [target](auto *a, auto *r) { target->InstallSnapshot(a, r); }, true);
+}
+
+bool SimRaftRpcUtil::RequestVote(raftRpcProctoc::RequestVoteArgs *args, raftRpcProctoc::RequestVoteReply *response) {
+  Raft *target = m_network->GetRaft(m_to);
+  return target != nullptr &&
+         m_network->Call(m_from, m_to, *args, response, [target](auto *a, auto *r) { target->RequestVote(a, r); });
+}
+
+bool SimRaftRpcUtil::RequestPreVote(raftRpcProctoc::RequestVoteArgs *args,
+                                    raftRpcProctoc::RequestVoteReply *response) {
+  Raft *target = m_network->GetRaft(m_to);
+  return target != nullptr &&
+         m_network->Call(m_from, m_to, *args, response,
+                         [target](auto *a, auto *r) { target->RequestPreVote(a, r); });
+}
+
+bool SimRaftRpcUtil::TimeoutNow(raftRpcProctoc::TimeoutNowArgs *args, raftRpcProctoc::TimeoutNowReply *response) {
+  Raft *target = m_network->GetRaft(m_to);
+  return target != nullptr &&
+         m_network->Call(m_from, m_to, *args, response, [target](auto *a, auto *r) { target->TimeoutNow(a, r); });
+}
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3014000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3014000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,13 +23,13 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/service.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
@@ -43,46 +43,97 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_kvServerRPC_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[4]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_kvServerRPC_2eproto;
 namespace raftKVRpcProctoc {
+class ChangeMembershipArgs;
+struct ChangeMembershipArgsDefaultTypeInternal;
+extern ChangeMembershipArgsDefaultTypeInternal _ChangeMembershipArgs_default_instance_;
+class ChangeMembershipReply;
+struct ChangeMembershipReplyDefaultTypeInternal;
+extern ChangeMembershipReplyDefaultTypeInternal _ChangeMembershipReply_default_instance_;
 class GetArgs;
-class GetArgsDefaultTypeInternal;
+struct GetArgsDefaultTypeInternal;
 extern GetArgsDefaultTypeInternal _GetArgs_default_instance_;
 class GetReply;
-class GetReplyDefaultTypeInternal;
+struct GetReplyDefaultTypeInternal;
 extern GetReplyDefaultTypeInternal _GetReply_default_instance_;
+class KeepAliveArgs;
+struct KeepAliveArgsDefaultTypeInternal;
+extern KeepAliveArgsDefaultTypeInternal _KeepAliveArgs_default_instance_;
+class KeepAliveReply;
+struct KeepAliveReplyDefaultTypeInternal;
+extern KeepAliveReplyDefaultTypeInternal _KeepAliveReply_default_instance_;
 class PutAppendArgs;
-class PutAppendArgsDefaultTypeInternal;
+struct PutAppendArgsDefaultTypeInternal;
 extern PutAppendArgsDefaultTypeInternal _PutAppendArgs_default_instance_;
 class PutAppendReply;
-class PutAppendReplyDefaultTypeInternal;
+struct PutAppendReplyDefaultTypeInternal;
 extern PutAppendReplyDefaultTypeInternal _PutAppendReply_default_instance_;
+class RegisterSessionArgs;
+struct RegisterSessionArgsDefaultTypeInternal;
+extern RegisterSessionArgsDefaultTypeInternal _RegisterSessionArgs_default_instance_;
+class RegisterSessionReply;
+struct RegisterSessionReplyDefaultTypeInternal;
+extern RegisterSessionReplyDefaultTypeInternal _RegisterSessionReply_default_instance_;
+class TransferLeadershipArgs;
+struct TransferLeadershipArgsDefaultTypeInternal;
+extern TransferLeadershipArgsDefaultTypeInternal _TransferLeadershipArgs_default_instance_;
+class TransferLeadershipReply;
+struct TransferLeadershipReplyDefaultTypeInternal;
+extern TransferLeadershipReplyDefaultTypeInternal _TransferLeadershipReply_default_instance_;
 }  // namespace raftKVRpcProctoc
 PROTOBUF_NAMESPACE_OPEN
+template<> ::raftKVRpcProctoc::ChangeMembershipArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::ChangeMembershipArgs>(Arena*);
+template<> ::raftKVRpcProctoc::ChangeMembershipReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::ChangeMembershipReply>(Arena*);
 template<> ::raftKVRpcProctoc::GetArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::GetArgs>(Arena*);
 template<> ::raftKVRpcProctoc::GetReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::GetReply>(Arena*);
+template<> ::raftKVRpcProctoc::KeepAliveArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::KeepAliveArgs>(Arena*);
+template<> ::raftKVRpcProctoc::KeepAliveReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::KeepAliveReply>(Arena*);
 template<> ::raftKVRpcProctoc::PutAppendArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::PutAppendArgs>(Arena*);
 template<> ::raftKVRpcProctoc::PutAppendReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::PutAppendReply>(Arena*);
+template<> ::raftKVRpcProctoc::RegisterSessionArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::RegisterSessionArgs>(Arena*);
+template<> ::raftKVRpcProctoc::RegisterSessionReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::RegisterSessionReply>(Arena*);
+template<> ::raftKVRpcProctoc::TransferLeadershipArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::TransferLeadershipArgs>(Arena*);
+template<> ::raftKVRpcProctoc::TransferLeadershipReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::TransferLeadershipReply>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace raftKVRpcProctoc {
 
+enum ConfChangeType : int {
+  AddVoter = 0,
+  AddLearner = 1,
+  RemoveNode = 2,
+  ConfChangeType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ConfChangeType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool ConfChangeType_IsValid(int value);
+constexpr ConfChangeType ConfChangeType_MIN = AddVoter;
+constexpr ConfChangeType ConfChangeType_MAX = RemoveNode;
+constexpr int ConfChangeType_ARRAYSIZE = ConfChangeType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ConfChangeType_descriptor();
+template<typename T>
+inline const std::string& ConfChangeType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ConfChangeType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ConfChangeType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ConfChangeType_descriptor(), enum_t_value);
+}
+inline bool ConfChangeType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ConfChangeType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ConfChangeType>(
+    ConfChangeType_descriptor(), name, value);
+}
 // ===================================================================
 
-class GetArgs PROTOBUF_FINAL :
+class GetArgs final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.GetArgs) */ {
  public:
   inline GetArgs() : GetArgs(nullptr) {}
-  virtual ~GetArgs();
+  ~GetArgs() override;
+  explicit PROTOBUF_CONSTEXPR GetArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetArgs(const GetArgs& from);
   GetArgs(GetArgs&& from) noexcept
@@ -95,8 +146,13 @@ class GetArgs PROTOBUF_FINAL :
     return *this;
   }
   inline GetArgs& operator=(GetArgs&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -107,13 +163,14 @@ class GetArgs PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetArgs& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetArgs& default_instance();
-
   static inline const GetArgs* internal_default_instance() {
     return reinterpret_cast<const GetArgs*>(
                &_GetArgs_default_instance_);
@@ -126,7 +183,12 @@ class GetArgs PROTOBUF_FINAL :
   }
   inline void Swap(GetArgs* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -134,56 +196,53 @@ class GetArgs PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetArgs* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetArgs* New() const final {
-    return CreateMaybeMessage<GetArgs>(nullptr);
-  }
-
-  GetArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetArgs>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetArgs& from);
-  void MergeFrom(const GetArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetArgs& from) {
+    GetArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetArgs* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftKVRpcProctoc.GetArgs";
   }
   protected:
-  explicit GetArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kvServerRPC_2eproto);
-    return ::descriptor_table_kvServerRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -193,46 +252,52 @@ class GetArgs PROTOBUF_FINAL :
     kKeyFieldNumber = 1,
     kClientIdFieldNumber = 2,
     kRequestIdFieldNumber = 3,
+    kMaxStaleMsFieldNumber = 4,
   };
   // bytes Key = 1;
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
   // bytes ClientId = 2;
   void clear_clientid();
   const std::string& clientid() const;
-  void set_clientid(const std::string& value);
-  void set_clientid(std::string&& value);
-  void set_clientid(const char* value);
-  void set_clientid(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientid(ArgT0&& arg0, ArgT... args);
   std::string* mutable_clientid();
-  std::string* release_clientid();
+  PROTOBUF_NODISCARD std::string* release_clientid();
   void set_allocated_clientid(std::string* clientid);
   private:
   const std::string& _internal_clientid() const;
-  void _internal_set_clientid(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientid(const std::string& value);
   std::string* _internal_mutable_clientid();
   public:
 
   // int32 RequestId = 3;
   void clear_requestid();
-  ::PROTOBUF_NAMESPACE_ID::int32 requestid() const;
-  void set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // int32 MaxStaleMs = 4;
+  void clear_maxstalems();
+  int32_t maxstalems() const;
+  void set_maxstalems(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_requestid() const;
-  void _internal_set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_maxstalems() const;
+  void _internal_set_maxstalems(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.GetArgs)
@@ -242,19 +307,24 @@ class GetArgs PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 requestid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
+    int32_t requestid_;
+    int32_t maxstalems_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kvServerRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetReply PROTOBUF_FINAL :
+class GetReply final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.GetReply) */ {
  public:
   inline GetReply() : GetReply(nullptr) {}
-  virtual ~GetReply();
+  ~GetReply() override;
+  explicit PROTOBUF_CONSTEXPR GetReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetReply(const GetReply& from);
   GetReply(GetReply&& from) noexcept
@@ -267,8 +337,13 @@ class GetReply PROTOBUF_FINAL :
     return *this;
   }
   inline GetReply& operator=(GetReply&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -279,13 +354,14 @@ class GetReply PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetReply& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetReply& default_instance();
-
   static inline const GetReply* internal_default_instance() {
     return reinterpret_cast<const GetReply*>(
                &_GetReply_default_instance_);
@@ -298,7 +374,12 @@ class GetReply PROTOBUF_FINAL :
   }
   inline void Swap(GetReply* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -306,56 +387,53 @@ class GetReply PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetReply* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetReply* New() const final {
-    return CreateMaybeMessage<GetReply>(nullptr);
-  }
-
-  GetReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetReply>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetReply& from);
-  void MergeFrom(const GetReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetReply& from) {
+    GetReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetReply* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftKVRpcProctoc.GetReply";
   }
   protected:
-  explicit GetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kvServerRPC_2eproto);
-    return ::descriptor_table_kvServerRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -368,32 +446,28 @@ class GetReply PROTOBUF_FINAL :
   // bytes Err = 1;
   void clear_err();
   const std::string& err() const;
-  void set_err(const std::string& value);
-  void set_err(std::string&& value);
-  void set_err(const char* value);
-  void set_err(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
   std::string* mutable_err();
-  std::string* release_err();
+  PROTOBUF_NODISCARD std::string* release_err();
   void set_allocated_err(std::string* err);
   private:
   const std::string& _internal_err() const;
-  void _internal_set_err(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
   std::string* _internal_mutable_err();
   public:
 
   // bytes Value = 2;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
@@ -404,18 +478,22 @@ class GetReply PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kvServerRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PutAppendArgs PROTOBUF_FINAL :
+class PutAppendArgs final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.PutAppendArgs) */ {
  public:
   inline PutAppendArgs() : PutAppendArgs(nullptr) {}
-  virtual ~PutAppendArgs();
+  ~PutAppendArgs() override;
+  explicit PROTOBUF_CONSTEXPR PutAppendArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PutAppendArgs(const PutAppendArgs& from);
   PutAppendArgs(PutAppendArgs&& from) noexcept
@@ -428,8 +506,13 @@ class PutAppendArgs PROTOBUF_FINAL :
     return *this;
   }
   inline PutAppendArgs& operator=(PutAppendArgs&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -440,13 +523,14 @@ class PutAppendArgs PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutAppendArgs& default_instance() {
+    return *internal_default_instance();
   }
-  static const PutAppendArgs& default_instance();
-
   static inline const PutAppendArgs* internal_default_instance() {
     return reinterpret_cast<const PutAppendArgs*>(
                &_PutAppendArgs_default_instance_);
@@ -459,7 +543,12 @@ class PutAppendArgs PROTOBUF_FINAL :
   }
   inline void Swap(PutAppendArgs* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -467,56 +556,53 @@ class PutAppendArgs PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(PutAppendArgs* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PutAppendArgs* New() const final {
-    return CreateMaybeMessage<PutAppendArgs>(nullptr);
-  }
-
-  PutAppendArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PutAppendArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PutAppendArgs>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PutAppendArgs& from);
-  void MergeFrom(const PutAppendArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutAppendArgs& from) {
+    PutAppendArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PutAppendArgs* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftKVRpcProctoc.PutAppendArgs";
   }
   protected:
-  explicit PutAppendArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit PutAppendArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kvServerRPC_2eproto);
-    return ::descriptor_table_kvServerRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -527,79 +613,81 @@ class PutAppendArgs PROTOBUF_FINAL :
     kValueFieldNumber = 2,
     kOpFieldNumber = 3,
     kClientIdFieldNumber = 4,
+    kSessionEpochFieldNumber = 6,
     kRequestIdFieldNumber = 5,
   };
   // bytes Key = 1;
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
   // bytes Value = 2;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
   // bytes Op = 3;
   void clear_op();
   const std::string& op() const;
-  void set_op(const std::string& value);
-  void set_op(std::string&& value);
-  void set_op(const char* value);
-  void set_op(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_op(ArgT0&& arg0, ArgT... args);
   std::string* mutable_op();
-  std::string* release_op();
+  PROTOBUF_NODISCARD std::string* release_op();
   void set_allocated_op(std::string* op);
   private:
   const std::string& _internal_op() const;
-  void _internal_set_op(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_op(const std::string& value);
   std::string* _internal_mutable_op();
   public:
 
   // bytes ClientId = 4;
   void clear_clientid();
   const std::string& clientid() const;
-  void set_clientid(const std::string& value);
-  void set_clientid(std::string&& value);
-  void set_clientid(const char* value);
-  void set_clientid(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientid(ArgT0&& arg0, ArgT... args);
   std::string* mutable_clientid();
-  std::string* release_clientid();
+  PROTOBUF_NODISCARD std::string* release_clientid();
   void set_allocated_clientid(std::string* clientid);
   private:
   const std::string& _internal_clientid() const;
-  void _internal_set_clientid(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientid(const std::string& value);
   std::string* _internal_mutable_clientid();
   public:
 
+  // int64 SessionEpoch = 6;
+  void clear_sessionepoch();
+  int64_t sessionepoch() const;
+  void set_sessionepoch(int64_t value);
+  private:
+  int64_t _internal_sessionepoch() const;
+  void _internal_set_sessionepoch(int64_t value);
+  public:
+
   // int32 RequestId = 5;
   void clear_requestid();
-  ::PROTOBUF_NAMESPACE_ID::int32 requestid() const;
-  void set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_requestid() const;
-  void _internal_set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.PutAppendArgs)
@@ -609,21 +697,26 @@ class PutAppendArgs PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 requestid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
+    int64_t sessionepoch_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kvServerRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PutAppendReply PROTOBUF_FINAL :
+class PutAppendReply final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.PutAppendReply) */ {
  public:
   inline PutAppendReply() : PutAppendReply(nullptr) {}
-  virtual ~PutAppendReply();
+  ~PutAppendReply() override;
+  explicit PROTOBUF_CONSTEXPR PutAppendReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PutAppendReply(const PutAppendReply& from);
   PutAppendReply(PutAppendReply&& from) noexcept
@@ -636,8 +729,13 @@ class PutAppendReply PROTOBUF_FINAL :
     return *this;
   }
   inline PutAppendReply& operator=(PutAppendReply&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -648,13 +746,14 @@ class PutAppendReply PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutAppendReply& default_instance() {
+    return *internal_default_instance();
   }
-  static const PutAppendReply& default_instance();
-
   static inline const PutAppendReply* internal_default_instance() {
     return reinterpret_cast<const PutAppendReply*>(
                &_PutAppendReply_default_instance_);
@@ -667,7 +766,12 @@ class PutAppendReply PROTOBUF_FINAL :
   }
   inline void Swap(PutAppendReply* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -675,56 +779,53 @@ class PutAppendReply PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(PutAppendReply* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PutAppendReply* New() const final {
-    return CreateMaybeMessage<PutAppendReply>(nullptr);
-  }
-
-  PutAppendReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PutAppendReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PutAppendReply>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PutAppendReply& from);
-  void MergeFrom(const PutAppendReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutAppendReply& from) {
+    PutAppendReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PutAppendReply* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftKVRpcProctoc.PutAppendReply";
   }
   protected:
-  explicit PutAppendReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit PutAppendReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kvServerRPC_2eproto);
-    return ::descriptor_table_kvServerRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -736,16 +837,14 @@ class PutAppendReply PROTOBUF_FINAL :
   // bytes Err = 1;
   void clear_err();
   const std::string& err() const;
-  void set_err(const std::string& value);
-  void set_err(std::string&& value);
-  void set_err(const char* value);
-  void set_err(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
   std::string* mutable_err();
-  std::string* release_err();
+  PROTOBUF_NODISCARD std::string* release_err();
   void set_allocated_err(std::string* err);
   private:
   const std::string& _internal_err() const;
-  void _internal_set_err(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
   std::string* _internal_mutable_err();
   public:
 
@@ -756,137 +855,1420 @@ class PutAppendReply PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kvServerRPC_2eproto;
 };
-// ===================================================================
-
-class kvServerRpc_Stub;
+// -------------------------------------------------------------------
 
-class kvServerRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
- protected:
-  // This class should be treated as an abstract interface.
-  inline kvServerRpc() {};
+class RegisterSessionArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.RegisterSessionArgs) */ {
  public:
-  virtual ~kvServerRpc();
+  inline RegisterSessionArgs() : RegisterSessionArgs(nullptr) {}
+  ~RegisterSessionArgs() override;
+  explicit PROTOBUF_CONSTEXPR RegisterSessionArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  typedef kvServerRpc_Stub Stub;
+  RegisterSessionArgs(const RegisterSessionArgs& from);
+  RegisterSessionArgs(RegisterSessionArgs&& from) noexcept
+    : RegisterSessionArgs() {
+    *this = ::std::move(from);
+  }
 
-  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
+  inline RegisterSessionArgs& operator=(const RegisterSessionArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RegisterSessionArgs& operator=(RegisterSessionArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  virtual void PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftKVRpcProctoc::PutAppendArgs* request,
-                       ::raftKVRpcProctoc::PutAppendReply* response,
-                       ::google::protobuf::Closure* done);
-  virtual void Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftKVRpcProctoc::GetArgs* request,
-                       ::raftKVRpcProctoc::GetReply* response,
-                       ::google::protobuf::Closure* done);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterSessionArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RegisterSessionArgs* internal_default_instance() {
+    return reinterpret_cast<const RegisterSessionArgs*>(
+               &_RegisterSessionArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  // implements Service ----------------------------------------------
+  friend void swap(RegisterSessionArgs& a, RegisterSessionArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RegisterSessionArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegisterSessionArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
-  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
-                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
-                  ::PROTOBUF_NAMESPACE_ID::Message* response,
-                  ::google::protobuf::Closure* done);
-  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
-  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  // implements Message ----------------------------------------------
+
+  RegisterSessionArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RegisterSessionArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RegisterSessionArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RegisterSessionArgs& from) {
+    RegisterSessionArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RegisterSessionArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.RegisterSessionArgs";
+  }
+  protected:
+  explicit RegisterSessionArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClientIdFieldNumber = 1,
+  };
+  // bytes ClientId = 1;
+  void clear_clientid();
+  const std::string& clientid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_clientid();
+  PROTOBUF_NODISCARD std::string* release_clientid();
+  void set_allocated_clientid(std::string* clientid);
+  private:
+  const std::string& _internal_clientid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientid(const std::string& value);
+  std::string* _internal_mutable_clientid();
+  public:
 
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.RegisterSessionArgs)
  private:
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(kvServerRpc);
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
 };
+// -------------------------------------------------------------------
 
-class kvServerRpc_Stub : public kvServerRpc {
+class RegisterSessionReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.RegisterSessionReply) */ {
  public:
-  kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
-  kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
-                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
-  ~kvServerRpc_Stub();
+  inline RegisterSessionReply() : RegisterSessionReply(nullptr) {}
+  ~RegisterSessionReply() override;
+  explicit PROTOBUF_CONSTEXPR RegisterSessionReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+  RegisterSessionReply(const RegisterSessionReply& from);
+  RegisterSessionReply(RegisterSessionReply&& from) noexcept
+    : RegisterSessionReply() {
+    *this = ::std::move(from);
+  }
 
-  // implements kvServerRpc ------------------------------------------
+  inline RegisterSessionReply& operator=(const RegisterSessionReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RegisterSessionReply& operator=(RegisterSessionReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  void PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftKVRpcProctoc::PutAppendArgs* request,
-                       ::raftKVRpcProctoc::PutAppendReply* response,
-                       ::google::protobuf::Closure* done);
-  void Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftKVRpcProctoc::GetArgs* request,
-                       ::raftKVRpcProctoc::GetReply* response,
-                       ::google::protobuf::Closure* done);
- private:
-  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
-  bool owns_channel_;
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(kvServerRpc_Stub);
-};
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterSessionReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RegisterSessionReply* internal_default_instance() {
+    return reinterpret_cast<const RegisterSessionReply*>(
+               &_RegisterSessionReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
 
+  friend void swap(RegisterSessionReply& a, RegisterSessionReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RegisterSessionReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegisterSessionReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-// ===================================================================
+  // implements Message ----------------------------------------------
 
+  RegisterSessionReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RegisterSessionReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RegisterSessionReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RegisterSessionReply& from) {
+    RegisterSessionReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// ===================================================================
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// GetArgs
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RegisterSessionReply* other);
 
-// bytes Key = 1;
-inline void GetArgs::clear_key() {
-  key_.ClearToEmpty();
-}
-inline const std::string& GetArgs::key() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.Key)
-  return _internal_key();
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.RegisterSessionReply";
+  }
+  protected:
+  explicit RegisterSessionReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+    kEpochFieldNumber = 2,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // int64 Epoch = 2;
+  void clear_epoch();
+  int64_t epoch() const;
+  void set_epoch(int64_t value);
+  private:
+  int64_t _internal_epoch() const;
+  void _internal_set_epoch(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.RegisterSessionReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    int64_t epoch_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class KeepAliveArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.KeepAliveArgs) */ {
+ public:
+  inline KeepAliveArgs() : KeepAliveArgs(nullptr) {}
+  ~KeepAliveArgs() override;
+  explicit PROTOBUF_CONSTEXPR KeepAliveArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  KeepAliveArgs(const KeepAliveArgs& from);
+  KeepAliveArgs(KeepAliveArgs&& from) noexcept
+    : KeepAliveArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline KeepAliveArgs& operator=(const KeepAliveArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline KeepAliveArgs& operator=(KeepAliveArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeepAliveArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeepAliveArgs* internal_default_instance() {
+    return reinterpret_cast<const KeepAliveArgs*>(
+               &_KeepAliveArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(KeepAliveArgs& a, KeepAliveArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeepAliveArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeepAliveArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  KeepAliveArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeepAliveArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeepAliveArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeepAliveArgs& from) {
+    KeepAliveArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeepAliveArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.KeepAliveArgs";
+  }
+  protected:
+  explicit KeepAliveArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClientIdFieldNumber = 1,
+  };
+  // bytes ClientId = 1;
+  void clear_clientid();
+  const std::string& clientid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_clientid();
+  PROTOBUF_NODISCARD std::string* release_clientid();
+  void set_allocated_clientid(std::string* clientid);
+  private:
+  const std::string& _internal_clientid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientid(const std::string& value);
+  std::string* _internal_mutable_clientid();
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.KeepAliveArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class KeepAliveReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.KeepAliveReply) */ {
+ public:
+  inline KeepAliveReply() : KeepAliveReply(nullptr) {}
+  ~KeepAliveReply() override;
+  explicit PROTOBUF_CONSTEXPR KeepAliveReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  KeepAliveReply(const KeepAliveReply& from);
+  KeepAliveReply(KeepAliveReply&& from) noexcept
+    : KeepAliveReply() {
+    *this = ::std::move(from);
+  }
+
+  inline KeepAliveReply& operator=(const KeepAliveReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline KeepAliveReply& operator=(KeepAliveReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeepAliveReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeepAliveReply* internal_default_instance() {
+    return reinterpret_cast<const KeepAliveReply*>(
+               &_KeepAliveReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(KeepAliveReply& a, KeepAliveReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeepAliveReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeepAliveReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  KeepAliveReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeepAliveReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeepAliveReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeepAliveReply& from) {
+    KeepAliveReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeepAliveReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.KeepAliveReply";
+  }
+  protected:
+  explicit KeepAliveReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.KeepAliveReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TransferLeadershipArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.TransferLeadershipArgs) */ {
+ public:
+  inline TransferLeadershipArgs() : TransferLeadershipArgs(nullptr) {}
+  ~TransferLeadershipArgs() override;
+  explicit PROTOBUF_CONSTEXPR TransferLeadershipArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TransferLeadershipArgs(const TransferLeadershipArgs& from);
+  TransferLeadershipArgs(TransferLeadershipArgs&& from) noexcept
+    : TransferLeadershipArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline TransferLeadershipArgs& operator=(const TransferLeadershipArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TransferLeadershipArgs& operator=(TransferLeadershipArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransferLeadershipArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TransferLeadershipArgs* internal_default_instance() {
+    return reinterpret_cast<const TransferLeadershipArgs*>(
+               &_TransferLeadershipArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(TransferLeadershipArgs& a, TransferLeadershipArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TransferLeadershipArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransferLeadershipArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TransferLeadershipArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TransferLeadershipArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TransferLeadershipArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransferLeadershipArgs& from) {
+    TransferLeadershipArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TransferLeadershipArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.TransferLeadershipArgs";
+  }
+  protected:
+  explicit TransferLeadershipArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTargetFieldNumber = 1,
+  };
+  // int32 Target = 1;
+  void clear_target();
+  int32_t target() const;
+  void set_target(int32_t value);
+  private:
+  int32_t _internal_target() const;
+  void _internal_set_target(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.TransferLeadershipArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t target_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TransferLeadershipReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.TransferLeadershipReply) */ {
+ public:
+  inline TransferLeadershipReply() : TransferLeadershipReply(nullptr) {}
+  ~TransferLeadershipReply() override;
+  explicit PROTOBUF_CONSTEXPR TransferLeadershipReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TransferLeadershipReply(const TransferLeadershipReply& from);
+  TransferLeadershipReply(TransferLeadershipReply&& from) noexcept
+    : TransferLeadershipReply() {
+    *this = ::std::move(from);
+  }
+
+  inline TransferLeadershipReply& operator=(const TransferLeadershipReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TransferLeadershipReply& operator=(TransferLeadershipReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransferLeadershipReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TransferLeadershipReply* internal_default_instance() {
+    return reinterpret_cast<const TransferLeadershipReply*>(
+               &_TransferLeadershipReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(TransferLeadershipReply& a, TransferLeadershipReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TransferLeadershipReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransferLeadershipReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TransferLeadershipReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TransferLeadershipReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TransferLeadershipReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransferLeadershipReply& from) {
+    TransferLeadershipReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TransferLeadershipReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.TransferLeadershipReply";
+  }
+  protected:
+  explicit TransferLeadershipReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.TransferLeadershipReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChangeMembershipArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.ChangeMembershipArgs) */ {
+ public:
+  inline ChangeMembershipArgs() : ChangeMembershipArgs(nullptr) {}
+  ~ChangeMembershipArgs() override;
+  explicit PROTOBUF_CONSTEXPR ChangeMembershipArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChangeMembershipArgs(const ChangeMembershipArgs& from);
+  ChangeMembershipArgs(ChangeMembershipArgs&& from) noexcept
+    : ChangeMembershipArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline ChangeMembershipArgs& operator=(const ChangeMembershipArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChangeMembershipArgs& operator=(ChangeMembershipArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChangeMembershipArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChangeMembershipArgs* internal_default_instance() {
+    return reinterpret_cast<const ChangeMembershipArgs*>(
+               &_ChangeMembershipArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(ChangeMembershipArgs& a, ChangeMembershipArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChangeMembershipArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChangeMembershipArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChangeMembershipArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChangeMembershipArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChangeMembershipArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChangeMembershipArgs& from) {
+    ChangeMembershipArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChangeMembershipArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.ChangeMembershipArgs";
+  }
+  protected:
+  explicit ChangeMembershipArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIpFieldNumber = 3,
+    kTypeFieldNumber = 1,
+    kNodeIdFieldNumber = 2,
+    kPortFieldNumber = 4,
+  };
+  // bytes Ip = 3;
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
+
+  // .raftKVRpcProctoc.ConfChangeType Type = 1;
+  void clear_type();
+  ::raftKVRpcProctoc::ConfChangeType type() const;
+  void set_type(::raftKVRpcProctoc::ConfChangeType value);
+  private:
+  ::raftKVRpcProctoc::ConfChangeType _internal_type() const;
+  void _internal_set_type(::raftKVRpcProctoc::ConfChangeType value);
+  public:
+
+  // int32 NodeId = 2;
+  void clear_nodeid();
+  int32_t nodeid() const;
+  void set_nodeid(int32_t value);
+  private:
+  int32_t _internal_nodeid() const;
+  void _internal_set_nodeid(int32_t value);
+  public:
+
+  // int32 Port = 4;
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
+  private:
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.ChangeMembershipArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    int type_;
+    int32_t nodeid_;
+    int32_t port_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChangeMembershipReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.ChangeMembershipReply) */ {
+ public:
+  inline ChangeMembershipReply() : ChangeMembershipReply(nullptr) {}
+  ~ChangeMembershipReply() override;
+  explicit PROTOBUF_CONSTEXPR ChangeMembershipReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChangeMembershipReply(const ChangeMembershipReply& from);
+  ChangeMembershipReply(ChangeMembershipReply&& from) noexcept
+    : ChangeMembershipReply() {
+    *this = ::std::move(from);
+  }
+
+  inline ChangeMembershipReply& operator=(const ChangeMembershipReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChangeMembershipReply& operator=(ChangeMembershipReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChangeMembershipReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChangeMembershipReply* internal_default_instance() {
+    return reinterpret_cast<const ChangeMembershipReply*>(
+               &_ChangeMembershipReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(ChangeMembershipReply& a, ChangeMembershipReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChangeMembershipReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChangeMembershipReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChangeMembershipReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChangeMembershipReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChangeMembershipReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChangeMembershipReply& from) {
+    ChangeMembershipReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChangeMembershipReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.ChangeMembershipReply";
+  }
+  protected:
+  explicit ChangeMembershipReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.ChangeMembershipReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// ===================================================================
+
+class kvServerRpc_Stub;
+
+class kvServerRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
+ protected:
+  // This class should be treated as an abstract interface.
+  inline kvServerRpc() {};
+ public:
+  virtual ~kvServerRpc();
+
+  typedef kvServerRpc_Stub Stub;
+
+  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
+
+  virtual void PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::PutAppendArgs* request,
+                       ::raftKVRpcProctoc::PutAppendReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::GetArgs* request,
+                       ::raftKVRpcProctoc::GetReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void RegisterSession(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::RegisterSessionArgs* request,
+                       ::raftKVRpcProctoc::RegisterSessionReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void KeepAlive(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::KeepAliveArgs* request,
+                       ::raftKVRpcProctoc::KeepAliveReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void TransferLeadership(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::TransferLeadershipArgs* request,
+                       ::raftKVRpcProctoc::TransferLeadershipReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void ChangeMembership(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::ChangeMembershipArgs* request,
+                       ::raftKVRpcProctoc::ChangeMembershipReply* response,
+                       ::google::protobuf::Closure* done);
+
+  // implements Service ----------------------------------------------
+
+  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
+  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                  ::PROTOBUF_NAMESPACE_ID::Message* response,
+                  ::google::protobuf::Closure* done);
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+
+ private:
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(kvServerRpc);
+};
+
+class kvServerRpc_Stub : public kvServerRpc {
+ public:
+  kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
+  kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
+  ~kvServerRpc_Stub();
+
+  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+
+  // implements kvServerRpc ------------------------------------------
+
+  void PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::PutAppendArgs* request,
+                       ::raftKVRpcProctoc::PutAppendReply* response,
+                       ::google::protobuf::Closure* done);
+  void Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::GetArgs* request,
+                       ::raftKVRpcProctoc::GetReply* response,
+                       ::google::protobuf::Closure* done);
+  void RegisterSession(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::RegisterSessionArgs* request,
+                       ::raftKVRpcProctoc::RegisterSessionReply* response,
+                       ::google::protobuf::Closure* done);
+  void KeepAlive(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::KeepAliveArgs* request,
+                       ::raftKVRpcProctoc::KeepAliveReply* response,
+                       ::google::protobuf::Closure* done);
+  void TransferLeadership(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::TransferLeadershipArgs* request,
+                       ::raftKVRpcProctoc::TransferLeadershipReply* response,
+                       ::google::protobuf::Closure* done);
+  void ChangeMembership(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::ChangeMembershipArgs* request,
+                       ::raftKVRpcProctoc::ChangeMembershipReply* response,
+                       ::google::protobuf::Closure* done);
+ private:
+  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
+  bool owns_channel_;
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(kvServerRpc_Stub);
+};
+
+
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// GetArgs
+
+// bytes Key = 1;
+inline void GetArgs::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& GetArgs::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.Key)
+  return _internal_key();
 }
-inline void GetArgs::set_key(const std::string& value) {
-  _internal_set_key(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetArgs::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.Key)
 }
 inline std::string* GetArgs::mutable_key() {
+  std::string* _s = _internal_mutable_key();
   // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetArgs.Key)
-  return _internal_mutable_key();
+  return _s;
 }
 inline const std::string& GetArgs::_internal_key() const {
-  return key_.Get();
+  return _impl_.key_.Get();
 }
 inline void GetArgs::_internal_set_key(const std::string& value) {
   
-  key_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void GetArgs::set_key(std::string&& value) {
-  
-  key_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.GetArgs.Key)
-}
-inline void GetArgs::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  key_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.GetArgs.Key)
-}
-inline void GetArgs::set_key(const void* value,
-    size_t size) {
-  
-  key_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.GetArgs.Key)
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GetArgs::_internal_mutable_key() {
   
-  return key_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GetArgs::release_key() {
   // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetArgs.Key)
-  return key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Release();
 }
 inline void GetArgs::set_allocated_key(std::string* key) {
   if (key != nullptr) {
@@ -894,60 +2276,49 @@ inline void GetArgs::set_allocated_key(std::string* key) {
   } else {
     
   }
-  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
-      GetArena());
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetArgs.Key)
 }
 
 // bytes ClientId = 2;
 inline void GetArgs::clear_clientid() {
-  clientid_.ClearToEmpty();
+  _impl_.clientid_.ClearToEmpty();
 }
 inline const std::string& GetArgs::clientid() const {
   // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.ClientId)
   return _internal_clientid();
 }
-inline void GetArgs::set_clientid(const std::string& value) {
-  _internal_set_clientid(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetArgs::set_clientid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clientid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.ClientId)
 }
 inline std::string* GetArgs::mutable_clientid() {
+  std::string* _s = _internal_mutable_clientid();
   // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetArgs.ClientId)
-  return _internal_mutable_clientid();
+  return _s;
 }
 inline const std::string& GetArgs::_internal_clientid() const {
-  return clientid_.Get();
+  return _impl_.clientid_.Get();
 }
 inline void GetArgs::_internal_set_clientid(const std::string& value) {
   
-  clientid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void GetArgs::set_clientid(std::string&& value) {
-  
-  clientid_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.GetArgs.ClientId)
-}
-inline void GetArgs::set_clientid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  clientid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.GetArgs.ClientId)
-}
-inline void GetArgs::set_clientid(const void* value,
-    size_t size) {
-  
-  clientid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.GetArgs.ClientId)
+  _impl_.clientid_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GetArgs::_internal_mutable_clientid() {
   
-  return clientid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.clientid_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GetArgs::release_clientid() {
   // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetArgs.ClientId)
-  return clientid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.clientid_.Release();
 }
 inline void GetArgs::set_allocated_clientid(std::string* clientid) {
   if (clientid != nullptr) {
@@ -955,84 +2326,93 @@ inline void GetArgs::set_allocated_clientid(std::string* clientid) {
   } else {
     
   }
-  clientid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), clientid,
-      GetArena());
+  _impl_.clientid_.SetAllocated(clientid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientid_.IsDefault()) {
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetArgs.ClientId)
 }
 
 // int32 RequestId = 3;
 inline void GetArgs::clear_requestid() {
-  requestid_ = 0;
+  _impl_.requestid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GetArgs::_internal_requestid() const {
-  return requestid_;
+inline int32_t GetArgs::_internal_requestid() const {
+  return _impl_.requestid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GetArgs::requestid() const {
+inline int32_t GetArgs::requestid() const {
   // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.RequestId)
   return _internal_requestid();
 }
-inline void GetArgs::_internal_set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GetArgs::_internal_set_requestid(int32_t value) {
   
-  requestid_ = value;
+  _impl_.requestid_ = value;
 }
-inline void GetArgs::set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GetArgs::set_requestid(int32_t value) {
   _internal_set_requestid(value);
   // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.RequestId)
 }
 
+// int32 MaxStaleMs = 4;
+inline void GetArgs::clear_maxstalems() {
+  _impl_.maxstalems_ = 0;
+}
+inline int32_t GetArgs::_internal_maxstalems() const {
+  return _impl_.maxstalems_;
+}
+inline int32_t GetArgs::maxstalems() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.MaxStaleMs)
+  return _internal_maxstalems();
+}
+inline void GetArgs::_internal_set_maxstalems(int32_t value) {
+  
+  _impl_.maxstalems_ = value;
+}
+inline void GetArgs::set_maxstalems(int32_t value) {
+  _internal_set_maxstalems(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.MaxStaleMs)
+}
+
 // -------------------------------------------------------------------
 
 // GetReply
 
 // bytes Err = 1;
 inline void GetReply::clear_err() {
-  err_.ClearToEmpty();
+  _impl_.err_.ClearToEmpty();
 }
 inline const std::string& GetReply::err() const {
   // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetReply.Err)
   return _internal_err();
 }
-inline void GetReply::set_err(const std::string& value) {
-  _internal_set_err(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetReply.Err)
 }
 inline std::string* GetReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
   // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetReply.Err)
-  return _internal_mutable_err();
+  return _s;
 }
 inline const std::string& GetReply::_internal_err() const {
-  return err_.Get();
+  return _impl_.err_.Get();
 }
 inline void GetReply::_internal_set_err(const std::string& value) {
   
-  err_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void GetReply::set_err(std::string&& value) {
-  
-  err_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.GetReply.Err)
-}
-inline void GetReply::set_err(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  err_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.GetReply.Err)
-}
-inline void GetReply::set_err(const void* value,
-    size_t size) {
-  
-  err_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.GetReply.Err)
+  _impl_.err_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GetReply::_internal_mutable_err() {
   
-  return err_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.err_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GetReply::release_err() {
   // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetReply.Err)
-  return err_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.err_.Release();
 }
 inline void GetReply::set_allocated_err(std::string* err) {
   if (err != nullptr) {
@@ -1040,60 +2420,49 @@ inline void GetReply::set_allocated_err(std::string* err) {
   } else {
     
   }
-  err_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), err,
-      GetArena());
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetReply.Err)
 }
 
 // bytes Value = 2;
 inline void GetReply::clear_value() {
-  value_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
 }
 inline const std::string& GetReply::value() const {
   // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetReply.Value)
   return _internal_value();
 }
-inline void GetReply::set_value(const std::string& value) {
-  _internal_set_value(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetReply::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetReply.Value)
 }
 inline std::string* GetReply::mutable_value() {
+  std::string* _s = _internal_mutable_value();
   // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetReply.Value)
-  return _internal_mutable_value();
+  return _s;
 }
 inline const std::string& GetReply::_internal_value() const {
-  return value_.Get();
+  return _impl_.value_.Get();
 }
 inline void GetReply::_internal_set_value(const std::string& value) {
   
-  value_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void GetReply::set_value(std::string&& value) {
-  
-  value_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.GetReply.Value)
-}
-inline void GetReply::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  value_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.GetReply.Value)
-}
-inline void GetReply::set_value(const void* value,
-    size_t size) {
-  
-  value_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.GetReply.Value)
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GetReply::_internal_mutable_value() {
   
-  return value_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GetReply::release_value() {
   // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetReply.Value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Release();
 }
 inline void GetReply::set_allocated_value(std::string* value) {
   if (value != nullptr) {
@@ -1101,8 +2470,12 @@ inline void GetReply::set_allocated_value(std::string* value) {
   } else {
     
   }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetReply.Value)
 }
 
@@ -1112,53 +2485,38 @@ inline void GetReply::set_allocated_value(std::string* value) {
 
 // bytes Key = 1;
 inline void PutAppendArgs::clear_key() {
-  key_.ClearToEmpty();
+  _impl_.key_.ClearToEmpty();
 }
 inline const std::string& PutAppendArgs::key() const {
   // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Key)
   return _internal_key();
 }
-inline void PutAppendArgs::set_key(const std::string& value) {
-  _internal_set_key(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendArgs::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Key)
 }
 inline std::string* PutAppendArgs::mutable_key() {
+  std::string* _s = _internal_mutable_key();
   // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Key)
-  return _internal_mutable_key();
+  return _s;
 }
 inline const std::string& PutAppendArgs::_internal_key() const {
-  return key_.Get();
+  return _impl_.key_.Get();
 }
 inline void PutAppendArgs::_internal_set_key(const std::string& value) {
   
-  key_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void PutAppendArgs::set_key(std::string&& value) {
-  
-  key_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendArgs.Key)
-}
-inline void PutAppendArgs::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  key_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendArgs.Key)
-}
-inline void PutAppendArgs::set_key(const void* value,
-    size_t size) {
-  
-  key_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendArgs.Key)
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
 inline std::string* PutAppendArgs::_internal_mutable_key() {
   
-  return key_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PutAppendArgs::release_key() {
   // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Key)
-  return key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Release();
 }
 inline void PutAppendArgs::set_allocated_key(std::string* key) {
   if (key != nullptr) {
@@ -1166,60 +2524,49 @@ inline void PutAppendArgs::set_allocated_key(std::string* key) {
   } else {
     
   }
-  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
-      GetArena());
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Key)
 }
 
 // bytes Value = 2;
 inline void PutAppendArgs::clear_value() {
-  value_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
 }
 inline const std::string& PutAppendArgs::value() const {
   // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Value)
   return _internal_value();
 }
-inline void PutAppendArgs::set_value(const std::string& value) {
-  _internal_set_value(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendArgs::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Value)
 }
 inline std::string* PutAppendArgs::mutable_value() {
+  std::string* _s = _internal_mutable_value();
   // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Value)
-  return _internal_mutable_value();
+  return _s;
 }
 inline const std::string& PutAppendArgs::_internal_value() const {
-  return value_.Get();
+  return _impl_.value_.Get();
 }
 inline void PutAppendArgs::_internal_set_value(const std::string& value) {
   
-  value_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void PutAppendArgs::set_value(std::string&& value) {
-  
-  value_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendArgs.Value)
-}
-inline void PutAppendArgs::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  value_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendArgs.Value)
-}
-inline void PutAppendArgs::set_value(const void* value,
-    size_t size) {
-  
-  value_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendArgs.Value)
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
 inline std::string* PutAppendArgs::_internal_mutable_value() {
   
-  return value_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PutAppendArgs::release_value() {
   // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Release();
 }
 inline void PutAppendArgs::set_allocated_value(std::string* value) {
   if (value != nullptr) {
@@ -1227,60 +2574,49 @@ inline void PutAppendArgs::set_allocated_value(std::string* value) {
   } else {
     
   }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Value)
 }
 
 // bytes Op = 3;
 inline void PutAppendArgs::clear_op() {
-  op_.ClearToEmpty();
+  _impl_.op_.ClearToEmpty();
 }
 inline const std::string& PutAppendArgs::op() const {
   // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Op)
   return _internal_op();
 }
-inline void PutAppendArgs::set_op(const std::string& value) {
-  _internal_set_op(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendArgs::set_op(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.op_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Op)
 }
 inline std::string* PutAppendArgs::mutable_op() {
+  std::string* _s = _internal_mutable_op();
   // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Op)
-  return _internal_mutable_op();
+  return _s;
 }
 inline const std::string& PutAppendArgs::_internal_op() const {
-  return op_.Get();
+  return _impl_.op_.Get();
 }
 inline void PutAppendArgs::_internal_set_op(const std::string& value) {
   
-  op_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void PutAppendArgs::set_op(std::string&& value) {
-  
-  op_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendArgs.Op)
-}
-inline void PutAppendArgs::set_op(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  op_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendArgs.Op)
-}
-inline void PutAppendArgs::set_op(const void* value,
-    size_t size) {
-  
-  op_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendArgs.Op)
+  _impl_.op_.Set(value, GetArenaForAllocation());
 }
 inline std::string* PutAppendArgs::_internal_mutable_op() {
   
-  return op_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.op_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PutAppendArgs::release_op() {
   // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Op)
-  return op_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.op_.Release();
 }
 inline void PutAppendArgs::set_allocated_op(std::string* op) {
   if (op != nullptr) {
@@ -1288,60 +2624,49 @@ inline void PutAppendArgs::set_allocated_op(std::string* op) {
   } else {
     
   }
-  op_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), op,
-      GetArena());
+  _impl_.op_.SetAllocated(op, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.op_.IsDefault()) {
+    _impl_.op_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Op)
 }
 
 // bytes ClientId = 4;
 inline void PutAppendArgs::clear_clientid() {
-  clientid_.ClearToEmpty();
+  _impl_.clientid_.ClearToEmpty();
 }
 inline const std::string& PutAppendArgs::clientid() const {
   // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.ClientId)
   return _internal_clientid();
 }
-inline void PutAppendArgs::set_clientid(const std::string& value) {
-  _internal_set_clientid(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendArgs::set_clientid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clientid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.ClientId)
 }
 inline std::string* PutAppendArgs::mutable_clientid() {
+  std::string* _s = _internal_mutable_clientid();
   // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.ClientId)
-  return _internal_mutable_clientid();
+  return _s;
 }
 inline const std::string& PutAppendArgs::_internal_clientid() const {
-  return clientid_.Get();
+  return _impl_.clientid_.Get();
 }
 inline void PutAppendArgs::_internal_set_clientid(const std::string& value) {
   
-  clientid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void PutAppendArgs::set_clientid(std::string&& value) {
-  
-  clientid_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendArgs.ClientId)
-}
-inline void PutAppendArgs::set_clientid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  clientid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendArgs.ClientId)
-}
-inline void PutAppendArgs::set_clientid(const void* value,
-    size_t size) {
-  
-  clientid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendArgs.ClientId)
+  _impl_.clientid_.Set(value, GetArenaForAllocation());
 }
 inline std::string* PutAppendArgs::_internal_mutable_clientid() {
   
-  return clientid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.clientid_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PutAppendArgs::release_clientid() {
   // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.ClientId)
-  return clientid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.clientid_.Release();
 }
 inline void PutAppendArgs::set_allocated_clientid(std::string* clientid) {
   if (clientid != nullptr) {
@@ -1349,94 +2674,589 @@ inline void PutAppendArgs::set_allocated_clientid(std::string* clientid) {
   } else {
     
   }
-  clientid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), clientid,
-      GetArena());
+  _impl_.clientid_.SetAllocated(clientid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientid_.IsDefault()) {
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.ClientId)
 }
 
 // int32 RequestId = 5;
 inline void PutAppendArgs::clear_requestid() {
-  requestid_ = 0;
+  _impl_.requestid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 PutAppendArgs::_internal_requestid() const {
-  return requestid_;
+inline int32_t PutAppendArgs::_internal_requestid() const {
+  return _impl_.requestid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 PutAppendArgs::requestid() const {
+inline int32_t PutAppendArgs::requestid() const {
   // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.RequestId)
   return _internal_requestid();
 }
-inline void PutAppendArgs::_internal_set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void PutAppendArgs::_internal_set_requestid(int32_t value) {
   
-  requestid_ = value;
+  _impl_.requestid_ = value;
 }
-inline void PutAppendArgs::set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void PutAppendArgs::set_requestid(int32_t value) {
   _internal_set_requestid(value);
   // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.RequestId)
 }
 
+// int64 SessionEpoch = 6;
+inline void PutAppendArgs::clear_sessionepoch() {
+  _impl_.sessionepoch_ = int64_t{0};
+}
+inline int64_t PutAppendArgs::_internal_sessionepoch() const {
+  return _impl_.sessionepoch_;
+}
+inline int64_t PutAppendArgs::sessionepoch() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.SessionEpoch)
+  return _internal_sessionepoch();
+}
+inline void PutAppendArgs::_internal_set_sessionepoch(int64_t value) {
+  
+  _impl_.sessionepoch_ = value;
+}
+inline void PutAppendArgs::set_sessionepoch(int64_t value) {
+  _internal_set_sessionepoch(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.SessionEpoch)
+}
+
 // -------------------------------------------------------------------
 
 // PutAppendReply
 
 // bytes Err = 1;
 inline void PutAppendReply::clear_err() {
-  err_.ClearToEmpty();
+  _impl_.err_.ClearToEmpty();
 }
 inline const std::string& PutAppendReply::err() const {
   // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendReply.Err)
   return _internal_err();
 }
-inline void PutAppendReply::set_err(const std::string& value) {
-  _internal_set_err(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendReply.Err)
 }
 inline std::string* PutAppendReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
   // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendReply.Err)
-  return _internal_mutable_err();
+  return _s;
 }
 inline const std::string& PutAppendReply::_internal_err() const {
-  return err_.Get();
+  return _impl_.err_.Get();
 }
 inline void PutAppendReply::_internal_set_err(const std::string& value) {
   
-  err_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+  _impl_.err_.Set(value, GetArenaForAllocation());
 }
-inline void PutAppendReply::set_err(std::string&& value) {
+inline std::string* PutAppendReply::_internal_mutable_err() {
   
-  err_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendReply.Err)
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutAppendReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendReply.Err)
+  return _impl_.err_.Release();
+}
+inline void PutAppendReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendReply.Err)
 }
-inline void PutAppendReply::set_err(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+
+// -------------------------------------------------------------------
+
+// RegisterSessionArgs
+
+// bytes ClientId = 1;
+inline void RegisterSessionArgs::clear_clientid() {
+  _impl_.clientid_.ClearToEmpty();
+}
+inline const std::string& RegisterSessionArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RegisterSessionArgs.ClientId)
+  return _internal_clientid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterSessionArgs::set_clientid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clientid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RegisterSessionArgs.ClientId)
+}
+inline std::string* RegisterSessionArgs::mutable_clientid() {
+  std::string* _s = _internal_mutable_clientid();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.RegisterSessionArgs.ClientId)
+  return _s;
+}
+inline const std::string& RegisterSessionArgs::_internal_clientid() const {
+  return _impl_.clientid_.Get();
+}
+inline void RegisterSessionArgs::_internal_set_clientid(const std::string& value) {
   
-  err_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendReply.Err)
+  _impl_.clientid_.Set(value, GetArenaForAllocation());
 }
-inline void PutAppendReply::set_err(const void* value,
-    size_t size) {
+inline std::string* RegisterSessionArgs::_internal_mutable_clientid() {
   
-  err_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendReply.Err)
+  return _impl_.clientid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* PutAppendReply::_internal_mutable_err() {
+inline std::string* RegisterSessionArgs::release_clientid() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.RegisterSessionArgs.ClientId)
+  return _impl_.clientid_.Release();
+}
+inline void RegisterSessionArgs::set_allocated_clientid(std::string* clientid) {
+  if (clientid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.clientid_.SetAllocated(clientid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientid_.IsDefault()) {
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.RegisterSessionArgs.ClientId)
+}
+
+// -------------------------------------------------------------------
+
+// RegisterSessionReply
+
+// bytes Err = 1;
+inline void RegisterSessionReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& RegisterSessionReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RegisterSessionReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterSessionReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RegisterSessionReply.Err)
+}
+inline std::string* RegisterSessionReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.RegisterSessionReply.Err)
+  return _s;
+}
+inline const std::string& RegisterSessionReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void RegisterSessionReply::_internal_set_err(const std::string& value) {
   
-  return err_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  _impl_.err_.Set(value, GetArenaForAllocation());
 }
-inline std::string* PutAppendReply::release_err() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendReply.Err)
-  return err_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* RegisterSessionReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
 }
-inline void PutAppendReply::set_allocated_err(std::string* err) {
+inline std::string* RegisterSessionReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.RegisterSessionReply.Err)
+  return _impl_.err_.Release();
+}
+inline void RegisterSessionReply::set_allocated_err(std::string* err) {
   if (err != nullptr) {
     
   } else {
     
   }
-  err_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), err,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendReply.Err)
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.RegisterSessionReply.Err)
+}
+
+// int64 Epoch = 2;
+inline void RegisterSessionReply::clear_epoch() {
+  _impl_.epoch_ = int64_t{0};
+}
+inline int64_t RegisterSessionReply::_internal_epoch() const {
+  return _impl_.epoch_;
+}
+inline int64_t RegisterSessionReply::epoch() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RegisterSessionReply.Epoch)
+  return _internal_epoch();
+}
+inline void RegisterSessionReply::_internal_set_epoch(int64_t value) {
+  
+  _impl_.epoch_ = value;
+}
+inline void RegisterSessionReply::set_epoch(int64_t value) {
+  _internal_set_epoch(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RegisterSessionReply.Epoch)
+}
+
+// -------------------------------------------------------------------
+
+// KeepAliveArgs
+
+// bytes ClientId = 1;
+inline void KeepAliveArgs::clear_clientid() {
+  _impl_.clientid_.ClearToEmpty();
+}
+inline const std::string& KeepAliveArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.KeepAliveArgs.ClientId)
+  return _internal_clientid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeepAliveArgs::set_clientid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clientid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.KeepAliveArgs.ClientId)
+}
+inline std::string* KeepAliveArgs::mutable_clientid() {
+  std::string* _s = _internal_mutable_clientid();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.KeepAliveArgs.ClientId)
+  return _s;
+}
+inline const std::string& KeepAliveArgs::_internal_clientid() const {
+  return _impl_.clientid_.Get();
+}
+inline void KeepAliveArgs::_internal_set_clientid(const std::string& value) {
+  
+  _impl_.clientid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeepAliveArgs::_internal_mutable_clientid() {
+  
+  return _impl_.clientid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeepAliveArgs::release_clientid() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.KeepAliveArgs.ClientId)
+  return _impl_.clientid_.Release();
+}
+inline void KeepAliveArgs::set_allocated_clientid(std::string* clientid) {
+  if (clientid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.clientid_.SetAllocated(clientid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientid_.IsDefault()) {
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.KeepAliveArgs.ClientId)
+}
+
+// -------------------------------------------------------------------
+
+// KeepAliveReply
+
+// bytes Err = 1;
+inline void KeepAliveReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& KeepAliveReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.KeepAliveReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeepAliveReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.KeepAliveReply.Err)
+}
+inline std::string* KeepAliveReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.KeepAliveReply.Err)
+  return _s;
+}
+inline const std::string& KeepAliveReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void KeepAliveReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeepAliveReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeepAliveReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.KeepAliveReply.Err)
+  return _impl_.err_.Release();
+}
+inline void KeepAliveReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.KeepAliveReply.Err)
+}
+
+// -------------------------------------------------------------------
+
+// TransferLeadershipArgs
+
+// int32 Target = 1;
+inline void TransferLeadershipArgs::clear_target() {
+  _impl_.target_ = 0;
+}
+inline int32_t TransferLeadershipArgs::_internal_target() const {
+  return _impl_.target_;
+}
+inline int32_t TransferLeadershipArgs::target() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TransferLeadershipArgs.Target)
+  return _internal_target();
+}
+inline void TransferLeadershipArgs::_internal_set_target(int32_t value) {
+  
+  _impl_.target_ = value;
+}
+inline void TransferLeadershipArgs::set_target(int32_t value) {
+  _internal_set_target(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TransferLeadershipArgs.Target)
+}
+
+// -------------------------------------------------------------------
+
+// TransferLeadershipReply
+
+// bytes Err = 1;
+inline void TransferLeadershipReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& TransferLeadershipReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TransferLeadershipReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransferLeadershipReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TransferLeadershipReply.Err)
+}
+inline std::string* TransferLeadershipReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TransferLeadershipReply.Err)
+  return _s;
+}
+inline const std::string& TransferLeadershipReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void TransferLeadershipReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TransferLeadershipReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TransferLeadershipReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.TransferLeadershipReply.Err)
+  return _impl_.err_.Release();
+}
+inline void TransferLeadershipReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.TransferLeadershipReply.Err)
+}
+
+// -------------------------------------------------------------------
+
+// ChangeMembershipArgs
+
+// .raftKVRpcProctoc.ConfChangeType Type = 1;
+inline void ChangeMembershipArgs::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::raftKVRpcProctoc::ConfChangeType ChangeMembershipArgs::_internal_type() const {
+  return static_cast< ::raftKVRpcProctoc::ConfChangeType >(_impl_.type_);
+}
+inline ::raftKVRpcProctoc::ConfChangeType ChangeMembershipArgs::type() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ChangeMembershipArgs.Type)
+  return _internal_type();
+}
+inline void ChangeMembershipArgs::_internal_set_type(::raftKVRpcProctoc::ConfChangeType value) {
+  
+  _impl_.type_ = value;
+}
+inline void ChangeMembershipArgs::set_type(::raftKVRpcProctoc::ConfChangeType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ChangeMembershipArgs.Type)
+}
+
+// int32 NodeId = 2;
+inline void ChangeMembershipArgs::clear_nodeid() {
+  _impl_.nodeid_ = 0;
+}
+inline int32_t ChangeMembershipArgs::_internal_nodeid() const {
+  return _impl_.nodeid_;
+}
+inline int32_t ChangeMembershipArgs::nodeid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ChangeMembershipArgs.NodeId)
+  return _internal_nodeid();
+}
+inline void ChangeMembershipArgs::_internal_set_nodeid(int32_t value) {
+  
+  _impl_.nodeid_ = value;
+}
+inline void ChangeMembershipArgs::set_nodeid(int32_t value) {
+  _internal_set_nodeid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ChangeMembershipArgs.NodeId)
+}
+
+// bytes Ip = 3;
+inline void ChangeMembershipArgs::clear_ip() {
+  _impl_.ip_.ClearToEmpty();
+}
+inline const std::string& ChangeMembershipArgs::ip() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ChangeMembershipArgs.Ip)
+  return _internal_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChangeMembershipArgs::set_ip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.ip_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ChangeMembershipArgs.Ip)
+}
+inline std::string* ChangeMembershipArgs::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ChangeMembershipArgs.Ip)
+  return _s;
+}
+inline const std::string& ChangeMembershipArgs::_internal_ip() const {
+  return _impl_.ip_.Get();
+}
+inline void ChangeMembershipArgs::_internal_set_ip(const std::string& value) {
+  
+  _impl_.ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChangeMembershipArgs::_internal_mutable_ip() {
+  
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChangeMembershipArgs::release_ip() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ChangeMembershipArgs.Ip)
+  return _impl_.ip_.Release();
+}
+inline void ChangeMembershipArgs::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ChangeMembershipArgs.Ip)
+}
+
+// int32 Port = 4;
+inline void ChangeMembershipArgs::clear_port() {
+  _impl_.port_ = 0;
+}
+inline int32_t ChangeMembershipArgs::_internal_port() const {
+  return _impl_.port_;
+}
+inline int32_t ChangeMembershipArgs::port() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ChangeMembershipArgs.Port)
+  return _internal_port();
+}
+inline void ChangeMembershipArgs::_internal_set_port(int32_t value) {
+  
+  _impl_.port_ = value;
+}
+inline void ChangeMembershipArgs::set_port(int32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ChangeMembershipArgs.Port)
+}
+
+// -------------------------------------------------------------------
+
+// ChangeMembershipReply
+
+// bytes Err = 1;
+inline void ChangeMembershipReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& ChangeMembershipReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ChangeMembershipReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChangeMembershipReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ChangeMembershipReply.Err)
+}
+inline std::string* ChangeMembershipReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ChangeMembershipReply.Err)
+  return _s;
+}
+inline const std::string& ChangeMembershipReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void ChangeMembershipReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChangeMembershipReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChangeMembershipReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ChangeMembershipReply.Err)
+  return _impl_.err_.Release();
+}
+inline void ChangeMembershipReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ChangeMembershipReply.Err)
 }
 
 #ifdef __GNUC__
@@ -1448,11 +3268,37 @@ inline void PutAppendReply::set_allocated_err(std::string* err) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace raftKVRpcProctoc
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::raftKVRpcProctoc::ConfChangeType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::raftKVRpcProctoc::ConfChangeType>() {
+  return ::raftKVRpcProctoc::ConfChangeType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
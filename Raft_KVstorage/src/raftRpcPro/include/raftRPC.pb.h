@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3014000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3014000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -43,58 +42,83 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_raftRPC_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[7]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_raftRPC_2eproto;
 namespace raftRpcProctoc {
 class AppendEntriesArgs;
-class AppendEntriesArgsDefaultTypeInternal;
+struct AppendEntriesArgsDefaultTypeInternal;
 extern AppendEntriesArgsDefaultTypeInternal _AppendEntriesArgs_default_instance_;
 class AppendEntriesReply;
-class AppendEntriesReplyDefaultTypeInternal;
+struct AppendEntriesReplyDefaultTypeInternal;
 extern AppendEntriesReplyDefaultTypeInternal _AppendEntriesReply_default_instance_;
+class BatchAppendEntriesArgs;
+struct BatchAppendEntriesArgsDefaultTypeInternal;
+extern BatchAppendEntriesArgsDefaultTypeInternal _BatchAppendEntriesArgs_default_instance_;
+class BatchAppendEntriesReply;
+struct BatchAppendEntriesReplyDefaultTypeInternal;
+extern BatchAppendEntriesReplyDefaultTypeInternal _BatchAppendEntriesReply_default_instance_;
+class ClusterConfig;
+struct ClusterConfigDefaultTypeInternal;
+extern ClusterConfigDefaultTypeInternal _ClusterConfig_default_instance_;
+class GroupAppendEntriesArgs;
+struct GroupAppendEntriesArgsDefaultTypeInternal;
+extern GroupAppendEntriesArgsDefaultTypeInternal _GroupAppendEntriesArgs_default_instance_;
+class GroupAppendEntriesReply;
+struct GroupAppendEntriesReplyDefaultTypeInternal;
+extern GroupAppendEntriesReplyDefaultTypeInternal _GroupAppendEntriesReply_default_instance_;
 class InstallSnapshotRequest;
-class InstallSnapshotRequestDefaultTypeInternal;
+struct InstallSnapshotRequestDefaultTypeInternal;
 extern InstallSnapshotRequestDefaultTypeInternal _InstallSnapshotRequest_default_instance_;
 class InstallSnapshotResponse;
-class InstallSnapshotResponseDefaultTypeInternal;
+struct InstallSnapshotResponseDefaultTypeInternal;
 extern InstallSnapshotResponseDefaultTypeInternal _InstallSnapshotResponse_default_instance_;
 class LogEntry;
-class LogEntryDefaultTypeInternal;
+struct LogEntryDefaultTypeInternal;
 extern LogEntryDefaultTypeInternal _LogEntry_default_instance_;
+class Member;
+struct MemberDefaultTypeInternal;
+extern MemberDefaultTypeInternal _Member_default_instance_;
 class RequestVoteArgs;
-class RequestVoteArgsDefaultTypeInternal;
+struct RequestVoteArgsDefaultTypeInternal;
 extern RequestVoteArgsDefaultTypeInternal _RequestVoteArgs_default_instance_;
 class RequestVoteReply;
-class RequestVoteReplyDefaultTypeInternal;
+struct RequestVoteReplyDefaultTypeInternal;
 extern RequestVoteReplyDefaultTypeInternal _RequestVoteReply_default_instance_;
+class TimeoutNowArgs;
+struct TimeoutNowArgsDefaultTypeInternal;
+extern TimeoutNowArgsDefaultTypeInternal _TimeoutNowArgs_default_instance_;
+class TimeoutNowReply;
+struct TimeoutNowReplyDefaultTypeInternal;
+extern TimeoutNowReplyDefaultTypeInternal _TimeoutNowReply_default_instance_;
 }  // namespace raftRpcProctoc
 PROTOBUF_NAMESPACE_OPEN
 template<> ::raftRpcProctoc::AppendEntriesArgs* Arena::CreateMaybeMessage<::raftRpcProctoc::AppendEntriesArgs>(Arena*);
 template<> ::raftRpcProctoc::AppendEntriesReply* Arena::CreateMaybeMessage<::raftRpcProctoc::AppendEntriesReply>(Arena*);
+template<> ::raftRpcProctoc::BatchAppendEntriesArgs* Arena::CreateMaybeMessage<::raftRpcProctoc::BatchAppendEntriesArgs>(Arena*);
+template<> ::raftRpcProctoc::BatchAppendEntriesReply* Arena::CreateMaybeMessage<::raftRpcProctoc::BatchAppendEntriesReply>(Arena*);
+template<> ::raftRpcProctoc::ClusterConfig* Arena::CreateMaybeMessage<::raftRpcProctoc::ClusterConfig>(Arena*);
+template<> ::raftRpcProctoc::GroupAppendEntriesArgs* Arena::CreateMaybeMessage<::raftRpcProctoc::GroupAppendEntriesArgs>(Arena*);
+template<> ::raftRpcProctoc::GroupAppendEntriesReply* Arena::CreateMaybeMessage<::raftRpcProctoc::GroupAppendEntriesReply>(Arena*);
 template<> ::raftRpcProctoc::InstallSnapshotRequest* Arena::CreateMaybeMessage<::raftRpcProctoc::InstallSnapshotRequest>(Arena*);
 template<> ::raftRpcProctoc::InstallSnapshotResponse* Arena::CreateMaybeMessage<::raftRpcProctoc::InstallSnapshotResponse>(Arena*);
 template<> ::raftRpcProctoc::LogEntry* Arena::CreateMaybeMessage<::raftRpcProctoc::LogEntry>(Arena*);
+template<> ::raftRpcProctoc::Member* Arena::CreateMaybeMessage<::raftRpcProctoc::Member>(Arena*);
 template<> ::raftRpcProctoc::RequestVoteArgs* Arena::CreateMaybeMessage<::raftRpcProctoc::RequestVoteArgs>(Arena*);
 template<> ::raftRpcProctoc::RequestVoteReply* Arena::CreateMaybeMessage<::raftRpcProctoc::RequestVoteReply>(Arena*);
+template<> ::raftRpcProctoc::TimeoutNowArgs* Arena::CreateMaybeMessage<::raftRpcProctoc::TimeoutNowArgs>(Arena*);
+template<> ::raftRpcProctoc::TimeoutNowReply* Arena::CreateMaybeMessage<::raftRpcProctoc::TimeoutNowReply>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace raftRpcProctoc {
 
 // ===================================================================
 
-class LogEntry PROTOBUF_FINAL :
+class LogEntry final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.LogEntry) */ {
  public:
   inline LogEntry() : LogEntry(nullptr) {}
-  virtual ~LogEntry();
+  ~LogEntry() override;
+  explicit PROTOBUF_CONSTEXPR LogEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LogEntry(const LogEntry& from);
   LogEntry(LogEntry&& from) noexcept
@@ -107,8 +131,13 @@ class LogEntry PROTOBUF_FINAL :
     return *this;
   }
   inline LogEntry& operator=(LogEntry&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -119,13 +148,14 @@ class LogEntry PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogEntry& default_instance() {
+    return *internal_default_instance();
   }
-  static const LogEntry& default_instance();
-
   static inline const LogEntry* internal_default_instance() {
     return reinterpret_cast<const LogEntry*>(
                &_LogEntry_default_instance_);
@@ -138,7 +168,12 @@ class LogEntry PROTOBUF_FINAL :
   }
   inline void Swap(LogEntry* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -146,56 +181,53 @@ class LogEntry PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(LogEntry* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LogEntry* New() const final {
-    return CreateMaybeMessage<LogEntry>(nullptr);
-  }
-
-  LogEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  LogEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<LogEntry>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LogEntry& from);
-  void MergeFrom(const LogEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogEntry& from) {
+    LogEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(LogEntry* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.LogEntry";
   }
   protected:
-  explicit LogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit LogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -205,39 +237,47 @@ class LogEntry PROTOBUF_FINAL :
     kCommandFieldNumber = 1,
     kLogTermFieldNumber = 2,
     kLogIndexFieldNumber = 3,
+    kConfChangeFieldNumber = 4,
   };
   // bytes Command = 1;
   void clear_command();
   const std::string& command() const;
-  void set_command(const std::string& value);
-  void set_command(std::string&& value);
-  void set_command(const char* value);
-  void set_command(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_command(ArgT0&& arg0, ArgT... args);
   std::string* mutable_command();
-  std::string* release_command();
+  PROTOBUF_NODISCARD std::string* release_command();
   void set_allocated_command(std::string* command);
   private:
   const std::string& _internal_command() const;
-  void _internal_set_command(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_command(const std::string& value);
   std::string* _internal_mutable_command();
   public:
 
   // int32 LogTerm = 2;
   void clear_logterm();
-  ::PROTOBUF_NAMESPACE_ID::int32 logterm() const;
-  void set_logterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t logterm() const;
+  void set_logterm(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_logterm() const;
-  void _internal_set_logterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_logterm() const;
+  void _internal_set_logterm(int32_t value);
   public:
 
   // int32 LogIndex = 3;
   void clear_logindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 logindex() const;
-  void set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t logindex() const;
+  void set_logindex(int32_t value);
+  private:
+  int32_t _internal_logindex() const;
+  void _internal_set_logindex(int32_t value);
+  public:
+
+  // bool ConfChange = 4;
+  void clear_confchange();
+  bool confchange() const;
+  void set_confchange(bool value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_logindex() const;
-  void _internal_set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  bool _internal_confchange() const;
+  void _internal_set_confchange(bool value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.LogEntry)
@@ -247,19 +287,367 @@ class LogEntry PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr command_;
-  ::PROTOBUF_NAMESPACE_ID::int32 logterm_;
-  ::PROTOBUF_NAMESPACE_ID::int32 logindex_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr command_;
+    int32_t logterm_;
+    int32_t logindex_;
+    bool confchange_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Member final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.Member) */ {
+ public:
+  inline Member() : Member(nullptr) {}
+  ~Member() override;
+  explicit PROTOBUF_CONSTEXPR Member(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Member(const Member& from);
+  Member(Member&& from) noexcept
+    : Member() {
+    *this = ::std::move(from);
+  }
+
+  inline Member& operator=(const Member& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Member& operator=(Member&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Member& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Member* internal_default_instance() {
+    return reinterpret_cast<const Member*>(
+               &_Member_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Member& a, Member& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Member* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Member* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Member* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Member>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Member& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Member& from) {
+    Member::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Member* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProctoc.Member";
+  }
+  protected:
+  explicit Member(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIpFieldNumber = 2,
+    kIdFieldNumber = 1,
+    kPortFieldNumber = 3,
+    kLearnerFieldNumber = 4,
+  };
+  // bytes Ip = 2;
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
+
+  // int32 Id = 1;
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // int32 Port = 3;
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
+  private:
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
+  public:
+
+  // bool Learner = 4;
+  void clear_learner();
+  bool learner() const;
+  void set_learner(bool value);
+  private:
+  bool _internal_learner() const;
+  void _internal_set_learner(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProctoc.Member)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    int32_t id_;
+    int32_t port_;
+    bool learner_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClusterConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.ClusterConfig) */ {
+ public:
+  inline ClusterConfig() : ClusterConfig(nullptr) {}
+  ~ClusterConfig() override;
+  explicit PROTOBUF_CONSTEXPR ClusterConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClusterConfig(const ClusterConfig& from);
+  ClusterConfig(ClusterConfig&& from) noexcept
+    : ClusterConfig() {
+    *this = ::std::move(from);
+  }
+
+  inline ClusterConfig& operator=(const ClusterConfig& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClusterConfig& operator=(ClusterConfig&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClusterConfig& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClusterConfig* internal_default_instance() {
+    return reinterpret_cast<const ClusterConfig*>(
+               &_ClusterConfig_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ClusterConfig& a, ClusterConfig& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClusterConfig* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClusterConfig* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClusterConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClusterConfig>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClusterConfig& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClusterConfig& from) {
+    ClusterConfig::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClusterConfig* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProctoc.ClusterConfig";
+  }
+  protected:
+  explicit ClusterConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMembersFieldNumber = 1,
+  };
+  // repeated .raftRpcProctoc.Member Members = 1;
+  int members_size() const;
+  private:
+  int _internal_members_size() const;
+  public:
+  void clear_members();
+  ::raftRpcProctoc::Member* mutable_members(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::Member >*
+      mutable_members();
+  private:
+  const ::raftRpcProctoc::Member& _internal_members(int index) const;
+  ::raftRpcProctoc::Member* _internal_add_members();
+  public:
+  const ::raftRpcProctoc::Member& members(int index) const;
+  ::raftRpcProctoc::Member* add_members();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::Member >&
+      members() const;
+
+  // @@protoc_insertion_point(class_scope:raftRpcProctoc.ClusterConfig)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::Member > members_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AppendEntriesArgs PROTOBUF_FINAL :
+class AppendEntriesArgs final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.AppendEntriesArgs) */ {
  public:
   inline AppendEntriesArgs() : AppendEntriesArgs(nullptr) {}
-  virtual ~AppendEntriesArgs();
+  ~AppendEntriesArgs() override;
+  explicit PROTOBUF_CONSTEXPR AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   AppendEntriesArgs(const AppendEntriesArgs& from);
   AppendEntriesArgs(AppendEntriesArgs&& from) noexcept
@@ -272,8 +660,13 @@ class AppendEntriesArgs PROTOBUF_FINAL :
     return *this;
   }
   inline AppendEntriesArgs& operator=(AppendEntriesArgs&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -284,26 +677,32 @@ class AppendEntriesArgs PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AppendEntriesArgs& default_instance() {
+    return *internal_default_instance();
   }
-  static const AppendEntriesArgs& default_instance();
-
   static inline const AppendEntriesArgs* internal_default_instance() {
     return reinterpret_cast<const AppendEntriesArgs*>(
                &_AppendEntriesArgs_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    1;
+    3;
 
   friend void swap(AppendEntriesArgs& a, AppendEntriesArgs& b) {
     a.Swap(&b);
   }
   inline void Swap(AppendEntriesArgs* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -311,56 +710,53 @@ class AppendEntriesArgs PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(AppendEntriesArgs* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline AppendEntriesArgs* New() const final {
-    return CreateMaybeMessage<AppendEntriesArgs>(nullptr);
-  }
-
-  AppendEntriesArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  AppendEntriesArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<AppendEntriesArgs>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const AppendEntriesArgs& from);
-  void MergeFrom(const AppendEntriesArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AppendEntriesArgs& from) {
+    AppendEntriesArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(AppendEntriesArgs* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.AppendEntriesArgs";
   }
   protected:
-  explicit AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -394,47 +790,47 @@ class AppendEntriesArgs PROTOBUF_FINAL :
 
   // int32 Term = 1;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
   // int32 LeaderId = 2;
   void clear_leaderid();
-  ::PROTOBUF_NAMESPACE_ID::int32 leaderid() const;
-  void set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_leaderid() const;
-  void _internal_set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
   public:
 
   // int32 PrevLogIndex = 3;
   void clear_prevlogindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 prevlogindex() const;
-  void set_prevlogindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t prevlogindex() const;
+  void set_prevlogindex(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_prevlogindex() const;
-  void _internal_set_prevlogindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_prevlogindex() const;
+  void _internal_set_prevlogindex(int32_t value);
   public:
 
   // int32 PrevLogTerm = 4;
   void clear_prevlogterm();
-  ::PROTOBUF_NAMESPACE_ID::int32 prevlogterm() const;
-  void set_prevlogterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t prevlogterm() const;
+  void set_prevlogterm(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_prevlogterm() const;
-  void _internal_set_prevlogterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_prevlogterm() const;
+  void _internal_set_prevlogterm(int32_t value);
   public:
 
   // int32 LeaderCommit = 6;
   void clear_leadercommit();
-  ::PROTOBUF_NAMESPACE_ID::int32 leadercommit() const;
-  void set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t leadercommit() const;
+  void set_leadercommit(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_leadercommit() const;
-  void _internal_set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_leadercommit() const;
+  void _internal_set_leadercommit(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.AppendEntriesArgs)
@@ -444,22 +840,26 @@ class AppendEntriesArgs PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::LogEntry > entries_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  ::PROTOBUF_NAMESPACE_ID::int32 leaderid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 prevlogindex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 prevlogterm_;
-  ::PROTOBUF_NAMESPACE_ID::int32 leadercommit_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::LogEntry > entries_;
+    int32_t term_;
+    int32_t leaderid_;
+    int32_t prevlogindex_;
+    int32_t prevlogterm_;
+    int32_t leadercommit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AppendEntriesReply PROTOBUF_FINAL :
+class AppendEntriesReply final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.AppendEntriesReply) */ {
  public:
   inline AppendEntriesReply() : AppendEntriesReply(nullptr) {}
-  virtual ~AppendEntriesReply();
+  ~AppendEntriesReply() override;
+  explicit PROTOBUF_CONSTEXPR AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   AppendEntriesReply(const AppendEntriesReply& from);
   AppendEntriesReply(AppendEntriesReply&& from) noexcept
@@ -472,8 +872,13 @@ class AppendEntriesReply PROTOBUF_FINAL :
     return *this;
   }
   inline AppendEntriesReply& operator=(AppendEntriesReply&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -484,26 +889,32 @@ class AppendEntriesReply PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AppendEntriesReply& default_instance() {
+    return *internal_default_instance();
   }
-  static const AppendEntriesReply& default_instance();
-
   static inline const AppendEntriesReply* internal_default_instance() {
     return reinterpret_cast<const AppendEntriesReply*>(
                &_AppendEntriesReply_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    4;
 
   friend void swap(AppendEntriesReply& a, AppendEntriesReply& b) {
     a.Swap(&b);
   }
   inline void Swap(AppendEntriesReply* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -511,56 +922,53 @@ class AppendEntriesReply PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(AppendEntriesReply* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline AppendEntriesReply* New() const final {
-    return CreateMaybeMessage<AppendEntriesReply>(nullptr);
-  }
-
-  AppendEntriesReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  AppendEntriesReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<AppendEntriesReply>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const AppendEntriesReply& from);
-  void MergeFrom(const AppendEntriesReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AppendEntriesReply& from) {
+    AppendEntriesReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(AppendEntriesReply* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.AppendEntriesReply";
   }
   protected:
-  explicit AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -574,11 +982,11 @@ class AppendEntriesReply PROTOBUF_FINAL :
   };
   // int32 Term = 1;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
   // bool Success = 2;
@@ -592,20 +1000,20 @@ class AppendEntriesReply PROTOBUF_FINAL :
 
   // int32 UpdateNextIndex = 3;
   void clear_updatenextindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 updatenextindex() const;
-  void set_updatenextindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t updatenextindex() const;
+  void set_updatenextindex(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_updatenextindex() const;
-  void _internal_set_updatenextindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_updatenextindex() const;
+  void _internal_set_updatenextindex(int32_t value);
   public:
 
   // int32 AppState = 4;
   void clear_appstate();
-  ::PROTOBUF_NAMESPACE_ID::int32 appstate() const;
-  void set_appstate(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t appstate() const;
+  void set_appstate(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_appstate() const;
-  void _internal_set_appstate(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_appstate() const;
+  void _internal_set_appstate(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.AppendEntriesReply)
@@ -615,20 +1023,24 @@ class AppendEntriesReply PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  bool success_;
-  ::PROTOBUF_NAMESPACE_ID::int32 updatenextindex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 appstate_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int32_t term_;
+    bool success_;
+    int32_t updatenextindex_;
+    int32_t appstate_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RequestVoteArgs PROTOBUF_FINAL :
+class RequestVoteArgs final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.RequestVoteArgs) */ {
  public:
   inline RequestVoteArgs() : RequestVoteArgs(nullptr) {}
-  virtual ~RequestVoteArgs();
+  ~RequestVoteArgs() override;
+  explicit PROTOBUF_CONSTEXPR RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RequestVoteArgs(const RequestVoteArgs& from);
   RequestVoteArgs(RequestVoteArgs&& from) noexcept
@@ -641,8 +1053,13 @@ class RequestVoteArgs PROTOBUF_FINAL :
     return *this;
   }
   inline RequestVoteArgs& operator=(RequestVoteArgs&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -653,26 +1070,32 @@ class RequestVoteArgs PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestVoteArgs& default_instance() {
+    return *internal_default_instance();
   }
-  static const RequestVoteArgs& default_instance();
-
   static inline const RequestVoteArgs* internal_default_instance() {
     return reinterpret_cast<const RequestVoteArgs*>(
                &_RequestVoteArgs_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    5;
 
   friend void swap(RequestVoteArgs& a, RequestVoteArgs& b) {
     a.Swap(&b);
   }
   inline void Swap(RequestVoteArgs* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -680,56 +1103,53 @@ class RequestVoteArgs PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(RequestVoteArgs* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RequestVoteArgs* New() const final {
-    return CreateMaybeMessage<RequestVoteArgs>(nullptr);
-  }
-
-  RequestVoteArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  RequestVoteArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RequestVoteArgs>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RequestVoteArgs& from);
-  void MergeFrom(const RequestVoteArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestVoteArgs& from) {
+    RequestVoteArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RequestVoteArgs* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.RequestVoteArgs";
   }
   protected:
-  explicit RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -740,41 +1160,51 @@ class RequestVoteArgs PROTOBUF_FINAL :
     kCandidateIdFieldNumber = 2,
     kLastLogIndexFieldNumber = 3,
     kLastLogTermFieldNumber = 4,
+    kLeadershipTransferFieldNumber = 5,
   };
   // int32 Term = 1;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
   // int32 CandidateId = 2;
   void clear_candidateid();
-  ::PROTOBUF_NAMESPACE_ID::int32 candidateid() const;
-  void set_candidateid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t candidateid() const;
+  void set_candidateid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_candidateid() const;
-  void _internal_set_candidateid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_candidateid() const;
+  void _internal_set_candidateid(int32_t value);
   public:
 
   // int32 LastLogIndex = 3;
   void clear_lastlogindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 lastlogindex() const;
-  void set_lastlogindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t lastlogindex() const;
+  void set_lastlogindex(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_lastlogindex() const;
-  void _internal_set_lastlogindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_lastlogindex() const;
+  void _internal_set_lastlogindex(int32_t value);
   public:
 
   // int32 LastLogTerm = 4;
   void clear_lastlogterm();
-  ::PROTOBUF_NAMESPACE_ID::int32 lastlogterm() const;
-  void set_lastlogterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t lastlogterm() const;
+  void set_lastlogterm(int32_t value);
+  private:
+  int32_t _internal_lastlogterm() const;
+  void _internal_set_lastlogterm(int32_t value);
+  public:
+
+  // bool LeadershipTransfer = 5;
+  void clear_leadershiptransfer();
+  bool leadershiptransfer() const;
+  void set_leadershiptransfer(bool value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_lastlogterm() const;
-  void _internal_set_lastlogterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  bool _internal_leadershiptransfer() const;
+  void _internal_set_leadershiptransfer(bool value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.RequestVoteArgs)
@@ -784,20 +1214,25 @@ class RequestVoteArgs PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  ::PROTOBUF_NAMESPACE_ID::int32 candidateid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 lastlogindex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 lastlogterm_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int32_t term_;
+    int32_t candidateid_;
+    int32_t lastlogindex_;
+    int32_t lastlogterm_;
+    bool leadershiptransfer_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RequestVoteReply PROTOBUF_FINAL :
+class RequestVoteReply final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.RequestVoteReply) */ {
  public:
   inline RequestVoteReply() : RequestVoteReply(nullptr) {}
-  virtual ~RequestVoteReply();
+  ~RequestVoteReply() override;
+  explicit PROTOBUF_CONSTEXPR RequestVoteReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RequestVoteReply(const RequestVoteReply& from);
   RequestVoteReply(RequestVoteReply&& from) noexcept
@@ -810,8 +1245,13 @@ class RequestVoteReply PROTOBUF_FINAL :
     return *this;
   }
   inline RequestVoteReply& operator=(RequestVoteReply&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -822,26 +1262,32 @@ class RequestVoteReply PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestVoteReply& default_instance() {
+    return *internal_default_instance();
   }
-  static const RequestVoteReply& default_instance();
-
   static inline const RequestVoteReply* internal_default_instance() {
     return reinterpret_cast<const RequestVoteReply*>(
                &_RequestVoteReply_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    6;
 
   friend void swap(RequestVoteReply& a, RequestVoteReply& b) {
     a.Swap(&b);
   }
   inline void Swap(RequestVoteReply* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -849,56 +1295,53 @@ class RequestVoteReply PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(RequestVoteReply* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RequestVoteReply* New() const final {
-    return CreateMaybeMessage<RequestVoteReply>(nullptr);
-  }
-
-  RequestVoteReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  RequestVoteReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RequestVoteReply>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RequestVoteReply& from);
-  void MergeFrom(const RequestVoteReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestVoteReply& from) {
+    RequestVoteReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RequestVoteReply* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.RequestVoteReply";
   }
   protected:
-  explicit RequestVoteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit RequestVoteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -911,11 +1354,11 @@ class RequestVoteReply PROTOBUF_FINAL :
   };
   // int32 Term = 1;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
   // bool VoteGranted = 2;
@@ -929,11 +1372,11 @@ class RequestVoteReply PROTOBUF_FINAL :
 
   // int32 VoteState = 3;
   void clear_votestate();
-  ::PROTOBUF_NAMESPACE_ID::int32 votestate() const;
-  void set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t votestate() const;
+  void set_votestate(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_votestate() const;
-  void _internal_set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_votestate() const;
+  void _internal_set_votestate(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.RequestVoteReply)
@@ -943,19 +1386,23 @@ class RequestVoteReply PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  bool votegranted_;
-  ::PROTOBUF_NAMESPACE_ID::int32 votestate_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int32_t term_;
+    bool votegranted_;
+    int32_t votestate_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class InstallSnapshotRequest PROTOBUF_FINAL :
+class InstallSnapshotRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.InstallSnapshotRequest) */ {
  public:
   inline InstallSnapshotRequest() : InstallSnapshotRequest(nullptr) {}
-  virtual ~InstallSnapshotRequest();
+  ~InstallSnapshotRequest() override;
+  explicit PROTOBUF_CONSTEXPR InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   InstallSnapshotRequest(const InstallSnapshotRequest& from);
   InstallSnapshotRequest(InstallSnapshotRequest&& from) noexcept
@@ -968,8 +1415,13 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
     return *this;
   }
   inline InstallSnapshotRequest& operator=(InstallSnapshotRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -980,26 +1432,32 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InstallSnapshotRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const InstallSnapshotRequest& default_instance();
-
   static inline const InstallSnapshotRequest* internal_default_instance() {
     return reinterpret_cast<const InstallSnapshotRequest*>(
                &_InstallSnapshotRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    7;
 
   friend void swap(InstallSnapshotRequest& a, InstallSnapshotRequest& b) {
     a.Swap(&b);
   }
   inline void Swap(InstallSnapshotRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1007,56 +1465,53 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(InstallSnapshotRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline InstallSnapshotRequest* New() const final {
-    return CreateMaybeMessage<InstallSnapshotRequest>(nullptr);
-  }
-
-  InstallSnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  InstallSnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<InstallSnapshotRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const InstallSnapshotRequest& from);
-  void MergeFrom(const InstallSnapshotRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InstallSnapshotRequest& from) {
+    InstallSnapshotRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(InstallSnapshotRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.InstallSnapshotRequest";
   }
   protected:
-  explicit InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1064,6 +1519,7 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
 
   enum : int {
     kDataFieldNumber = 5,
+    kConfigFieldNumber = 6,
     kLeaderIdFieldNumber = 1,
     kTermFieldNumber = 2,
     kLastSnapShotIncludeIndexFieldNumber = 3,
@@ -1072,53 +1528,69 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
   // bytes Data = 5;
   void clear_data();
   const std::string& data() const;
-  void set_data(const std::string& value);
-  void set_data(std::string&& value);
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
   std::string* mutable_data();
-  std::string* release_data();
+  PROTOBUF_NODISCARD std::string* release_data();
   void set_allocated_data(std::string* data);
   private:
   const std::string& _internal_data() const;
-  void _internal_set_data(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
   std::string* _internal_mutable_data();
   public:
 
+  // .raftRpcProctoc.ClusterConfig Config = 6;
+  bool has_config() const;
+  private:
+  bool _internal_has_config() const;
+  public:
+  void clear_config();
+  const ::raftRpcProctoc::ClusterConfig& config() const;
+  PROTOBUF_NODISCARD ::raftRpcProctoc::ClusterConfig* release_config();
+  ::raftRpcProctoc::ClusterConfig* mutable_config();
+  void set_allocated_config(::raftRpcProctoc::ClusterConfig* config);
+  private:
+  const ::raftRpcProctoc::ClusterConfig& _internal_config() const;
+  ::raftRpcProctoc::ClusterConfig* _internal_mutable_config();
+  public:
+  void unsafe_arena_set_allocated_config(
+      ::raftRpcProctoc::ClusterConfig* config);
+  ::raftRpcProctoc::ClusterConfig* unsafe_arena_release_config();
+
   // int32 LeaderId = 1;
   void clear_leaderid();
-  ::PROTOBUF_NAMESPACE_ID::int32 leaderid() const;
-  void set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_leaderid() const;
-  void _internal_set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
   public:
 
   // int32 Term = 2;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
   // int32 LastSnapShotIncludeIndex = 3;
   void clear_lastsnapshotincludeindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 lastsnapshotincludeindex() const;
-  void set_lastsnapshotincludeindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t lastsnapshotincludeindex() const;
+  void set_lastsnapshotincludeindex(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_lastsnapshotincludeindex() const;
-  void _internal_set_lastsnapshotincludeindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_lastsnapshotincludeindex() const;
+  void _internal_set_lastsnapshotincludeindex(int32_t value);
   public:
 
   // int32 LastSnapShotIncludeTerm = 4;
   void clear_lastsnapshotincludeterm();
-  ::PROTOBUF_NAMESPACE_ID::int32 lastsnapshotincludeterm() const;
-  void set_lastsnapshotincludeterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t lastsnapshotincludeterm() const;
+  void set_lastsnapshotincludeterm(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_lastsnapshotincludeterm() const;
-  void _internal_set_lastsnapshotincludeterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_lastsnapshotincludeterm() const;
+  void _internal_set_lastsnapshotincludeterm(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.InstallSnapshotRequest)
@@ -1128,21 +1600,26 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
-  ::PROTOBUF_NAMESPACE_ID::int32 leaderid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  ::PROTOBUF_NAMESPACE_ID::int32 lastsnapshotincludeindex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 lastsnapshotincludeterm_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::raftRpcProctoc::ClusterConfig* config_;
+    int32_t leaderid_;
+    int32_t term_;
+    int32_t lastsnapshotincludeindex_;
+    int32_t lastsnapshotincludeterm_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class InstallSnapshotResponse PROTOBUF_FINAL :
+class InstallSnapshotResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.InstallSnapshotResponse) */ {
  public:
   inline InstallSnapshotResponse() : InstallSnapshotResponse(nullptr) {}
-  virtual ~InstallSnapshotResponse();
+  ~InstallSnapshotResponse() override;
+  explicit PROTOBUF_CONSTEXPR InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   InstallSnapshotResponse(const InstallSnapshotResponse& from);
   InstallSnapshotResponse(InstallSnapshotResponse&& from) noexcept
@@ -1155,8 +1632,13 @@ class InstallSnapshotResponse PROTOBUF_FINAL :
     return *this;
   }
   inline InstallSnapshotResponse& operator=(InstallSnapshotResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1167,26 +1649,32 @@ class InstallSnapshotResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InstallSnapshotResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const InstallSnapshotResponse& default_instance();
-
   static inline const InstallSnapshotResponse* internal_default_instance() {
     return reinterpret_cast<const InstallSnapshotResponse*>(
                &_InstallSnapshotResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    8;
 
   friend void swap(InstallSnapshotResponse& a, InstallSnapshotResponse& b) {
     a.Swap(&b);
   }
   inline void Swap(InstallSnapshotResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1194,56 +1682,53 @@ class InstallSnapshotResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(InstallSnapshotResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline InstallSnapshotResponse* New() const final {
-    return CreateMaybeMessage<InstallSnapshotResponse>(nullptr);
-  }
-
-  InstallSnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  InstallSnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<InstallSnapshotResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const InstallSnapshotResponse& from);
-  void MergeFrom(const InstallSnapshotResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InstallSnapshotResponse& from) {
+    InstallSnapshotResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(InstallSnapshotResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.InstallSnapshotResponse";
   }
   protected:
-  explicit InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1254,11 +1739,11 @@ class InstallSnapshotResponse PROTOBUF_FINAL :
   };
   // int32 Term = 1;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.InstallSnapshotResponse)
@@ -1268,195 +1753,1397 @@ class InstallSnapshotResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int32_t term_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
-// ===================================================================
-
-class raftRpc_Stub;
+// -------------------------------------------------------------------
 
-class raftRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
- protected:
-  // This class should be treated as an abstract interface.
-  inline raftRpc() {};
+class TimeoutNowArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.TimeoutNowArgs) */ {
  public:
-  virtual ~raftRpc();
+  inline TimeoutNowArgs() : TimeoutNowArgs(nullptr) {}
+  ~TimeoutNowArgs() override;
+  explicit PROTOBUF_CONSTEXPR TimeoutNowArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  typedef raftRpc_Stub Stub;
+  TimeoutNowArgs(const TimeoutNowArgs& from);
+  TimeoutNowArgs(TimeoutNowArgs&& from) noexcept
+    : TimeoutNowArgs() {
+    *this = ::std::move(from);
+  }
 
-  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
+  inline TimeoutNowArgs& operator=(const TimeoutNowArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TimeoutNowArgs& operator=(TimeoutNowArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  virtual void AppendEntries(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftRpcProctoc::AppendEntriesArgs* request,
-                       ::raftRpcProctoc::AppendEntriesReply* response,
-                       ::google::protobuf::Closure* done);
-  virtual void InstallSnapshot(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftRpcProctoc::InstallSnapshotRequest* request,
-                       ::raftRpcProctoc::InstallSnapshotResponse* response,
-                       ::google::protobuf::Closure* done);
-  virtual void RequestVote(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftRpcProctoc::RequestVoteArgs* request,
-                       ::raftRpcProctoc::RequestVoteReply* response,
-                       ::google::protobuf::Closure* done);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TimeoutNowArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TimeoutNowArgs* internal_default_instance() {
+    return reinterpret_cast<const TimeoutNowArgs*>(
+               &_TimeoutNowArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
 
-  // implements Service ----------------------------------------------
+  friend void swap(TimeoutNowArgs& a, TimeoutNowArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TimeoutNowArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TimeoutNowArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
-  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
-                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
-                  ::PROTOBUF_NAMESPACE_ID::Message* response,
-                  ::google::protobuf::Closure* done);
-  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
-  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  // implements Message ----------------------------------------------
+
+  TimeoutNowArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TimeoutNowArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TimeoutNowArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TimeoutNowArgs& from) {
+    TimeoutNowArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TimeoutNowArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProctoc.TimeoutNowArgs";
+  }
+  protected:
+  explicit TimeoutNowArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kLeaderIdFieldNumber = 2,
+  };
+  // int32 Term = 1;
+  void clear_term();
+  int32_t term() const;
+  void set_term(int32_t value);
+  private:
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
+  public:
+
+  // int32 LeaderId = 2;
+  void clear_leaderid();
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
+  private:
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
+  public:
 
+  // @@protoc_insertion_point(class_scope:raftRpcProctoc.TimeoutNowArgs)
  private:
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(raftRpc);
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t term_;
+    int32_t leaderid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
 };
+// -------------------------------------------------------------------
 
-class raftRpc_Stub : public raftRpc {
+class TimeoutNowReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.TimeoutNowReply) */ {
  public:
-  raftRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
-  raftRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
-                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
-  ~raftRpc_Stub();
+  inline TimeoutNowReply() : TimeoutNowReply(nullptr) {}
+  ~TimeoutNowReply() override;
+  explicit PROTOBUF_CONSTEXPR TimeoutNowReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+  TimeoutNowReply(const TimeoutNowReply& from);
+  TimeoutNowReply(TimeoutNowReply&& from) noexcept
+    : TimeoutNowReply() {
+    *this = ::std::move(from);
+  }
 
-  // implements raftRpc ------------------------------------------
+  inline TimeoutNowReply& operator=(const TimeoutNowReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TimeoutNowReply& operator=(TimeoutNowReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  void AppendEntries(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftRpcProctoc::AppendEntriesArgs* request,
-                       ::raftRpcProctoc::AppendEntriesReply* response,
-                       ::google::protobuf::Closure* done);
-  void InstallSnapshot(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftRpcProctoc::InstallSnapshotRequest* request,
-                       ::raftRpcProctoc::InstallSnapshotResponse* response,
-                       ::google::protobuf::Closure* done);
-  void RequestVote(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftRpcProctoc::RequestVoteArgs* request,
-                       ::raftRpcProctoc::RequestVoteReply* response,
-                       ::google::protobuf::Closure* done);
- private:
-  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
-  bool owns_channel_;
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(raftRpc_Stub);
-};
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TimeoutNowReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TimeoutNowReply* internal_default_instance() {
+    return reinterpret_cast<const TimeoutNowReply*>(
+               &_TimeoutNowReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(TimeoutNowReply& a, TimeoutNowReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TimeoutNowReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TimeoutNowReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
+  // implements Message ----------------------------------------------
 
-// ===================================================================
+  TimeoutNowReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TimeoutNowReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TimeoutNowReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TimeoutNowReply& from) {
+    TimeoutNowReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// ===================================================================
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TimeoutNowReply* other);
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// LogEntry
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProctoc.TimeoutNowReply";
+  }
+  protected:
+  explicit TimeoutNowReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+  };
+  // int32 Term = 1;
+  void clear_term();
+  int32_t term() const;
+  void set_term(int32_t value);
+  private:
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProctoc.TimeoutNowReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t term_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GroupAppendEntriesArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.GroupAppendEntriesArgs) */ {
+ public:
+  inline GroupAppendEntriesArgs() : GroupAppendEntriesArgs(nullptr) {}
+  ~GroupAppendEntriesArgs() override;
+  explicit PROTOBUF_CONSTEXPR GroupAppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GroupAppendEntriesArgs(const GroupAppendEntriesArgs& from);
+  GroupAppendEntriesArgs(GroupAppendEntriesArgs&& from) noexcept
+    : GroupAppendEntriesArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline GroupAppendEntriesArgs& operator=(const GroupAppendEntriesArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GroupAppendEntriesArgs& operator=(GroupAppendEntriesArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GroupAppendEntriesArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GroupAppendEntriesArgs* internal_default_instance() {
+    return reinterpret_cast<const GroupAppendEntriesArgs*>(
+               &_GroupAppendEntriesArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(GroupAppendEntriesArgs& a, GroupAppendEntriesArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GroupAppendEntriesArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GroupAppendEntriesArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GroupAppendEntriesArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GroupAppendEntriesArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GroupAppendEntriesArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GroupAppendEntriesArgs& from) {
+    GroupAppendEntriesArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GroupAppendEntriesArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProctoc.GroupAppendEntriesArgs";
+  }
+  protected:
+  explicit GroupAppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kArgsFieldNumber = 2,
+    kGroupIdFieldNumber = 1,
+  };
+  // .raftRpcProctoc.AppendEntriesArgs Args = 2;
+  bool has_args() const;
+  private:
+  bool _internal_has_args() const;
+  public:
+  void clear_args();
+  const ::raftRpcProctoc::AppendEntriesArgs& args() const;
+  PROTOBUF_NODISCARD ::raftRpcProctoc::AppendEntriesArgs* release_args();
+  ::raftRpcProctoc::AppendEntriesArgs* mutable_args();
+  void set_allocated_args(::raftRpcProctoc::AppendEntriesArgs* args);
+  private:
+  const ::raftRpcProctoc::AppendEntriesArgs& _internal_args() const;
+  ::raftRpcProctoc::AppendEntriesArgs* _internal_mutable_args();
+  public:
+  void unsafe_arena_set_allocated_args(
+      ::raftRpcProctoc::AppendEntriesArgs* args);
+  ::raftRpcProctoc::AppendEntriesArgs* unsafe_arena_release_args();
+
+  // uint32 GroupId = 1;
+  void clear_groupid();
+  uint32_t groupid() const;
+  void set_groupid(uint32_t value);
+  private:
+  uint32_t _internal_groupid() const;
+  void _internal_set_groupid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProctoc.GroupAppendEntriesArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::raftRpcProctoc::AppendEntriesArgs* args_;
+    uint32_t groupid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GroupAppendEntriesReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.GroupAppendEntriesReply) */ {
+ public:
+  inline GroupAppendEntriesReply() : GroupAppendEntriesReply(nullptr) {}
+  ~GroupAppendEntriesReply() override;
+  explicit PROTOBUF_CONSTEXPR GroupAppendEntriesReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GroupAppendEntriesReply(const GroupAppendEntriesReply& from);
+  GroupAppendEntriesReply(GroupAppendEntriesReply&& from) noexcept
+    : GroupAppendEntriesReply() {
+    *this = ::std::move(from);
+  }
+
+  inline GroupAppendEntriesReply& operator=(const GroupAppendEntriesReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GroupAppendEntriesReply& operator=(GroupAppendEntriesReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GroupAppendEntriesReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GroupAppendEntriesReply* internal_default_instance() {
+    return reinterpret_cast<const GroupAppendEntriesReply*>(
+               &_GroupAppendEntriesReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(GroupAppendEntriesReply& a, GroupAppendEntriesReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GroupAppendEntriesReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GroupAppendEntriesReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GroupAppendEntriesReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GroupAppendEntriesReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GroupAppendEntriesReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GroupAppendEntriesReply& from) {
+    GroupAppendEntriesReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GroupAppendEntriesReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProctoc.GroupAppendEntriesReply";
+  }
+  protected:
+  explicit GroupAppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyFieldNumber = 2,
+    kGroupIdFieldNumber = 1,
+  };
+  // .raftRpcProctoc.AppendEntriesReply Reply = 2;
+  bool has_reply() const;
+  private:
+  bool _internal_has_reply() const;
+  public:
+  void clear_reply();
+  const ::raftRpcProctoc::AppendEntriesReply& reply() const;
+  PROTOBUF_NODISCARD ::raftRpcProctoc::AppendEntriesReply* release_reply();
+  ::raftRpcProctoc::AppendEntriesReply* mutable_reply();
+  void set_allocated_reply(::raftRpcProctoc::AppendEntriesReply* reply);
+  private:
+  const ::raftRpcProctoc::AppendEntriesReply& _internal_reply() const;
+  ::raftRpcProctoc::AppendEntriesReply* _internal_mutable_reply();
+  public:
+  void unsafe_arena_set_allocated_reply(
+      ::raftRpcProctoc::AppendEntriesReply* reply);
+  ::raftRpcProctoc::AppendEntriesReply* unsafe_arena_release_reply();
+
+  // uint32 GroupId = 1;
+  void clear_groupid();
+  uint32_t groupid() const;
+  void set_groupid(uint32_t value);
+  private:
+  uint32_t _internal_groupid() const;
+  void _internal_set_groupid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProctoc.GroupAppendEntriesReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::raftRpcProctoc::AppendEntriesReply* reply_;
+    uint32_t groupid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchAppendEntriesArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.BatchAppendEntriesArgs) */ {
+ public:
+  inline BatchAppendEntriesArgs() : BatchAppendEntriesArgs(nullptr) {}
+  ~BatchAppendEntriesArgs() override;
+  explicit PROTOBUF_CONSTEXPR BatchAppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchAppendEntriesArgs(const BatchAppendEntriesArgs& from);
+  BatchAppendEntriesArgs(BatchAppendEntriesArgs&& from) noexcept
+    : BatchAppendEntriesArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchAppendEntriesArgs& operator=(const BatchAppendEntriesArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchAppendEntriesArgs& operator=(BatchAppendEntriesArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchAppendEntriesArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchAppendEntriesArgs* internal_default_instance() {
+    return reinterpret_cast<const BatchAppendEntriesArgs*>(
+               &_BatchAppendEntriesArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(BatchAppendEntriesArgs& a, BatchAppendEntriesArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchAppendEntriesArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchAppendEntriesArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchAppendEntriesArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchAppendEntriesArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchAppendEntriesArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchAppendEntriesArgs& from) {
+    BatchAppendEntriesArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchAppendEntriesArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProctoc.BatchAppendEntriesArgs";
+  }
+  protected:
+  explicit BatchAppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 1,
+  };
+  // repeated .raftRpcProctoc.GroupAppendEntriesArgs Entries = 1;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::raftRpcProctoc::GroupAppendEntriesArgs* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::GroupAppendEntriesArgs >*
+      mutable_entries();
+  private:
+  const ::raftRpcProctoc::GroupAppendEntriesArgs& _internal_entries(int index) const;
+  ::raftRpcProctoc::GroupAppendEntriesArgs* _internal_add_entries();
+  public:
+  const ::raftRpcProctoc::GroupAppendEntriesArgs& entries(int index) const;
+  ::raftRpcProctoc::GroupAppendEntriesArgs* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::GroupAppendEntriesArgs >&
+      entries() const;
+
+  // @@protoc_insertion_point(class_scope:raftRpcProctoc.BatchAppendEntriesArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::GroupAppendEntriesArgs > entries_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchAppendEntriesReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.BatchAppendEntriesReply) */ {
+ public:
+  inline BatchAppendEntriesReply() : BatchAppendEntriesReply(nullptr) {}
+  ~BatchAppendEntriesReply() override;
+  explicit PROTOBUF_CONSTEXPR BatchAppendEntriesReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchAppendEntriesReply(const BatchAppendEntriesReply& from);
+  BatchAppendEntriesReply(BatchAppendEntriesReply&& from) noexcept
+    : BatchAppendEntriesReply() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchAppendEntriesReply& operator=(const BatchAppendEntriesReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchAppendEntriesReply& operator=(BatchAppendEntriesReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchAppendEntriesReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchAppendEntriesReply* internal_default_instance() {
+    return reinterpret_cast<const BatchAppendEntriesReply*>(
+               &_BatchAppendEntriesReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(BatchAppendEntriesReply& a, BatchAppendEntriesReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchAppendEntriesReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchAppendEntriesReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchAppendEntriesReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchAppendEntriesReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchAppendEntriesReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchAppendEntriesReply& from) {
+    BatchAppendEntriesReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchAppendEntriesReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProctoc.BatchAppendEntriesReply";
+  }
+  protected:
+  explicit BatchAppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 1,
+  };
+  // repeated .raftRpcProctoc.GroupAppendEntriesReply Entries = 1;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::raftRpcProctoc::GroupAppendEntriesReply* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::GroupAppendEntriesReply >*
+      mutable_entries();
+  private:
+  const ::raftRpcProctoc::GroupAppendEntriesReply& _internal_entries(int index) const;
+  ::raftRpcProctoc::GroupAppendEntriesReply* _internal_add_entries();
+  public:
+  const ::raftRpcProctoc::GroupAppendEntriesReply& entries(int index) const;
+  ::raftRpcProctoc::GroupAppendEntriesReply* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::GroupAppendEntriesReply >&
+      entries() const;
+
+  // @@protoc_insertion_point(class_scope:raftRpcProctoc.BatchAppendEntriesReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::GroupAppendEntriesReply > entries_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// ===================================================================
+
+class raftRpc_Stub;
+
+class raftRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
+ protected:
+  // This class should be treated as an abstract interface.
+  inline raftRpc() {};
+ public:
+  virtual ~raftRpc();
+
+  typedef raftRpc_Stub Stub;
+
+  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
+
+  virtual void AppendEntries(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::AppendEntriesArgs* request,
+                       ::raftRpcProctoc::AppendEntriesReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void InstallSnapshot(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::InstallSnapshotRequest* request,
+                       ::raftRpcProctoc::InstallSnapshotResponse* response,
+                       ::google::protobuf::Closure* done);
+  virtual void RequestVote(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::RequestVoteArgs* request,
+                       ::raftRpcProctoc::RequestVoteReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void RequestPreVote(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::RequestVoteArgs* request,
+                       ::raftRpcProctoc::RequestVoteReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void TimeoutNow(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::TimeoutNowArgs* request,
+                       ::raftRpcProctoc::TimeoutNowReply* response,
+                       ::google::protobuf::Closure* done);
+
+  // implements Service ----------------------------------------------
+
+  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
+  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                  ::PROTOBUF_NAMESPACE_ID::Message* response,
+                  ::google::protobuf::Closure* done);
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+
+ private:
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(raftRpc);
+};
+
+class raftRpc_Stub : public raftRpc {
+ public:
+  raftRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
+  raftRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
+  ~raftRpc_Stub();
+
+  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+
+  // implements raftRpc ------------------------------------------
+
+  void AppendEntries(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::AppendEntriesArgs* request,
+                       ::raftRpcProctoc::AppendEntriesReply* response,
+                       ::google::protobuf::Closure* done);
+  void InstallSnapshot(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::InstallSnapshotRequest* request,
+                       ::raftRpcProctoc::InstallSnapshotResponse* response,
+                       ::google::protobuf::Closure* done);
+  void RequestVote(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::RequestVoteArgs* request,
+                       ::raftRpcProctoc::RequestVoteReply* response,
+                       ::google::protobuf::Closure* done);
+  void RequestPreVote(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::RequestVoteArgs* request,
+                       ::raftRpcProctoc::RequestVoteReply* response,
+                       ::google::protobuf::Closure* done);
+  void TimeoutNow(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::TimeoutNowArgs* request,
+                       ::raftRpcProctoc::TimeoutNowReply* response,
+                       ::google::protobuf::Closure* done);
+ private:
+  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
+  bool owns_channel_;
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(raftRpc_Stub);
+};
+
+
+// -------------------------------------------------------------------
+
+class multiRaftRpc_Stub;
+
+class multiRaftRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
+ protected:
+  // This class should be treated as an abstract interface.
+  inline multiRaftRpc() {};
+ public:
+  virtual ~multiRaftRpc();
+
+  typedef multiRaftRpc_Stub Stub;
+
+  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
+
+  virtual void BatchAppendEntries(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::BatchAppendEntriesArgs* request,
+                       ::raftRpcProctoc::BatchAppendEntriesReply* response,
+                       ::google::protobuf::Closure* done);
+
+  // implements Service ----------------------------------------------
+
+  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
+  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                  ::PROTOBUF_NAMESPACE_ID::Message* response,
+                  ::google::protobuf::Closure* done);
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+
+ private:
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(multiRaftRpc);
+};
+
+class multiRaftRpc_Stub : public multiRaftRpc {
+ public:
+  multiRaftRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
+  multiRaftRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
+  ~multiRaftRpc_Stub();
+
+  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+
+  // implements multiRaftRpc ------------------------------------------
+
+  void BatchAppendEntries(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::BatchAppendEntriesArgs* request,
+                       ::raftRpcProctoc::BatchAppendEntriesReply* response,
+                       ::google::protobuf::Closure* done);
+ private:
+  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
+  bool owns_channel_;
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(multiRaftRpc_Stub);
+};
+
+
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// LogEntry
+
+// bytes Command = 1;
+inline void LogEntry::clear_command() {
+  _impl_.command_.ClearToEmpty();
+}
+inline const std::string& LogEntry::command() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.LogEntry.Command)
+  return _internal_command();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogEntry::set_command(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.command_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.LogEntry.Command)
+}
+inline std::string* LogEntry::mutable_command() {
+  std::string* _s = _internal_mutable_command();
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.LogEntry.Command)
+  return _s;
+}
+inline const std::string& LogEntry::_internal_command() const {
+  return _impl_.command_.Get();
+}
+inline void LogEntry::_internal_set_command(const std::string& value) {
+  
+  _impl_.command_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogEntry::_internal_mutable_command() {
+  
+  return _impl_.command_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogEntry::release_command() {
+  // @@protoc_insertion_point(field_release:raftRpcProctoc.LogEntry.Command)
+  return _impl_.command_.Release();
+}
+inline void LogEntry::set_allocated_command(std::string* command) {
+  if (command != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.command_.SetAllocated(command, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.command_.IsDefault()) {
+    _impl_.command_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.LogEntry.Command)
+}
+
+// int32 LogTerm = 2;
+inline void LogEntry::clear_logterm() {
+  _impl_.logterm_ = 0;
+}
+inline int32_t LogEntry::_internal_logterm() const {
+  return _impl_.logterm_;
+}
+inline int32_t LogEntry::logterm() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.LogEntry.LogTerm)
+  return _internal_logterm();
+}
+inline void LogEntry::_internal_set_logterm(int32_t value) {
+  
+  _impl_.logterm_ = value;
+}
+inline void LogEntry::set_logterm(int32_t value) {
+  _internal_set_logterm(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.LogEntry.LogTerm)
+}
+
+// int32 LogIndex = 3;
+inline void LogEntry::clear_logindex() {
+  _impl_.logindex_ = 0;
+}
+inline int32_t LogEntry::_internal_logindex() const {
+  return _impl_.logindex_;
+}
+inline int32_t LogEntry::logindex() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.LogEntry.LogIndex)
+  return _internal_logindex();
+}
+inline void LogEntry::_internal_set_logindex(int32_t value) {
+  
+  _impl_.logindex_ = value;
+}
+inline void LogEntry::set_logindex(int32_t value) {
+  _internal_set_logindex(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.LogEntry.LogIndex)
+}
+
+// bool ConfChange = 4;
+inline void LogEntry::clear_confchange() {
+  _impl_.confchange_ = false;
+}
+inline bool LogEntry::_internal_confchange() const {
+  return _impl_.confchange_;
+}
+inline bool LogEntry::confchange() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.LogEntry.ConfChange)
+  return _internal_confchange();
+}
+inline void LogEntry::_internal_set_confchange(bool value) {
+  
+  _impl_.confchange_ = value;
+}
+inline void LogEntry::set_confchange(bool value) {
+  _internal_set_confchange(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.LogEntry.ConfChange)
+}
+
+// -------------------------------------------------------------------
 
-// bytes Command = 1;
-inline void LogEntry::clear_command() {
-  command_.ClearToEmpty();
+// Member
+
+// int32 Id = 1;
+inline void Member::clear_id() {
+  _impl_.id_ = 0;
 }
-inline const std::string& LogEntry::command() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.LogEntry.Command)
-  return _internal_command();
+inline int32_t Member::_internal_id() const {
+  return _impl_.id_;
 }
-inline void LogEntry::set_command(const std::string& value) {
-  _internal_set_command(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.LogEntry.Command)
+inline int32_t Member::id() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.Member.Id)
+  return _internal_id();
 }
-inline std::string* LogEntry::mutable_command() {
-  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.LogEntry.Command)
-  return _internal_mutable_command();
+inline void Member::_internal_set_id(int32_t value) {
+  
+  _impl_.id_ = value;
 }
-inline const std::string& LogEntry::_internal_command() const {
-  return command_.Get();
+inline void Member::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.Member.Id)
 }
-inline void LogEntry::_internal_set_command(const std::string& value) {
-  
-  command_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+
+// bytes Ip = 2;
+inline void Member::clear_ip() {
+  _impl_.ip_.ClearToEmpty();
 }
-inline void LogEntry::set_command(std::string&& value) {
-  
-  command_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftRpcProctoc.LogEntry.Command)
+inline const std::string& Member::ip() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.Member.Ip)
+  return _internal_ip();
 }
-inline void LogEntry::set_command(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  command_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:raftRpcProctoc.LogEntry.Command)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Member::set_ip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.ip_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.Member.Ip)
 }
-inline void LogEntry::set_command(const void* value,
-    size_t size) {
+inline std::string* Member::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.Member.Ip)
+  return _s;
+}
+inline const std::string& Member::_internal_ip() const {
+  return _impl_.ip_.Get();
+}
+inline void Member::_internal_set_ip(const std::string& value) {
   
-  command_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftRpcProctoc.LogEntry.Command)
+  _impl_.ip_.Set(value, GetArenaForAllocation());
 }
-inline std::string* LogEntry::_internal_mutable_command() {
+inline std::string* Member::_internal_mutable_ip() {
   
-  return command_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
 }
-inline std::string* LogEntry::release_command() {
-  // @@protoc_insertion_point(field_release:raftRpcProctoc.LogEntry.Command)
-  return command_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* Member::release_ip() {
+  // @@protoc_insertion_point(field_release:raftRpcProctoc.Member.Ip)
+  return _impl_.ip_.Release();
 }
-inline void LogEntry::set_allocated_command(std::string* command) {
-  if (command != nullptr) {
+inline void Member::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
     
   } else {
     
   }
-  command_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), command,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.LogEntry.Command)
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.Member.Ip)
 }
 
-// int32 LogTerm = 2;
-inline void LogEntry::clear_logterm() {
-  logterm_ = 0;
+// int32 Port = 3;
+inline void Member::clear_port() {
+  _impl_.port_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LogEntry::_internal_logterm() const {
-  return logterm_;
+inline int32_t Member::_internal_port() const {
+  return _impl_.port_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LogEntry::logterm() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.LogEntry.LogTerm)
-  return _internal_logterm();
+inline int32_t Member::port() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.Member.Port)
+  return _internal_port();
 }
-inline void LogEntry::_internal_set_logterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void Member::_internal_set_port(int32_t value) {
   
-  logterm_ = value;
+  _impl_.port_ = value;
 }
-inline void LogEntry::set_logterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_logterm(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.LogEntry.LogTerm)
+inline void Member::set_port(int32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.Member.Port)
 }
 
-// int32 LogIndex = 3;
-inline void LogEntry::clear_logindex() {
-  logindex_ = 0;
+// bool Learner = 4;
+inline void Member::clear_learner() {
+  _impl_.learner_ = false;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LogEntry::_internal_logindex() const {
-  return logindex_;
+inline bool Member::_internal_learner() const {
+  return _impl_.learner_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LogEntry::logindex() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.LogEntry.LogIndex)
-  return _internal_logindex();
+inline bool Member::learner() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.Member.Learner)
+  return _internal_learner();
 }
-inline void LogEntry::_internal_set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void Member::_internal_set_learner(bool value) {
   
-  logindex_ = value;
+  _impl_.learner_ = value;
 }
-inline void LogEntry::set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_logindex(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.LogEntry.LogIndex)
+inline void Member::set_learner(bool value) {
+  _internal_set_learner(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.Member.Learner)
+}
+
+// -------------------------------------------------------------------
+
+// ClusterConfig
+
+// repeated .raftRpcProctoc.Member Members = 1;
+inline int ClusterConfig::_internal_members_size() const {
+  return _impl_.members_.size();
+}
+inline int ClusterConfig::members_size() const {
+  return _internal_members_size();
+}
+inline void ClusterConfig::clear_members() {
+  _impl_.members_.Clear();
+}
+inline ::raftRpcProctoc::Member* ClusterConfig::mutable_members(int index) {
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.ClusterConfig.Members)
+  return _impl_.members_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::Member >*
+ClusterConfig::mutable_members() {
+  // @@protoc_insertion_point(field_mutable_list:raftRpcProctoc.ClusterConfig.Members)
+  return &_impl_.members_;
+}
+inline const ::raftRpcProctoc::Member& ClusterConfig::_internal_members(int index) const {
+  return _impl_.members_.Get(index);
+}
+inline const ::raftRpcProctoc::Member& ClusterConfig::members(int index) const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.ClusterConfig.Members)
+  return _internal_members(index);
+}
+inline ::raftRpcProctoc::Member* ClusterConfig::_internal_add_members() {
+  return _impl_.members_.Add();
+}
+inline ::raftRpcProctoc::Member* ClusterConfig::add_members() {
+  ::raftRpcProctoc::Member* _add = _internal_add_members();
+  // @@protoc_insertion_point(field_add:raftRpcProctoc.ClusterConfig.Members)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::Member >&
+ClusterConfig::members() const {
+  // @@protoc_insertion_point(field_list:raftRpcProctoc.ClusterConfig.Members)
+  return _impl_.members_;
 }
 
 // -------------------------------------------------------------------
@@ -1465,139 +3152,140 @@ inline void LogEntry::set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
 // int32 Term = 1;
 inline void AppendEntriesArgs::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_term() const {
-  return term_;
+inline int32_t AppendEntriesArgs::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::term() const {
+inline int32_t AppendEntriesArgs::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.Term)
   return _internal_term();
 }
-inline void AppendEntriesArgs::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::_internal_set_term(int32_t value) {
   
-  term_ = value;
+  _impl_.term_ = value;
 }
-inline void AppendEntriesArgs::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.Term)
 }
 
 // int32 LeaderId = 2;
 inline void AppendEntriesArgs::clear_leaderid() {
-  leaderid_ = 0;
+  _impl_.leaderid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_leaderid() const {
-  return leaderid_;
+inline int32_t AppendEntriesArgs::_internal_leaderid() const {
+  return _impl_.leaderid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::leaderid() const {
+inline int32_t AppendEntriesArgs::leaderid() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.LeaderId)
   return _internal_leaderid();
 }
-inline void AppendEntriesArgs::_internal_set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::_internal_set_leaderid(int32_t value) {
   
-  leaderid_ = value;
+  _impl_.leaderid_ = value;
 }
-inline void AppendEntriesArgs::set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::set_leaderid(int32_t value) {
   _internal_set_leaderid(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.LeaderId)
 }
 
 // int32 PrevLogIndex = 3;
 inline void AppendEntriesArgs::clear_prevlogindex() {
-  prevlogindex_ = 0;
+  _impl_.prevlogindex_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_prevlogindex() const {
-  return prevlogindex_;
+inline int32_t AppendEntriesArgs::_internal_prevlogindex() const {
+  return _impl_.prevlogindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::prevlogindex() const {
+inline int32_t AppendEntriesArgs::prevlogindex() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.PrevLogIndex)
   return _internal_prevlogindex();
 }
-inline void AppendEntriesArgs::_internal_set_prevlogindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::_internal_set_prevlogindex(int32_t value) {
   
-  prevlogindex_ = value;
+  _impl_.prevlogindex_ = value;
 }
-inline void AppendEntriesArgs::set_prevlogindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::set_prevlogindex(int32_t value) {
   _internal_set_prevlogindex(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.PrevLogIndex)
 }
 
 // int32 PrevLogTerm = 4;
 inline void AppendEntriesArgs::clear_prevlogterm() {
-  prevlogterm_ = 0;
+  _impl_.prevlogterm_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_prevlogterm() const {
-  return prevlogterm_;
+inline int32_t AppendEntriesArgs::_internal_prevlogterm() const {
+  return _impl_.prevlogterm_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::prevlogterm() const {
+inline int32_t AppendEntriesArgs::prevlogterm() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.PrevLogTerm)
   return _internal_prevlogterm();
 }
-inline void AppendEntriesArgs::_internal_set_prevlogterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::_internal_set_prevlogterm(int32_t value) {
   
-  prevlogterm_ = value;
+  _impl_.prevlogterm_ = value;
 }
-inline void AppendEntriesArgs::set_prevlogterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::set_prevlogterm(int32_t value) {
   _internal_set_prevlogterm(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.PrevLogTerm)
 }
 
 // repeated .raftRpcProctoc.LogEntry Entries = 5;
 inline int AppendEntriesArgs::_internal_entries_size() const {
-  return entries_.size();
+  return _impl_.entries_.size();
 }
 inline int AppendEntriesArgs::entries_size() const {
   return _internal_entries_size();
 }
 inline void AppendEntriesArgs::clear_entries() {
-  entries_.Clear();
+  _impl_.entries_.Clear();
 }
 inline ::raftRpcProctoc::LogEntry* AppendEntriesArgs::mutable_entries(int index) {
   // @@protoc_insertion_point(field_mutable:raftRpcProctoc.AppendEntriesArgs.Entries)
-  return entries_.Mutable(index);
+  return _impl_.entries_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::LogEntry >*
 AppendEntriesArgs::mutable_entries() {
   // @@protoc_insertion_point(field_mutable_list:raftRpcProctoc.AppendEntriesArgs.Entries)
-  return &entries_;
+  return &_impl_.entries_;
 }
 inline const ::raftRpcProctoc::LogEntry& AppendEntriesArgs::_internal_entries(int index) const {
-  return entries_.Get(index);
+  return _impl_.entries_.Get(index);
 }
 inline const ::raftRpcProctoc::LogEntry& AppendEntriesArgs::entries(int index) const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.Entries)
   return _internal_entries(index);
 }
 inline ::raftRpcProctoc::LogEntry* AppendEntriesArgs::_internal_add_entries() {
-  return entries_.Add();
+  return _impl_.entries_.Add();
 }
 inline ::raftRpcProctoc::LogEntry* AppendEntriesArgs::add_entries() {
+  ::raftRpcProctoc::LogEntry* _add = _internal_add_entries();
   // @@protoc_insertion_point(field_add:raftRpcProctoc.AppendEntriesArgs.Entries)
-  return _internal_add_entries();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::LogEntry >&
 AppendEntriesArgs::entries() const {
   // @@protoc_insertion_point(field_list:raftRpcProctoc.AppendEntriesArgs.Entries)
-  return entries_;
+  return _impl_.entries_;
 }
 
 // int32 LeaderCommit = 6;
 inline void AppendEntriesArgs::clear_leadercommit() {
-  leadercommit_ = 0;
+  _impl_.leadercommit_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_leadercommit() const {
-  return leadercommit_;
+inline int32_t AppendEntriesArgs::_internal_leadercommit() const {
+  return _impl_.leadercommit_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::leadercommit() const {
+inline int32_t AppendEntriesArgs::leadercommit() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.LeaderCommit)
   return _internal_leadercommit();
 }
-inline void AppendEntriesArgs::_internal_set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::_internal_set_leadercommit(int32_t value) {
   
-  leadercommit_ = value;
+  _impl_.leadercommit_ = value;
 }
-inline void AppendEntriesArgs::set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::set_leadercommit(int32_t value) {
   _internal_set_leadercommit(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.LeaderCommit)
 }
@@ -1608,30 +3296,30 @@ inline void AppendEntriesArgs::set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 v
 
 // int32 Term = 1;
 inline void AppendEntriesReply::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::_internal_term() const {
-  return term_;
+inline int32_t AppendEntriesReply::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::term() const {
+inline int32_t AppendEntriesReply::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesReply.Term)
   return _internal_term();
 }
-inline void AppendEntriesReply::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesReply::_internal_set_term(int32_t value) {
   
-  term_ = value;
+  _impl_.term_ = value;
 }
-inline void AppendEntriesReply::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesReply::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesReply.Term)
 }
 
 // bool Success = 2;
 inline void AppendEntriesReply::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
 }
 inline bool AppendEntriesReply::_internal_success() const {
-  return success_;
+  return _impl_.success_;
 }
 inline bool AppendEntriesReply::success() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesReply.Success)
@@ -1639,7 +3327,7 @@ inline bool AppendEntriesReply::success() const {
 }
 inline void AppendEntriesReply::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
 }
 inline void AppendEntriesReply::set_success(bool value) {
   _internal_set_success(value);
@@ -1648,40 +3336,40 @@ inline void AppendEntriesReply::set_success(bool value) {
 
 // int32 UpdateNextIndex = 3;
 inline void AppendEntriesReply::clear_updatenextindex() {
-  updatenextindex_ = 0;
+  _impl_.updatenextindex_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::_internal_updatenextindex() const {
-  return updatenextindex_;
+inline int32_t AppendEntriesReply::_internal_updatenextindex() const {
+  return _impl_.updatenextindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::updatenextindex() const {
+inline int32_t AppendEntriesReply::updatenextindex() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesReply.UpdateNextIndex)
   return _internal_updatenextindex();
 }
-inline void AppendEntriesReply::_internal_set_updatenextindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesReply::_internal_set_updatenextindex(int32_t value) {
   
-  updatenextindex_ = value;
+  _impl_.updatenextindex_ = value;
 }
-inline void AppendEntriesReply::set_updatenextindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesReply::set_updatenextindex(int32_t value) {
   _internal_set_updatenextindex(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesReply.UpdateNextIndex)
 }
 
 // int32 AppState = 4;
 inline void AppendEntriesReply::clear_appstate() {
-  appstate_ = 0;
+  _impl_.appstate_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::_internal_appstate() const {
-  return appstate_;
+inline int32_t AppendEntriesReply::_internal_appstate() const {
+  return _impl_.appstate_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::appstate() const {
+inline int32_t AppendEntriesReply::appstate() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesReply.AppState)
   return _internal_appstate();
 }
-inline void AppendEntriesReply::_internal_set_appstate(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesReply::_internal_set_appstate(int32_t value) {
   
-  appstate_ = value;
+  _impl_.appstate_ = value;
 }
-inline void AppendEntriesReply::set_appstate(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesReply::set_appstate(int32_t value) {
   _internal_set_appstate(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesReply.AppState)
 }
@@ -1692,114 +3380,134 @@ inline void AppendEntriesReply::set_appstate(::PROTOBUF_NAMESPACE_ID::int32 valu
 
 // int32 Term = 1;
 inline void RequestVoteArgs::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::_internal_term() const {
-  return term_;
+inline int32_t RequestVoteArgs::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::term() const {
+inline int32_t RequestVoteArgs::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.Term)
   return _internal_term();
 }
-inline void RequestVoteArgs::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::_internal_set_term(int32_t value) {
   
-  term_ = value;
+  _impl_.term_ = value;
 }
-inline void RequestVoteArgs::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.Term)
 }
 
 // int32 CandidateId = 2;
 inline void RequestVoteArgs::clear_candidateid() {
-  candidateid_ = 0;
+  _impl_.candidateid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::_internal_candidateid() const {
-  return candidateid_;
+inline int32_t RequestVoteArgs::_internal_candidateid() const {
+  return _impl_.candidateid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::candidateid() const {
+inline int32_t RequestVoteArgs::candidateid() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.CandidateId)
   return _internal_candidateid();
 }
-inline void RequestVoteArgs::_internal_set_candidateid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::_internal_set_candidateid(int32_t value) {
   
-  candidateid_ = value;
+  _impl_.candidateid_ = value;
 }
-inline void RequestVoteArgs::set_candidateid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::set_candidateid(int32_t value) {
   _internal_set_candidateid(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.CandidateId)
 }
 
 // int32 LastLogIndex = 3;
 inline void RequestVoteArgs::clear_lastlogindex() {
-  lastlogindex_ = 0;
+  _impl_.lastlogindex_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::_internal_lastlogindex() const {
-  return lastlogindex_;
+inline int32_t RequestVoteArgs::_internal_lastlogindex() const {
+  return _impl_.lastlogindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::lastlogindex() const {
+inline int32_t RequestVoteArgs::lastlogindex() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.LastLogIndex)
   return _internal_lastlogindex();
 }
-inline void RequestVoteArgs::_internal_set_lastlogindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::_internal_set_lastlogindex(int32_t value) {
   
-  lastlogindex_ = value;
+  _impl_.lastlogindex_ = value;
 }
-inline void RequestVoteArgs::set_lastlogindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::set_lastlogindex(int32_t value) {
   _internal_set_lastlogindex(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.LastLogIndex)
 }
 
 // int32 LastLogTerm = 4;
 inline void RequestVoteArgs::clear_lastlogterm() {
-  lastlogterm_ = 0;
+  _impl_.lastlogterm_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::_internal_lastlogterm() const {
-  return lastlogterm_;
+inline int32_t RequestVoteArgs::_internal_lastlogterm() const {
+  return _impl_.lastlogterm_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::lastlogterm() const {
+inline int32_t RequestVoteArgs::lastlogterm() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.LastLogTerm)
   return _internal_lastlogterm();
 }
-inline void RequestVoteArgs::_internal_set_lastlogterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::_internal_set_lastlogterm(int32_t value) {
   
-  lastlogterm_ = value;
+  _impl_.lastlogterm_ = value;
 }
-inline void RequestVoteArgs::set_lastlogterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::set_lastlogterm(int32_t value) {
   _internal_set_lastlogterm(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.LastLogTerm)
 }
 
+// bool LeadershipTransfer = 5;
+inline void RequestVoteArgs::clear_leadershiptransfer() {
+  _impl_.leadershiptransfer_ = false;
+}
+inline bool RequestVoteArgs::_internal_leadershiptransfer() const {
+  return _impl_.leadershiptransfer_;
+}
+inline bool RequestVoteArgs::leadershiptransfer() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.LeadershipTransfer)
+  return _internal_leadershiptransfer();
+}
+inline void RequestVoteArgs::_internal_set_leadershiptransfer(bool value) {
+  
+  _impl_.leadershiptransfer_ = value;
+}
+inline void RequestVoteArgs::set_leadershiptransfer(bool value) {
+  _internal_set_leadershiptransfer(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.LeadershipTransfer)
+}
+
 // -------------------------------------------------------------------
 
 // RequestVoteReply
 
 // int32 Term = 1;
 inline void RequestVoteReply::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteReply::_internal_term() const {
-  return term_;
+inline int32_t RequestVoteReply::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteReply::term() const {
+inline int32_t RequestVoteReply::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteReply.Term)
   return _internal_term();
 }
-inline void RequestVoteReply::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteReply::_internal_set_term(int32_t value) {
   
-  term_ = value;
+  _impl_.term_ = value;
 }
-inline void RequestVoteReply::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteReply::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteReply.Term)
 }
 
 // bool VoteGranted = 2;
 inline void RequestVoteReply::clear_votegranted() {
-  votegranted_ = false;
+  _impl_.votegranted_ = false;
 }
 inline bool RequestVoteReply::_internal_votegranted() const {
-  return votegranted_;
+  return _impl_.votegranted_;
 }
 inline bool RequestVoteReply::votegranted() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteReply.VoteGranted)
@@ -1807,7 +3515,7 @@ inline bool RequestVoteReply::votegranted() const {
 }
 inline void RequestVoteReply::_internal_set_votegranted(bool value) {
   
-  votegranted_ = value;
+  _impl_.votegranted_ = value;
 }
 inline void RequestVoteReply::set_votegranted(bool value) {
   _internal_set_votegranted(value);
@@ -1816,20 +3524,20 @@ inline void RequestVoteReply::set_votegranted(bool value) {
 
 // int32 VoteState = 3;
 inline void RequestVoteReply::clear_votestate() {
-  votestate_ = 0;
+  _impl_.votestate_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteReply::_internal_votestate() const {
-  return votestate_;
+inline int32_t RequestVoteReply::_internal_votestate() const {
+  return _impl_.votestate_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteReply::votestate() const {
+inline int32_t RequestVoteReply::votestate() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteReply.VoteState)
   return _internal_votestate();
 }
-inline void RequestVoteReply::_internal_set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteReply::_internal_set_votestate(int32_t value) {
   
-  votestate_ = value;
+  _impl_.votestate_ = value;
 }
-inline void RequestVoteReply::set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteReply::set_votestate(int32_t value) {
   _internal_set_votestate(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteReply.VoteState)
 }
@@ -1840,133 +3548,118 @@ inline void RequestVoteReply::set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value
 
 // int32 LeaderId = 1;
 inline void InstallSnapshotRequest::clear_leaderid() {
-  leaderid_ = 0;
+  _impl_.leaderid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::_internal_leaderid() const {
-  return leaderid_;
+inline int32_t InstallSnapshotRequest::_internal_leaderid() const {
+  return _impl_.leaderid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::leaderid() const {
+inline int32_t InstallSnapshotRequest::leaderid() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.LeaderId)
   return _internal_leaderid();
 }
-inline void InstallSnapshotRequest::_internal_set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::_internal_set_leaderid(int32_t value) {
   
-  leaderid_ = value;
+  _impl_.leaderid_ = value;
 }
-inline void InstallSnapshotRequest::set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::set_leaderid(int32_t value) {
   _internal_set_leaderid(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.LeaderId)
 }
 
 // int32 Term = 2;
 inline void InstallSnapshotRequest::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::_internal_term() const {
-  return term_;
+inline int32_t InstallSnapshotRequest::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::term() const {
+inline int32_t InstallSnapshotRequest::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.Term)
   return _internal_term();
 }
-inline void InstallSnapshotRequest::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::_internal_set_term(int32_t value) {
   
-  term_ = value;
+  _impl_.term_ = value;
 }
-inline void InstallSnapshotRequest::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.Term)
 }
 
 // int32 LastSnapShotIncludeIndex = 3;
 inline void InstallSnapshotRequest::clear_lastsnapshotincludeindex() {
-  lastsnapshotincludeindex_ = 0;
+  _impl_.lastsnapshotincludeindex_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::_internal_lastsnapshotincludeindex() const {
-  return lastsnapshotincludeindex_;
+inline int32_t InstallSnapshotRequest::_internal_lastsnapshotincludeindex() const {
+  return _impl_.lastsnapshotincludeindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::lastsnapshotincludeindex() const {
+inline int32_t InstallSnapshotRequest::lastsnapshotincludeindex() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.LastSnapShotIncludeIndex)
   return _internal_lastsnapshotincludeindex();
 }
-inline void InstallSnapshotRequest::_internal_set_lastsnapshotincludeindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::_internal_set_lastsnapshotincludeindex(int32_t value) {
   
-  lastsnapshotincludeindex_ = value;
+  _impl_.lastsnapshotincludeindex_ = value;
 }
-inline void InstallSnapshotRequest::set_lastsnapshotincludeindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::set_lastsnapshotincludeindex(int32_t value) {
   _internal_set_lastsnapshotincludeindex(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.LastSnapShotIncludeIndex)
 }
 
 // int32 LastSnapShotIncludeTerm = 4;
 inline void InstallSnapshotRequest::clear_lastsnapshotincludeterm() {
-  lastsnapshotincludeterm_ = 0;
+  _impl_.lastsnapshotincludeterm_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::_internal_lastsnapshotincludeterm() const {
-  return lastsnapshotincludeterm_;
+inline int32_t InstallSnapshotRequest::_internal_lastsnapshotincludeterm() const {
+  return _impl_.lastsnapshotincludeterm_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::lastsnapshotincludeterm() const {
+inline int32_t InstallSnapshotRequest::lastsnapshotincludeterm() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.LastSnapShotIncludeTerm)
   return _internal_lastsnapshotincludeterm();
 }
-inline void InstallSnapshotRequest::_internal_set_lastsnapshotincludeterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::_internal_set_lastsnapshotincludeterm(int32_t value) {
   
-  lastsnapshotincludeterm_ = value;
+  _impl_.lastsnapshotincludeterm_ = value;
 }
-inline void InstallSnapshotRequest::set_lastsnapshotincludeterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::set_lastsnapshotincludeterm(int32_t value) {
   _internal_set_lastsnapshotincludeterm(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.LastSnapShotIncludeTerm)
 }
 
 // bytes Data = 5;
 inline void InstallSnapshotRequest::clear_data() {
-  data_.ClearToEmpty();
+  _impl_.data_.ClearToEmpty();
 }
 inline const std::string& InstallSnapshotRequest::data() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.Data)
   return _internal_data();
 }
-inline void InstallSnapshotRequest::set_data(const std::string& value) {
-  _internal_set_data(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InstallSnapshotRequest::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.Data)
 }
 inline std::string* InstallSnapshotRequest::mutable_data() {
+  std::string* _s = _internal_mutable_data();
   // @@protoc_insertion_point(field_mutable:raftRpcProctoc.InstallSnapshotRequest.Data)
-  return _internal_mutable_data();
+  return _s;
 }
 inline const std::string& InstallSnapshotRequest::_internal_data() const {
-  return data_.Get();
+  return _impl_.data_.Get();
 }
 inline void InstallSnapshotRequest::_internal_set_data(const std::string& value) {
   
-  data_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void InstallSnapshotRequest::set_data(std::string&& value) {
-  
-  data_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftRpcProctoc.InstallSnapshotRequest.Data)
-}
-inline void InstallSnapshotRequest::set_data(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  data_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:raftRpcProctoc.InstallSnapshotRequest.Data)
-}
-inline void InstallSnapshotRequest::set_data(const void* value,
-    size_t size) {
-  
-  data_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftRpcProctoc.InstallSnapshotRequest.Data)
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
 inline std::string* InstallSnapshotRequest::_internal_mutable_data() {
   
-  return data_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
 inline std::string* InstallSnapshotRequest::release_data() {
   // @@protoc_insertion_point(field_release:raftRpcProctoc.InstallSnapshotRequest.Data)
-  return data_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.data_.Release();
 }
 inline void InstallSnapshotRequest::set_allocated_data(std::string* data) {
   if (data != nullptr) {
@@ -1974,35 +3667,513 @@ inline void InstallSnapshotRequest::set_allocated_data(std::string* data) {
   } else {
     
   }
-  data_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data,
-      GetArena());
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.InstallSnapshotRequest.Data)
 }
 
+// .raftRpcProctoc.ClusterConfig Config = 6;
+inline bool InstallSnapshotRequest::_internal_has_config() const {
+  return this != internal_default_instance() && _impl_.config_ != nullptr;
+}
+inline bool InstallSnapshotRequest::has_config() const {
+  return _internal_has_config();
+}
+inline void InstallSnapshotRequest::clear_config() {
+  if (GetArenaForAllocation() == nullptr && _impl_.config_ != nullptr) {
+    delete _impl_.config_;
+  }
+  _impl_.config_ = nullptr;
+}
+inline const ::raftRpcProctoc::ClusterConfig& InstallSnapshotRequest::_internal_config() const {
+  const ::raftRpcProctoc::ClusterConfig* p = _impl_.config_;
+  return p != nullptr ? *p : reinterpret_cast<const ::raftRpcProctoc::ClusterConfig&>(
+      ::raftRpcProctoc::_ClusterConfig_default_instance_);
+}
+inline const ::raftRpcProctoc::ClusterConfig& InstallSnapshotRequest::config() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.Config)
+  return _internal_config();
+}
+inline void InstallSnapshotRequest::unsafe_arena_set_allocated_config(
+    ::raftRpcProctoc::ClusterConfig* config) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.config_);
+  }
+  _impl_.config_ = config;
+  if (config) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftRpcProctoc.InstallSnapshotRequest.Config)
+}
+inline ::raftRpcProctoc::ClusterConfig* InstallSnapshotRequest::release_config() {
+  
+  ::raftRpcProctoc::ClusterConfig* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::raftRpcProctoc::ClusterConfig* InstallSnapshotRequest::unsafe_arena_release_config() {
+  // @@protoc_insertion_point(field_release:raftRpcProctoc.InstallSnapshotRequest.Config)
+  
+  ::raftRpcProctoc::ClusterConfig* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
+  return temp;
+}
+inline ::raftRpcProctoc::ClusterConfig* InstallSnapshotRequest::_internal_mutable_config() {
+  
+  if (_impl_.config_ == nullptr) {
+    auto* p = CreateMaybeMessage<::raftRpcProctoc::ClusterConfig>(GetArenaForAllocation());
+    _impl_.config_ = p;
+  }
+  return _impl_.config_;
+}
+inline ::raftRpcProctoc::ClusterConfig* InstallSnapshotRequest::mutable_config() {
+  ::raftRpcProctoc::ClusterConfig* _msg = _internal_mutable_config();
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.InstallSnapshotRequest.Config)
+  return _msg;
+}
+inline void InstallSnapshotRequest::set_allocated_config(::raftRpcProctoc::ClusterConfig* config) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.config_;
+  }
+  if (config) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(config);
+    if (message_arena != submessage_arena) {
+      config = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, config, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.config_ = config;
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.InstallSnapshotRequest.Config)
+}
+
 // -------------------------------------------------------------------
 
 // InstallSnapshotResponse
 
 // int32 Term = 1;
 inline void InstallSnapshotResponse::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotResponse::_internal_term() const {
-  return term_;
+inline int32_t InstallSnapshotResponse::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotResponse::term() const {
+inline int32_t InstallSnapshotResponse::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotResponse.Term)
   return _internal_term();
 }
-inline void InstallSnapshotResponse::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotResponse::_internal_set_term(int32_t value) {
   
-  term_ = value;
+  _impl_.term_ = value;
 }
-inline void InstallSnapshotResponse::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotResponse::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotResponse.Term)
 }
 
+// -------------------------------------------------------------------
+
+// TimeoutNowArgs
+
+// int32 Term = 1;
+inline void TimeoutNowArgs::clear_term() {
+  _impl_.term_ = 0;
+}
+inline int32_t TimeoutNowArgs::_internal_term() const {
+  return _impl_.term_;
+}
+inline int32_t TimeoutNowArgs::term() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.TimeoutNowArgs.Term)
+  return _internal_term();
+}
+inline void TimeoutNowArgs::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void TimeoutNowArgs::set_term(int32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.TimeoutNowArgs.Term)
+}
+
+// int32 LeaderId = 2;
+inline void TimeoutNowArgs::clear_leaderid() {
+  _impl_.leaderid_ = 0;
+}
+inline int32_t TimeoutNowArgs::_internal_leaderid() const {
+  return _impl_.leaderid_;
+}
+inline int32_t TimeoutNowArgs::leaderid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.TimeoutNowArgs.LeaderId)
+  return _internal_leaderid();
+}
+inline void TimeoutNowArgs::_internal_set_leaderid(int32_t value) {
+  
+  _impl_.leaderid_ = value;
+}
+inline void TimeoutNowArgs::set_leaderid(int32_t value) {
+  _internal_set_leaderid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.TimeoutNowArgs.LeaderId)
+}
+
+// -------------------------------------------------------------------
+
+// TimeoutNowReply
+
+// int32 Term = 1;
+inline void TimeoutNowReply::clear_term() {
+  _impl_.term_ = 0;
+}
+inline int32_t TimeoutNowReply::_internal_term() const {
+  return _impl_.term_;
+}
+inline int32_t TimeoutNowReply::term() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.TimeoutNowReply.Term)
+  return _internal_term();
+}
+inline void TimeoutNowReply::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void TimeoutNowReply::set_term(int32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.TimeoutNowReply.Term)
+}
+
+// -------------------------------------------------------------------
+
+// GroupAppendEntriesArgs
+
+// uint32 GroupId = 1;
+inline void GroupAppendEntriesArgs::clear_groupid() {
+  _impl_.groupid_ = 0u;
+}
+inline uint32_t GroupAppendEntriesArgs::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline uint32_t GroupAppendEntriesArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.GroupAppendEntriesArgs.GroupId)
+  return _internal_groupid();
+}
+inline void GroupAppendEntriesArgs::_internal_set_groupid(uint32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void GroupAppendEntriesArgs::set_groupid(uint32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.GroupAppendEntriesArgs.GroupId)
+}
+
+// .raftRpcProctoc.AppendEntriesArgs Args = 2;
+inline bool GroupAppendEntriesArgs::_internal_has_args() const {
+  return this != internal_default_instance() && _impl_.args_ != nullptr;
+}
+inline bool GroupAppendEntriesArgs::has_args() const {
+  return _internal_has_args();
+}
+inline void GroupAppendEntriesArgs::clear_args() {
+  if (GetArenaForAllocation() == nullptr && _impl_.args_ != nullptr) {
+    delete _impl_.args_;
+  }
+  _impl_.args_ = nullptr;
+}
+inline const ::raftRpcProctoc::AppendEntriesArgs& GroupAppendEntriesArgs::_internal_args() const {
+  const ::raftRpcProctoc::AppendEntriesArgs* p = _impl_.args_;
+  return p != nullptr ? *p : reinterpret_cast<const ::raftRpcProctoc::AppendEntriesArgs&>(
+      ::raftRpcProctoc::_AppendEntriesArgs_default_instance_);
+}
+inline const ::raftRpcProctoc::AppendEntriesArgs& GroupAppendEntriesArgs::args() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.GroupAppendEntriesArgs.Args)
+  return _internal_args();
+}
+inline void GroupAppendEntriesArgs::unsafe_arena_set_allocated_args(
+    ::raftRpcProctoc::AppendEntriesArgs* args) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.args_);
+  }
+  _impl_.args_ = args;
+  if (args) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftRpcProctoc.GroupAppendEntriesArgs.Args)
+}
+inline ::raftRpcProctoc::AppendEntriesArgs* GroupAppendEntriesArgs::release_args() {
+  
+  ::raftRpcProctoc::AppendEntriesArgs* temp = _impl_.args_;
+  _impl_.args_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::raftRpcProctoc::AppendEntriesArgs* GroupAppendEntriesArgs::unsafe_arena_release_args() {
+  // @@protoc_insertion_point(field_release:raftRpcProctoc.GroupAppendEntriesArgs.Args)
+  
+  ::raftRpcProctoc::AppendEntriesArgs* temp = _impl_.args_;
+  _impl_.args_ = nullptr;
+  return temp;
+}
+inline ::raftRpcProctoc::AppendEntriesArgs* GroupAppendEntriesArgs::_internal_mutable_args() {
+  
+  if (_impl_.args_ == nullptr) {
+    auto* p = CreateMaybeMessage<::raftRpcProctoc::AppendEntriesArgs>(GetArenaForAllocation());
+    _impl_.args_ = p;
+  }
+  return _impl_.args_;
+}
+inline ::raftRpcProctoc::AppendEntriesArgs* GroupAppendEntriesArgs::mutable_args() {
+  ::raftRpcProctoc::AppendEntriesArgs* _msg = _internal_mutable_args();
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.GroupAppendEntriesArgs.Args)
+  return _msg;
+}
+inline void GroupAppendEntriesArgs::set_allocated_args(::raftRpcProctoc::AppendEntriesArgs* args) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.args_;
+  }
+  if (args) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(args);
+    if (message_arena != submessage_arena) {
+      args = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, args, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.args_ = args;
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.GroupAppendEntriesArgs.Args)
+}
+
+// -------------------------------------------------------------------
+
+// GroupAppendEntriesReply
+
+// uint32 GroupId = 1;
+inline void GroupAppendEntriesReply::clear_groupid() {
+  _impl_.groupid_ = 0u;
+}
+inline uint32_t GroupAppendEntriesReply::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline uint32_t GroupAppendEntriesReply::groupid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.GroupAppendEntriesReply.GroupId)
+  return _internal_groupid();
+}
+inline void GroupAppendEntriesReply::_internal_set_groupid(uint32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void GroupAppendEntriesReply::set_groupid(uint32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.GroupAppendEntriesReply.GroupId)
+}
+
+// .raftRpcProctoc.AppendEntriesReply Reply = 2;
+inline bool GroupAppendEntriesReply::_internal_has_reply() const {
+  return this != internal_default_instance() && _impl_.reply_ != nullptr;
+}
+inline bool GroupAppendEntriesReply::has_reply() const {
+  return _internal_has_reply();
+}
+inline void GroupAppendEntriesReply::clear_reply() {
+  if (GetArenaForAllocation() == nullptr && _impl_.reply_ != nullptr) {
+    delete _impl_.reply_;
+  }
+  _impl_.reply_ = nullptr;
+}
+inline const ::raftRpcProctoc::AppendEntriesReply& GroupAppendEntriesReply::_internal_reply() const {
+  const ::raftRpcProctoc::AppendEntriesReply* p = _impl_.reply_;
+  return p != nullptr ? *p : reinterpret_cast<const ::raftRpcProctoc::AppendEntriesReply&>(
+      ::raftRpcProctoc::_AppendEntriesReply_default_instance_);
+}
+inline const ::raftRpcProctoc::AppendEntriesReply& GroupAppendEntriesReply::reply() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.GroupAppendEntriesReply.Reply)
+  return _internal_reply();
+}
+inline void GroupAppendEntriesReply::unsafe_arena_set_allocated_reply(
+    ::raftRpcProctoc::AppendEntriesReply* reply) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.reply_);
+  }
+  _impl_.reply_ = reply;
+  if (reply) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftRpcProctoc.GroupAppendEntriesReply.Reply)
+}
+inline ::raftRpcProctoc::AppendEntriesReply* GroupAppendEntriesReply::release_reply() {
+  
+  ::raftRpcProctoc::AppendEntriesReply* temp = _impl_.reply_;
+  _impl_.reply_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::raftRpcProctoc::AppendEntriesReply* GroupAppendEntriesReply::unsafe_arena_release_reply() {
+  // @@protoc_insertion_point(field_release:raftRpcProctoc.GroupAppendEntriesReply.Reply)
+  
+  ::raftRpcProctoc::AppendEntriesReply* temp = _impl_.reply_;
+  _impl_.reply_ = nullptr;
+  return temp;
+}
+inline ::raftRpcProctoc::AppendEntriesReply* GroupAppendEntriesReply::_internal_mutable_reply() {
+  
+  if (_impl_.reply_ == nullptr) {
+    auto* p = CreateMaybeMessage<::raftRpcProctoc::AppendEntriesReply>(GetArenaForAllocation());
+    _impl_.reply_ = p;
+  }
+  return _impl_.reply_;
+}
+inline ::raftRpcProctoc::AppendEntriesReply* GroupAppendEntriesReply::mutable_reply() {
+  ::raftRpcProctoc::AppendEntriesReply* _msg = _internal_mutable_reply();
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.GroupAppendEntriesReply.Reply)
+  return _msg;
+}
+inline void GroupAppendEntriesReply::set_allocated_reply(::raftRpcProctoc::AppendEntriesReply* reply) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.reply_;
+  }
+  if (reply) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reply);
+    if (message_arena != submessage_arena) {
+      reply = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reply, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.reply_ = reply;
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.GroupAppendEntriesReply.Reply)
+}
+
+// -------------------------------------------------------------------
+
+// BatchAppendEntriesArgs
+
+// repeated .raftRpcProctoc.GroupAppendEntriesArgs Entries = 1;
+inline int BatchAppendEntriesArgs::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int BatchAppendEntriesArgs::entries_size() const {
+  return _internal_entries_size();
+}
+inline void BatchAppendEntriesArgs::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::raftRpcProctoc::GroupAppendEntriesArgs* BatchAppendEntriesArgs::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.BatchAppendEntriesArgs.Entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::GroupAppendEntriesArgs >*
+BatchAppendEntriesArgs::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:raftRpcProctoc.BatchAppendEntriesArgs.Entries)
+  return &_impl_.entries_;
+}
+inline const ::raftRpcProctoc::GroupAppendEntriesArgs& BatchAppendEntriesArgs::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::raftRpcProctoc::GroupAppendEntriesArgs& BatchAppendEntriesArgs::entries(int index) const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.BatchAppendEntriesArgs.Entries)
+  return _internal_entries(index);
+}
+inline ::raftRpcProctoc::GroupAppendEntriesArgs* BatchAppendEntriesArgs::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::raftRpcProctoc::GroupAppendEntriesArgs* BatchAppendEntriesArgs::add_entries() {
+  ::raftRpcProctoc::GroupAppendEntriesArgs* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:raftRpcProctoc.BatchAppendEntriesArgs.Entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::GroupAppendEntriesArgs >&
+BatchAppendEntriesArgs::entries() const {
+  // @@protoc_insertion_point(field_list:raftRpcProctoc.BatchAppendEntriesArgs.Entries)
+  return _impl_.entries_;
+}
+
+// -------------------------------------------------------------------
+
+// BatchAppendEntriesReply
+
+// repeated .raftRpcProctoc.GroupAppendEntriesReply Entries = 1;
+inline int BatchAppendEntriesReply::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int BatchAppendEntriesReply::entries_size() const {
+  return _internal_entries_size();
+}
+inline void BatchAppendEntriesReply::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::raftRpcProctoc::GroupAppendEntriesReply* BatchAppendEntriesReply::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.BatchAppendEntriesReply.Entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::GroupAppendEntriesReply >*
+BatchAppendEntriesReply::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:raftRpcProctoc.BatchAppendEntriesReply.Entries)
+  return &_impl_.entries_;
+}
+inline const ::raftRpcProctoc::GroupAppendEntriesReply& BatchAppendEntriesReply::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::raftRpcProctoc::GroupAppendEntriesReply& BatchAppendEntriesReply::entries(int index) const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.BatchAppendEntriesReply.Entries)
+  return _internal_entries(index);
+}
+inline ::raftRpcProctoc::GroupAppendEntriesReply* BatchAppendEntriesReply::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::raftRpcProctoc::GroupAppendEntriesReply* BatchAppendEntriesReply::add_entries() {
+  ::raftRpcProctoc::GroupAppendEntriesReply* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:raftRpcProctoc.BatchAppendEntriesReply.Entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::GroupAppendEntriesReply >&
+BatchAppendEntriesReply::entries() const {
+  // @@protoc_insertion_point(field_list:raftRpcProctoc.BatchAppendEntriesReply.Entries)
+  return _impl_.entries_;
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -2018,6 +4189,22 @@ inline void InstallSnapshotResponse::set_term(::PROTOBUF_NAMESPACE_ID::int32 val
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
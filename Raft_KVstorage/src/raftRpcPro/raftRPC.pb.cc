@@ -14,264 +14,478 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_raftRPC_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_LogEntry_raftRPC_2eproto;
-namespace raftRpcProctoc {
-class LogEntryDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<LogEntry> _instance;
-} _LogEntry_default_instance_;
-class AppendEntriesArgsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AppendEntriesArgs> _instance;
-} _AppendEntriesArgs_default_instance_;
-class AppendEntriesReplyDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AppendEntriesReply> _instance;
-} _AppendEntriesReply_default_instance_;
-class RequestVoteArgsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RequestVoteArgs> _instance;
-} _RequestVoteArgs_default_instance_;
-class RequestVoteReplyDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RequestVoteReply> _instance;
-} _RequestVoteReply_default_instance_;
-class InstallSnapshotRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<InstallSnapshotRequest> _instance;
-} _InstallSnapshotRequest_default_instance_;
-class InstallSnapshotResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<InstallSnapshotResponse> _instance;
-} _InstallSnapshotResponse_default_instance_;
-}  // namespace raftRpcProctoc
-static void InitDefaultsscc_info_AppendEntriesArgs_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProctoc::_AppendEntriesArgs_default_instance_;
-    new (ptr) ::raftRpcProctoc::AppendEntriesArgs();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_AppendEntriesArgs_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_AppendEntriesArgs_raftRPC_2eproto}, {
-      &scc_info_LogEntry_raftRPC_2eproto.base,}};
-
-static void InitDefaultsscc_info_AppendEntriesReply_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProctoc::_AppendEntriesReply_default_instance_;
-    new (ptr) ::raftRpcProctoc::AppendEntriesReply();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AppendEntriesReply_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_AppendEntriesReply_raftRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_InstallSnapshotRequest_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProctoc::_InstallSnapshotRequest_default_instance_;
-    new (ptr) ::raftRpcProctoc::InstallSnapshotRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_InstallSnapshotRequest_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_InstallSnapshotRequest_raftRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_InstallSnapshotResponse_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProctoc::_InstallSnapshotResponse_default_instance_;
-    new (ptr) ::raftRpcProctoc::InstallSnapshotResponse();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_InstallSnapshotResponse_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_InstallSnapshotResponse_raftRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_LogEntry_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProctoc::_LogEntry_default_instance_;
-    new (ptr) ::raftRpcProctoc::LogEntry();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_LogEntry_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_LogEntry_raftRPC_2eproto}, {}};
+PROTOBUF_PRAGMA_INIT_SEG
 
-static void InitDefaultsscc_info_RequestVoteArgs_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-  {
-    void* ptr = &::raftRpcProctoc::_RequestVoteArgs_default_instance_;
-    new (ptr) ::raftRpcProctoc::RequestVoteArgs();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RequestVoteArgs_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_RequestVoteArgs_raftRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_RequestVoteReply_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProctoc::_RequestVoteReply_default_instance_;
-    new (ptr) ::raftRpcProctoc::RequestVoteReply();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RequestVoteReply_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_RequestVoteReply_raftRPC_2eproto}, {}};
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_raftRPC_2eproto[7];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_raftRPC_2eproto = nullptr;
-static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* file_level_service_descriptors_raftRPC_2eproto[1];
+namespace raftRpcProctoc {
+PROTOBUF_CONSTEXPR LogEntry::LogEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.command_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.logterm_)*/0
+  , /*decltype(_impl_.logindex_)*/0
+  , /*decltype(_impl_.confchange_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LogEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogEntryDefaultTypeInternal() {}
+  union {
+    LogEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogEntryDefaultTypeInternal _LogEntry_default_instance_;
+PROTOBUF_CONSTEXPR Member::Member(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.port_)*/0
+  , /*decltype(_impl_.learner_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MemberDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MemberDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MemberDefaultTypeInternal() {}
+  union {
+    Member _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MemberDefaultTypeInternal _Member_default_instance_;
+PROTOBUF_CONSTEXPR ClusterConfig::ClusterConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.members_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ClusterConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ClusterConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ClusterConfigDefaultTypeInternal() {}
+  union {
+    ClusterConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClusterConfigDefaultTypeInternal _ClusterConfig_default_instance_;
+PROTOBUF_CONSTEXPR AppendEntriesArgs::AppendEntriesArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_.prevlogindex_)*/0
+  , /*decltype(_impl_.prevlogterm_)*/0
+  , /*decltype(_impl_.leadercommit_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AppendEntriesArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AppendEntriesArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AppendEntriesArgsDefaultTypeInternal() {}
+  union {
+    AppendEntriesArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AppendEntriesArgsDefaultTypeInternal _AppendEntriesArgs_default_instance_;
+PROTOBUF_CONSTEXPR AppendEntriesReply::AppendEntriesReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.updatenextindex_)*/0
+  , /*decltype(_impl_.appstate_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AppendEntriesReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AppendEntriesReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AppendEntriesReplyDefaultTypeInternal() {}
+  union {
+    AppendEntriesReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AppendEntriesReplyDefaultTypeInternal _AppendEntriesReply_default_instance_;
+PROTOBUF_CONSTEXPR RequestVoteArgs::RequestVoteArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.candidateid_)*/0
+  , /*decltype(_impl_.lastlogindex_)*/0
+  , /*decltype(_impl_.lastlogterm_)*/0
+  , /*decltype(_impl_.leadershiptransfer_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RequestVoteArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestVoteArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestVoteArgsDefaultTypeInternal() {}
+  union {
+    RequestVoteArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestVoteArgsDefaultTypeInternal _RequestVoteArgs_default_instance_;
+PROTOBUF_CONSTEXPR RequestVoteReply::RequestVoteReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.votegranted_)*/false
+  , /*decltype(_impl_.votestate_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RequestVoteReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestVoteReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestVoteReplyDefaultTypeInternal() {}
+  union {
+    RequestVoteReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestVoteReplyDefaultTypeInternal _RequestVoteReply_default_instance_;
+PROTOBUF_CONSTEXPR InstallSnapshotRequest::InstallSnapshotRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.config_)*/nullptr
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.lastsnapshotincludeindex_)*/0
+  , /*decltype(_impl_.lastsnapshotincludeterm_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InstallSnapshotRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InstallSnapshotRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InstallSnapshotRequestDefaultTypeInternal() {}
+  union {
+    InstallSnapshotRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InstallSnapshotRequestDefaultTypeInternal _InstallSnapshotRequest_default_instance_;
+PROTOBUF_CONSTEXPR InstallSnapshotResponse::InstallSnapshotResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InstallSnapshotResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InstallSnapshotResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InstallSnapshotResponseDefaultTypeInternal() {}
+  union {
+    InstallSnapshotResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InstallSnapshotResponseDefaultTypeInternal _InstallSnapshotResponse_default_instance_;
+PROTOBUF_CONSTEXPR TimeoutNowArgs::TimeoutNowArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TimeoutNowArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TimeoutNowArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TimeoutNowArgsDefaultTypeInternal() {}
+  union {
+    TimeoutNowArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TimeoutNowArgsDefaultTypeInternal _TimeoutNowArgs_default_instance_;
+PROTOBUF_CONSTEXPR TimeoutNowReply::TimeoutNowReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TimeoutNowReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TimeoutNowReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TimeoutNowReplyDefaultTypeInternal() {}
+  union {
+    TimeoutNowReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TimeoutNowReplyDefaultTypeInternal _TimeoutNowReply_default_instance_;
+PROTOBUF_CONSTEXPR GroupAppendEntriesArgs::GroupAppendEntriesArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.args_)*/nullptr
+  , /*decltype(_impl_.groupid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GroupAppendEntriesArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GroupAppendEntriesArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GroupAppendEntriesArgsDefaultTypeInternal() {}
+  union {
+    GroupAppendEntriesArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GroupAppendEntriesArgsDefaultTypeInternal _GroupAppendEntriesArgs_default_instance_;
+PROTOBUF_CONSTEXPR GroupAppendEntriesReply::GroupAppendEntriesReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.reply_)*/nullptr
+  , /*decltype(_impl_.groupid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GroupAppendEntriesReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GroupAppendEntriesReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GroupAppendEntriesReplyDefaultTypeInternal() {}
+  union {
+    GroupAppendEntriesReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GroupAppendEntriesReplyDefaultTypeInternal _GroupAppendEntriesReply_default_instance_;
+PROTOBUF_CONSTEXPR BatchAppendEntriesArgs::BatchAppendEntriesArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchAppendEntriesArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchAppendEntriesArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchAppendEntriesArgsDefaultTypeInternal() {}
+  union {
+    BatchAppendEntriesArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchAppendEntriesArgsDefaultTypeInternal _BatchAppendEntriesArgs_default_instance_;
+PROTOBUF_CONSTEXPR BatchAppendEntriesReply::BatchAppendEntriesReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchAppendEntriesReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchAppendEntriesReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchAppendEntriesReplyDefaultTypeInternal() {}
+  union {
+    BatchAppendEntriesReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchAppendEntriesReplyDefaultTypeInternal _BatchAppendEntriesReply_default_instance_;
+}  // namespace raftRpcProctoc
+static ::_pb::Metadata file_level_metadata_raftRPC_2eproto[15];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_raftRPC_2eproto = nullptr;
+static const ::_pb::ServiceDescriptor* file_level_service_descriptors_raftRPC_2eproto[2];
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_raftRPC_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_raftRPC_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::LogEntry, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::LogEntry, command_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::LogEntry, logterm_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::LogEntry, logindex_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::LogEntry, _impl_.command_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::LogEntry, _impl_.logterm_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::LogEntry, _impl_.logindex_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::LogEntry, _impl_.confchange_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::Member, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::Member, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::Member, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::Member, _impl_.port_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::Member, _impl_.learner_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::ClusterConfig, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::ClusterConfig, _impl_.members_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, term_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, leaderid_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, prevlogindex_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, prevlogterm_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, entries_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, leadercommit_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, _impl_.leaderid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, _impl_.prevlogindex_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, _impl_.prevlogterm_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, _impl_.leadercommit_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, term_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, success_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, updatenextindex_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, appstate_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, _impl_.updatenextindex_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, _impl_.appstate_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, term_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, candidateid_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, lastlogindex_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, lastlogterm_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, _impl_.candidateid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, _impl_.lastlogindex_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, _impl_.lastlogterm_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, _impl_.leadershiptransfer_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteReply, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteReply, term_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteReply, votegranted_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteReply, votestate_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteReply, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteReply, _impl_.votegranted_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteReply, _impl_.votestate_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, leaderid_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, term_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, lastsnapshotincludeindex_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, lastsnapshotincludeterm_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, data_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, _impl_.leaderid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, _impl_.lastsnapshotincludeindex_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, _impl_.lastsnapshotincludeterm_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, _impl_.config_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotResponse, term_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotResponse, _impl_.term_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::TimeoutNowArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::TimeoutNowArgs, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::TimeoutNowArgs, _impl_.leaderid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::TimeoutNowReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::TimeoutNowReply, _impl_.term_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::GroupAppendEntriesArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::GroupAppendEntriesArgs, _impl_.groupid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::GroupAppendEntriesArgs, _impl_.args_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::GroupAppendEntriesReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::GroupAppendEntriesReply, _impl_.groupid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::GroupAppendEntriesReply, _impl_.reply_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::BatchAppendEntriesArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::BatchAppendEntriesArgs, _impl_.entries_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::BatchAppendEntriesReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::BatchAppendEntriesReply, _impl_.entries_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::raftRpcProctoc::LogEntry)},
-  { 8, -1, sizeof(::raftRpcProctoc::AppendEntriesArgs)},
-  { 19, -1, sizeof(::raftRpcProctoc::AppendEntriesReply)},
-  { 28, -1, sizeof(::raftRpcProctoc::RequestVoteArgs)},
-  { 37, -1, sizeof(::raftRpcProctoc::RequestVoteReply)},
-  { 45, -1, sizeof(::raftRpcProctoc::InstallSnapshotRequest)},
-  { 55, -1, sizeof(::raftRpcProctoc::InstallSnapshotResponse)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::raftRpcProctoc::LogEntry)},
+  { 10, -1, -1, sizeof(::raftRpcProctoc::Member)},
+  { 20, -1, -1, sizeof(::raftRpcProctoc::ClusterConfig)},
+  { 27, -1, -1, sizeof(::raftRpcProctoc::AppendEntriesArgs)},
+  { 39, -1, -1, sizeof(::raftRpcProctoc::AppendEntriesReply)},
+  { 49, -1, -1, sizeof(::raftRpcProctoc::RequestVoteArgs)},
+  { 60, -1, -1, sizeof(::raftRpcProctoc::RequestVoteReply)},
+  { 69, -1, -1, sizeof(::raftRpcProctoc::InstallSnapshotRequest)},
+  { 81, -1, -1, sizeof(::raftRpcProctoc::InstallSnapshotResponse)},
+  { 88, -1, -1, sizeof(::raftRpcProctoc::TimeoutNowArgs)},
+  { 96, -1, -1, sizeof(::raftRpcProctoc::TimeoutNowReply)},
+  { 103, -1, -1, sizeof(::raftRpcProctoc::GroupAppendEntriesArgs)},
+  { 111, -1, -1, sizeof(::raftRpcProctoc::GroupAppendEntriesReply)},
+  { 119, -1, -1, sizeof(::raftRpcProctoc::BatchAppendEntriesArgs)},
+  { 126, -1, -1, sizeof(::raftRpcProctoc::BatchAppendEntriesReply)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProctoc::_LogEntry_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProctoc::_AppendEntriesArgs_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProctoc::_AppendEntriesReply_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProctoc::_RequestVoteArgs_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProctoc::_RequestVoteReply_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProctoc::_InstallSnapshotRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProctoc::_InstallSnapshotResponse_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::raftRpcProctoc::_LogEntry_default_instance_._instance,
+  &::raftRpcProctoc::_Member_default_instance_._instance,
+  &::raftRpcProctoc::_ClusterConfig_default_instance_._instance,
+  &::raftRpcProctoc::_AppendEntriesArgs_default_instance_._instance,
+  &::raftRpcProctoc::_AppendEntriesReply_default_instance_._instance,
+  &::raftRpcProctoc::_RequestVoteArgs_default_instance_._instance,
+  &::raftRpcProctoc::_RequestVoteReply_default_instance_._instance,
+  &::raftRpcProctoc::_InstallSnapshotRequest_default_instance_._instance,
+  &::raftRpcProctoc::_InstallSnapshotResponse_default_instance_._instance,
+  &::raftRpcProctoc::_TimeoutNowArgs_default_instance_._instance,
+  &::raftRpcProctoc::_TimeoutNowReply_default_instance_._instance,
+  &::raftRpcProctoc::_GroupAppendEntriesArgs_default_instance_._instance,
+  &::raftRpcProctoc::_GroupAppendEntriesReply_default_instance_._instance,
+  &::raftRpcProctoc::_BatchAppendEntriesArgs_default_instance_._instance,
+  &::raftRpcProctoc::_BatchAppendEntriesReply_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_raftRPC_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\rraftRPC.proto\022\016raftRpcProctoc\">\n\010LogEn"
+  "\n\rraftRPC.proto\022\016raftRpcProctoc\"R\n\010LogEn"
   "try\022\017\n\007Command\030\001 \001(\014\022\017\n\007LogTerm\030\002 \001(\005\022\020\n"
-  "\010LogIndex\030\003 \001(\005\"\237\001\n\021AppendEntriesArgs\022\014\n"
-  "\004Term\030\001 \001(\005\022\020\n\010LeaderId\030\002 \001(\005\022\024\n\014PrevLog"
-  "Index\030\003 \001(\005\022\023\n\013PrevLogTerm\030\004 \001(\005\022)\n\007Entr"
-  "ies\030\005 \003(\0132\030.raftRpcProctoc.LogEntry\022\024\n\014L"
-  "eaderCommit\030\006 \001(\005\"^\n\022AppendEntriesReply\022"
-  "\014\n\004Term\030\001 \001(\005\022\017\n\007Success\030\002 \001(\010\022\027\n\017Update"
-  "NextIndex\030\003 \001(\005\022\020\n\010AppState\030\004 \001(\005\"_\n\017Req"
-  "uestVoteArgs\022\014\n\004Term\030\001 \001(\005\022\023\n\013CandidateI"
-  "d\030\002 \001(\005\022\024\n\014LastLogIndex\030\003 \001(\005\022\023\n\013LastLog"
-  "Term\030\004 \001(\005\"H\n\020RequestVoteReply\022\014\n\004Term\030\001"
-  " \001(\005\022\023\n\013VoteGranted\030\002 \001(\010\022\021\n\tVoteState\030\003"
-  " \001(\005\"\211\001\n\026InstallSnapshotRequest\022\020\n\010Leade"
-  "rId\030\001 \001(\005\022\014\n\004Term\030\002 \001(\005\022 \n\030LastSnapShotI"
-  "ncludeIndex\030\003 \001(\005\022\037\n\027LastSnapShotInclude"
-  "Term\030\004 \001(\005\022\014\n\004Data\030\005 \001(\014\"\'\n\027InstallSnaps"
-  "hotResponse\022\014\n\004Term\030\001 \001(\0052\227\002\n\007raftRpc\022V\n"
-  "\rAppendEntries\022!.raftRpcProctoc.AppendEn"
-  "triesArgs\032\".raftRpcProctoc.AppendEntries"
-  "Reply\022b\n\017InstallSnapshot\022&.raftRpcProcto"
-  "c.InstallSnapshotRequest\032\'.raftRpcProcto"
-  "c.InstallSnapshotResponse\022P\n\013RequestVote"
-  "\022\037.raftRpcProctoc.RequestVoteArgs\032 .raft"
-  "RpcProctoc.RequestVoteReplyB\003\200\001\001b\006proto3"
+  "\010LogIndex\030\003 \001(\005\022\022\n\nConfChange\030\004 \001(\010\"\?\n\006M"
+  "ember\022\n\n\002Id\030\001 \001(\005\022\n\n\002Ip\030\002 \001(\014\022\014\n\004Port\030\003 "
+  "\001(\005\022\017\n\007Learner\030\004 \001(\010\"8\n\rClusterConfig\022\'\n"
+  "\007Members\030\001 \003(\0132\026.raftRpcProctoc.Member\"\237"
+  "\001\n\021AppendEntriesArgs\022\014\n\004Term\030\001 \001(\005\022\020\n\010Le"
+  "aderId\030\002 \001(\005\022\024\n\014PrevLogIndex\030\003 \001(\005\022\023\n\013Pr"
+  "evLogTerm\030\004 \001(\005\022)\n\007Entries\030\005 \003(\0132\030.raftR"
+  "pcProctoc.LogEntry\022\024\n\014LeaderCommit\030\006 \001(\005"
+  "\"^\n\022AppendEntriesReply\022\014\n\004Term\030\001 \001(\005\022\017\n\007"
+  "Success\030\002 \001(\010\022\027\n\017UpdateNextIndex\030\003 \001(\005\022\020"
+  "\n\010AppState\030\004 \001(\005\"{\n\017RequestVoteArgs\022\014\n\004T"
+  "erm\030\001 \001(\005\022\023\n\013CandidateId\030\002 \001(\005\022\024\n\014LastLo"
+  "gIndex\030\003 \001(\005\022\023\n\013LastLogTerm\030\004 \001(\005\022\032\n\022Lea"
+  "dershipTransfer\030\005 \001(\010\"H\n\020RequestVoteRepl"
+  "y\022\014\n\004Term\030\001 \001(\005\022\023\n\013VoteGranted\030\002 \001(\010\022\021\n\t"
+  "VoteState\030\003 \001(\005\"\270\001\n\026InstallSnapshotReque"
+  "st\022\020\n\010LeaderId\030\001 \001(\005\022\014\n\004Term\030\002 \001(\005\022 \n\030La"
+  "stSnapShotIncludeIndex\030\003 \001(\005\022\037\n\027LastSnap"
+  "ShotIncludeTerm\030\004 \001(\005\022\014\n\004Data\030\005 \001(\014\022-\n\006C"
+  "onfig\030\006 \001(\0132\035.raftRpcProctoc.ClusterConf"
+  "ig\"\'\n\027InstallSnapshotResponse\022\014\n\004Term\030\001 "
+  "\001(\005\"0\n\016TimeoutNowArgs\022\014\n\004Term\030\001 \001(\005\022\020\n\010L"
+  "eaderId\030\002 \001(\005\"\037\n\017TimeoutNowReply\022\014\n\004Term"
+  "\030\001 \001(\005\"Z\n\026GroupAppendEntriesArgs\022\017\n\007Grou"
+  "pId\030\001 \001(\r\022/\n\004Args\030\002 \001(\0132!.raftRpcProctoc"
+  ".AppendEntriesArgs\"]\n\027GroupAppendEntries"
+  "Reply\022\017\n\007GroupId\030\001 \001(\r\0221\n\005Reply\030\002 \001(\0132\"."
+  "raftRpcProctoc.AppendEntriesReply\"Q\n\026Bat"
+  "chAppendEntriesArgs\0227\n\007Entries\030\001 \003(\0132&.r"
+  "aftRpcProctoc.GroupAppendEntriesArgs\"S\n\027"
+  "BatchAppendEntriesReply\0228\n\007Entries\030\001 \003(\013"
+  "2\'.raftRpcProctoc.GroupAppendEntriesRepl"
+  "y2\273\003\n\007raftRpc\022V\n\rAppendEntries\022!.raftRpc"
+  "Proctoc.AppendEntriesArgs\032\".raftRpcProct"
+  "oc.AppendEntriesReply\022b\n\017InstallSnapshot"
+  "\022&.raftRpcProctoc.InstallSnapshotRequest"
+  "\032\'.raftRpcProctoc.InstallSnapshotRespons"
+  "e\022P\n\013RequestVote\022\037.raftRpcProctoc.Reques"
+  "tVoteArgs\032 .raftRpcProctoc.RequestVoteRe"
+  "ply\022S\n\016RequestPreVote\022\037.raftRpcProctoc.R"
+  "equestVoteArgs\032 .raftRpcProctoc.RequestV"
+  "oteReply\022M\n\nTimeoutNow\022\036.raftRpcProctoc."
+  "TimeoutNowArgs\032\037.raftRpcProctoc.TimeoutN"
+  "owReply2u\n\014multiRaftRpc\022e\n\022BatchAppendEn"
+  "tries\022&.raftRpcProctoc.BatchAppendEntrie"
+  "sArgs\032\'.raftRpcProctoc.BatchAppendEntrie"
+  "sReplyB\003\200\001\001b\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_raftRPC_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_raftRPC_2eproto_sccs[7] = {
-  &scc_info_AppendEntriesArgs_raftRPC_2eproto.base,
-  &scc_info_AppendEntriesReply_raftRPC_2eproto.base,
-  &scc_info_InstallSnapshotRequest_raftRPC_2eproto.base,
-  &scc_info_InstallSnapshotResponse_raftRPC_2eproto.base,
-  &scc_info_LogEntry_raftRPC_2eproto.base,
-  &scc_info_RequestVoteArgs_raftRPC_2eproto.base,
-  &scc_info_RequestVoteReply_raftRPC_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_raftRPC_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_raftRPC_2eproto = {
-  false, false, descriptor_table_protodef_raftRPC_2eproto, "raftRPC.proto", 1000,
-  &descriptor_table_raftRPC_2eproto_once, descriptor_table_raftRPC_2eproto_sccs, descriptor_table_raftRPC_2eproto_deps, 7, 0,
-  schemas, file_default_instances, TableStruct_raftRPC_2eproto::offsets,
-  file_level_metadata_raftRPC_2eproto, 7, file_level_enum_descriptors_raftRPC_2eproto, file_level_service_descriptors_raftRPC_2eproto,
+static ::_pbi::once_flag descriptor_table_raftRPC_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_raftRPC_2eproto = {
+    false, false, 1939, descriptor_table_protodef_raftRPC_2eproto,
+    "raftRPC.proto",
+    &descriptor_table_raftRPC_2eproto_once, nullptr, 0, 15,
+    schemas, file_default_instances, TableStruct_raftRPC_2eproto::offsets,
+    file_level_metadata_raftRPC_2eproto, file_level_enum_descriptors_raftRPC_2eproto,
+    file_level_service_descriptors_raftRPC_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_raftRPC_2eproto_getter() {
+  return &descriptor_table_raftRPC_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_raftRPC_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_raftRPC_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_raftRPC_2eproto(&descriptor_table_raftRPC_2eproto);
 namespace raftRpcProctoc {
 
 // ===================================================================
@@ -280,151 +494,179 @@ class LogEntry::_Internal {
  public:
 };
 
-LogEntry::LogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+LogEntry::LogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.LogEntry)
 }
 LogEntry::LogEntry(const LogEntry& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.command_){}
+    , decltype(_impl_.logterm_){}
+    , decltype(_impl_.logindex_){}
+    , decltype(_impl_.confchange_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  command_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_command().empty()) {
-    command_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_command(), 
-      GetArena());
+    _this->_impl_.command_.Set(from._internal_command(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&logterm_, &from.logterm_,
-    static_cast<size_t>(reinterpret_cast<char*>(&logindex_) -
-    reinterpret_cast<char*>(&logterm_)) + sizeof(logindex_));
+  ::memcpy(&_impl_.logterm_, &from._impl_.logterm_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.confchange_) -
+    reinterpret_cast<char*>(&_impl_.logterm_)) + sizeof(_impl_.confchange_));
   // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.LogEntry)
 }
 
-void LogEntry::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_LogEntry_raftRPC_2eproto.base);
-  command_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&logterm_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&logindex_) -
-      reinterpret_cast<char*>(&logterm_)) + sizeof(logindex_));
+inline void LogEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.command_){}
+    , decltype(_impl_.logterm_){0}
+    , decltype(_impl_.logindex_){0}
+    , decltype(_impl_.confchange_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 LogEntry::~LogEntry() {
   // @@protoc_insertion_point(destructor:raftRpcProctoc.LogEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void LogEntry::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  command_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void LogEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.command_.Destroy();
 }
 
-void LogEntry::ArenaDtor(void* object) {
-  LogEntry* _this = reinterpret_cast< LogEntry* >(object);
-  (void)_this;
-}
-void LogEntry::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void LogEntry::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const LogEntry& LogEntry::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_LogEntry_raftRPC_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void LogEntry::Clear() {
 // @@protoc_insertion_point(message_clear_start:raftRpcProctoc.LogEntry)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  command_.ClearToEmpty();
-  ::memset(&logterm_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&logindex_) -
-      reinterpret_cast<char*>(&logterm_)) + sizeof(logindex_));
+  _impl_.command_.ClearToEmpty();
+  ::memset(&_impl_.logterm_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.confchange_) -
+      reinterpret_cast<char*>(&_impl_.logterm_)) + sizeof(_impl_.confchange_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* LogEntry::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* LogEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // bytes Command = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_command();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 LogTerm = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          logterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.logterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 LogIndex = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          logindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.logindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // bool ConfChange = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.confchange_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* LogEntry::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* LogEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.LogEntry)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes Command = 1;
-  if (this->command().size() > 0) {
+  if (!this->_internal_command().empty()) {
     target = stream->WriteBytesMaybeAliased(
         1, this->_internal_command(), target);
   }
 
   // int32 LogTerm = 2;
-  if (this->logterm() != 0) {
+  if (this->_internal_logterm() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_logterm(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_logterm(), target);
   }
 
   // int32 LogIndex = 3;
-  if (this->logindex() != 0) {
+  if (this->_internal_logindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_logindex(), target);
+  }
+
+  // bool ConfChange = 4;
+  if (this->_internal_confchange() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_logindex(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_confchange(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.LogEntry)
@@ -435,78 +677,63 @@ size_t LogEntry::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.LogEntry)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // bytes Command = 1;
-  if (this->command().size() > 0) {
+  if (!this->_internal_command().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_command());
   }
 
   // int32 LogTerm = 2;
-  if (this->logterm() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_logterm());
+  if (this->_internal_logterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_logterm());
   }
 
   // int32 LogIndex = 3;
-  if (this->logindex() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_logindex());
+  if (this->_internal_logindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_logindex());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // bool ConfChange = 4;
+  if (this->_internal_confchange() != 0) {
+    total_size += 1 + 1;
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void LogEntry::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProctoc.LogEntry)
-  GOOGLE_DCHECK_NE(&from, this);
-  const LogEntry* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<LogEntry>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProctoc.LogEntry)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProctoc.LogEntry)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void LogEntry::MergeFrom(const LogEntry& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.LogEntry)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogEntry::GetClassData() const { return &_class_data_; }
+
+
+void LogEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogEntry*>(&to_msg);
+  auto& from = static_cast<const LogEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.LogEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.command().size() > 0) {
-    _internal_set_command(from._internal_command());
+  if (!from._internal_command().empty()) {
+    _this->_internal_set_command(from._internal_command());
   }
-  if (from.logterm() != 0) {
-    _internal_set_logterm(from._internal_logterm());
+  if (from._internal_logterm() != 0) {
+    _this->_internal_set_logterm(from._internal_logterm());
   }
-  if (from.logindex() != 0) {
-    _internal_set_logindex(from._internal_logindex());
+  if (from._internal_logindex() != 0) {
+    _this->_internal_set_logindex(from._internal_logindex());
   }
-}
-
-void LogEntry::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProctoc.LogEntry)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_confchange() != 0) {
+    _this->_internal_set_confchange(from._internal_confchange());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void LogEntry::CopyFrom(const LogEntry& from) {
@@ -522,1653 +749,3320 @@ bool LogEntry::IsInitialized() const {
 
 void LogEntry::InternalSwap(LogEntry* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  command_.Swap(&other->command_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.command_, lhs_arena,
+      &other->_impl_.command_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(LogEntry, logindex_)
-      + sizeof(LogEntry::logindex_)
-      - PROTOBUF_FIELD_OFFSET(LogEntry, logterm_)>(
-          reinterpret_cast<char*>(&logterm_),
-          reinterpret_cast<char*>(&other->logterm_));
+      PROTOBUF_FIELD_OFFSET(LogEntry, _impl_.confchange_)
+      + sizeof(LogEntry::_impl_.confchange_)
+      - PROTOBUF_FIELD_OFFSET(LogEntry, _impl_.logterm_)>(
+          reinterpret_cast<char*>(&_impl_.logterm_),
+          reinterpret_cast<char*>(&other->_impl_.logterm_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata LogEntry::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[0]);
 }
 
-
 // ===================================================================
 
-class AppendEntriesArgs::_Internal {
+class Member::_Internal {
  public:
 };
 
-AppendEntriesArgs::AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  entries_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.AppendEntriesArgs)
-}
-AppendEntriesArgs::AppendEntriesArgs(const AppendEntriesArgs& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      entries_(from.entries_) {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&term_, &from.term_,
-    static_cast<size_t>(reinterpret_cast<char*>(&leadercommit_) -
-    reinterpret_cast<char*>(&term_)) + sizeof(leadercommit_));
-  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.AppendEntriesArgs)
-}
-
-void AppendEntriesArgs::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_AppendEntriesArgs_raftRPC_2eproto.base);
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&term_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&leadercommit_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(leadercommit_));
+Member::Member(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.Member)
 }
+Member::Member(const Member& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Member* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ip_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.port_){}
+    , decltype(_impl_.learner_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-AppendEntriesArgs::~AppendEntriesArgs() {
-  // @@protoc_insertion_point(destructor:raftRpcProctoc.AppendEntriesArgs)
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_ip().empty()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.learner_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.learner_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.Member)
+}
+
+inline void Member::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ip_){}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.port_){0}
+    , decltype(_impl_.learner_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Member::~Member() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.Member)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void AppendEntriesArgs::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void Member::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ip_.Destroy();
 }
 
-void AppendEntriesArgs::ArenaDtor(void* object) {
-  AppendEntriesArgs* _this = reinterpret_cast< AppendEntriesArgs* >(object);
-  (void)_this;
-}
-void AppendEntriesArgs::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void AppendEntriesArgs::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const AppendEntriesArgs& AppendEntriesArgs::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AppendEntriesArgs_raftRPC_2eproto.base);
-  return *internal_default_instance();
+void Member::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void AppendEntriesArgs::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.AppendEntriesArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Member::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.Member)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  entries_.Clear();
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&leadercommit_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(leadercommit_));
+  _impl_.ip_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.learner_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.learner_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* AppendEntriesArgs::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Member::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 Term = 1;
+      // int32 Id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 LeaderId = 2;
+      // bytes Ip = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 PrevLogIndex = 3;
+      // int32 Port = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          prevlogindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 PrevLogTerm = 4;
+      // bool Learner = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          prevlogterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // repeated .raftRpcProctoc.LogEntry Entries = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
-        } else goto handle_unusual;
-        continue;
-      // int32 LeaderCommit = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
-          leadercommit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.learner_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* AppendEntriesArgs::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.AppendEntriesArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* Member::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.Member)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 Term = 1;
-  if (this->term() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
-  }
-
-  // int32 LeaderId = 2;
-  if (this->leaderid() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_leaderid(), target);
-  }
-
-  // int32 PrevLogIndex = 3;
-  if (this->prevlogindex() != 0) {
+  // int32 Id = 1;
+  if (this->_internal_id() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_prevlogindex(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_id(), target);
   }
 
-  // int32 PrevLogTerm = 4;
-  if (this->prevlogterm() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_prevlogterm(), target);
+  // bytes Ip = 2;
+  if (!this->_internal_ip().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_ip(), target);
   }
 
-  // repeated .raftRpcProctoc.LogEntry Entries = 5;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_entries_size()); i < n; i++) {
+  // int32 Port = 3;
+  if (this->_internal_port() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(5, this->_internal_entries(i), target, stream);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_port(), target);
   }
 
-  // int32 LeaderCommit = 6;
-  if (this->leadercommit() != 0) {
+  // bool Learner = 4;
+  if (this->_internal_learner() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(6, this->_internal_leadercommit(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_learner(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.AppendEntriesArgs)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.Member)
   return target;
 }
 
-size_t AppendEntriesArgs::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.AppendEntriesArgs)
+size_t Member::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.Member)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .raftRpcProctoc.LogEntry Entries = 5;
-  total_size += 1UL * this->_internal_entries_size();
-  for (const auto& msg : this->entries_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  // int32 Term = 1;
-  if (this->term() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
-  }
-
-  // int32 LeaderId = 2;
-  if (this->leaderid() != 0) {
+  // bytes Ip = 2;
+  if (!this->_internal_ip().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_leaderid());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_ip());
   }
 
-  // int32 PrevLogIndex = 3;
-  if (this->prevlogindex() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_prevlogindex());
+  // int32 Id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
   }
 
-  // int32 PrevLogTerm = 4;
-  if (this->prevlogterm() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_prevlogterm());
+  // int32 Port = 3;
+  if (this->_internal_port() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
   }
 
-  // int32 LeaderCommit = 6;
-  if (this->leadercommit() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_leadercommit());
+  // bool Learner = 4;
+  if (this->_internal_learner() != 0) {
+    total_size += 1 + 1;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void AppendEntriesArgs::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProctoc.AppendEntriesArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  const AppendEntriesArgs* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AppendEntriesArgs>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProctoc.AppendEntriesArgs)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProctoc.AppendEntriesArgs)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Member::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Member::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Member::GetClassData() const { return &_class_data_; }
 
-void AppendEntriesArgs::MergeFrom(const AppendEntriesArgs& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.AppendEntriesArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void Member::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Member*>(&to_msg);
+  auto& from = static_cast<const Member&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.Member)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  entries_.MergeFrom(from.entries_);
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
-  }
-  if (from.leaderid() != 0) {
-    _internal_set_leaderid(from._internal_leaderid());
+  if (!from._internal_ip().empty()) {
+    _this->_internal_set_ip(from._internal_ip());
   }
-  if (from.prevlogindex() != 0) {
-    _internal_set_prevlogindex(from._internal_prevlogindex());
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
   }
-  if (from.prevlogterm() != 0) {
-    _internal_set_prevlogterm(from._internal_prevlogterm());
+  if (from._internal_port() != 0) {
+    _this->_internal_set_port(from._internal_port());
   }
-  if (from.leadercommit() != 0) {
-    _internal_set_leadercommit(from._internal_leadercommit());
+  if (from._internal_learner() != 0) {
+    _this->_internal_set_learner(from._internal_learner());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void AppendEntriesArgs::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProctoc.AppendEntriesArgs)
+void Member::CopyFrom(const Member& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.Member)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void AppendEntriesArgs::CopyFrom(const AppendEntriesArgs& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.AppendEntriesArgs)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool AppendEntriesArgs::IsInitialized() const {
+bool Member::IsInitialized() const {
   return true;
 }
 
-void AppendEntriesArgs::InternalSwap(AppendEntriesArgs* other) {
+void Member::InternalSwap(Member* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  entries_.InternalSwap(&other->entries_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AppendEntriesArgs, leadercommit_)
-      + sizeof(AppendEntriesArgs::leadercommit_)
-      - PROTOBUF_FIELD_OFFSET(AppendEntriesArgs, term_)>(
-          reinterpret_cast<char*>(&term_),
-          reinterpret_cast<char*>(&other->term_));
+      PROTOBUF_FIELD_OFFSET(Member, _impl_.learner_)
+      + sizeof(Member::_impl_.learner_)
+      - PROTOBUF_FIELD_OFFSET(Member, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata AppendEntriesArgs::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata Member::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[1]);
 }
 
-
 // ===================================================================
 
-class AppendEntriesReply::_Internal {
+class ClusterConfig::_Internal {
  public:
 };
 
-AppendEntriesReply::AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.AppendEntriesReply)
+ClusterConfig::ClusterConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.ClusterConfig)
 }
-AppendEntriesReply::AppendEntriesReply(const AppendEntriesReply& from)
+ClusterConfig::ClusterConfig(const ClusterConfig& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClusterConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.members_){from._impl_.members_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&term_, &from.term_,
-    static_cast<size_t>(reinterpret_cast<char*>(&appstate_) -
-    reinterpret_cast<char*>(&term_)) + sizeof(appstate_));
-  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.AppendEntriesReply)
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.ClusterConfig)
 }
 
-void AppendEntriesReply::SharedCtor() {
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&term_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&appstate_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(appstate_));
+inline void ClusterConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.members_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-AppendEntriesReply::~AppendEntriesReply() {
-  // @@protoc_insertion_point(destructor:raftRpcProctoc.AppendEntriesReply)
+ClusterConfig::~ClusterConfig() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.ClusterConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void AppendEntriesReply::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void ClusterConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.members_.~RepeatedPtrField();
 }
 
-void AppendEntriesReply::ArenaDtor(void* object) {
-  AppendEntriesReply* _this = reinterpret_cast< AppendEntriesReply* >(object);
-  (void)_this;
-}
-void AppendEntriesReply::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void ClusterConfig::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-void AppendEntriesReply::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const AppendEntriesReply& AppendEntriesReply::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AppendEntriesReply_raftRPC_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void AppendEntriesReply::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.AppendEntriesReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ClusterConfig::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.ClusterConfig)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&appstate_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(appstate_));
+  _impl_.members_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* AppendEntriesReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ClusterConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 Term = 1;
+      // repeated .raftRpcProctoc.Member Members = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // bool Success = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 UpdateNextIndex = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          updatenextindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 AppState = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          appstate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_members(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* AppendEntriesReply::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.AppendEntriesReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* ClusterConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.ClusterConfig)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 Term = 1;
-  if (this->term() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
-  }
-
-  // bool Success = 2;
-  if (this->success() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_success(), target);
-  }
-
-  // int32 UpdateNextIndex = 3;
-  if (this->updatenextindex() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_updatenextindex(), target);
-  }
-
-  // int32 AppState = 4;
-  if (this->appstate() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_appstate(), target);
+  // repeated .raftRpcProctoc.Member Members = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_members_size()); i < n; i++) {
+    const auto& repfield = this->_internal_members(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.AppendEntriesReply)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.ClusterConfig)
   return target;
 }
 
-size_t AppendEntriesReply::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.AppendEntriesReply)
+size_t ClusterConfig::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.ClusterConfig)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 Term = 1;
-  if (this->term() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
-  }
-
-  // bool Success = 2;
-  if (this->success() != 0) {
-    total_size += 1 + 1;
-  }
-
-  // int32 UpdateNextIndex = 3;
-  if (this->updatenextindex() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_updatenextindex());
-  }
-
-  // int32 AppState = 4;
-  if (this->appstate() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_appstate());
+  // repeated .raftRpcProctoc.Member Members = 1;
+  total_size += 1UL * this->_internal_members_size();
+  for (const auto& msg : this->_impl_.members_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void AppendEntriesReply::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProctoc.AppendEntriesReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  const AppendEntriesReply* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AppendEntriesReply>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProctoc.AppendEntriesReply)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProctoc.AppendEntriesReply)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClusterConfig::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ClusterConfig::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClusterConfig::GetClassData() const { return &_class_data_; }
 
-void AppendEntriesReply::MergeFrom(const AppendEntriesReply& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.AppendEntriesReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
-  }
-  if (from.success() != 0) {
-    _internal_set_success(from._internal_success());
-  }
-  if (from.updatenextindex() != 0) {
-    _internal_set_updatenextindex(from._internal_updatenextindex());
-  }
-  if (from.appstate() != 0) {
-    _internal_set_appstate(from._internal_appstate());
-  }
-}
+void ClusterConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClusterConfig*>(&to_msg);
+  auto& from = static_cast<const ClusterConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.ClusterConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void AppendEntriesReply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProctoc.AppendEntriesReply)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.members_.MergeFrom(from._impl_.members_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void AppendEntriesReply::CopyFrom(const AppendEntriesReply& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.AppendEntriesReply)
+void ClusterConfig::CopyFrom(const ClusterConfig& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.ClusterConfig)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AppendEntriesReply::IsInitialized() const {
+bool ClusterConfig::IsInitialized() const {
   return true;
 }
 
-void AppendEntriesReply::InternalSwap(AppendEntriesReply* other) {
+void ClusterConfig::InternalSwap(ClusterConfig* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AppendEntriesReply, appstate_)
-      + sizeof(AppendEntriesReply::appstate_)
-      - PROTOBUF_FIELD_OFFSET(AppendEntriesReply, term_)>(
-          reinterpret_cast<char*>(&term_),
-          reinterpret_cast<char*>(&other->term_));
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.members_.InternalSwap(&other->_impl_.members_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata AppendEntriesReply::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata ClusterConfig::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[2]);
 }
 
-
 // ===================================================================
 
-class RequestVoteArgs::_Internal {
+class AppendEntriesArgs::_Internal {
  public:
 };
 
-RequestVoteArgs::RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.RequestVoteArgs)
+AppendEntriesArgs::AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.AppendEntriesArgs)
 }
-RequestVoteArgs::RequestVoteArgs(const RequestVoteArgs& from)
+AppendEntriesArgs::AppendEntriesArgs(const AppendEntriesArgs& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AppendEntriesArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.leaderid_){}
+    , decltype(_impl_.prevlogindex_){}
+    , decltype(_impl_.prevlogterm_){}
+    , decltype(_impl_.leadercommit_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&term_, &from.term_,
-    static_cast<size_t>(reinterpret_cast<char*>(&lastlogterm_) -
-    reinterpret_cast<char*>(&term_)) + sizeof(lastlogterm_));
-  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.RequestVoteArgs)
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.leadercommit_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.leadercommit_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.AppendEntriesArgs)
 }
 
-void RequestVoteArgs::SharedCtor() {
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&term_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&lastlogterm_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(lastlogterm_));
+inline void AppendEntriesArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){arena}
+    , decltype(_impl_.term_){0}
+    , decltype(_impl_.leaderid_){0}
+    , decltype(_impl_.prevlogindex_){0}
+    , decltype(_impl_.prevlogterm_){0}
+    , decltype(_impl_.leadercommit_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-RequestVoteArgs::~RequestVoteArgs() {
-  // @@protoc_insertion_point(destructor:raftRpcProctoc.RequestVoteArgs)
+AppendEntriesArgs::~AppendEntriesArgs() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.AppendEntriesArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void RequestVoteArgs::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void AppendEntriesArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
 }
 
-void RequestVoteArgs::ArenaDtor(void* object) {
-  RequestVoteArgs* _this = reinterpret_cast< RequestVoteArgs* >(object);
-  (void)_this;
-}
-void RequestVoteArgs::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void RequestVoteArgs::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RequestVoteArgs& RequestVoteArgs::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RequestVoteArgs_raftRPC_2eproto.base);
-  return *internal_default_instance();
+void AppendEntriesArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void RequestVoteArgs::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.RequestVoteArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void AppendEntriesArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.AppendEntriesArgs)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lastlogterm_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(lastlogterm_));
+  _impl_.entries_.Clear();
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.leadercommit_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.leadercommit_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RequestVoteArgs::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* AppendEntriesArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 Term = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 CandidateId = 2;
+      // int32 LeaderId = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          candidateid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 LastLogIndex = 3;
+      // int32 PrevLogIndex = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          lastlogindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.prevlogindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 LastLogTerm = 4;
+      // int32 PrevLogTerm = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          lastlogterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.prevlogterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .raftRpcProctoc.LogEntry Entries = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // int32 LeaderCommit = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.leadercommit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RequestVoteArgs::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.RequestVoteArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* AppendEntriesArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.AppendEntriesArgs)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 Term = 1;
-  if (this->term() != 0) {
+  if (this->_internal_term() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
   }
 
-  // int32 CandidateId = 2;
-  if (this->candidateid() != 0) {
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_candidateid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_leaderid(), target);
   }
 
-  // int32 LastLogIndex = 3;
-  if (this->lastlogindex() != 0) {
+  // int32 PrevLogIndex = 3;
+  if (this->_internal_prevlogindex() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_lastlogindex(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_prevlogindex(), target);
   }
 
-  // int32 LastLogTerm = 4;
-  if (this->lastlogterm() != 0) {
+  // int32 PrevLogTerm = 4;
+  if (this->_internal_prevlogterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_prevlogterm(), target);
+  }
+
+  // repeated .raftRpcProctoc.LogEntry Entries = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int32 LeaderCommit = 6;
+  if (this->_internal_leadercommit() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_lastlogterm(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_leadercommit(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.RequestVoteArgs)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.AppendEntriesArgs)
   return target;
 }
 
-size_t RequestVoteArgs::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.RequestVoteArgs)
+size_t AppendEntriesArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.AppendEntriesArgs)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 Term = 1;
-  if (this->term() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
+  // repeated .raftRpcProctoc.LogEntry Entries = 5;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // int32 CandidateId = 2;
-  if (this->candidateid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_candidateid());
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
   }
 
-  // int32 LastLogIndex = 3;
-  if (this->lastlogindex() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_lastlogindex());
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
   }
 
-  // int32 LastLogTerm = 4;
-  if (this->lastlogterm() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_lastlogterm());
+  // int32 PrevLogIndex = 3;
+  if (this->_internal_prevlogindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_prevlogindex());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // int32 PrevLogTerm = 4;
+  if (this->_internal_prevlogterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_prevlogterm());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void RequestVoteArgs::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProctoc.RequestVoteArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RequestVoteArgs* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RequestVoteArgs>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProctoc.RequestVoteArgs)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProctoc.RequestVoteArgs)
-    MergeFrom(*source);
+  // int32 LeaderCommit = 6;
+  if (this->_internal_leadercommit() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leadercommit());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RequestVoteArgs::MergeFrom(const RequestVoteArgs& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.RequestVoteArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AppendEntriesArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AppendEntriesArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AppendEntriesArgs::GetClassData() const { return &_class_data_; }
+
+
+void AppendEntriesArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AppendEntriesArgs*>(&to_msg);
+  auto& from = static_cast<const AppendEntriesArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.AppendEntriesArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
   }
-  if (from.candidateid() != 0) {
-    _internal_set_candidateid(from._internal_candidateid());
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
   }
-  if (from.lastlogindex() != 0) {
-    _internal_set_lastlogindex(from._internal_lastlogindex());
+  if (from._internal_prevlogindex() != 0) {
+    _this->_internal_set_prevlogindex(from._internal_prevlogindex());
   }
-  if (from.lastlogterm() != 0) {
-    _internal_set_lastlogterm(from._internal_lastlogterm());
+  if (from._internal_prevlogterm() != 0) {
+    _this->_internal_set_prevlogterm(from._internal_prevlogterm());
   }
+  if (from._internal_leadercommit() != 0) {
+    _this->_internal_set_leadercommit(from._internal_leadercommit());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RequestVoteArgs::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProctoc.RequestVoteArgs)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void RequestVoteArgs::CopyFrom(const RequestVoteArgs& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.RequestVoteArgs)
+void AppendEntriesArgs::CopyFrom(const AppendEntriesArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.AppendEntriesArgs)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RequestVoteArgs::IsInitialized() const {
+bool AppendEntriesArgs::IsInitialized() const {
   return true;
 }
 
-void RequestVoteArgs::InternalSwap(RequestVoteArgs* other) {
+void AppendEntriesArgs::InternalSwap(AppendEntriesArgs* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RequestVoteArgs, lastlogterm_)
-      + sizeof(RequestVoteArgs::lastlogterm_)
-      - PROTOBUF_FIELD_OFFSET(RequestVoteArgs, term_)>(
-          reinterpret_cast<char*>(&term_),
-          reinterpret_cast<char*>(&other->term_));
+      PROTOBUF_FIELD_OFFSET(AppendEntriesArgs, _impl_.leadercommit_)
+      + sizeof(AppendEntriesArgs::_impl_.leadercommit_)
+      - PROTOBUF_FIELD_OFFSET(AppendEntriesArgs, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata RequestVoteArgs::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata AppendEntriesArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[3]);
 }
 
-
 // ===================================================================
 
-class RequestVoteReply::_Internal {
+class AppendEntriesReply::_Internal {
  public:
 };
 
-RequestVoteReply::RequestVoteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.RequestVoteReply)
+AppendEntriesReply::AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.AppendEntriesReply)
 }
-RequestVoteReply::RequestVoteReply(const RequestVoteReply& from)
+AppendEntriesReply::AppendEntriesReply(const AppendEntriesReply& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AppendEntriesReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.updatenextindex_){}
+    , decltype(_impl_.appstate_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&term_, &from.term_,
-    static_cast<size_t>(reinterpret_cast<char*>(&votestate_) -
-    reinterpret_cast<char*>(&term_)) + sizeof(votestate_));
-  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.RequestVoteReply)
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.appstate_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.appstate_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.AppendEntriesReply)
 }
 
-void RequestVoteReply::SharedCtor() {
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&term_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&votestate_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(votestate_));
+inline void AppendEntriesReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.updatenextindex_){0}
+    , decltype(_impl_.appstate_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-RequestVoteReply::~RequestVoteReply() {
-  // @@protoc_insertion_point(destructor:raftRpcProctoc.RequestVoteReply)
+AppendEntriesReply::~AppendEntriesReply() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.AppendEntriesReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void RequestVoteReply::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void AppendEntriesReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void RequestVoteReply::ArenaDtor(void* object) {
-  RequestVoteReply* _this = reinterpret_cast< RequestVoteReply* >(object);
-  (void)_this;
-}
-void RequestVoteReply::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void RequestVoteReply::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RequestVoteReply& RequestVoteReply::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RequestVoteReply_raftRPC_2eproto.base);
-  return *internal_default_instance();
+void AppendEntriesReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void RequestVoteReply::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.RequestVoteReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void AppendEntriesReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.AppendEntriesReply)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&votestate_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(votestate_));
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.appstate_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.appstate_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RequestVoteReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* AppendEntriesReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 Term = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // bool VoteGranted = 2;
+      // bool Success = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          votegranted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 VoteState = 3;
+      // int32 UpdateNextIndex = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          votestate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.updatenextindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // int32 AppState = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.appstate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RequestVoteReply::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.RequestVoteReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* AppendEntriesReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.AppendEntriesReply)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 Term = 1;
-  if (this->term() != 0) {
+  if (this->_internal_term() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
   }
 
-  // bool VoteGranted = 2;
-  if (this->votegranted() != 0) {
+  // bool Success = 2;
+  if (this->_internal_success() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_votegranted(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_success(), target);
   }
 
-  // int32 VoteState = 3;
-  if (this->votestate() != 0) {
+  // int32 UpdateNextIndex = 3;
+  if (this->_internal_updatenextindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_updatenextindex(), target);
+  }
+
+  // int32 AppState = 4;
+  if (this->_internal_appstate() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_votestate(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_appstate(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.RequestVoteReply)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.AppendEntriesReply)
   return target;
 }
 
-size_t RequestVoteReply::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.RequestVoteReply)
+size_t AppendEntriesReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.AppendEntriesReply)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // int32 Term = 1;
-  if (this->term() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
   }
 
-  // bool VoteGranted = 2;
-  if (this->votegranted() != 0) {
+  // bool Success = 2;
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  // int32 VoteState = 3;
-  if (this->votestate() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_votestate());
+  // int32 UpdateNextIndex = 3;
+  if (this->_internal_updatenextindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_updatenextindex());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // int32 AppState = 4;
+  if (this->_internal_appstate() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_appstate());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void RequestVoteReply::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProctoc.RequestVoteReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RequestVoteReply* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RequestVoteReply>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProctoc.RequestVoteReply)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProctoc.RequestVoteReply)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RequestVoteReply::MergeFrom(const RequestVoteReply& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.RequestVoteReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AppendEntriesReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AppendEntriesReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AppendEntriesReply::GetClassData() const { return &_class_data_; }
+
+
+void AppendEntriesReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AppendEntriesReply*>(&to_msg);
+  auto& from = static_cast<const AppendEntriesReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.AppendEntriesReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
   }
-  if (from.votegranted() != 0) {
-    _internal_set_votegranted(from._internal_votegranted());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
-  if (from.votestate() != 0) {
-    _internal_set_votestate(from._internal_votestate());
+  if (from._internal_updatenextindex() != 0) {
+    _this->_internal_set_updatenextindex(from._internal_updatenextindex());
   }
+  if (from._internal_appstate() != 0) {
+    _this->_internal_set_appstate(from._internal_appstate());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RequestVoteReply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProctoc.RequestVoteReply)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void RequestVoteReply::CopyFrom(const RequestVoteReply& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.RequestVoteReply)
+void AppendEntriesReply::CopyFrom(const AppendEntriesReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.AppendEntriesReply)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RequestVoteReply::IsInitialized() const {
+bool AppendEntriesReply::IsInitialized() const {
   return true;
 }
 
-void RequestVoteReply::InternalSwap(RequestVoteReply* other) {
+void AppendEntriesReply::InternalSwap(AppendEntriesReply* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RequestVoteReply, votestate_)
-      + sizeof(RequestVoteReply::votestate_)
-      - PROTOBUF_FIELD_OFFSET(RequestVoteReply, term_)>(
-          reinterpret_cast<char*>(&term_),
-          reinterpret_cast<char*>(&other->term_));
+      PROTOBUF_FIELD_OFFSET(AppendEntriesReply, _impl_.appstate_)
+      + sizeof(AppendEntriesReply::_impl_.appstate_)
+      - PROTOBUF_FIELD_OFFSET(AppendEntriesReply, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata RequestVoteReply::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata AppendEntriesReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[4]);
 }
 
-
 // ===================================================================
 
-class InstallSnapshotRequest::_Internal {
+class RequestVoteArgs::_Internal {
  public:
 };
 
-InstallSnapshotRequest::InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.InstallSnapshotRequest)
+RequestVoteArgs::RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.RequestVoteArgs)
 }
-InstallSnapshotRequest::InstallSnapshotRequest(const InstallSnapshotRequest& from)
+RequestVoteArgs::RequestVoteArgs(const RequestVoteArgs& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestVoteArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.candidateid_){}
+    , decltype(_impl_.lastlogindex_){}
+    , decltype(_impl_.lastlogterm_){}
+    , decltype(_impl_.leadershiptransfer_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_data().empty()) {
-    data_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_data(), 
-      GetArena());
-  }
-  ::memcpy(&leaderid_, &from.leaderid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&lastsnapshotincludeterm_) -
-    reinterpret_cast<char*>(&leaderid_)) + sizeof(lastsnapshotincludeterm_));
-  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.InstallSnapshotRequest)
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.leadershiptransfer_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.leadershiptransfer_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.RequestVoteArgs)
 }
 
-void InstallSnapshotRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_InstallSnapshotRequest_raftRPC_2eproto.base);
-  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&leaderid_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&lastsnapshotincludeterm_) -
-      reinterpret_cast<char*>(&leaderid_)) + sizeof(lastsnapshotincludeterm_));
+inline void RequestVoteArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.candidateid_){0}
+    , decltype(_impl_.lastlogindex_){0}
+    , decltype(_impl_.lastlogterm_){0}
+    , decltype(_impl_.leadershiptransfer_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-InstallSnapshotRequest::~InstallSnapshotRequest() {
-  // @@protoc_insertion_point(destructor:raftRpcProctoc.InstallSnapshotRequest)
+RequestVoteArgs::~RequestVoteArgs() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.RequestVoteArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void InstallSnapshotRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void RequestVoteArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void InstallSnapshotRequest::ArenaDtor(void* object) {
-  InstallSnapshotRequest* _this = reinterpret_cast< InstallSnapshotRequest* >(object);
-  (void)_this;
+void RequestVoteArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestVoteArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.RequestVoteArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.leadershiptransfer_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.leadershiptransfer_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestVoteArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 Term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 CandidateId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.candidateid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LastLogIndex = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.lastlogindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LastLogTerm = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.lastlogterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool LeadershipTransfer = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.leadershiptransfer_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestVoteArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.RequestVoteArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // int32 CandidateId = 2;
+  if (this->_internal_candidateid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_candidateid(), target);
+  }
+
+  // int32 LastLogIndex = 3;
+  if (this->_internal_lastlogindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_lastlogindex(), target);
+  }
+
+  // int32 LastLogTerm = 4;
+  if (this->_internal_lastlogterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_lastlogterm(), target);
+  }
+
+  // bool LeadershipTransfer = 5;
+  if (this->_internal_leadershiptransfer() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_leadershiptransfer(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.RequestVoteArgs)
+  return target;
+}
+
+size_t RequestVoteArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.RequestVoteArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  // int32 CandidateId = 2;
+  if (this->_internal_candidateid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_candidateid());
+  }
+
+  // int32 LastLogIndex = 3;
+  if (this->_internal_lastlogindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_lastlogindex());
+  }
+
+  // int32 LastLogTerm = 4;
+  if (this->_internal_lastlogterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_lastlogterm());
+  }
+
+  // bool LeadershipTransfer = 5;
+  if (this->_internal_leadershiptransfer() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestVoteArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestVoteArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestVoteArgs::GetClassData() const { return &_class_data_; }
+
+
+void RequestVoteArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestVoteArgs*>(&to_msg);
+  auto& from = static_cast<const RequestVoteArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.RequestVoteArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  if (from._internal_candidateid() != 0) {
+    _this->_internal_set_candidateid(from._internal_candidateid());
+  }
+  if (from._internal_lastlogindex() != 0) {
+    _this->_internal_set_lastlogindex(from._internal_lastlogindex());
+  }
+  if (from._internal_lastlogterm() != 0) {
+    _this->_internal_set_lastlogterm(from._internal_lastlogterm());
+  }
+  if (from._internal_leadershiptransfer() != 0) {
+    _this->_internal_set_leadershiptransfer(from._internal_leadershiptransfer());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestVoteArgs::CopyFrom(const RequestVoteArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.RequestVoteArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestVoteArgs::IsInitialized() const {
+  return true;
+}
+
+void RequestVoteArgs::InternalSwap(RequestVoteArgs* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RequestVoteArgs, _impl_.leadershiptransfer_)
+      + sizeof(RequestVoteArgs::_impl_.leadershiptransfer_)
+      - PROTOBUF_FIELD_OFFSET(RequestVoteArgs, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestVoteArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[5]);
+}
+
+// ===================================================================
+
+class RequestVoteReply::_Internal {
+ public:
+};
+
+RequestVoteReply::RequestVoteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.RequestVoteReply)
+}
+RequestVoteReply::RequestVoteReply(const RequestVoteReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestVoteReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.votegranted_){}
+    , decltype(_impl_.votestate_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.votestate_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.votestate_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.RequestVoteReply)
+}
+
+inline void RequestVoteReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.votegranted_){false}
+    , decltype(_impl_.votestate_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RequestVoteReply::~RequestVoteReply() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.RequestVoteReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RequestVoteReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RequestVoteReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestVoteReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.RequestVoteReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.votestate_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.votestate_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestVoteReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 Term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool VoteGranted = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.votegranted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 VoteState = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.votestate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestVoteReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.RequestVoteReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // bool VoteGranted = 2;
+  if (this->_internal_votegranted() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_votegranted(), target);
+  }
+
+  // int32 VoteState = 3;
+  if (this->_internal_votestate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_votestate(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.RequestVoteReply)
+  return target;
+}
+
+size_t RequestVoteReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.RequestVoteReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  // bool VoteGranted = 2;
+  if (this->_internal_votegranted() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int32 VoteState = 3;
+  if (this->_internal_votestate() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_votestate());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestVoteReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestVoteReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestVoteReply::GetClassData() const { return &_class_data_; }
+
+
+void RequestVoteReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestVoteReply*>(&to_msg);
+  auto& from = static_cast<const RequestVoteReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.RequestVoteReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  if (from._internal_votegranted() != 0) {
+    _this->_internal_set_votegranted(from._internal_votegranted());
+  }
+  if (from._internal_votestate() != 0) {
+    _this->_internal_set_votestate(from._internal_votestate());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestVoteReply::CopyFrom(const RequestVoteReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.RequestVoteReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestVoteReply::IsInitialized() const {
+  return true;
+}
+
+void RequestVoteReply::InternalSwap(RequestVoteReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RequestVoteReply, _impl_.votestate_)
+      + sizeof(RequestVoteReply::_impl_.votestate_)
+      - PROTOBUF_FIELD_OFFSET(RequestVoteReply, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestVoteReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[6]);
+}
+
+// ===================================================================
+
+class InstallSnapshotRequest::_Internal {
+ public:
+  static const ::raftRpcProctoc::ClusterConfig& config(const InstallSnapshotRequest* msg);
+};
+
+const ::raftRpcProctoc::ClusterConfig&
+InstallSnapshotRequest::_Internal::config(const InstallSnapshotRequest* msg) {
+  return *msg->_impl_.config_;
+}
+InstallSnapshotRequest::InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.InstallSnapshotRequest)
+}
+InstallSnapshotRequest::InstallSnapshotRequest(const InstallSnapshotRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InstallSnapshotRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.leaderid_){}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.lastsnapshotincludeindex_){}
+    , decltype(_impl_.lastsnapshotincludeterm_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_config()) {
+    _this->_impl_.config_ = new ::raftRpcProctoc::ClusterConfig(*from._impl_.config_);
+  }
+  ::memcpy(&_impl_.leaderid_, &from._impl_.leaderid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lastsnapshotincludeterm_) -
+    reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.lastsnapshotincludeterm_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.InstallSnapshotRequest)
+}
+
+inline void InstallSnapshotRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.leaderid_){0}
+    , decltype(_impl_.term_){0}
+    , decltype(_impl_.lastsnapshotincludeindex_){0}
+    , decltype(_impl_.lastsnapshotincludeterm_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+InstallSnapshotRequest::~InstallSnapshotRequest() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.InstallSnapshotRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void InstallSnapshotRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.config_;
+}
+
+void InstallSnapshotRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void InstallSnapshotRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.InstallSnapshotRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.config_ != nullptr) {
+    delete _impl_.config_;
+  }
+  _impl_.config_ = nullptr;
+  ::memset(&_impl_.leaderid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.lastsnapshotincludeterm_) -
+      reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.lastsnapshotincludeterm_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* InstallSnapshotRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 LeaderId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 Term = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LastSnapShotIncludeIndex = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.lastsnapshotincludeindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LastSnapShotIncludeTerm = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.lastsnapshotincludeterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Data = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .raftRpcProctoc.ClusterConfig Config = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_config(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* InstallSnapshotRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.InstallSnapshotRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 LeaderId = 1;
+  if (this->_internal_leaderid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_leaderid(), target);
+  }
+
+  // int32 Term = 2;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_term(), target);
+  }
+
+  // int32 LastSnapShotIncludeIndex = 3;
+  if (this->_internal_lastsnapshotincludeindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_lastsnapshotincludeindex(), target);
+  }
+
+  // int32 LastSnapShotIncludeTerm = 4;
+  if (this->_internal_lastsnapshotincludeterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_lastsnapshotincludeterm(), target);
+  }
+
+  // bytes Data = 5;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_data(), target);
+  }
+
+  // .raftRpcProctoc.ClusterConfig Config = 6;
+  if (this->_internal_has_config()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::config(this),
+        _Internal::config(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.InstallSnapshotRequest)
+  return target;
+}
+
+size_t InstallSnapshotRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.InstallSnapshotRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Data = 5;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // .raftRpcProctoc.ClusterConfig Config = 6;
+  if (this->_internal_has_config()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.config_);
+  }
+
+  // int32 LeaderId = 1;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
+  }
+
+  // int32 Term = 2;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  // int32 LastSnapShotIncludeIndex = 3;
+  if (this->_internal_lastsnapshotincludeindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_lastsnapshotincludeindex());
+  }
+
+  // int32 LastSnapShotIncludeTerm = 4;
+  if (this->_internal_lastsnapshotincludeterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_lastsnapshotincludeterm());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InstallSnapshotRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InstallSnapshotRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InstallSnapshotRequest::GetClassData() const { return &_class_data_; }
+
+
+void InstallSnapshotRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InstallSnapshotRequest*>(&to_msg);
+  auto& from = static_cast<const InstallSnapshotRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.InstallSnapshotRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_has_config()) {
+    _this->_internal_mutable_config()->::raftRpcProctoc::ClusterConfig::MergeFrom(
+        from._internal_config());
+  }
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
+  }
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  if (from._internal_lastsnapshotincludeindex() != 0) {
+    _this->_internal_set_lastsnapshotincludeindex(from._internal_lastsnapshotincludeindex());
+  }
+  if (from._internal_lastsnapshotincludeterm() != 0) {
+    _this->_internal_set_lastsnapshotincludeterm(from._internal_lastsnapshotincludeterm());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void InstallSnapshotRequest::CopyFrom(const InstallSnapshotRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.InstallSnapshotRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InstallSnapshotRequest::IsInitialized() const {
+  return true;
+}
+
+void InstallSnapshotRequest::InternalSwap(InstallSnapshotRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InstallSnapshotRequest, _impl_.lastsnapshotincludeterm_)
+      + sizeof(InstallSnapshotRequest::_impl_.lastsnapshotincludeterm_)
+      - PROTOBUF_FIELD_OFFSET(InstallSnapshotRequest, _impl_.config_)>(
+          reinterpret_cast<char*>(&_impl_.config_),
+          reinterpret_cast<char*>(&other->_impl_.config_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata InstallSnapshotRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[7]);
+}
+
+// ===================================================================
+
+class InstallSnapshotResponse::_Internal {
+ public:
+};
+
+InstallSnapshotResponse::InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.InstallSnapshotResponse)
+}
+InstallSnapshotResponse::InstallSnapshotResponse(const InstallSnapshotResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InstallSnapshotResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.term_ = from._impl_.term_;
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.InstallSnapshotResponse)
+}
+
+inline void InstallSnapshotResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+InstallSnapshotResponse::~InstallSnapshotResponse() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.InstallSnapshotResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void InstallSnapshotResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void InstallSnapshotResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void InstallSnapshotResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.InstallSnapshotResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.term_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* InstallSnapshotResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 Term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* InstallSnapshotResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.InstallSnapshotResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.InstallSnapshotResponse)
+  return target;
+}
+
+size_t InstallSnapshotResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.InstallSnapshotResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InstallSnapshotResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InstallSnapshotResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InstallSnapshotResponse::GetClassData() const { return &_class_data_; }
+
+
+void InstallSnapshotResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InstallSnapshotResponse*>(&to_msg);
+  auto& from = static_cast<const InstallSnapshotResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.InstallSnapshotResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void InstallSnapshotResponse::CopyFrom(const InstallSnapshotResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.InstallSnapshotResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InstallSnapshotResponse::IsInitialized() const {
+  return true;
+}
+
+void InstallSnapshotResponse::InternalSwap(InstallSnapshotResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.term_, other->_impl_.term_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata InstallSnapshotResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[8]);
+}
+
+// ===================================================================
+
+class TimeoutNowArgs::_Internal {
+ public:
+};
+
+TimeoutNowArgs::TimeoutNowArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.TimeoutNowArgs)
+}
+TimeoutNowArgs::TimeoutNowArgs(const TimeoutNowArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TimeoutNowArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.leaderid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.leaderid_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.leaderid_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.TimeoutNowArgs)
+}
+
+inline void TimeoutNowArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.leaderid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TimeoutNowArgs::~TimeoutNowArgs() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.TimeoutNowArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TimeoutNowArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void TimeoutNowArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TimeoutNowArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.TimeoutNowArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.leaderid_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.leaderid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TimeoutNowArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 Term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TimeoutNowArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.TimeoutNowArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_leaderid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.TimeoutNowArgs)
+  return target;
+}
+
+size_t TimeoutNowArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.TimeoutNowArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TimeoutNowArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TimeoutNowArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TimeoutNowArgs::GetClassData() const { return &_class_data_; }
+
+
+void TimeoutNowArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TimeoutNowArgs*>(&to_msg);
+  auto& from = static_cast<const TimeoutNowArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.TimeoutNowArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TimeoutNowArgs::CopyFrom(const TimeoutNowArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.TimeoutNowArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TimeoutNowArgs::IsInitialized() const {
+  return true;
+}
+
+void TimeoutNowArgs::InternalSwap(TimeoutNowArgs* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TimeoutNowArgs, _impl_.leaderid_)
+      + sizeof(TimeoutNowArgs::_impl_.leaderid_)
+      - PROTOBUF_FIELD_OFFSET(TimeoutNowArgs, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TimeoutNowArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[9]);
+}
+
+// ===================================================================
+
+class TimeoutNowReply::_Internal {
+ public:
+};
+
+TimeoutNowReply::TimeoutNowReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.TimeoutNowReply)
+}
+TimeoutNowReply::TimeoutNowReply(const TimeoutNowReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TimeoutNowReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.term_ = from._impl_.term_;
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.TimeoutNowReply)
+}
+
+inline void TimeoutNowReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TimeoutNowReply::~TimeoutNowReply() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.TimeoutNowReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TimeoutNowReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void TimeoutNowReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TimeoutNowReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.TimeoutNowReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.term_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TimeoutNowReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 Term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
-void InstallSnapshotRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+
+uint8_t* TimeoutNowReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.TimeoutNowReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.TimeoutNowReply)
+  return target;
 }
-void InstallSnapshotRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+
+size_t TimeoutNowReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.TimeoutNowReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TimeoutNowReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TimeoutNowReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TimeoutNowReply::GetClassData() const { return &_class_data_; }
+
+
+void TimeoutNowReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TimeoutNowReply*>(&to_msg);
+  auto& from = static_cast<const TimeoutNowReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.TimeoutNowReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TimeoutNowReply::CopyFrom(const TimeoutNowReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.TimeoutNowReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TimeoutNowReply::IsInitialized() const {
+  return true;
+}
+
+void TimeoutNowReply::InternalSwap(TimeoutNowReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.term_, other->_impl_.term_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TimeoutNowReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[10]);
+}
+
+// ===================================================================
+
+class GroupAppendEntriesArgs::_Internal {
+ public:
+  static const ::raftRpcProctoc::AppendEntriesArgs& args(const GroupAppendEntriesArgs* msg);
+};
+
+const ::raftRpcProctoc::AppendEntriesArgs&
+GroupAppendEntriesArgs::_Internal::args(const GroupAppendEntriesArgs* msg) {
+  return *msg->_impl_.args_;
+}
+GroupAppendEntriesArgs::GroupAppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.GroupAppendEntriesArgs)
+}
+GroupAppendEntriesArgs::GroupAppendEntriesArgs(const GroupAppendEntriesArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GroupAppendEntriesArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.args_){nullptr}
+    , decltype(_impl_.groupid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_args()) {
+    _this->_impl_.args_ = new ::raftRpcProctoc::AppendEntriesArgs(*from._impl_.args_);
+  }
+  _this->_impl_.groupid_ = from._impl_.groupid_;
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.GroupAppendEntriesArgs)
+}
+
+inline void GroupAppendEntriesArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.args_){nullptr}
+    , decltype(_impl_.groupid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GroupAppendEntriesArgs::~GroupAppendEntriesArgs() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.GroupAppendEntriesArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GroupAppendEntriesArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.args_;
+}
+
+void GroupAppendEntriesArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GroupAppendEntriesArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.GroupAppendEntriesArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.args_ != nullptr) {
+    delete _impl_.args_;
+  }
+  _impl_.args_ = nullptr;
+  _impl_.groupid_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GroupAppendEntriesArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 GroupId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .raftRpcProctoc.AppendEntriesArgs Args = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_args(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GroupAppendEntriesArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.GroupAppendEntriesArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 GroupId = 1;
+  if (this->_internal_groupid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_groupid(), target);
+  }
+
+  // .raftRpcProctoc.AppendEntriesArgs Args = 2;
+  if (this->_internal_has_args()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::args(this),
+        _Internal::args(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.GroupAppendEntriesArgs)
+  return target;
+}
+
+size_t GroupAppendEntriesArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.GroupAppendEntriesArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .raftRpcProctoc.AppendEntriesArgs Args = 2;
+  if (this->_internal_has_args()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.args_);
+  }
+
+  // uint32 GroupId = 1;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_groupid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GroupAppendEntriesArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GroupAppendEntriesArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GroupAppendEntriesArgs::GetClassData() const { return &_class_data_; }
+
+
+void GroupAppendEntriesArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GroupAppendEntriesArgs*>(&to_msg);
+  auto& from = static_cast<const GroupAppendEntriesArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.GroupAppendEntriesArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_args()) {
+    _this->_internal_mutable_args()->::raftRpcProctoc::AppendEntriesArgs::MergeFrom(
+        from._internal_args());
+  }
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GroupAppendEntriesArgs::CopyFrom(const GroupAppendEntriesArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.GroupAppendEntriesArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GroupAppendEntriesArgs::IsInitialized() const {
+  return true;
+}
+
+void GroupAppendEntriesArgs::InternalSwap(GroupAppendEntriesArgs* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GroupAppendEntriesArgs, _impl_.groupid_)
+      + sizeof(GroupAppendEntriesArgs::_impl_.groupid_)
+      - PROTOBUF_FIELD_OFFSET(GroupAppendEntriesArgs, _impl_.args_)>(
+          reinterpret_cast<char*>(&_impl_.args_),
+          reinterpret_cast<char*>(&other->_impl_.args_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GroupAppendEntriesArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[11]);
+}
+
+// ===================================================================
+
+class GroupAppendEntriesReply::_Internal {
+ public:
+  static const ::raftRpcProctoc::AppendEntriesReply& reply(const GroupAppendEntriesReply* msg);
+};
+
+const ::raftRpcProctoc::AppendEntriesReply&
+GroupAppendEntriesReply::_Internal::reply(const GroupAppendEntriesReply* msg) {
+  return *msg->_impl_.reply_;
+}
+GroupAppendEntriesReply::GroupAppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.GroupAppendEntriesReply)
+}
+GroupAppendEntriesReply::GroupAppendEntriesReply(const GroupAppendEntriesReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GroupAppendEntriesReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.reply_){nullptr}
+    , decltype(_impl_.groupid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_reply()) {
+    _this->_impl_.reply_ = new ::raftRpcProctoc::AppendEntriesReply(*from._impl_.reply_);
+  }
+  _this->_impl_.groupid_ = from._impl_.groupid_;
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.GroupAppendEntriesReply)
+}
+
+inline void GroupAppendEntriesReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.reply_){nullptr}
+    , decltype(_impl_.groupid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GroupAppendEntriesReply::~GroupAppendEntriesReply() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.GroupAppendEntriesReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GroupAppendEntriesReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.reply_;
+}
+
+void GroupAppendEntriesReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GroupAppendEntriesReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.GroupAppendEntriesReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.reply_ != nullptr) {
+    delete _impl_.reply_;
+  }
+  _impl_.reply_ = nullptr;
+  _impl_.groupid_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GroupAppendEntriesReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 GroupId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .raftRpcProctoc.AppendEntriesReply Reply = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reply(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GroupAppendEntriesReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.GroupAppendEntriesReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 GroupId = 1;
+  if (this->_internal_groupid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_groupid(), target);
+  }
+
+  // .raftRpcProctoc.AppendEntriesReply Reply = 2;
+  if (this->_internal_has_reply()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::reply(this),
+        _Internal::reply(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.GroupAppendEntriesReply)
+  return target;
+}
+
+size_t GroupAppendEntriesReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.GroupAppendEntriesReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .raftRpcProctoc.AppendEntriesReply Reply = 2;
+  if (this->_internal_has_reply()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.reply_);
+  }
+
+  // uint32 GroupId = 1;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_groupid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GroupAppendEntriesReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GroupAppendEntriesReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GroupAppendEntriesReply::GetClassData() const { return &_class_data_; }
+
+
+void GroupAppendEntriesReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GroupAppendEntriesReply*>(&to_msg);
+  auto& from = static_cast<const GroupAppendEntriesReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.GroupAppendEntriesReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_reply()) {
+    _this->_internal_mutable_reply()->::raftRpcProctoc::AppendEntriesReply::MergeFrom(
+        from._internal_reply());
+  }
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
-const InstallSnapshotRequest& InstallSnapshotRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_InstallSnapshotRequest_raftRPC_2eproto.base);
-  return *internal_default_instance();
+
+void GroupAppendEntriesReply::CopyFrom(const GroupAppendEntriesReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.GroupAppendEntriesReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GroupAppendEntriesReply::IsInitialized() const {
+  return true;
+}
+
+void GroupAppendEntriesReply::InternalSwap(GroupAppendEntriesReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GroupAppendEntriesReply, _impl_.groupid_)
+      + sizeof(GroupAppendEntriesReply::_impl_.groupid_)
+      - PROTOBUF_FIELD_OFFSET(GroupAppendEntriesReply, _impl_.reply_)>(
+          reinterpret_cast<char*>(&_impl_.reply_),
+          reinterpret_cast<char*>(&other->_impl_.reply_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GroupAppendEntriesReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[12]);
+}
+
+// ===================================================================
+
+class BatchAppendEntriesArgs::_Internal {
+ public:
+};
+
+BatchAppendEntriesArgs::BatchAppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.BatchAppendEntriesArgs)
+}
+BatchAppendEntriesArgs::BatchAppendEntriesArgs(const BatchAppendEntriesArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchAppendEntriesArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){from._impl_.entries_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.BatchAppendEntriesArgs)
+}
+
+inline void BatchAppendEntriesArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BatchAppendEntriesArgs::~BatchAppendEntriesArgs() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.BatchAppendEntriesArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchAppendEntriesArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
 }
 
+void BatchAppendEntriesArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-void InstallSnapshotRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.InstallSnapshotRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void BatchAppendEntriesArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.BatchAppendEntriesArgs)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  data_.ClearToEmpty();
-  ::memset(&leaderid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lastsnapshotincludeterm_) -
-      reinterpret_cast<char*>(&leaderid_)) + sizeof(lastsnapshotincludeterm_));
+  _impl_.entries_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* InstallSnapshotRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* BatchAppendEntriesArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 LeaderId = 1;
+      // repeated .raftRpcProctoc.GroupAppendEntriesArgs Entries = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 Term = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 LastSnapShotIncludeIndex = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          lastsnapshotincludeindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 LastSnapShotIncludeTerm = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          lastsnapshotincludeterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // bytes Data = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          auto str = _internal_mutable_data();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* InstallSnapshotRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.InstallSnapshotRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* BatchAppendEntriesArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.BatchAppendEntriesArgs)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 LeaderId = 1;
-  if (this->leaderid() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_leaderid(), target);
-  }
-
-  // int32 Term = 2;
-  if (this->term() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_term(), target);
-  }
-
-  // int32 LastSnapShotIncludeIndex = 3;
-  if (this->lastsnapshotincludeindex() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_lastsnapshotincludeindex(), target);
-  }
-
-  // int32 LastSnapShotIncludeTerm = 4;
-  if (this->lastsnapshotincludeterm() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_lastsnapshotincludeterm(), target);
-  }
-
-  // bytes Data = 5;
-  if (this->data().size() > 0) {
-    target = stream->WriteBytesMaybeAliased(
-        5, this->_internal_data(), target);
+  // repeated .raftRpcProctoc.GroupAppendEntriesArgs Entries = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.InstallSnapshotRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.BatchAppendEntriesArgs)
   return target;
 }
 
-size_t InstallSnapshotRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.InstallSnapshotRequest)
+size_t BatchAppendEntriesArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.BatchAppendEntriesArgs)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // bytes Data = 5;
-  if (this->data().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_data());
-  }
-
-  // int32 LeaderId = 1;
-  if (this->leaderid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_leaderid());
-  }
-
-  // int32 Term = 2;
-  if (this->term() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
-  }
-
-  // int32 LastSnapShotIncludeIndex = 3;
-  if (this->lastsnapshotincludeindex() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_lastsnapshotincludeindex());
-  }
-
-  // int32 LastSnapShotIncludeTerm = 4;
-  if (this->lastsnapshotincludeterm() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_lastsnapshotincludeterm());
+  // repeated .raftRpcProctoc.GroupAppendEntriesArgs Entries = 1;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void InstallSnapshotRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProctoc.InstallSnapshotRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const InstallSnapshotRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<InstallSnapshotRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProctoc.InstallSnapshotRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProctoc.InstallSnapshotRequest)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchAppendEntriesArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchAppendEntriesArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchAppendEntriesArgs::GetClassData() const { return &_class_data_; }
 
-void InstallSnapshotRequest::MergeFrom(const InstallSnapshotRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.InstallSnapshotRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.data().size() > 0) {
-    _internal_set_data(from._internal_data());
-  }
-  if (from.leaderid() != 0) {
-    _internal_set_leaderid(from._internal_leaderid());
-  }
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
-  }
-  if (from.lastsnapshotincludeindex() != 0) {
-    _internal_set_lastsnapshotincludeindex(from._internal_lastsnapshotincludeindex());
-  }
-  if (from.lastsnapshotincludeterm() != 0) {
-    _internal_set_lastsnapshotincludeterm(from._internal_lastsnapshotincludeterm());
-  }
-}
+void BatchAppendEntriesArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchAppendEntriesArgs*>(&to_msg);
+  auto& from = static_cast<const BatchAppendEntriesArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.BatchAppendEntriesArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void InstallSnapshotRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProctoc.InstallSnapshotRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void InstallSnapshotRequest::CopyFrom(const InstallSnapshotRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.InstallSnapshotRequest)
+void BatchAppendEntriesArgs::CopyFrom(const BatchAppendEntriesArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.BatchAppendEntriesArgs)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InstallSnapshotRequest::IsInitialized() const {
+bool BatchAppendEntriesArgs::IsInitialized() const {
   return true;
 }
 
-void InstallSnapshotRequest::InternalSwap(InstallSnapshotRequest* other) {
+void BatchAppendEntriesArgs::InternalSwap(BatchAppendEntriesArgs* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  data_.Swap(&other->data_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(InstallSnapshotRequest, lastsnapshotincludeterm_)
-      + sizeof(InstallSnapshotRequest::lastsnapshotincludeterm_)
-      - PROTOBUF_FIELD_OFFSET(InstallSnapshotRequest, leaderid_)>(
-          reinterpret_cast<char*>(&leaderid_),
-          reinterpret_cast<char*>(&other->leaderid_));
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata InstallSnapshotRequest::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata BatchAppendEntriesArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[13]);
 }
 
-
 // ===================================================================
 
-class InstallSnapshotResponse::_Internal {
+class BatchAppendEntriesReply::_Internal {
  public:
 };
 
-InstallSnapshotResponse::InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.InstallSnapshotResponse)
+BatchAppendEntriesReply::BatchAppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.BatchAppendEntriesReply)
 }
-InstallSnapshotResponse::InstallSnapshotResponse(const InstallSnapshotResponse& from)
+BatchAppendEntriesReply::BatchAppendEntriesReply(const BatchAppendEntriesReply& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchAppendEntriesReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){from._impl_.entries_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  term_ = from.term_;
-  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.InstallSnapshotResponse)
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.BatchAppendEntriesReply)
 }
 
-void InstallSnapshotResponse::SharedCtor() {
-  term_ = 0;
+inline void BatchAppendEntriesReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-InstallSnapshotResponse::~InstallSnapshotResponse() {
-  // @@protoc_insertion_point(destructor:raftRpcProctoc.InstallSnapshotResponse)
+BatchAppendEntriesReply::~BatchAppendEntriesReply() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.BatchAppendEntriesReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void InstallSnapshotResponse::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void BatchAppendEntriesReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
 }
 
-void InstallSnapshotResponse::ArenaDtor(void* object) {
-  InstallSnapshotResponse* _this = reinterpret_cast< InstallSnapshotResponse* >(object);
-  (void)_this;
-}
-void InstallSnapshotResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void InstallSnapshotResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const InstallSnapshotResponse& InstallSnapshotResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_InstallSnapshotResponse_raftRPC_2eproto.base);
-  return *internal_default_instance();
+void BatchAppendEntriesReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void InstallSnapshotResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.InstallSnapshotResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void BatchAppendEntriesReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.BatchAppendEntriesReply)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  term_ = 0;
+  _impl_.entries_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* InstallSnapshotResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* BatchAppendEntriesReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 Term = 1;
+      // repeated .raftRpcProctoc.GroupAppendEntriesReply Entries = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* InstallSnapshotResponse::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.InstallSnapshotResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* BatchAppendEntriesReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.BatchAppendEntriesReply)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 Term = 1;
-  if (this->term() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+  // repeated .raftRpcProctoc.GroupAppendEntriesReply Entries = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.InstallSnapshotResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.BatchAppendEntriesReply)
   return target;
 }
 
-size_t InstallSnapshotResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.InstallSnapshotResponse)
+size_t BatchAppendEntriesReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.BatchAppendEntriesReply)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 Term = 1;
-  if (this->term() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
+  // repeated .raftRpcProctoc.GroupAppendEntriesReply Entries = 1;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void InstallSnapshotResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProctoc.InstallSnapshotResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const InstallSnapshotResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<InstallSnapshotResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProctoc.InstallSnapshotResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProctoc.InstallSnapshotResponse)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchAppendEntriesReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchAppendEntriesReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchAppendEntriesReply::GetClassData() const { return &_class_data_; }
 
-void InstallSnapshotResponse::MergeFrom(const InstallSnapshotResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.InstallSnapshotResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
-  }
-}
+void BatchAppendEntriesReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchAppendEntriesReply*>(&to_msg);
+  auto& from = static_cast<const BatchAppendEntriesReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.BatchAppendEntriesReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void InstallSnapshotResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProctoc.InstallSnapshotResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void InstallSnapshotResponse::CopyFrom(const InstallSnapshotResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.InstallSnapshotResponse)
+void BatchAppendEntriesReply::CopyFrom(const BatchAppendEntriesReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.BatchAppendEntriesReply)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InstallSnapshotResponse::IsInitialized() const {
+bool BatchAppendEntriesReply::IsInitialized() const {
   return true;
 }
 
-void InstallSnapshotResponse::InternalSwap(InstallSnapshotResponse* other) {
+void BatchAppendEntriesReply::InternalSwap(BatchAppendEntriesReply* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(term_, other->term_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata InstallSnapshotResponse::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata BatchAppendEntriesReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[14]);
 }
 
-
 // ===================================================================
 
 raftRpc::~raftRpc() {}
@@ -2206,6 +4100,22 @@ void raftRpc::RequestVote(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
   done->Run();
 }
 
+void raftRpc::RequestPreVote(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftRpcProctoc::RequestVoteArgs*,
+                         ::raftRpcProctoc::RequestVoteReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method RequestPreVote() not implemented.");
+  done->Run();
+}
+
+void raftRpc::TimeoutNow(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftRpcProctoc::TimeoutNowArgs*,
+                         ::raftRpcProctoc::TimeoutNowReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method TimeoutNow() not implemented.");
+  done->Run();
+}
+
 void raftRpc::CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
                              ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                              const ::PROTOBUF_NAMESPACE_ID::Message* request,
@@ -2237,6 +4147,22 @@ void raftRpc::CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method
                  response),
              done);
       break;
+    case 3:
+      RequestPreVote(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftRpcProctoc::RequestVoteArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftRpcProctoc::RequestVoteReply*>(
+                 response),
+             done);
+      break;
+    case 4:
+      TimeoutNow(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftRpcProctoc::TimeoutNowArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftRpcProctoc::TimeoutNowReply*>(
+                 response),
+             done);
+      break;
     default:
       GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
       break;
@@ -2253,6 +4179,10 @@ const ::PROTOBUF_NAMESPACE_ID::Message& raftRpc::GetRequestPrototype(
       return ::raftRpcProctoc::InstallSnapshotRequest::default_instance();
     case 2:
       return ::raftRpcProctoc::RequestVoteArgs::default_instance();
+    case 3:
+      return ::raftRpcProctoc::RequestVoteArgs::default_instance();
+    case 4:
+      return ::raftRpcProctoc::TimeoutNowArgs::default_instance();
     default:
       GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
       return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
@@ -2270,6 +4200,10 @@ const ::PROTOBUF_NAMESPACE_ID::Message& raftRpc::GetResponsePrototype(
       return ::raftRpcProctoc::InstallSnapshotResponse::default_instance();
     case 2:
       return ::raftRpcProctoc::RequestVoteReply::default_instance();
+    case 3:
+      return ::raftRpcProctoc::RequestVoteReply::default_instance();
+    case 4:
+      return ::raftRpcProctoc::TimeoutNowReply::default_instance();
     default:
       GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
       return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
@@ -2309,31 +4243,170 @@ void raftRpc_Stub::RequestVote(::PROTOBUF_NAMESPACE_ID::RpcController* controlle
   channel_->CallMethod(descriptor()->method(2),
                        controller, request, response, done);
 }
+void raftRpc_Stub::RequestPreVote(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftRpcProctoc::RequestVoteArgs* request,
+                              ::raftRpcProctoc::RequestVoteReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(3),
+                       controller, request, response, done);
+}
+void raftRpc_Stub::TimeoutNow(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftRpcProctoc::TimeoutNowArgs* request,
+                              ::raftRpcProctoc::TimeoutNowReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(4),
+                       controller, request, response, done);
+}
+// ===================================================================
+
+multiRaftRpc::~multiRaftRpc() {}
+
+const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* multiRaftRpc::descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_raftRPC_2eproto);
+  return file_level_service_descriptors_raftRPC_2eproto[1];
+}
+
+const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* multiRaftRpc::GetDescriptor() {
+  return descriptor();
+}
+
+void multiRaftRpc::BatchAppendEntries(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftRpcProctoc::BatchAppendEntriesArgs*,
+                         ::raftRpcProctoc::BatchAppendEntriesReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method BatchAppendEntries() not implemented.");
+  done->Run();
+}
+
+void multiRaftRpc::CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                             ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                             const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                             ::PROTOBUF_NAMESPACE_ID::Message* response,
+                             ::google::protobuf::Closure* done) {
+  GOOGLE_DCHECK_EQ(method->service(), file_level_service_descriptors_raftRPC_2eproto[1]);
+  switch(method->index()) {
+    case 0:
+      BatchAppendEntries(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftRpcProctoc::BatchAppendEntriesArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftRpcProctoc::BatchAppendEntriesReply*>(
+                 response),
+             done);
+      break;
+    default:
+      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
+      break;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message& multiRaftRpc::GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const {
+  GOOGLE_DCHECK_EQ(method->service(), descriptor());
+  switch(method->index()) {
+    case 0:
+      return ::raftRpcProctoc::BatchAppendEntriesArgs::default_instance();
+    default:
+      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
+      return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
+          ->GetPrototype(method->input_type());
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message& multiRaftRpc::GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const {
+  GOOGLE_DCHECK_EQ(method->service(), descriptor());
+  switch(method->index()) {
+    case 0:
+      return ::raftRpcProctoc::BatchAppendEntriesReply::default_instance();
+    default:
+      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
+      return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
+          ->GetPrototype(method->output_type());
+  }
+}
+
+multiRaftRpc_Stub::multiRaftRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel)
+  : channel_(channel), owns_channel_(false) {}
+multiRaftRpc_Stub::multiRaftRpc_Stub(
+    ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+    ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership)
+  : channel_(channel),
+    owns_channel_(ownership == ::PROTOBUF_NAMESPACE_ID::Service::STUB_OWNS_CHANNEL) {}
+multiRaftRpc_Stub::~multiRaftRpc_Stub() {
+  if (owns_channel_) delete channel_;
+}
+
+void multiRaftRpc_Stub::BatchAppendEntries(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftRpcProctoc::BatchAppendEntriesArgs* request,
+                              ::raftRpcProctoc::BatchAppendEntriesReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(0),
+                       controller, request, response, done);
+}
 
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace raftRpcProctoc
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::raftRpcProctoc::LogEntry* Arena::CreateMaybeMessage< ::raftRpcProctoc::LogEntry >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::LogEntry*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::LogEntry >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProctoc::LogEntry >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProctoc::AppendEntriesArgs* Arena::CreateMaybeMessage< ::raftRpcProctoc::AppendEntriesArgs >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::Member*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::Member >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProctoc::Member >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::ClusterConfig*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::ClusterConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProctoc::ClusterConfig >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::AppendEntriesArgs*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::AppendEntriesArgs >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProctoc::AppendEntriesArgs >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProctoc::AppendEntriesReply* Arena::CreateMaybeMessage< ::raftRpcProctoc::AppendEntriesReply >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::AppendEntriesReply*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::AppendEntriesReply >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProctoc::AppendEntriesReply >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProctoc::RequestVoteArgs* Arena::CreateMaybeMessage< ::raftRpcProctoc::RequestVoteArgs >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::RequestVoteArgs*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::RequestVoteArgs >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProctoc::RequestVoteArgs >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProctoc::RequestVoteReply* Arena::CreateMaybeMessage< ::raftRpcProctoc::RequestVoteReply >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::RequestVoteReply*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::RequestVoteReply >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProctoc::RequestVoteReply >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProctoc::InstallSnapshotRequest* Arena::CreateMaybeMessage< ::raftRpcProctoc::InstallSnapshotRequest >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::InstallSnapshotRequest*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::InstallSnapshotRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProctoc::InstallSnapshotRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProctoc::InstallSnapshotResponse* Arena::CreateMaybeMessage< ::raftRpcProctoc::InstallSnapshotResponse >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::InstallSnapshotResponse*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::InstallSnapshotResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProctoc::InstallSnapshotResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::TimeoutNowArgs*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::TimeoutNowArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProctoc::TimeoutNowArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::TimeoutNowReply*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::TimeoutNowReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProctoc::TimeoutNowReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::GroupAppendEntriesArgs*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::GroupAppendEntriesArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProctoc::GroupAppendEntriesArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::GroupAppendEntriesReply*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::GroupAppendEntriesReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProctoc::GroupAppendEntriesReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::BatchAppendEntriesArgs*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::BatchAppendEntriesArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProctoc::BatchAppendEntriesArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::BatchAppendEntriesReply*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::BatchAppendEntriesReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProctoc::BatchAppendEntriesReply >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -6,9 +6,13 @@
 #include <google/protobuf/service.h>
 #include <algorithm>
 #include <algorithm>  // 包含 std::generate_n() 和 std::generate() 函数的头文件
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <random>  // 包含 std::uniform_int_distribution 类型的头文件
 #include <string>
 #include <unordered_map>
@@ -17,6 +21,8 @@ using namespace std;
 
 // 真正负责发送和接受的前后处理工作
 //  如消息的组织方式，向哪个节点发送等等
+// 一个channel上的请求之间用m_mtx串行；multi-raft时只有合并心跳的channel由多个raft组共用，
+// 目标组号由MprpcController携带
 class MprpcChannel : public google::protobuf::RpcChannel {
  public:
   // 所有通过stub代理对象调用的rpc方法，都走到这里了，统一做rpc方法调用的数据数据序列化和网络发送 那一步
@@ -25,15 +31,35 @@ class MprpcChannel : public google::protobuf::RpcChannel {
                   google::protobuf::Closure *done) override;
   MprpcChannel(string ip, short port, bool connectNow);
 
+  // 故障注入，测试网络分区用：返回false表示本进程到 ip:port 的链路不通，请求直接失败，不会发出去
+  // 随时可以替换，正在发出的请求用的还是替换前的filter
+  using LinkFilter = std::function<bool(const std::string &ip, uint16_t port)>;
+  static void SetLinkFilter(LinkFilter filter);
+  // 模拟慢速网络，测试用：本进程所有channel发出的请求共享bytesPerSec的带宽，<=0不限制
+  static void SetBandwidthLimit(int64_t bytesPerSec);
+
  private:
+  std::mutex m_mtx;  // 一条连接上同一时刻只能有一个请求在途，否则响应会错乱
   int m_clientFd;
   const std::string m_ip;  //保存ip和端口，如果断了可以尝试重连
   const uint16_t m_port;
+  // 对方能解压的算法，从响应的RpcResponseExt中得知；每次重新连接都清零，对方可能换成了旧版本
+  uint32_t m_peerCompress = 0;
   /// @brief 连接ip和端口,并设置m_clientFd
   /// @param ip ip地址，本机字节序
   /// @param port 端口，本机字节序
   /// @return 成功返回空字符串，否则返回失败信息
   bool newConnect(const char *ip, uint16_t port, string *errMsg);
+  /// @brief 读取一个完整的响应帧：varint长度 + 响应体
+  bool recvResponse(std::string *response, string *errMsg);
+  // 按带宽限制等到bytes字节“发送完”
+  static void throttle(size_t bytes);
+
+  // 发请求的线程取一份快照再调用，SetLinkFilter整体替换，不会读到写了一半的std::function
+  static std::atomic<std::shared_ptr<const LinkFilter>> s_linkFilter;
+  static std::atomic<int64_t> s_bandwidthLimit;
+  static std::mutex s_linkMtx;
+  static std::chrono::steady_clock::time_point s_linkFreeAt;  // 模拟的链路在这个时间之后空闲
 };
 
 #endif  // MPRPCCHANNEL_H
\ No newline at end of file
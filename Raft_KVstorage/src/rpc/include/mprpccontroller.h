@@ -1,5 +1,6 @@
 #pragma once
 #include <google/protobuf/service.h>
+#include <cstdint>
 #include <string>
 
 class MprpcController : public google::protobuf::RpcController {
@@ -10,6 +11,10 @@ class MprpcController : public google::protobuf::RpcController {
   std::string ErrorText() const;
   void SetFailed(const std::string& reason);
 
+  // multi-raft：同一个连接上可能有多个raft组的请求，由controller携带目标组号写入RpcHeader
+  void SetGroupId(uint32_t groupId);
+  uint32_t GroupId() const;
+
   // 目前未实现具体的功能
   void StartCancel();
   bool IsCanceled() const;
@@ -18,4 +23,5 @@ class MprpcController : public google::protobuf::RpcController {
  private:
   bool m_failed;          // RPC方法执行过程中的状态
   std::string m_errText;  // RPC方法执行过程中的错误信息
+  uint32_t m_groupId;     // 目标raft组
 };
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include <string>
 #include <unordered_map>
 #include "google/protobuf/service.h"
+#include "rpcheader.pb.h"
 
 // 框架提供的专门发布rpc服务的网络对象类
 // todo:现在rpc客户端变成了 长连接，因此rpc服务器这边最好提供一个定时器，用以断开很久没有请求的连接。
@@ -15,11 +16,15 @@
 class RpcProvider {
  public:
   // 这里是框架提供给外部使用的，可以发布rpc方法的函数接口
-  void NotifyService(google::protobuf::Service *service);
+  // groupId：multi-raft时同一个服务（如raftRpc）每个raft组注册一份，按RpcHeader中的group_id分发
+  void NotifyService(google::protobuf::Service *service, uint32_t groupId = 0);
 
   // 启动rpc服务节点，开始提供rpc远程网络调用服务
   void Run(int nodeIndex, short port);
 
+  // 本机对外的ip，Run监听的就是这个地址；启动脚本用它预先把集群地址写进配置文件
+  static std::string GetLocalIp();
+
  private:
   // 组合EventLoop
   muduo::net::EventLoop m_eventLoop;
@@ -30,15 +35,22 @@ class RpcProvider {
     google::protobuf::Service *m_service;                                                     // 保存服务对象
     std::unordered_map<std::string, const google::protobuf::MethodDescriptor *> m_methodMap;  // 保存服务方法
   };
-  // 存储注册成功的服务对象和其服务方法的所有信息
+  // 存储注册成功的服务对象和其服务方法的所有信息，key为 groupId/服务名
   std::unordered_map<std::string, ServiceInfo> m_serviceMap;
+  static std::string serviceKey(uint32_t groupId, const std::string &serviceName) {
+    return std::to_string(groupId) + "/" + serviceName;
+  }
 
   // 新的socket连接回调
   void OnConnection(const muduo::net::TcpConnectionPtr &);
   // 已建立连接用户的读写事件回调
   void OnMessage(const muduo::net::TcpConnectionPtr &, muduo::net::Buffer *, muduo::Timestamp);
+  // 处理一个完整的请求帧
+  void HandleRequest(const muduo::net::TcpConnectionPtr &, const RPC::RpcHeader &, const std::string &args_str);
   // Closure的回调操作，用于序列化rpc的响应和网络发送
-  void SendRpcResponse(const muduo::net::TcpConnectionPtr &, google::protobuf::Message *);
+  // acceptCompress：请求头中调用方能解压的算法，不为0时在响应后附加RpcResponseExt
+  void SendRpcResponse(const muduo::net::TcpConnectionPtr &, google::protobuf::Message *, uint32_t acceptCompress);
+  class ResponseClosure;
 
  public:
   ~RpcProvider();
@@ -5,12 +5,15 @@
 #include <unistd.h>
 #include <cerrno>
 #include <string>
+#include <thread>
+#include "compress.h"
 #include "mprpccontroller.h"
 #include "rpcheader.pb.h"
 #include "util.h"
 
 /*
-header_size + service_name method_name args_size + args
+请求：header_size + service_name method_name args_size group_id compress accept_compress + args
+响应：response_size + response（请求带accept_compress时后面再拼接RpcResponseExt）
 */
 // 所有通过stub代理对象调用的rpc方法，都会走到这里了，
 // 统一通过rpcChannel来调用方法
@@ -18,6 +21,12 @@ header_size + service_name method_name args_size + args
 void MprpcChannel::CallMethod(const google::protobuf::MethodDescriptor* method,
                               google::protobuf::RpcController* controller, const google::protobuf::Message* request,
                               google::protobuf::Message* response, google::protobuf::Closure* done) {
+  std::shared_ptr<const LinkFilter> filter = s_linkFilter.load(std::memory_order_acquire);
+  if (filter && !(*filter)(m_ip, m_port)) {
+    controller->SetFailed("link down (fault injection)");
+    return;
+  }
+  std::lock_guard<std::mutex> lg(m_mtx);
   if (m_clientFd == -1) {
     std::string errMsg;
     bool rt = newConnect(m_ip.c_str(), m_port, &errMsg);
@@ -35,18 +44,28 @@ void MprpcChannel::CallMethod(const google::protobuf::MethodDescriptor* method,
   std::string method_name = method->name();  // method_name
 
   // 获取参数的序列化字符串长度 args_size
-  uint32_t args_size{};
   std::string args_str;
-  if (request->SerializeToString(&args_str)) {
-    args_size = args_str.size();
-  } else {
+  if (!request->SerializeToString(&args_str)) {
     controller->SetFailed("serialize request error!");
     return;
   }
   RPC::RpcHeader rpcHeader;
   rpcHeader.set_service_name(service_name);
   rpcHeader.set_method_name(method_name);
-  rpcHeader.set_args_size(args_size);
+  // 开启压缩时先协商：请求头带上自己能解压的算法，对方在响应中回复它支持的算法之后才压缩请求
+  bool compress = CompressEnabled();
+  if (compress) {
+    rpcHeader.set_accept_compress(kSupportedCompressMask);
+    std::string compressed;
+    if ((m_peerCompress & (1u << kCompressZlib)) && args_str.size() >= COMPRESS_MIN_BYTES &&
+        Compress(kCompressZlib, args_str, &compressed)) {
+      args_str.swap(compressed);
+      rpcHeader.set_compress(kCompressZlib);
+    }
+  }
+  rpcHeader.set_args_size(args_str.size());
+  auto* mprpcController = dynamic_cast<MprpcController*>(controller);
+  rpcHeader.set_group_id(mprpcController != nullptr ? mprpcController->GroupId() : 0);
 
   std::string rpc_header_str;
   if (!rpcHeader.SerializeToString(&rpc_header_str)) {
@@ -83,6 +102,7 @@ void MprpcChannel::CallMethod(const google::protobuf::MethodDescriptor* method,
 
   // 发送rpc请求
   //失败会重试连接再发送，重试连接失败会直接return
+  throttle(send_rpc_str.size());
   while (-1 == send(m_clientFd, send_rpc_str.c_str(), send_rpc_str.size(), 0)) {
     char errtxt[512] = {0};
     sprintf(errtxt, "send error! errno:%d", errno);
@@ -101,27 +121,83 @@ void MprpcChannel::CallMethod(const google::protobuf::MethodDescriptor* method,
   */
 
   // 接收rpc请求的响应值
-  char recv_buf[1024] = {0};
-  int recv_size = 0;
-  if (-1 == (recv_size = recv(m_clientFd, recv_buf, 1024, 0))) {
+  // 响应带有长度前缀，按帧读取，响应超过一次recv的大小（如multi-raft合并心跳的回复）也能完整收到
+  std::string response_str;
+  std::string errMsg;
+  if (!recvResponse(&response_str, &errMsg)) {
     close(m_clientFd);
     m_clientFd = -1;
-    char errtxt[512] = {0};
-    sprintf(errtxt, "recv error! errno:%d", errno);
-    controller->SetFailed(errtxt);
+    controller->SetFailed(errMsg);
     return;
   }
 
+  if (compress) {
+    // 响应自己的字段对RpcResponseExt来说都是未知字段，解析时跳过
+    RPC::RpcResponseExt ext;
+    if (ext.ParseFromString(response_str)) {
+      m_peerCompress = ext.accept_compress();
+      if (!ext.compressed_response().empty()) {
+        std::string raw;
+        if (!Decompress(static_cast<CompressType>(ext.compress()), ext.compressed_response(), &raw)) {
+          controller->SetFailed("decompress response error! size:" + std::to_string(response_str.size()));
+          return;
+        }
+        response_str.swap(raw);
+      }
+    }
+  }
+
   // 反序列化rpc调用的响应数据
-  // std::string response_str(recv_buf, 0, recv_size); //
-  // bug：出现问题，recv_buf中遇到\0后面的数据就存不下来了，导致反序列化失败 if
-  // (!response->ParseFromString(response_str))
-  if (!response->ParseFromArray(recv_buf, recv_size)) {
-    char errtxt[1050] = {0};
-    sprintf(errtxt, "parse error! response_str:%s", recv_buf);
-    controller->SetFailed(errtxt);
+  if (!response->ParseFromString(response_str)) {
+    controller->SetFailed("parse error! response size:" + std::to_string(response_str.size()));
     return;
   }
+  if (compress) {
+    response->DiscardUnknownFields();  // 去掉附加的RpcResponseExt字段
+  }
+}
+
+void MprpcChannel::throttle(size_t bytes) {
+  int64_t limit = s_bandwidthLimit;
+  if (limit <= 0) {
+    return;
+  }
+  std::chrono::steady_clock::time_point done;
+  {
+    std::lock_guard<std::mutex> lg(s_linkMtx);
+    auto now = std::chrono::steady_clock::now();
+    s_linkFreeAt = std::max(s_linkFreeAt, now) + std::chrono::nanoseconds(bytes * 1000000000LL / limit);
+    done = s_linkFreeAt;
+  }
+  std::this_thread::sleep_until(done);
+}
+
+bool MprpcChannel::recvResponse(std::string* response, string* errMsg) {
+  std::string recv_str;
+  char recv_buf[4096];
+  while (true) {
+    // 先尝试从已经收到的数据里解析出 长度 + 响应体
+    if (!recv_str.empty()) {
+      google::protobuf::io::ArrayInputStream array_input(recv_str.data(), recv_str.size());
+      google::protobuf::io::CodedInputStream coded_input(&array_input);
+      uint32_t response_size = 0;
+      if (coded_input.ReadVarint32(&response_size)) {
+        size_t header_len = coded_input.CurrentPosition();
+        if (recv_str.size() >= header_len + response_size) {
+          response->assign(recv_str, header_len, response_size);
+          return true;
+        }
+      }
+    }
+    ssize_t recv_size = recv(m_clientFd, recv_buf, sizeof(recv_buf), 0);
+    if (recv_size <= 0) {
+      char errtxt[512] = {0};
+      sprintf(errtxt, "recv error! errno:%d", recv_size == 0 ? 0 : errno);
+      *errMsg = errtxt;
+      return false;
+    }
+    recv_str.append(recv_buf, recv_size);
+  }
 }
 
 bool MprpcChannel::newConnect(const char* ip, uint16_t port, string* errMsg) {
@@ -148,9 +224,22 @@ bool MprpcChannel::newConnect(const char* ip, uint16_t port, string* errMsg) {
     return false;
   }
   m_clientFd = clientfd;
+  m_peerCompress = 0;
   return true;
 }
 
+std::atomic<std::shared_ptr<const MprpcChannel::LinkFilter>> MprpcChannel::s_linkFilter;
+std::atomic<int64_t> MprpcChannel::s_bandwidthLimit{0};
+std::mutex MprpcChannel::s_linkMtx;
+std::chrono::steady_clock::time_point MprpcChannel::s_linkFreeAt;
+
+void MprpcChannel::SetLinkFilter(LinkFilter filter) {
+  s_linkFilter.store(filter ? std::make_shared<const LinkFilter>(std::move(filter)) : nullptr,
+                     std::memory_order_release);
+}
+
+void MprpcChannel::SetBandwidthLimit(int64_t bytesPerSec) { s_bandwidthLimit = bytesPerSec; }
+
 MprpcChannel::MprpcChannel(string ip, short port, bool connectNow) : m_ip(ip), m_port(port), m_clientFd(-1) {
   // 使用tcp编程，完成rpc方法的远程调用，使用的是短连接，因此每次都要重新连接上去，待改成长连接。
   // 没有连接或者连接已经断开，那么就要重新连接呢,会一直不断地重试
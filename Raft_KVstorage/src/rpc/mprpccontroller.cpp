@@ -3,11 +3,13 @@
 MprpcController::MprpcController() {
   m_failed = false;
   m_errText = "";
+  m_groupId = 0;
 }
 
 void MprpcController::Reset() {
   m_failed = false;
   m_errText = "";
+  m_groupId = 0;
 }
 
 bool MprpcController::Failed() const { return m_failed; }
@@ -19,6 +21,10 @@ void MprpcController::SetFailed(const std::string& reason) {
   m_errText = reason;
 }
 
+void MprpcController::SetGroupId(uint32_t groupId) { m_groupId = groupId; }
+
+uint32_t MprpcController::GroupId() const { return m_groupId; }
+
 // 目前未实现具体的功能
 void MprpcController::StartCancel() {}
 bool MprpcController::IsCanceled() const { return false; }
@@ -14,67 +14,108 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-namespace RPC {
-class RpcHeaderDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RpcHeader> _instance;
-} _RpcHeader_default_instance_;
-}  // namespace RPC
-static void InitDefaultsscc_info_RpcHeader_rpcheader_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-  {
-    void* ptr = &::RPC::_RpcHeader_default_instance_;
-    new (ptr) ::RPC::RpcHeader();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
+PROTOBUF_PRAGMA_INIT_SEG
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RpcHeader_rpcheader_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_RpcHeader_rpcheader_2eproto}, {}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_rpcheader_2eproto[1];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_rpcheader_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_rpcheader_2eproto = nullptr;
+namespace RPC {
+PROTOBUF_CONSTEXPR RpcHeader::RpcHeader(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.service_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.method_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.args_size_)*/0u
+  , /*decltype(_impl_.group_id_)*/0u
+  , /*decltype(_impl_.compress_)*/0u
+  , /*decltype(_impl_.accept_compress_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RpcHeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RpcHeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RpcHeaderDefaultTypeInternal() {}
+  union {
+    RpcHeader _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RpcHeaderDefaultTypeInternal _RpcHeader_default_instance_;
+PROTOBUF_CONSTEXPR RpcResponseExt::RpcResponseExt(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.compressed_response_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.compress_)*/0u
+  , /*decltype(_impl_.accept_compress_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RpcResponseExtDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RpcResponseExtDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RpcResponseExtDefaultTypeInternal() {}
+  union {
+    RpcResponseExt _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RpcResponseExtDefaultTypeInternal _RpcResponseExt_default_instance_;
+}  // namespace RPC
+static ::_pb::Metadata file_level_metadata_rpcheader_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_rpcheader_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_rpcheader_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_rpcheader_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_rpcheader_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::RPC::RpcHeader, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::RPC::RpcHeader, service_name_),
-  PROTOBUF_FIELD_OFFSET(::RPC::RpcHeader, method_name_),
-  PROTOBUF_FIELD_OFFSET(::RPC::RpcHeader, args_size_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RPC::RpcHeader, _impl_.service_name_),
+  PROTOBUF_FIELD_OFFSET(::RPC::RpcHeader, _impl_.method_name_),
+  PROTOBUF_FIELD_OFFSET(::RPC::RpcHeader, _impl_.args_size_),
+  PROTOBUF_FIELD_OFFSET(::RPC::RpcHeader, _impl_.group_id_),
+  PROTOBUF_FIELD_OFFSET(::RPC::RpcHeader, _impl_.compress_),
+  PROTOBUF_FIELD_OFFSET(::RPC::RpcHeader, _impl_.accept_compress_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::RPC::RpcResponseExt, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RPC::RpcResponseExt, _impl_.compress_),
+  PROTOBUF_FIELD_OFFSET(::RPC::RpcResponseExt, _impl_.compressed_response_),
+  PROTOBUF_FIELD_OFFSET(::RPC::RpcResponseExt, _impl_.accept_compress_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::RPC::RpcHeader)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::RPC::RpcHeader)},
+  { 12, -1, -1, sizeof(::RPC::RpcResponseExt)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::RPC::_RpcHeader_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RPC::_RpcHeader_default_instance_._instance,
+  &::RPC::_RpcResponseExt_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_rpcheader_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\017rpcheader.proto\022\003RPC\"I\n\tRpcHeader\022\024\n\014s"
-  "ervice_name\030\001 \001(\014\022\023\n\013method_name\030\002 \001(\014\022\021"
-  "\n\targs_size\030\003 \001(\rb\006proto3"
+  "\n\017rpcheader.proto\022\003RPC\"\206\001\n\tRpcHeader\022\024\n\014"
+  "service_name\030\001 \001(\014\022\023\n\013method_name\030\002 \001(\014\022"
+  "\021\n\targs_size\030\003 \001(\r\022\020\n\010group_id\030\004 \001(\r\022\020\n\010"
+  "compress\030\005 \001(\r\022\027\n\017accept_compress\030\006 \001(\r\""
+  "[\n\016RpcResponseExt\022\021\n\010compress\030\375\017 \001(\r\022\034\n\023"
+  "compressed_response\030\376\017 \001(\014\022\030\n\017accept_com"
+  "press\030\377\017 \001(\rb\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_rpcheader_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_rpcheader_2eproto_sccs[1] = {
-  &scc_info_RpcHeader_rpcheader_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_rpcheader_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_rpcheader_2eproto = {
-  false, false, descriptor_table_protodef_rpcheader_2eproto, "rpcheader.proto", 105,
-  &descriptor_table_rpcheader_2eproto_once, descriptor_table_rpcheader_2eproto_sccs, descriptor_table_rpcheader_2eproto_deps, 1, 0,
-  schemas, file_default_instances, TableStruct_rpcheader_2eproto::offsets,
-  file_level_metadata_rpcheader_2eproto, 1, file_level_enum_descriptors_rpcheader_2eproto, file_level_service_descriptors_rpcheader_2eproto,
+static ::_pbi::once_flag descriptor_table_rpcheader_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_rpcheader_2eproto = {
+    false, false, 260, descriptor_table_protodef_rpcheader_2eproto,
+    "rpcheader.proto",
+    &descriptor_table_rpcheader_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_rpcheader_2eproto::offsets,
+    file_level_metadata_rpcheader_2eproto, file_level_enum_descriptors_rpcheader_2eproto,
+    file_level_service_descriptors_rpcheader_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_rpcheader_2eproto_getter() {
+  return &descriptor_table_rpcheader_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_rpcheader_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_rpcheader_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_rpcheader_2eproto(&descriptor_table_rpcheader_2eproto);
 namespace RPC {
 
 // ===================================================================
@@ -83,153 +124,226 @@ class RpcHeader::_Internal {
  public:
 };
 
-RpcHeader::RpcHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+RpcHeader::RpcHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:RPC.RpcHeader)
 }
 RpcHeader::RpcHeader(const RpcHeader& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RpcHeader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){}
+    , decltype(_impl_.method_name_){}
+    , decltype(_impl_.args_size_){}
+    , decltype(_impl_.group_id_){}
+    , decltype(_impl_.compress_){}
+    , decltype(_impl_.accept_compress_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  service_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_service_name().empty()) {
-    service_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_service_name(), 
-      GetArena());
+    _this->_impl_.service_name_.Set(from._internal_service_name(), 
+      _this->GetArenaForAllocation());
   }
-  method_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.method_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_method_name().empty()) {
-    method_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_method_name(), 
-      GetArena());
+    _this->_impl_.method_name_.Set(from._internal_method_name(), 
+      _this->GetArenaForAllocation());
   }
-  args_size_ = from.args_size_;
+  ::memcpy(&_impl_.args_size_, &from._impl_.args_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.accept_compress_) -
+    reinterpret_cast<char*>(&_impl_.args_size_)) + sizeof(_impl_.accept_compress_));
   // @@protoc_insertion_point(copy_constructor:RPC.RpcHeader)
 }
 
-void RpcHeader::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_RpcHeader_rpcheader_2eproto.base);
-  service_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  method_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  args_size_ = 0u;
+inline void RpcHeader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){}
+    , decltype(_impl_.method_name_){}
+    , decltype(_impl_.args_size_){0u}
+    , decltype(_impl_.group_id_){0u}
+    , decltype(_impl_.compress_){0u}
+    , decltype(_impl_.accept_compress_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.method_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 RpcHeader::~RpcHeader() {
   // @@protoc_insertion_point(destructor:RPC.RpcHeader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void RpcHeader::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  service_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  method_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void RpcHeader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_name_.Destroy();
+  _impl_.method_name_.Destroy();
 }
 
-void RpcHeader::ArenaDtor(void* object) {
-  RpcHeader* _this = reinterpret_cast< RpcHeader* >(object);
-  (void)_this;
-}
-void RpcHeader::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void RpcHeader::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const RpcHeader& RpcHeader::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RpcHeader_rpcheader_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void RpcHeader::Clear() {
 // @@protoc_insertion_point(message_clear_start:RPC.RpcHeader)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  service_name_.ClearToEmpty();
-  method_name_.ClearToEmpty();
-  args_size_ = 0u;
+  _impl_.service_name_.ClearToEmpty();
+  _impl_.method_name_.ClearToEmpty();
+  ::memset(&_impl_.args_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.accept_compress_) -
+      reinterpret_cast<char*>(&_impl_.args_size_)) + sizeof(_impl_.accept_compress_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RpcHeader::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* RpcHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // bytes service_name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_service_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bytes method_name = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_method_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 args_size = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          args_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.args_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 group_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.group_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 compress = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.compress_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint32 accept_compress = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.accept_compress_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RpcHeader::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* RpcHeader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:RPC.RpcHeader)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes service_name = 1;
-  if (this->service_name().size() > 0) {
+  if (!this->_internal_service_name().empty()) {
     target = stream->WriteBytesMaybeAliased(
         1, this->_internal_service_name(), target);
   }
 
   // bytes method_name = 2;
-  if (this->method_name().size() > 0) {
+  if (!this->_internal_method_name().empty()) {
     target = stream->WriteBytesMaybeAliased(
         2, this->_internal_method_name(), target);
   }
 
   // uint32 args_size = 3;
-  if (this->args_size() != 0) {
+  if (this->_internal_args_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_args_size(), target);
+  }
+
+  // uint32 group_id = 4;
+  if (this->_internal_group_id() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->_internal_args_size(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_group_id(), target);
+  }
+
+  // uint32 compress = 5;
+  if (this->_internal_compress() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_compress(), target);
+  }
+
+  // uint32 accept_compress = 6;
+  if (this->_internal_accept_compress() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_accept_compress(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:RPC.RpcHeader)
@@ -240,78 +354,81 @@ size_t RpcHeader::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:RPC.RpcHeader)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // bytes service_name = 1;
-  if (this->service_name().size() > 0) {
+  if (!this->_internal_service_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_service_name());
   }
 
   // bytes method_name = 2;
-  if (this->method_name().size() > 0) {
+  if (!this->_internal_method_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_method_name());
   }
 
   // uint32 args_size = 3;
-  if (this->args_size() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_args_size());
+  if (this->_internal_args_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_args_size());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint32 group_id = 4;
+  if (this->_internal_group_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_group_id());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void RpcHeader::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:RPC.RpcHeader)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RpcHeader* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RpcHeader>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:RPC.RpcHeader)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:RPC.RpcHeader)
-    MergeFrom(*source);
+  // uint32 compress = 5;
+  if (this->_internal_compress() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_compress());
   }
+
+  // uint32 accept_compress = 6;
+  if (this->_internal_accept_compress() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_accept_compress());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RpcHeader::MergeFrom(const RpcHeader& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:RPC.RpcHeader)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RpcHeader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RpcHeader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RpcHeader::GetClassData() const { return &_class_data_; }
+
+
+void RpcHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RpcHeader*>(&to_msg);
+  auto& from = static_cast<const RpcHeader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RPC.RpcHeader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.service_name().size() > 0) {
-    _internal_set_service_name(from._internal_service_name());
+  if (!from._internal_service_name().empty()) {
+    _this->_internal_set_service_name(from._internal_service_name());
   }
-  if (from.method_name().size() > 0) {
-    _internal_set_method_name(from._internal_method_name());
+  if (!from._internal_method_name().empty()) {
+    _this->_internal_set_method_name(from._internal_method_name());
   }
-  if (from.args_size() != 0) {
-    _internal_set_args_size(from._internal_args_size());
+  if (from._internal_args_size() != 0) {
+    _this->_internal_set_args_size(from._internal_args_size());
   }
-}
-
-void RpcHeader::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:RPC.RpcHeader)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_group_id() != 0) {
+    _this->_internal_set_group_id(from._internal_group_id());
+  }
+  if (from._internal_compress() != 0) {
+    _this->_internal_set_compress(from._internal_compress());
+  }
+  if (from._internal_accept_compress() != 0) {
+    _this->_internal_set_accept_compress(from._internal_accept_compress());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RpcHeader::CopyFrom(const RpcHeader& from) {
@@ -327,23 +444,304 @@ bool RpcHeader::IsInitialized() const {
 
 void RpcHeader::InternalSwap(RpcHeader* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  service_name_.Swap(&other->service_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  method_name_.Swap(&other->method_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(args_size_, other->args_size_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.service_name_, lhs_arena,
+      &other->_impl_.service_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.method_name_, lhs_arena,
+      &other->_impl_.method_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RpcHeader, _impl_.accept_compress_)
+      + sizeof(RpcHeader::_impl_.accept_compress_)
+      - PROTOBUF_FIELD_OFFSET(RpcHeader, _impl_.args_size_)>(
+          reinterpret_cast<char*>(&_impl_.args_size_),
+          reinterpret_cast<char*>(&other->_impl_.args_size_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata RpcHeader::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpcheader_2eproto_getter, &descriptor_table_rpcheader_2eproto_once,
+      file_level_metadata_rpcheader_2eproto[0]);
 }
 
+// ===================================================================
+
+class RpcResponseExt::_Internal {
+ public:
+};
+
+RpcResponseExt::RpcResponseExt(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RPC.RpcResponseExt)
+}
+RpcResponseExt::RpcResponseExt(const RpcResponseExt& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RpcResponseExt* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.compressed_response_){}
+    , decltype(_impl_.compress_){}
+    , decltype(_impl_.accept_compress_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.compressed_response_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.compressed_response_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_compressed_response().empty()) {
+    _this->_impl_.compressed_response_.Set(from._internal_compressed_response(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.compress_, &from._impl_.compress_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.accept_compress_) -
+    reinterpret_cast<char*>(&_impl_.compress_)) + sizeof(_impl_.accept_compress_));
+  // @@protoc_insertion_point(copy_constructor:RPC.RpcResponseExt)
+}
+
+inline void RpcResponseExt::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.compressed_response_){}
+    , decltype(_impl_.compress_){0u}
+    , decltype(_impl_.accept_compress_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.compressed_response_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.compressed_response_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RpcResponseExt::~RpcResponseExt() {
+  // @@protoc_insertion_point(destructor:RPC.RpcResponseExt)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RpcResponseExt::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.compressed_response_.Destroy();
+}
+
+void RpcResponseExt::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RpcResponseExt::Clear() {
+// @@protoc_insertion_point(message_clear_start:RPC.RpcResponseExt)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.compressed_response_.ClearToEmpty();
+  ::memset(&_impl_.compress_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.accept_compress_) -
+      reinterpret_cast<char*>(&_impl_.compress_)) + sizeof(_impl_.accept_compress_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RpcResponseExt::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 compress = 2045;
+      case 2045:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 232)) {
+          _impl_.compress_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes compressed_response = 2046;
+      case 2046:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 242)) {
+          auto str = _internal_mutable_compressed_response();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 accept_compress = 2047;
+      case 2047:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 248)) {
+          _impl_.accept_compress_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RpcResponseExt::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RPC.RpcResponseExt)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 compress = 2045;
+  if (this->_internal_compress() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2045, this->_internal_compress(), target);
+  }
+
+  // bytes compressed_response = 2046;
+  if (!this->_internal_compressed_response().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2046, this->_internal_compressed_response(), target);
+  }
+
+  // uint32 accept_compress = 2047;
+  if (this->_internal_accept_compress() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2047, this->_internal_accept_compress(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RPC.RpcResponseExt)
+  return target;
+}
+
+size_t RpcResponseExt::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RPC.RpcResponseExt)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes compressed_response = 2046;
+  if (!this->_internal_compressed_response().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_compressed_response());
+  }
+
+  // uint32 compress = 2045;
+  if (this->_internal_compress() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_compress());
+  }
+
+  // uint32 accept_compress = 2047;
+  if (this->_internal_accept_compress() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_accept_compress());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RpcResponseExt::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RpcResponseExt::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RpcResponseExt::GetClassData() const { return &_class_data_; }
+
+
+void RpcResponseExt::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RpcResponseExt*>(&to_msg);
+  auto& from = static_cast<const RpcResponseExt&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RPC.RpcResponseExt)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_compressed_response().empty()) {
+    _this->_internal_set_compressed_response(from._internal_compressed_response());
+  }
+  if (from._internal_compress() != 0) {
+    _this->_internal_set_compress(from._internal_compress());
+  }
+  if (from._internal_accept_compress() != 0) {
+    _this->_internal_set_accept_compress(from._internal_accept_compress());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RpcResponseExt::CopyFrom(const RpcResponseExt& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RPC.RpcResponseExt)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RpcResponseExt::IsInitialized() const {
+  return true;
+}
+
+void RpcResponseExt::InternalSwap(RpcResponseExt* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.compressed_response_, lhs_arena,
+      &other->_impl_.compressed_response_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RpcResponseExt, _impl_.accept_compress_)
+      + sizeof(RpcResponseExt::_impl_.accept_compress_)
+      - PROTOBUF_FIELD_OFFSET(RpcResponseExt, _impl_.compress_)>(
+          reinterpret_cast<char*>(&_impl_.compress_),
+          reinterpret_cast<char*>(&other->_impl_.compress_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RpcResponseExt::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpcheader_2eproto_getter, &descriptor_table_rpcheader_2eproto_once,
+      file_level_metadata_rpcheader_2eproto[1]);
+}
 
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace RPC
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::RPC::RpcHeader* Arena::CreateMaybeMessage< ::RPC::RpcHeader >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::RPC::RpcHeader*
+Arena::CreateMaybeMessage< ::RPC::RpcHeader >(Arena* arena) {
   return Arena::CreateMessageInternal< ::RPC::RpcHeader >(arena);
 }
+template<> PROTOBUF_NOINLINE ::RPC::RpcResponseExt*
+Arena::CreateMaybeMessage< ::RPC::RpcResponseExt >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RPC::RpcResponseExt >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -5,6 +5,7 @@
 #include <cstring>
 #include <fstream>
 #include <string>
+#include "compress.h"
 #include "rpcheader.pb.h"
 #include "util.h"
 /*
@@ -16,7 +17,7 @@ json   protobuf
 // 这里是框架提供给外部使用的，可以发布rpc方法的函数接口
 // 只是简单的把服务描述符和方法描述符全部保存在本地而已
 // todo 待修改 要把本机开启的ip和端口写在文件里面
-void RpcProvider::NotifyService(google::protobuf::Service *service) {
+void RpcProvider::NotifyService(google::protobuf::Service *service, uint32_t groupId) {
   ServiceInfo service_info;
 
   // 获取了服务对象的描述信息
@@ -26,7 +27,7 @@ void RpcProvider::NotifyService(google::protobuf::Service *service) {
   // 获取服务对象service的方法的数量
   int methodCnt = pserviceDesc->method_count();
 
-  std::cout << "service_name:" << service_name << std::endl;
+  std::cout << "service_name:" << service_name << " group:" << groupId << std::endl;
 
   for (int i = 0; i < methodCnt; ++i) {
     // 获取了服务对象指定下标的服务方法的描述（抽象描述） UserService   Login
@@ -35,12 +36,10 @@ void RpcProvider::NotifyService(google::protobuf::Service *service) {
     service_info.m_methodMap.insert({method_name, pmethodDesc});
   }
   service_info.m_service = service;
-  m_serviceMap.insert({service_name, service_info});
+  m_serviceMap.insert({serviceKey(groupId, service_name), service_info});
 }
 
-// 启动rpc服务节点，开始提供rpc远程网络调用服务
-void RpcProvider::Run(int nodeIndex, short port) {
-  //获取可用ip
+std::string RpcProvider::GetLocalIp() {
   char *ipC;
   char hname[128];
   struct hostent *hent;
@@ -49,7 +48,32 @@ void RpcProvider::Run(int nodeIndex, short port) {
   for (int i = 0; hent->h_addr_list[i]; i++) {
     ipC = inet_ntoa(*(struct in_addr *)(hent->h_addr_list[i]));  // IP地址
   }
-  std::string ip = std::string(ipC);
+  return std::string(ipC);
+}
+
+// 本地方法执行完之后发送响应，比NewCallback多带一个请求头中的accept_compress
+class RpcProvider::ResponseClosure : public google::protobuf::Closure {
+ public:
+  ResponseClosure(RpcProvider *provider, const muduo::net::TcpConnectionPtr &conn, google::protobuf::Message *response,
+                  uint32_t acceptCompress)
+      : m_provider(provider), m_conn(conn), m_response(response), m_acceptCompress(acceptCompress) {}
+
+  void Run() override {
+    m_provider->SendRpcResponse(m_conn, m_response, m_acceptCompress);
+    delete this;
+  }
+
+ private:
+  RpcProvider *m_provider;
+  muduo::net::TcpConnectionPtr m_conn;
+  google::protobuf::Message *m_response;
+  uint32_t m_acceptCompress;
+};
+
+// 启动rpc服务节点，开始提供rpc远程网络调用服务
+void RpcProvider::Run(int nodeIndex, short port) {
+  //获取可用ip
+  std::string ip = GetLocalIp();
   //    // 获取端口
   //    if(getReleasePort(port)) //在port的基础上获取一个可用的port，不知道为何没有效果
   //    {
@@ -132,61 +156,64 @@ std::string   insert和copy方法
 // 因此本函数需要：解析请求，根据服务名，方法名，参数，来调用service的来callmethod来调用本地的业务
 void RpcProvider::OnMessage(const muduo::net::TcpConnectionPtr &conn, muduo::net::Buffer *buffer, muduo::Timestamp) {
   // 网络上接收的远程rpc调用请求的字符流    Login args
-  std::string recv_buf = buffer->retrieveAllAsString();
-
-  // 使用protobuf的CodedInputStream来解析数据流
-  google::protobuf::io::ArrayInputStream array_input(recv_buf.data(), recv_buf.size());
-  google::protobuf::io::CodedInputStream coded_input(&array_input);
-  uint32_t header_size{};
-
-  coded_input.ReadVarint32(&header_size);  // 解析header_size
-
-  // 根据header_size读取数据头的原始字符流，反序列化数据，得到rpc请求的详细信息
-  std::string rpc_header_str;
-  RPC::RpcHeader rpcHeader;
-  std::string service_name;
-  std::string method_name;
-
-  // 设置读取限制，不必担心数据读多
-  google::protobuf::io::CodedInputStream::Limit msg_limit = coded_input.PushLimit(header_size);
-  coded_input.ReadString(&rpc_header_str, header_size);
-  // 恢复之前的限制，以便安全地继续读取其他数据
-  coded_input.PopLimit(msg_limit);
-  uint32_t args_size{};
-  if (rpcHeader.ParseFromString(rpc_header_str)) {
-    // 数据头反序列化成功
-    service_name = rpcHeader.service_name();
-    method_name = rpcHeader.method_name();
-    args_size = rpcHeader.args_size();
-  } else {
-    // 数据头反序列化失败
-    std::cout << "rpc_header_str:" << rpc_header_str << " parse error!" << std::endl;
-    return;
-  }
+  // tcp是字节流，一次回调里可能只有半个请求（请求较大时），也可能有多个请求，因此按帧解析：
+  // 数据不完整就先留在buffer里等下次回调，完整的帧逐个处理
+  while (buffer->readableBytes() > 0) {
+    // 使用protobuf的CodedInputStream来解析数据流
+    google::protobuf::io::ArrayInputStream array_input(buffer->peek(), buffer->readableBytes());
+    google::protobuf::io::CodedInputStream coded_input(&array_input);
+    uint32_t header_size{};
+
+    if (!coded_input.ReadVarint32(&header_size)) {  // 解析header_size
+      return;
+    }
 
-  // 获取rpc方法参数的字符流数据
-  std::string args_str;
-  // 直接读取args_size长度的字符串数据
-  bool read_args_success = coded_input.ReadString(&args_str, args_size);
+    // 根据header_size读取数据头的原始字符流，反序列化数据，得到rpc请求的详细信息
+    std::string rpc_header_str;
+    RPC::RpcHeader rpcHeader;
 
-  if (!read_args_success) {
-    // 处理错误：参数数据读取失败
-    return;
+    // 设置读取限制，不必担心数据读多
+    google::protobuf::io::CodedInputStream::Limit msg_limit = coded_input.PushLimit(header_size);
+    if (!coded_input.ReadString(&rpc_header_str, header_size)) {
+      return;  // 数据头还没收全
+    }
+    // 恢复之前的限制，以便安全地继续读取其他数据
+    coded_input.PopLimit(msg_limit);
+    if (!rpcHeader.ParseFromString(rpc_header_str)) {
+      // 数据头反序列化失败，后面的数据也无法再对齐，直接丢弃
+      std::cout << "rpc_header_str:" << rpc_header_str << " parse error!" << std::endl;
+      buffer->retrieveAllAsString();
+      return;
+    }
+
+    // 获取rpc方法参数的字符流数据
+    std::string args_str;
+    // 直接读取args_size长度的字符串数据
+    if (!coded_input.ReadString(&args_str, rpcHeader.args_size())) {
+      return;  // 参数还没收全
+    }
+    buffer->retrieve(coded_input.CurrentPosition());
+
+    HandleRequest(conn, rpcHeader, args_str);
   }
+}
+
+void RpcProvider::HandleRequest(const muduo::net::TcpConnectionPtr &conn, const RPC::RpcHeader &rpcHeader,
+                                const std::string &args_str) {
+  const std::string &service_name = rpcHeader.service_name();
+  const std::string &method_name = rpcHeader.method_name();
 
   // 打印调试信息
   //    std::cout << "============================================" << std::endl;
-  //    std::cout << "header_size: " << header_size << std::endl;
-  //    std::cout << "rpc_header_str: " << rpc_header_str << std::endl;
   //    std::cout << "service_name: " << service_name << std::endl;
   //    std::cout << "method_name: " << method_name << std::endl;
   //    std::cout << "args_str: " << args_str << std::endl;
   //    std::cout << "============================================" << std::endl;
 
   // 获取service对象和method对象
-  auto it = m_serviceMap.find(service_name);
+  auto it = m_serviceMap.find(serviceKey(rpcHeader.group_id(), service_name));
   if (it == m_serviceMap.end()) {
-    std::cout << "服务：" << service_name << " is not exist!" << std::endl;
+    std::cout << "服务：" << service_name << " group:" << rpcHeader.group_id() << " is not exist!" << std::endl;
     std::cout << "当前已经有的服务列表为:";
     for (auto item : m_serviceMap) {
       std::cout << item.first << " ";
@@ -206,7 +233,14 @@ void RpcProvider::OnMessage(const muduo::net::TcpConnectionPtr &conn, muduo::net
 
   // 生成rpc方法调用的请求request和响应response参数,由于是rpc的请求，因此请求需要通过request来序列化
   google::protobuf::Message *request = service->GetRequestPrototype(method).New();
-  if (!request->ParseFromString(args_str)) {
+  std::string raw_args;
+  if (rpcHeader.compress() != kCompressNone &&
+      !Decompress(static_cast<CompressType>(rpcHeader.compress()), args_str, &raw_args)) {
+    std::cout << service_name << ":" << method_name << " decompress request error, compress:" << rpcHeader.compress()
+              << std::endl;
+    return;
+  }
+  if (!request->ParseFromString(rpcHeader.compress() != kCompressNone ? raw_args : args_str)) {
     std::cout << "request parse error, content:" << args_str << std::endl;
     return;
   }
@@ -214,9 +248,7 @@ void RpcProvider::OnMessage(const muduo::net::TcpConnectionPtr &conn, muduo::net
 
   // 给下面的method方法的调用，绑定一个Closure的回调函数
   // closure是执行完本地方法之后会发生的回调，因此需要完成序列化和反向发送请求的操作
-  google::protobuf::Closure *done =
-      google::protobuf::NewCallback<RpcProvider, const muduo::net::TcpConnectionPtr &, google::protobuf::Message *>(
-          this, &RpcProvider::SendRpcResponse, conn, response);
+  google::protobuf::Closure *done = new ResponseClosure(this, conn, response, rpcHeader.accept_compress());
 
   // 在框架上根据远端rpc请求，调用当前rpc节点上发布的方法
   // new UserService().Login(controller, request, response, done)
@@ -235,12 +267,34 @@ void RpcProvider::OnMessage(const muduo::net::TcpConnectionPtr &conn, muduo::net
 }
 
 // Closure的回调操作，用于序列化rpc的响应和网络发送,发送响应回去
-void RpcProvider::SendRpcResponse(const muduo::net::TcpConnectionPtr &conn, google::protobuf::Message *response) {
+void RpcProvider::SendRpcResponse(const muduo::net::TcpConnectionPtr &conn, google::protobuf::Message *response,
+                                  uint32_t acceptCompress) {
   std::string response_str;
   if (response->SerializeToString(&response_str))  // response进行序列化
   {
+    if (acceptCompress != 0) {
+      // 调用方支持压缩：告诉它本进程能解压的算法；响应较大、本进程也开启了压缩时把整个响应压缩
+      RPC::RpcResponseExt ext;
+      ext.set_accept_compress(kSupportedCompressMask);
+      std::string compressed;
+      if (CompressEnabled() && (acceptCompress & (1u << kCompressZlib)) && response_str.size() >= COMPRESS_MIN_BYTES &&
+          Compress(kCompressZlib, response_str, &compressed)) {
+        ext.set_compress(kCompressZlib);
+        ext.set_compressed_response(std::move(compressed));
+        response_str.clear();
+      }
+      response_str += ext.SerializeAsString();
+    }
     // 序列化成功后，通过网络把rpc方法执行的结果发送会rpc的调用方
-    conn->send(response_str);
+    // 响应前面加上变长编码的长度，调用方据此判断响应是否收全
+    std::string send_str;
+    {
+      google::protobuf::io::StringOutputStream string_output(&send_str);
+      google::protobuf::io::CodedOutputStream coded_output(&string_output);
+      coded_output.WriteVarint32(static_cast<uint32_t>(response_str.size()));
+      coded_output.WriteString(response_str);
+    }
+    conn->send(send_str);
   } else {
     std::cout << "serialize response_str error!" << std::endl;
   }
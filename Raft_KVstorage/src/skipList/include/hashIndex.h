@@ -0,0 +1,140 @@
+#ifndef HASHINDEX_H
+#define HASHINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+template <typename K, typename V>
+class Node;
+
+/**
+ * \brief 跳表旁路的哈希索引：开放寻址（线性探测）表，槽位里直接存跳表节点指针。
+ * 点查不再走 O(log n) 的逐层比较，而是一次哈希 + 少量探测；有序遍历/范围扫描仍然走跳表本身。
+ * 索引不拥有节点，节点的生命周期由 SkipList 管理，SkipList 负责在插入/删除节点时同步维护索引。
+ * 本身不加锁，与 SkipList 共用同一把锁（或同一个外部锁）。
+ */
+template <typename K, typename V>
+class HashIndex {
+ public:
+  explicit HashIndex(size_t capacity = 16);
+
+  // 返回key对应的节点，不存在返回nullptr
+  Node<K, V> *find(const K &key) const;
+  // 调用方保证key不在索引中（SkipList在插入新节点时才调用）
+  void insert(Node<K, V> *node);
+  bool erase(const K &key);
+  void clear();
+  size_t size() const { return _size; }
+
+ private:
+  struct Slot {
+    size_t hash;
+    Node<K, V> *node;  // nullptr：空槽；tombstone()：被删除的槽，探测时需要跨过
+  };
+
+  static Node<K, V> *tombstone() { return reinterpret_cast<Node<K, V> *>(static_cast<uintptr_t>(1)); }
+  // 返回key所在的槽位下标，不存在返回-1
+  long find_slot(const K &key, size_t hash) const;
+  void rehash(size_t new_capacity);
+
+ private:
+  std::vector<Slot> _slots;
+  size_t _mask;
+  size_t _size;  // 有效节点数
+  size_t _used;  // 有效节点数 + 墓碑数，决定何时扩容/清理墓碑
+  std::hash<K> _hasher;
+};
+
+template <typename K, typename V>
+HashIndex<K, V>::HashIndex(size_t capacity) : _size(0), _used(0) {
+  size_t cap = 16;
+  while (cap < capacity) {
+    cap <<= 1;
+  }
+  _slots.assign(cap, Slot{0, nullptr});
+  _mask = cap - 1;
+}
+
+template <typename K, typename V>
+long HashIndex<K, V>::find_slot(const K &key, size_t hash) const {
+  for (size_t i = hash & _mask;; i = (i + 1) & _mask) {
+    const Slot &slot = _slots[i];
+    if (slot.node == nullptr) {
+      return -1;
+    }
+    if (slot.node != tombstone() && slot.hash == hash && slot.node->get_key() == key) {
+      return static_cast<long>(i);
+    }
+  }
+}
+
+template <typename K, typename V>
+Node<K, V> *HashIndex<K, V>::find(const K &key) const {
+  long idx = find_slot(key, _hasher(key));
+  return idx < 0 ? nullptr : _slots[idx].node;
+}
+
+template <typename K, typename V>
+void HashIndex<K, V>::insert(Node<K, V> *node) {
+  // 负载因子（含墓碑）控制在 1/2 以下，保证探测链足够短
+  if ((_used + 1) * 2 > _slots.size()) {
+    // 墓碑占多数时原地重建即可，否则扩容
+    rehash(_size * 4 > _slots.size() ? _slots.size() * 2 : _slots.size());
+  }
+  size_t hash = _hasher(node->get_key());
+  for (size_t i = hash & _mask;; i = (i + 1) & _mask) {
+    Slot &slot = _slots[i];
+    if (slot.node == nullptr || slot.node == tombstone()) {
+      if (slot.node == nullptr) {
+        _used++;
+      }
+      slot.hash = hash;
+      slot.node = node;
+      _size++;
+      return;
+    }
+  }
+}
+
+template <typename K, typename V>
+bool HashIndex<K, V>::erase(const K &key) {
+  long idx = find_slot(key, _hasher(key));
+  if (idx < 0) {
+    return false;
+  }
+  _slots[idx].node = tombstone();
+  _size--;
+  return true;
+}
+
+template <typename K, typename V>
+void HashIndex<K, V>::clear() {
+  for (auto &slot : _slots) {
+    slot.node = nullptr;
+  }
+  _size = 0;
+  _used = 0;
+}
+
+template <typename K, typename V>
+void HashIndex<K, V>::rehash(size_t new_capacity) {
+  std::vector<Slot> old;
+  old.swap(_slots);
+  _slots.assign(new_capacity, Slot{0, nullptr});
+  _mask = new_capacity - 1;
+  _used = _size;
+  for (const auto &slot : old) {
+    if (slot.node == nullptr || slot.node == tombstone()) {
+      continue;
+    }
+    size_t i = slot.hash & _mask;
+    while (_slots[i].node != nullptr) {
+      i = (i + 1) & _mask;
+    }
+    _slots[i] = slot;
+  }
+}
+
+#endif  // HASHINDEX_H
@@ -12,12 +12,19 @@
 > Description:
  ************************************************************************/
 
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/serialization/vector.hpp>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <iostream>
 #include <mutex>
+#include <sstream>
+#include <utility>
+#include <vector>
+#include "hashIndex.h"
 
 #define STORE_FILE "store/dumpFile"
 
@@ -110,13 +117,20 @@ class SkipList {
   bool search_element(K, V &value);
   void delete_element(K);
   void insert_set_element(K &, V &);
+  // 按key升序返回 [begin, end) 内的元素，最多limit个（limit<0表示不限），返回实际个数
+  int scan_element(const K &begin, const K &end, int limit, std::vector<std::pair<K, V>> &result);
+  // 开启/关闭点查哈希索引，开启时会根据当前已有节点建好索引
+  void enable_hash_index(bool enable);
+  bool hash_index_enabled() const { return _hash_index != nullptr; }
   std::string dump_file();
   void load_file(const std::string &dumpStr);
-  //递归删除节点
+  //删除cur及其之后的所有节点
   void clear(Node<K, V> *);
   int size();
 
  private:
+  // 返回key对应的节点，开启了哈希索引时O(1)，否则逐层查找
+  Node<K, V> *find_node(const K &key);
   void get_key_value_from_string(const std::string &str, std::string *key, std::string *value);
   bool is_valid_string(const std::string &str);
 
@@ -137,6 +151,9 @@ class SkipList {
   // skiplist current element count
   int _element_count;
 
+  // 可选的点查哈希索引，nullptr表示未开启
+  HashIndex<K, V> *_hash_index;
+
   std::mutex _mtx;  // mutex for critical section
 };
 
@@ -193,7 +210,6 @@ int SkipList<K, V>::insert_element(const K key, const V value) {
 
   // if current node have key equal to searched key, we get it
   if (current != NULL && current->get_key() == key) {
-    std::cout << "key: " << key << ", exists" << std::endl;
     _mtx.unlock();
     return 1;
   }
@@ -220,7 +236,9 @@ int SkipList<K, V>::insert_element(const K key, const V value) {
       inserted_node->forward[i] = update[i]->forward[i];
       update[i]->forward[i] = inserted_node;
     }
-    std::cout << "Successfully inserted key:" << key << ", value:" << value << std::endl;
+    if (_hash_index != nullptr) {
+      _hash_index->insert(inserted_node);
+    }
     _element_count++;
   }
   _mtx.unlock();
@@ -296,7 +314,7 @@ void SkipList<K, V>::load_file(const std::string &dumpStr) {
   boost::archive::text_iarchive ia(iss);
   ia >> dumper;
   for (int i = 0; i < dumper.keyDumpVt_.size(); ++i) {
-    insert_element(dumper.keyDumpVt_[i], dumper.keyDumpVt_[i]);
+    insert_element(dumper.keyDumpVt_[i], dumper.valDumpVt_[i]);
   }
 }
 
@@ -357,7 +375,9 @@ void SkipList<K, V>::delete_element(K key) {
       _skip_list_level--;
     }
 
-    std::cout << "Successfully deleted key " << key << std::endl;
+    if (_hash_index != nullptr) {
+      _hash_index->erase(key);
+    }
     delete current;
     _element_count--;
   }
@@ -369,16 +389,75 @@ void SkipList<K, V>::delete_element(K key) {
  * \brief 作用与insert_element相同类似，
  * insert_element是插入新元素，
  * insert_set_element是插入元素，如果元素存在则改变其值
+ * 元素已存在时直接原地修改节点的值，不再 删除+重新插入，哈希索引中的节点指针也因此保持有效
  */
 template <typename K, typename V>
 void SkipList<K, V>::insert_set_element(K &key, V &value) {
-  V oldValue;
-  if (search_element(key, oldValue)) {
-    delete_element(key);
+  _mtx.lock();
+  Node<K, V> *node = find_node(key);
+  if (node != nullptr) {
+    node->set_value(value);
+    _mtx.unlock();
+    return;
   }
+  _mtx.unlock();
   insert_element(key, value);
 }
 
+template <typename K, typename V>
+int SkipList<K, V>::scan_element(const K &begin, const K &end, int limit, std::vector<std::pair<K, V>> &result) {
+  std::lock_guard<std::mutex> lg(_mtx);
+  Node<K, V> *current = _header;
+  for (int i = _skip_list_level; i >= 0; i--) {
+    while (current->forward[i] && current->forward[i]->get_key() < begin) {
+      current = current->forward[i];
+    }
+  }
+  current = current->forward[0];
+  int count = 0;
+  while (current != nullptr && current->get_key() < end && (limit < 0 || count < limit)) {
+    result.emplace_back(current->get_key(), current->get_value());
+    current = current->forward[0];
+    count++;
+  }
+  return count;
+}
+
+template <typename K, typename V>
+void SkipList<K, V>::enable_hash_index(bool enable) {
+  std::lock_guard<std::mutex> lg(_mtx);
+  if (!enable) {
+    delete _hash_index;
+    _hash_index = nullptr;
+    return;
+  }
+  if (_hash_index != nullptr) {
+    return;
+  }
+  _hash_index = new HashIndex<K, V>(_element_count * 2);
+  for (Node<K, V> *node = _header->forward[0]; node != nullptr; node = node->forward[0]) {
+    _hash_index->insert(node);
+  }
+}
+
+template <typename K, typename V>
+Node<K, V> *SkipList<K, V>::find_node(const K &key) {
+  if (_hash_index != nullptr) {
+    return _hash_index->find(key);
+  }
+  Node<K, V> *current = _header;
+  for (int i = _skip_list_level; i >= 0; i--) {
+    while (current->forward[i] && current->forward[i]->get_key() < key) {
+      current = current->forward[i];
+    }
+  }
+  current = current->forward[0];
+  if (current != nullptr && current->get_key() == key) {
+    return current;
+  }
+  return nullptr;
+}
+
 // Search for element in skip list
 /*
                            +------------+
@@ -400,7 +479,14 @@ level 0         1    4   9 10         30   40    50+-->60      70       100
 */
 template <typename K, typename V>
 bool SkipList<K, V>::search_element(K key, V &value) {
-  std::cout << "search_element-----------------" << std::endl;
+  if (_hash_index != nullptr) {
+    Node<K, V> *node = _hash_index->find(key);
+    if (node == nullptr) {
+      return false;
+    }
+    value = node->get_value();
+    return true;
+  }
   Node<K, V> *current = _header;
 
   // start from highest level of skip list
@@ -416,11 +502,9 @@ bool SkipList<K, V>::search_element(K key, V &value) {
   // if current node have key equal to searched key, we get it
   if (current and current->get_key() == key) {
     value = current->get_value();
-    std::cout << "Found key: " << key << ", value: " << current->get_value() << std::endl;
     return true;
   }
 
-  std::cout << "Not Found Key:" << key << std::endl;
   return false;
 }
 
@@ -436,6 +520,7 @@ SkipList<K, V>::SkipList(int max_level) {
   this->_max_level = max_level;
   this->_skip_list_level = 0;
   this->_element_count = 0;
+  this->_hash_index = nullptr;
 
   // create header node and initialize key and value to null
   K k;
@@ -452,18 +537,21 @@ SkipList<K, V>::~SkipList() {
     _file_reader.close();
   }
 
-  //递归删除跳表链条
+  //删除跳表链条
   if (_header->forward[0] != nullptr) {
     clear(_header->forward[0]);
   }
   delete (_header);
+  delete _hash_index;
 }
 template <typename K, typename V>
 void SkipList<K, V>::clear(Node<K, V> *cur) {
-  if (cur->forward[0] != nullptr) {
-    clear(cur->forward[0]);
+  // 沿第0层迭代删除，元素很多时递归会爆栈
+  while (cur != nullptr) {
+    Node<K, V> *next = cur->forward[0];
+    delete (cur);
+    cur = next;
   }
-  delete (cur);
 }
 
 template <typename K, typename V>